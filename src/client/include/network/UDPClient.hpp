@@ -17,10 +17,16 @@
 #include <queue>
 #include <functional>
 #include <optional>
+#include <unordered_map>
 #include <chrono>
 #include <atomic>
 
 #include "Protocol.hpp"
+#include "PackedSnapshot.hpp"
+#include "ReliableChannel.hpp"
+#include "compression/SnapshotDelta.hpp"
+#include "compression/CompressionContext.hpp"
+#include "compression/SnapshotDictionary.hpp"
 #include "NetworkEvents.hpp"
 
 namespace client::network
@@ -196,11 +202,19 @@ namespace client::network
 
         void handleConnect(const boost::system::error_code &error);
         void handleRead(const boost::system::error_code &error, std::size_t bytes);
+        // One message, from its own datagram or from a Bundle entry
+        void handleMessage(const UDPHeader& head, const uint8_t* data, size_t size);
         void handleWrite(const boost::system::error_code &error);
 
         void handlePlayerJoin(const uint8_t* payload, size_t size);
         void handlePlayerLeave(const uint8_t* payload, size_t size);
-        void handleSnapshot(const uint8_t* payload, size_t size);
+        // partial: PARTIAL_SNAPSHOT_FLAG was set, entities left out keep their last state for a while
+        void handleSnapshot(uint16_t sequence, const GameSnapshot& snapshot, bool partial);  // Decoded Snapshot or SnapshotPacked
+        void handleSnapshotDelta(uint16_t sequence, const uint8_t* payload, size_t size, bool partial);
+        void acceptSnapshot(uint16_t sequence);  // Remembers and acks it
+        void applySnapshot(const GameSnapshot& snapshot, uint16_t sequence, bool partial);
+        // Events arrive on their own or in order from a ReliableEvents packet
+        void handleGameEvent(MessageType type, const uint8_t* payload, size_t size);
         void handleMissileSpawned(const uint8_t* payload, size_t size);
         void handleMissileDestroyed(const uint8_t* payload, size_t size);
         void handleEnemyDestroyed(const uint8_t* payload, size_t size);
@@ -238,6 +252,21 @@ namespace client::network
         bool _isWriting;
 
         char _readBuffer[BUFFER_SIZE];
+
+        // Compressed payloads decompress into _decompressBuffer, which only ever grows (io thread only)
+        compression::CompressionContext _decompressor{compression::SNAPSHOT_DICTIONARY};
+        std::vector<uint8_t> _decompressBuffer;
+
+        // Snapshots received, baselines of the server's deltas (io thread only)
+        compression::SnapshotHistory _snapshotHistory;
+        uint16_t _lastSnapshotSequence = 0;
+        bool _hasSnapshotSequence = false;
+        // Last snapshot that carried each entity, by ID (io thread only)
+        std::unordered_map<uint16_t, uint16_t> _missileSeen;
+        std::unordered_map<uint16_t, uint16_t> _enemySeen;
+        std::unordered_map<uint16_t, uint16_t> _enemyMissileSeen;
+        // Acks the ReliableEvents packets, delivers their events in order (io thread only)
+        reliable::ReliableReceiver _reliableEvents;
         std::vector<uint8_t> _accumulator;
 
         std::optional<uint8_t> _localPlayerId;
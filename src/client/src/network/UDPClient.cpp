@@ -7,7 +7,6 @@
 
 #include "network/UDPClient.hpp"
 #include "Protocol.hpp"
-#include "compression/Compression.hpp"
 #include "core/Logger.hpp"
 #include "accessibility/AccessibilityConfig.hpp"
 #include <algorithm>
@@ -27,6 +26,31 @@ namespace client::network
 {
     static constexpr int HEARTBEAT_INTERVAL_MS = 1000;
     static constexpr int HEARTBEAT_TIMEOUT_MS = 2000;
+    // Snapshots a partial snapshot can skip an entity for before it is dropped (0.5 s at 20 Hz)
+    static constexpr uint16_t PARTIAL_ENTITY_TTL = 10;
+
+    namespace {
+        // Stamps the entities of a snapshot and, when it was partial, keeps the recent ones it left out
+        template<typename Entity>
+        void keepLeftOut(std::vector<Entity>& fresh, const std::vector<Entity>& previous,
+                         std::unordered_map<uint16_t, uint16_t>& lastSeen, uint16_t sequence, bool partial) {
+            for (const auto& entity : fresh) {
+                lastSeen[entity.id] = sequence;
+            }
+            if (partial) {
+                for (const auto& entity : previous) {
+                    auto it = lastSeen.find(entity.id);
+                    if (it != lastSeen.end() && it->second != sequence
+                        && static_cast<uint16_t>(sequence - it->second) <= PARTIAL_ENTITY_TTL) {
+                        fresh.push_back(entity);
+                    }
+                }
+            }
+            std::erase_if(lastSeen, [sequence](const auto& entry) {
+                return static_cast<uint16_t>(sequence - entry.second) > PARTIAL_ENTITY_TTL;
+            });
+        }
+    }
 
     UDPClient::UDPClient()
         : _socket(_ioContext), _heartbeatTimer(_ioContext), _isWriting(false), _localPlayerId(std::nullopt)
@@ -388,15 +412,69 @@ namespace client::network
         }
     }
 
-    void UDPClient::handleSnapshot(const uint8_t* payload, size_t size) {
-        auto gsOpt = GameSnapshot::from_bytes(payload, size);
+    void UDPClient::handleSnapshot(uint16_t sequence, const GameSnapshot& snapshot, bool partial) {
+        if (_hasSnapshotSequence && compression::isNewerSequence(_lastSnapshotSequence, sequence)) {
+            return;  // Reordered: an older snapshot would roll the world back
+        }
+
+        // Kept as a baseline for the deltas the server sends once it gets the ack
+        compression::toSnapshotImage(snapshot, _snapshotHistory.store(sequence));
+        acceptSnapshot(sequence);
+        applySnapshot(snapshot, sequence, partial);
+    }
+
+    void UDPClient::handleSnapshotDelta(uint16_t sequence, const uint8_t* payload, size_t size, bool partial) {
+        if (_hasSnapshotSequence && compression::isNewerSequence(_lastSnapshotSequence, sequence)) {
+            return;
+        }
+        auto deltaHeadOpt = SnapshotDeltaHeader::from_bytes(payload, size);
+        if (!deltaHeadOpt) return;
+
+        // Baseline gone: skip it, the server falls back to a full snapshot once ours ages out
+        const compression::SnapshotImage* baseline = _snapshotHistory.find(deltaHeadOpt->baseline_seq);
+        if (!baseline) return;
+
+        compression::SnapshotImage image;
+        if (!compression::decodeSnapshotDelta(*baseline, payload + SnapshotDeltaHeader::WIRE_SIZE,
+                                              size - SnapshotDeltaHeader::WIRE_SIZE, image)) {
+            return;
+        }
+        auto gsOpt = compression::fromSnapshotImage(image);
         if (!gsOpt) return;
 
+        _snapshotHistory.store(sequence) = image;
+        acceptSnapshot(sequence);
+        applySnapshot(*gsOpt, sequence, partial);
+    }
+
+    void UDPClient::acceptSnapshot(uint16_t sequence) {
+        _lastSnapshotSequence = sequence;
+        _hasSnapshotSequence = true;
+
+        UDPHeader head{
+            .type = static_cast<uint16_t>(MessageType::SnapshotAck),
+            .sequence_num = 0,
+            .timestamp = UDPHeader::getTimestamp()
+        };
+        // The reliable channel's packet acks ride along (all bits clear until a ReliableEvents packet arrives)
+        SnapshotAck ack{
+            .sequence = sequence,
+            .event_ack = _reliableEvents.ack(),
+            .event_ack_bits = _reliableEvents.ackBits()
+        };
+        const size_t totalSize = UDPHeader::WIRE_SIZE + SnapshotAck::WIRE_SIZE;
+        auto buf = std::make_shared<std::vector<uint8_t>>(totalSize);
+        head.to_bytes(buf->data());
+        ack.to_bytes(buf->data() + UDPHeader::WIRE_SIZE);
+        asyncSendTo(buf, totalSize);
+    }
+
+    void UDPClient::applySnapshot(const GameSnapshot& snapshot, uint16_t sequence, bool partial) {
         std::vector<NetworkPlayer> newPlayers;
-        newPlayers.reserve(gsOpt->player_count);
+        newPlayers.reserve(snapshot.player_count);
 
-        for (uint8_t i = 0; i < gsOpt->player_count; ++i) {
-            const auto& ps = gsOpt->players[i];
+        for (uint8_t i = 0; i < snapshot.player_count; ++i) {
+            const auto& ps = snapshot.players[i];
             newPlayers.push_back(NetworkPlayer{
                 .id = ps.id,
                 .x = ps.x,
@@ -419,10 +497,10 @@ namespace client::network
         }
 
         std::vector<NetworkMissile> newMissiles;
-        newMissiles.reserve(gsOpt->missile_count);
+        newMissiles.reserve(snapshot.missile_count);
 
-        for (uint8_t i = 0; i < gsOpt->missile_count; ++i) {
-            const auto& ms = gsOpt->missiles[i];
+        for (uint8_t i = 0; i < snapshot.missile_count; ++i) {
+            const auto& ms = snapshot.missiles[i];
             newMissiles.push_back(NetworkMissile{
                 .id = ms.id,
                 .owner_id = ms.owner_id,
@@ -433,10 +511,10 @@ namespace client::network
         }
 
         std::vector<NetworkEnemy> newEnemies;
-        newEnemies.reserve(gsOpt->enemy_count);
+        newEnemies.reserve(snapshot.enemy_count);
 
-        for (uint8_t i = 0; i < gsOpt->enemy_count; ++i) {
-            const auto& es = gsOpt->enemies[i];
+        for (uint8_t i = 0; i < snapshot.enemy_count; ++i) {
+            const auto& es = snapshot.enemies[i];
             newEnemies.push_back(NetworkEnemy{
                 .id = es.id,
                 .x = es.x,
@@ -447,10 +525,10 @@ namespace client::network
         }
 
         std::vector<NetworkMissile> newEnemyMissiles;
-        newEnemyMissiles.reserve(gsOpt->enemy_missile_count);
+        newEnemyMissiles.reserve(snapshot.enemy_missile_count);
 
-        for (uint8_t i = 0; i < gsOpt->enemy_missile_count; ++i) {
-            const auto& ms = gsOpt->enemy_missiles[i];
+        for (uint8_t i = 0; i < snapshot.enemy_missile_count; ++i) {
+            const auto& ms = snapshot.enemy_missiles[i];
             newEnemyMissiles.push_back(NetworkMissile{
                 .id = ms.id,
                 .owner_id = ms.owner_id,
@@ -466,33 +544,36 @@ namespace client::network
         }
         {
             std::lock_guard<std::mutex> lock(_missilesMutex);
+            keepLeftOut(newMissiles, _missiles, _missileSeen, sequence, partial);
             _missiles = std::move(newMissiles);
         }
         {
             std::lock_guard<std::mutex> lock(_enemiesMutex);
+            keepLeftOut(newEnemies, _enemies, _enemySeen, sequence, partial);
             _enemies = std::move(newEnemies);
         }
         {
             std::lock_guard<std::mutex> lock(_enemyMissilesMutex);
+            keepLeftOut(newEnemyMissiles, _enemyMissiles, _enemyMissileSeen, sequence, partial);
             _enemyMissiles = std::move(newEnemyMissiles);
         }
         {
             std::lock_guard<std::mutex> lock(_waveNumberMutex);
-            _waveNumber = gsOpt->wave_number;
+            _waveNumber = snapshot.wave_number;
         }
 
         // Boss state
         {
             std::lock_guard<std::mutex> lock(_bossMutex);
-            if (gsOpt->has_boss) {
+            if (snapshot.has_boss) {
                 _bossState = NetworkBoss{
-                    .id = gsOpt->boss_state.id,
-                    .x = gsOpt->boss_state.x,
-                    .y = gsOpt->boss_state.y,
-                    .max_health = gsOpt->boss_state.max_health,
-                    .health = gsOpt->boss_state.health,
-                    .phase = gsOpt->boss_state.phase,
-                    .is_active = (gsOpt->boss_state.is_active != 0)
+                    .id = snapshot.boss_state.id,
+                    .x = snapshot.boss_state.x,
+                    .y = snapshot.boss_state.y,
+                    .max_health = snapshot.boss_state.max_health,
+                    .health = snapshot.boss_state.health,
+                    .phase = snapshot.boss_state.phase,
+                    .is_active = (snapshot.boss_state.is_active != 0)
                 };
             } else {
                 _bossState = std::nullopt;
@@ -502,9 +583,9 @@ namespace client::network
         // Force Pods from snapshot
         {
             std::vector<NetworkForce> newForces;
-            newForces.reserve(gsOpt->force_count);
-            for (uint8_t i = 0; i < gsOpt->force_count; ++i) {
-                const auto& fs = gsOpt->forces[i];
+            newForces.reserve(snapshot.force_count);
+            for (uint8_t i = 0; i < snapshot.force_count; ++i) {
+                const auto& fs = snapshot.forces[i];
                 newForces.push_back(NetworkForce{
                     .owner_id = fs.owner_id,
                     .x = fs.x,
@@ -520,9 +601,9 @@ namespace client::network
         // Bit Devices from snapshot
         {
             std::vector<NetworkBit> newBits;
-            newBits.reserve(gsOpt->bit_count);
-            for (uint8_t i = 0; i < gsOpt->bit_count; ++i) {
-                const auto& bs = gsOpt->bits[i];
+            newBits.reserve(snapshot.bit_count);
+            for (uint8_t i = 0; i < snapshot.bit_count; ++i) {
+                const auto& bs = snapshot.bits[i];
                 newBits.push_back(NetworkBit{
                     .owner_id = bs.owner_id,
                     .bit_index = bs.bit_index,
@@ -647,6 +728,162 @@ namespace client::network
         });
     }
 
+    void UDPClient::handleGameEvent(MessageType type, const uint8_t* payload, size_t size) {
+        switch (type) {
+            case MessageType::PlayerJoin:
+                handlePlayerJoin(payload, size);
+                break;
+            case MessageType::PlayerLeave:
+                handlePlayerLeave(payload, size);
+                break;
+            case MessageType::MissileSpawned:
+                handleMissileSpawned(payload, size);
+                break;
+            case MessageType::MissileDestroyed:
+                handleMissileDestroyed(payload, size);
+                break;
+            case MessageType::EnemyDestroyed:
+                handleEnemyDestroyed(payload, size);
+                break;
+            case MessageType::PlayerDamaged:
+                handlePlayerDamaged(payload, size);
+                break;
+            case MessageType::PlayerDied:
+                handlePlayerDied(payload, size);
+                break;
+            // R-Type Authentic (Phase 3) message handlers
+            case MessageType::WaveCannonFired:
+                handleWaveCannonFired(payload, size);
+                break;
+            case MessageType::PowerUpSpawned:
+                handlePowerUpSpawned(payload, size);
+                break;
+            case MessageType::PowerUpCollected:
+                handlePowerUpCollected(payload, size);
+                break;
+            case MessageType::PowerUpExpired:
+                handlePowerUpExpired(payload, size);
+                break;
+            case MessageType::ForceStateUpdate:
+                handleForceStateUpdate(payload, size);
+                break;
+            case MessageType::PauseStateSync:
+                handlePauseStateSync(payload, size);
+                break;
+            default:
+                break;
+        }
+    }
+
+    void UDPClient::handleMessage(const UDPHeader& head, const uint8_t* data, size_t size)
+    {
+        auto logger = client::logging::Logger::getNetworkLogger();
+
+        // Check for compression flag
+        bool isCompressed = (head.type & COMPRESSION_FLAG) != 0;
+        bool isPartial = (head.type & PARTIAL_SNAPSHOT_FLAG) != 0;
+        uint16_t actualType = head.type & ~(COMPRESSION_FLAG | PARTIAL_SNAPSHOT_FLAG);
+
+        const uint8_t* payload = data;
+        size_t payload_size = size;
+
+        if (isCompressed) {
+            // Read compression header
+            if (size < CompressionHeader::WIRE_SIZE) {
+                return;
+            }
+            auto compHeadOpt = CompressionHeader::from_bytes(data, size);
+            if (!compHeadOpt) {
+                return;
+            }
+
+            size_t originalSize = compHeadOpt->originalSize;
+            const uint8_t* actualCompressedData = data + CompressionHeader::WIRE_SIZE;
+            size_t actualCompressedSize = size - CompressionHeader::WIRE_SIZE;
+
+            // Always with the snapshot dictionary: packets compressed without it decode the same
+            if (_decompressBuffer.size() < originalSize) {
+                _decompressBuffer.resize(originalSize);
+            }
+            if (!_decompressor.decompress({actualCompressedData, actualCompressedSize},
+                                          {_decompressBuffer.data(), originalSize})) {
+                logger->warn("Failed to decompress packet (type=0x{:04X})", actualType);
+                return;
+            }
+
+            payload = _decompressBuffer.data();
+            payload_size = originalSize;
+        }
+
+        switch (static_cast<MessageType>(actualType)) {
+            case MessageType::HeartBeatAck:
+                // Confirm connection on first HeartBeatAck
+                if (_connecting.exchange(false)) {
+                    _connected.store(true);
+                    logger->info("UDP connection confirmed by server");
+                    _eventQueue.push(UDPConnectedEvent{0});  // Player ID will be set by PlayerJoin
+                    if (_onConnected) {
+                        _onConnected();
+                    }
+                }
+                break;
+            case MessageType::Snapshot:
+                if (auto gsOpt = GameSnapshot::from_bytes(payload, payload_size)) {
+                    handleSnapshot(head.sequence_num, *gsOpt, isPartial);
+                }
+                break;
+            case MessageType::SnapshotPacked:
+                if (auto gsOpt = unpackSnapshot(payload, payload_size)) {
+                    handleSnapshot(head.sequence_num, *gsOpt, isPartial);
+                }
+                break;
+            case MessageType::SnapshotDelta:
+                handleSnapshotDelta(head.sequence_num, payload, payload_size, isPartial);
+                break;
+            case MessageType::ReliableEvents:
+                _reliableEvents.receive(head.sequence_num, payload, payload_size,
+                    [this](MessageType type, const uint8_t* event, size_t size) {
+                        handleGameEvent(type, event, size);
+                    });
+                break;
+            case MessageType::JoinGameAck:
+                if (payload_size >= JoinGameAck::MIN_WIRE_SIZE) {
+                    auto ackOpt = JoinGameAck::from_bytes(payload, payload_size);
+                    if (ackOpt) {
+                        logger->info("JoinGame accepted, player_id={}, snapshot encoding {}",
+                                     ackOpt->player_id, ackOpt->snapshotEncoding);
+                        {
+                            std::scoped_lock lock(_playersMutex);
+                            _localPlayerId = ackOpt->player_id;
+                        }
+                        // New game instance: its snapshot sequence starts over
+                        _snapshotHistory.clear();
+                        _hasSnapshotSequence = false;
+                        _missileSeen.clear();
+                        _enemySeen.clear();
+                        _enemyMissileSeen.clear();
+                        _reliableEvents.reset();
+                        _eventQueue.push(UDPJoinGameAckEvent{ackOpt->player_id});
+                    }
+                }
+                break;
+            case MessageType::JoinGameNack:
+                if (payload_size >= JoinGameNack::WIRE_SIZE) {
+                    auto nackOpt = JoinGameNack::from_bytes(payload, payload_size);
+                    if (nackOpt) {
+                        std::string reason(nackOpt->reason);
+                        logger->warn("JoinGame rejected: {}", reason);
+                        _eventQueue.push(UDPJoinGameNackEvent{reason});
+                    }
+                }
+                break;
+            default:
+                // Game events, from servers (or players) without the reliable channel
+                handleGameEvent(static_cast<MessageType>(actualType), payload, payload_size);
+                break;
+        }
+    }
+
     void UDPClient::handleRead(const boost::system::error_code &error, std::size_t bytes)
     {
         // Ignore operation_aborted - expected when intentionally disconnecting
@@ -669,127 +906,27 @@ namespace client::network
                 }
                 UDPHeader head = *headOpt;
 
-                // Check for compression flag
-                bool isCompressed = (head.type & COMPRESSION_FLAG) != 0;
-                uint16_t actualType = head.type & ~COMPRESSION_FLAG;
-
-                size_t headerOffset = UDPHeader::WIRE_SIZE;
-                const uint8_t* compressedPayload = reinterpret_cast<const uint8_t*>(_readBuffer) + headerOffset;
-                size_t compressedSize = bytes - headerOffset;
-
-                // Decompression buffer (reused to avoid allocations)
-                static thread_local std::vector<uint8_t> decompressedBuf;
-                const uint8_t* payload = compressedPayload;
-                size_t payload_size = compressedSize;
-
-                if (isCompressed) {
-                    // Read compression header
-                    if (compressedSize < CompressionHeader::WIRE_SIZE) {
-                        asyncReceiveFrom();
-                        return;
-                    }
-                    auto compHeadOpt = CompressionHeader::from_bytes(compressedPayload, compressedSize);
-                    if (!compHeadOpt) {
-                        asyncReceiveFrom();
-                        return;
-                    }
-
-                    size_t originalSize = compHeadOpt->originalSize;
-                    const uint8_t* actualCompressedData = compressedPayload + CompressionHeader::WIRE_SIZE;
-                    size_t actualCompressedSize = compressedSize - CompressionHeader::WIRE_SIZE;
-
-                    auto decompressed = compression::decompress(actualCompressedData, actualCompressedSize, originalSize);
-                    if (!decompressed) {
-                        logger->warn("Failed to decompress packet (type=0x{:04X})", actualType);
-                        asyncReceiveFrom();
-                        return;
-                    }
-
-                    decompressedBuf = std::move(*decompressed);
-                    payload = decompressedBuf.data();
-                    payload_size = decompressedBuf.size();
-                }
-
-                switch (static_cast<MessageType>(actualType)) {
-                    case MessageType::HeartBeatAck:
-                        // Confirm connection on first HeartBeatAck
-                        if (_connecting.exchange(false)) {
-                            _connected.store(true);
-                            logger->info("UDP connection confirmed by server");
-                            _eventQueue.push(UDPConnectedEvent{0});  // Player ID will be set by PlayerJoin
-                            if (_onConnected) {
-                                _onConnected();
-                            }
+                if (head.type == static_cast<uint16_t>(MessageType::Bundle)) {
+                    // A tick's messages coalesced by the server, each as if it came in its own datagram
+                    const uint8_t* data = reinterpret_cast<const uint8_t*>(_readBuffer) + UDPHeader::WIRE_SIZE;
+                    size_t remaining = bytes - UDPHeader::WIRE_SIZE;
+                    while (auto entryOpt = BundleEntryHeader::from_bytes(data, remaining)) {
+                        if (BundleEntryHeader::WIRE_SIZE + entryOpt->size > remaining
+                            || entryOpt->type == static_cast<uint16_t>(MessageType::Bundle)) {
+                            break;
                         }
-                        break;
-                    case MessageType::PlayerJoin:
-                        handlePlayerJoin(payload, payload_size);
-                        break;
-                    case MessageType::PlayerLeave:
-                        handlePlayerLeave(payload, payload_size);
-                        break;
-                    case MessageType::Snapshot:
-                        handleSnapshot(payload, payload_size);
-                        break;
-                    case MessageType::MissileSpawned:
-                        handleMissileSpawned(payload, payload_size);
-                        break;
-                    case MessageType::MissileDestroyed:
-                        handleMissileDestroyed(payload, payload_size);
-                        break;
-                    case MessageType::EnemyDestroyed:
-                        handleEnemyDestroyed(payload, payload_size);
-                        break;
-                    case MessageType::PlayerDamaged:
-                        handlePlayerDamaged(payload, payload_size);
-                        break;
-                    case MessageType::PlayerDied:
-                        handlePlayerDied(payload, payload_size);
-                        break;
-                    case MessageType::JoinGameAck:
-                        if (payload_size >= JoinGameAck::WIRE_SIZE) {
-                            auto ackOpt = JoinGameAck::from_bytes(payload, payload_size);
-                            if (ackOpt) {
-                                logger->info("JoinGame accepted, player_id={}", ackOpt->player_id);
-                                {
-                                    std::scoped_lock lock(_playersMutex);
-                                    _localPlayerId = ackOpt->player_id;
-                                }
-                                _eventQueue.push(UDPJoinGameAckEvent{ackOpt->player_id});
-                            }
-                        }
-                        break;
-                    case MessageType::JoinGameNack:
-                        if (payload_size >= JoinGameNack::WIRE_SIZE) {
-                            auto nackOpt = JoinGameNack::from_bytes(payload, payload_size);
-                            if (nackOpt) {
-                                std::string reason(nackOpt->reason);
-                                logger->warn("JoinGame rejected: {}", reason);
-                                _eventQueue.push(UDPJoinGameNackEvent{reason});
-                            }
-                        }
-                        break;
-                    // R-Type Authentic (Phase 3) message handlers
-                    case MessageType::WaveCannonFired:
-                        handleWaveCannonFired(payload, payload_size);
-                        break;
-                    case MessageType::PowerUpSpawned:
-                        handlePowerUpSpawned(payload, payload_size);
-                        break;
-                    case MessageType::PowerUpCollected:
-                        handlePowerUpCollected(payload, payload_size);
-                        break;
-                    case MessageType::PowerUpExpired:
-                        handlePowerUpExpired(payload, payload_size);
-                        break;
-                    case MessageType::ForceStateUpdate:
-                        handleForceStateUpdate(payload, payload_size);
-                        break;
-                    case MessageType::PauseStateSync:
-                        handlePauseStateSync(payload, payload_size);
-                        break;
-                    default:
-                        break;
+                        UDPHeader entryHead{
+                            .type = entryOpt->type,
+                            .sequence_num = entryOpt->sequence_num,
+                            .timestamp = head.timestamp
+                        };
+                        handleMessage(entryHead, data + BundleEntryHeader::WIRE_SIZE, entryOpt->size);
+                        data += BundleEntryHeader::WIRE_SIZE + entryOpt->size;
+                        remaining -= BundleEntryHeader::WIRE_SIZE + entryOpt->size;
+                    }
+                } else {
+                    handleMessage(head, reinterpret_cast<const uint8_t*>(_readBuffer) + UDPHeader::WIRE_SIZE,
+                                  bytes - UDPHeader::WIRE_SIZE);
                 }
                 asyncReceiveFrom();
             }
@@ -890,6 +1027,8 @@ namespace client::network
         JoinGame joinGame;
         joinGame.token = token;
         joinGame.shipSkin = shipSkin;
+        joinGame.snapshotEncoding = static_cast<uint8_t>(LATEST_SNAPSHOT_ENCODING);
+        joinGame.features = GameFeatures::RELIABLE_EVENTS | GameFeatures::BUNDLES;
 
         // Copy room code (pad with zeros if shorter than ROOM_CODE_LEN)
         std::memset(joinGame.roomCode, 0, ROOM_CODE_LEN);
@@ -0,0 +1,276 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** AABBBatch - SIMD batch AABB intersection over SoA arrays
+*/
+
+#ifndef AABB_BATCH_HPP_
+#define AABB_BATCH_HPP_
+
+#include "collision/AABB.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define RTYPE_AABB_SSE2 1
+    #include <immintrin.h>
+    // GCC/Clang can compile an AVX2 kernel without -mavx2 and pick it at runtime
+    #if defined(__AVX2__) || defined(__GNUC__)
+        #define RTYPE_AABB_AVX2 1
+    #endif
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #define RTYPE_AABB_NEON 1
+    #include <arm_neon.h>
+#endif
+
+namespace collision {
+
+/**
+ * @brief Non-owning SoA view over 'count' boxes.
+ */
+struct AABBArrays {
+    const float* xs;
+    const float* ys;
+    const float* ws;
+    const float* hs;
+    std::size_t count;
+
+    AABB at(std::size_t i) const { return AABB(xs[i], ys[i], ws[i], hs[i]); }
+};
+
+/**
+ * @brief Owning SoA box list, reused across ticks (clear() keeps the capacity).
+ */
+class AABBBatch {
+public:
+    void clear() {
+        _xs.clear();
+        _ys.clear();
+        _ws.clear();
+        _hs.clear();
+    }
+
+    void reserve(std::size_t count) {
+        _xs.reserve(count);
+        _ys.reserve(count);
+        _ws.reserve(count);
+        _hs.reserve(count);
+    }
+
+    void push(const AABB& box) {
+        _xs.push_back(box.x);
+        _ys.push_back(box.y);
+        _ws.push_back(box.width);
+        _hs.push_back(box.height);
+    }
+
+    std::size_t size() const { return _xs.size(); }
+    bool empty() const { return _xs.empty(); }
+
+    AABBArrays arrays() const { return {_xs.data(), _ys.data(), _ws.data(), _hs.data(), _xs.size()}; }
+
+private:
+    std::vector<float> _xs;
+    std::vector<float> _ys;
+    std::vector<float> _ws;
+    std::vector<float> _hs;
+};
+
+namespace detail {
+
+    // Every kernel calls sink(base, bits) for each block of boxes with at least one hit:
+    // bit k set means box base + k intersects. SIMD blocks start on multiples of their
+    // width (4 or 8), so a block never straddles a 64-bit mask word.
+
+    template<typename Sink>
+    inline void scanScalar(const AABB& box, const AABBArrays& boxes, std::size_t begin, Sink&& sink) {
+        for (std::size_t i = begin; i < boxes.count; ++i) {
+            if (box.intersects(boxes.at(i)))
+                sink(static_cast<uint32_t>(i), 1u);
+        }
+    }
+
+#if defined(RTYPE_AABB_SSE2)
+    template<typename Sink>
+    inline void scanSSE2(const AABB& box, const AABBArrays& boxes, Sink&& sink) {
+        const __m128 minX = _mm_set1_ps(box.x);
+        const __m128 maxX = _mm_set1_ps(box.x + box.width);
+        const __m128 minY = _mm_set1_ps(box.y);
+        const __m128 maxY = _mm_set1_ps(box.y + box.height);
+        std::size_t i = 0;
+        for (; i + 4 <= boxes.count; i += 4) {
+            __m128 x = _mm_loadu_ps(boxes.xs + i);
+            __m128 y = _mm_loadu_ps(boxes.ys + i);
+            __m128 hitX = _mm_and_ps(_mm_cmplt_ps(minX, _mm_add_ps(x, _mm_loadu_ps(boxes.ws + i))),
+                                     _mm_cmpgt_ps(maxX, x));
+            __m128 hitY = _mm_and_ps(_mm_cmplt_ps(minY, _mm_add_ps(y, _mm_loadu_ps(boxes.hs + i))),
+                                     _mm_cmpgt_ps(maxY, y));
+            int bits = _mm_movemask_ps(_mm_and_ps(hitX, hitY));
+            if (bits != 0)
+                sink(static_cast<uint32_t>(i), static_cast<uint32_t>(bits));
+        }
+        scanScalar(box, boxes, i, sink);
+    }
+#endif
+
+#if defined(RTYPE_AABB_AVX2)
+    template<typename Sink>
+    #if !defined(__AVX2__)
+    __attribute__((target("avx2")))
+    #endif
+    inline void scanAVX2(const AABB& box, const AABBArrays& boxes, Sink&& sink) {
+        const __m256 minX = _mm256_set1_ps(box.x);
+        const __m256 maxX = _mm256_set1_ps(box.x + box.width);
+        const __m256 minY = _mm256_set1_ps(box.y);
+        const __m256 maxY = _mm256_set1_ps(box.y + box.height);
+        std::size_t i = 0;
+        for (; i + 8 <= boxes.count; i += 8) {
+            __m256 x = _mm256_loadu_ps(boxes.xs + i);
+            __m256 y = _mm256_loadu_ps(boxes.ys + i);
+            __m256 hitX = _mm256_and_ps(
+                _mm256_cmp_ps(minX, _mm256_add_ps(x, _mm256_loadu_ps(boxes.ws + i)), _CMP_LT_OQ),
+                _mm256_cmp_ps(maxX, x, _CMP_GT_OQ));
+            __m256 hitY = _mm256_and_ps(
+                _mm256_cmp_ps(minY, _mm256_add_ps(y, _mm256_loadu_ps(boxes.hs + i)), _CMP_LT_OQ),
+                _mm256_cmp_ps(maxY, y, _CMP_GT_OQ));
+            int bits = _mm256_movemask_ps(_mm256_and_ps(hitX, hitY));
+            if (bits != 0)
+                sink(static_cast<uint32_t>(i), static_cast<uint32_t>(bits));
+        }
+        scanScalar(box, boxes, i, sink);
+    }
+
+    inline bool cpuHasAVX2() {
+    #if defined(__AVX2__)
+        return true;
+    #else
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+    #endif
+    }
+#endif
+
+#if defined(RTYPE_AABB_NEON)
+    template<typename Sink>
+    inline void scanNEON(const AABB& box, const AABBArrays& boxes, Sink&& sink) {
+        const float32x4_t minX = vdupq_n_f32(box.x);
+        const float32x4_t maxX = vdupq_n_f32(box.x + box.width);
+        const float32x4_t minY = vdupq_n_f32(box.y);
+        const float32x4_t maxY = vdupq_n_f32(box.y + box.height);
+        const int32_t laneShifts[4] = {0, 1, 2, 3};
+        const int32x4_t shifts = vld1q_s32(laneShifts);
+        std::size_t i = 0;
+        for (; i + 4 <= boxes.count; i += 4) {
+            float32x4_t x = vld1q_f32(boxes.xs + i);
+            float32x4_t y = vld1q_f32(boxes.ys + i);
+            uint32x4_t hitX = vandq_u32(vcltq_f32(minX, vaddq_f32(x, vld1q_f32(boxes.ws + i))),
+                                        vcgtq_f32(maxX, x));
+            uint32x4_t hitY = vandq_u32(vcltq_f32(minY, vaddq_f32(y, vld1q_f32(boxes.hs + i))),
+                                        vcgtq_f32(maxY, y));
+            // movemask: one bit per lane
+            uint32_t bits = vaddvq_u32(vshlq_u32(vshrq_n_u32(vandq_u32(hitX, hitY), 31), shifts));
+            if (bits != 0)
+                sink(static_cast<uint32_t>(i), bits);
+        }
+        scanScalar(box, boxes, i, sink);
+    }
+#endif
+
+    template<typename Sink>
+    inline void scan(const AABB& box, const AABBArrays& boxes, Sink&& sink) {
+#if defined(RTYPE_AABB_AVX2)
+        if (cpuHasAVX2()) {
+            scanAVX2(box, boxes, sink);
+            return;
+        }
+#endif
+#if defined(RTYPE_AABB_SSE2)
+        scanSSE2(box, boxes, sink);
+#elif defined(RTYPE_AABB_NEON)
+        scanNEON(box, boxes, sink);
+#else
+        scanScalar(box, boxes, 0, sink);
+#endif
+    }
+
+}
+
+/**
+ * @brief Name of the kernel intersect*() functions run with on this CPU.
+ */
+inline const char* batchKernelName() {
+#if defined(RTYPE_AABB_AVX2)
+    if (detail::cpuHasAVX2())
+        return "avx2";
+#endif
+#if defined(RTYPE_AABB_SSE2)
+    return "sse2";
+#elif defined(RTYPE_AABB_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+/**
+ * @brief Writes the indices of the boxes intersecting 'box' to 'out', in increasing order.
+ *
+ * Same result as calling AABB::intersects on every box.
+ *
+ * @param out Must hold boxes.count indices
+ * @return The amount of indices written
+ */
+inline std::size_t intersectIndices(const AABB& box, const AABBArrays& boxes, uint32_t* out) {
+    std::size_t count = 0;
+    detail::scan(box, boxes, [out, &count](uint32_t base, uint32_t bits) {
+        while (bits != 0) {
+            out[count++] = base + static_cast<uint32_t>(std::countr_zero(bits));
+            bits &= bits - 1;
+        }
+    });
+    return count;
+}
+
+/**
+ * @brief Scalar reference of intersectIndices(), kept for tests and benchmarks.
+ */
+inline std::size_t intersectIndicesScalar(const AABB& box, const AABBArrays& boxes, uint32_t* out) {
+    std::size_t count = 0;
+    detail::scanScalar(box, boxes, 0, [out, &count](uint32_t index, uint32_t) { out[count++] = index; });
+    return count;
+}
+
+/**
+ * @brief Sets bit i of 'mask' when box i intersects 'box' (bit i is bit i % 64 of word i / 64).
+ *
+ * @param mask Must hold (boxes.count + 63) / 64 words, they are overwritten
+ */
+inline void intersectMask(const AABB& box, const AABBArrays& boxes, uint64_t* mask) {
+    for (std::size_t w = 0; w < (boxes.count + 63) / 64; ++w)
+        mask[w] = 0;
+    detail::scan(box, boxes, [mask](uint32_t base, uint32_t bits) {
+        mask[base / 64] |= static_cast<uint64_t>(bits) << (base % 64);
+    });
+}
+
+/**
+ * @brief Calls fn(i, j) for every intersecting pair (a[i], b[j]), ordered by i then j.
+ */
+template<typename Func>
+inline void forEachIntersectingPair(const AABBArrays& a, const AABBArrays& b, Func&& fn) {
+    for (std::size_t i = 0; i < a.count; ++i) {
+        detail::scan(a.at(i), b, [&fn, i](uint32_t base, uint32_t bits) {
+            while (bits != 0) {
+                fn(static_cast<uint32_t>(i), base + static_cast<uint32_t>(std::countr_zero(bits)));
+                bits &= bits - 1;
+            }
+        });
+    }
+}
+
+}
+
+#endif /* !AABB_BATCH_HPP_ */
@@ -0,0 +1,164 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SpatialGrid - Uniform grid broadphase for AABB collision detection
+*/
+
+#ifndef SPATIAL_GRID_HPP_
+#define SPATIAL_GRID_HPP_
+
+#include "collision/AABB.hpp"
+#include "collision/AABBBatch.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace collision {
+
+/**
+ * @brief Uniform grid over the playfield, rebuilt once per tick.
+ *
+ * build() buckets a set of boxes into fixed-size cells (counting sort, the
+ * cell contents are stored contiguously); query() then only tests a box
+ * against the boxes sharing one of its cells, with AABB::intersects as the
+ * narrowphase. Boxes outside the playfield are clamped into the border
+ * cells, so off-screen entities are still found, just less efficiently.
+ *
+ * A pair whose boxes share several cells is only tested once: it is kept
+ * in the cell holding the max corner of the two boxes' min corners.
+ * Buffers are reused across builds, a steady-state tick doesn't allocate.
+ */
+class SpatialGrid {
+public:
+    static constexpr float WORLD_WIDTH = 1920.0f;
+    static constexpr float WORLD_HEIGHT = 1080.0f;
+    static constexpr float CELL_SIZE = 64.0f;
+
+    explicit SpatialGrid(float worldWidth = WORLD_WIDTH, float worldHeight = WORLD_HEIGHT,
+                         float cellSize = CELL_SIZE)
+        : _cellSize(cellSize),
+          _columns(std::max(1, static_cast<int>(worldWidth / cellSize + 0.999f))),
+          _rows(std::max(1, static_cast<int>(worldHeight / cellSize + 0.999f))),
+          _cellStart(static_cast<std::size_t>(_columns * _rows) + 1, 0) {}
+
+    /**
+     * @brief Replaces the indexed boxes. Box i is reported as index i by query().
+     */
+    void build(const AABB* boxes, std::size_t count) {
+        _boxes.assign(boxes, boxes + count);
+        bucket();
+    }
+
+    /**
+     * @brief Same as build(const AABB*, size_t), from SoA arrays.
+     */
+    void build(const AABBArrays& boxes) {
+        _boxes.clear();
+        for (std::size_t i = 0; i < boxes.count; ++i)
+            _boxes.push_back(boxes.at(i));
+        bucket();
+    }
+
+    /**
+     * @brief Calls fn(index) for every indexed box intersecting 'box'.
+     *
+     * Indices come out in cell order, not in index order.
+     */
+    template<typename Func>
+    void query(const AABB& box, Func&& fn) {
+        CellRange range = cellsOf(box);
+        for (int cy = range.y0; cy <= range.y1; ++cy) {
+            for (int cx = range.x0; cx <= range.x1; ++cx) {
+                std::size_t cell = static_cast<std::size_t>(cy * _columns + cx);
+                for (uint32_t k = _cellStart[cell]; k < _cellStart[cell + 1]; ++k) {
+                    uint32_t index = _items[k];
+                    const AABB& other = _boxes[index];
+                    // Only the reference cell of the pair tests it
+                    if (column(std::max(box.x, other.x)) != cx || row(std::max(box.y, other.y)) != cy)
+                        continue;
+                    ++_candidates;
+                    if (box.intersects(other))
+                        fn(index);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Preallocates for 'boxes' boxes spanning up to 'cellsPerBox' cells each.
+     */
+    void reserve(std::size_t boxes, std::size_t cellsPerBox = 4) {
+        _boxes.reserve(boxes);
+        _items.reserve(boxes * cellsPerBox);
+    }
+
+    /**
+     * @brief Pairs that reached the narrowphase since the last build().
+     */
+    std::size_t candidateCount() const { return _candidates; }
+
+    std::size_t size() const { return _boxes.size(); }
+
+private:
+    struct CellRange {
+        int x0, y0, x1, y1;
+    };
+
+    float _cellSize;
+    int _columns;
+    int _rows;
+    std::vector<AABB> _boxes;
+    std::vector<uint32_t> _cellStart;   // Prefix sums, cell c owns _items[_cellStart[c], _cellStart[c + 1])
+    std::vector<uint32_t> _cursor;
+    std::vector<uint32_t> _items;
+    std::size_t _candidates = 0;
+
+    // Clamped in float first: huge or NaN coordinates must not overflow the int cast
+    static int cellIndex(float coord, float cellSize, int count) {
+        float cell = coord / cellSize;
+        if (!(cell >= 0.0f))
+            return 0;
+        if (cell >= static_cast<float>(count - 1))
+            return count - 1;
+        return static_cast<int>(cell);
+    }
+
+    // Counting sort of _boxes into the cells
+    void bucket() {
+        std::fill(_cellStart.begin(), _cellStart.end(), 0u);
+
+        // Pass 1: count the boxes of every cell
+        for (const auto& box : _boxes) {
+            CellRange range = cellsOf(box);
+            for (int cy = range.y0; cy <= range.y1; ++cy)
+                for (int cx = range.x0; cx <= range.x1; ++cx)
+                    ++_cellStart[static_cast<std::size_t>(cy * _columns + cx) + 1];
+        }
+        for (std::size_t i = 1; i < _cellStart.size(); ++i)
+            _cellStart[i] += _cellStart[i - 1];
+
+        // Pass 2: scatter, every cell lists its boxes by increasing index
+        _cursor.assign(_cellStart.begin(), _cellStart.end() - 1);
+        _items.resize(_cellStart.back());
+        for (std::size_t i = 0; i < _boxes.size(); ++i) {
+            CellRange range = cellsOf(_boxes[i]);
+            for (int cy = range.y0; cy <= range.y1; ++cy)
+                for (int cx = range.x0; cx <= range.x1; ++cx)
+                    _items[_cursor[static_cast<std::size_t>(cy * _columns + cx)]++] = static_cast<uint32_t>(i);
+        }
+        _candidates = 0;
+    }
+
+    int column(float x) const { return cellIndex(x, _cellSize, _columns); }
+    int row(float y) const { return cellIndex(y, _cellSize, _rows); }
+
+    CellRange cellsOf(const AABB& box) const {
+        return {column(box.x), row(box.y), column(box.x + box.width), row(box.y + box.height)};
+    }
+};
+
+}
+
+#endif /* !SPATIAL_GRID_HPP_ */
@@ -16,6 +16,42 @@
 
 namespace compression {
 
+/**
+ * @brief Worst-case compressed size of srcSize bytes
+ * @return Size compressInto() may need, 0 if srcSize is too large for LZ4
+ */
+inline size_t compressBound(size_t srcSize) {
+    int bound = LZ4_compressBound(static_cast<int>(srcSize));
+    return bound > 0 ? static_cast<size_t>(bound) : 0;
+}
+
+/**
+ * @brief Compresses data into a caller-provided buffer (no allocation)
+ * @param src Source data to compress
+ * @param srcSize Size of source data in bytes
+ * @param dst Destination buffer
+ * @param dstCapacity Size of dst, compressBound(srcSize) always fits
+ * @return Compressed size, or 0 if compression fails/not worth it
+ */
+inline size_t compressInto(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity) {
+    if (srcSize == 0 || src == nullptr || dst == nullptr) {
+        return 0;
+    }
+
+    int compressedSize = LZ4_compress_default(
+        reinterpret_cast<const char*>(src),
+        reinterpret_cast<char*>(dst),
+        static_cast<int>(srcSize),
+        static_cast<int>(dstCapacity)
+    );
+
+    // Only use compression if it actually reduces size
+    if (compressedSize <= 0 || static_cast<size_t>(compressedSize) >= srcSize) {
+        return 0;
+    }
+    return static_cast<size_t>(compressedSize);
+}
+
 /**
  * @brief Compresses data using LZ4 algorithm
  * @param src Source data to compress
@@ -30,30 +66,18 @@ inline std::vector<uint8_t> compress(const uint8_t* src, size_t srcSize) {
     }
 
     // Get maximum compressed size
-    int maxDstSize = LZ4_compressBound(static_cast<int>(srcSize));
-    if (maxDstSize <= 0) {
-        return {};
-    }
-
-    std::vector<uint8_t> compressed(static_cast<size_t>(maxDstSize));
-
-    int compressedSize = LZ4_compress_default(
-        reinterpret_cast<const char*>(src),
-        reinterpret_cast<char*>(compressed.data()),
-        static_cast<int>(srcSize),
-        maxDstSize
-    );
-
-    if (compressedSize <= 0) {
+    size_t maxDstSize = compressBound(srcSize);
+    if (maxDstSize == 0) {
         return {};
     }
 
-    // Only use compression if it actually reduces size
-    if (static_cast<size_t>(compressedSize) >= srcSize) {
+    std::vector<uint8_t> compressed(maxDstSize);
+    size_t compressedSize = compressInto(src, srcSize, compressed.data(), compressed.size());
+    if (compressedSize == 0) {
         return {};
     }
 
-    compressed.resize(static_cast<size_t>(compressedSize));
+    compressed.resize(compressedSize);
     return compressed;
 }
 
@@ -0,0 +1,193 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** CompressionContext - Reusable, allocation-free LZ4 context with an optional dictionary
+*/
+
+#ifndef COMPRESSIONCONTEXT_HPP_
+#define COMPRESSIONCONTEXT_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <lz4.h>
+
+namespace compression {
+
+/**
+ * @brief LZ4 compressor/decompressor that keeps its state between packets
+ *
+ * compress() reuses one LZ4 state instead of letting LZ4 set one up per call,
+ * and writes into the caller's buffer. With a dictionary, each packet is
+ * compressed as if the dictionary preceded it: a small snapshot finds matches
+ * in the dictionary that it could never find in its own few hundred bytes.
+ * The dictionary is hashed once, at construction.
+ *
+ * The decoder needs the same dictionary. Data compressed without one
+ * decompresses fine with it, so a receiver can always pass it.
+ *
+ * Not thread-safe: one context per thread or per strand. The dictionary bytes
+ * are not copied and must outlive the context.
+ */
+class CompressionContext {
+public:
+    CompressionContext() = default;
+
+    explicit CompressionContext(std::span<const uint8_t> dictionary) : _dictionary(dictionary) {
+        if (!_dictionary.empty()) {
+            LZ4_initStream(&_dictionaryState, sizeof(_dictionaryState));
+            LZ4_loadDict(&_dictionaryState, reinterpret_cast<const char*>(_dictionary.data()),
+                         static_cast<int>(_dictionary.size()));
+        }
+    }
+
+    CompressionContext(const CompressionContext&) = delete;
+    CompressionContext& operator=(const CompressionContext&) = delete;
+
+    bool hasDictionary() const { return !_dictionary.empty(); }
+
+    /**
+     * @brief Compresses src into dst (no allocation)
+     * @param useDictionary Prime with the dictionary, if the context has one (the receiver must have it too)
+     * @return Compressed size, or 0 if compression fails/not worth it
+     */
+    size_t compress(std::span<const uint8_t> src, std::span<uint8_t> dst, bool useDictionary = true) {
+        if (src.empty() || dst.empty()) {
+            return 0;
+        }
+
+        int compressedSize;
+        if (useDictionary && hasDictionary()) {
+            // The loaded dictionary is the stream's history: start every packet from a copy of it
+            std::memcpy(&_state, &_dictionaryState, sizeof(_state));
+            compressedSize = LZ4_compress_fast_continue(&_state,
+                reinterpret_cast<const char*>(src.data()), reinterpret_cast<char*>(dst.data()),
+                static_cast<int>(src.size()), static_cast<int>(dst.size()), 1);
+        } else {
+            compressedSize = LZ4_compress_fast_extState(&_state,
+                reinterpret_cast<const char*>(src.data()), reinterpret_cast<char*>(dst.data()),
+                static_cast<int>(src.size()), static_cast<int>(dst.size()), 1);
+        }
+
+        // Only use compression if it actually reduces size
+        if (compressedSize <= 0 || static_cast<size_t>(compressedSize) >= src.size()) {
+            return 0;
+        }
+        return static_cast<size_t>(compressedSize);
+    }
+
+    /**
+     * @brief Decompresses src into dst, which must be exactly the original size
+     * @return false if the data is corrupt or does not decompress to dst.size() bytes
+     */
+    bool decompress(std::span<const uint8_t> src, std::span<uint8_t> dst) const {
+        if (src.empty() || dst.empty()) {
+            return false;
+        }
+        int decompressedSize = LZ4_decompress_safe_usingDict(
+            reinterpret_cast<const char*>(src.data()), reinterpret_cast<char*>(dst.data()),
+            static_cast<int>(src.size()), static_cast<int>(dst.size()),
+            reinterpret_cast<const char*>(_dictionary.data()), static_cast<int>(_dictionary.size()));
+        return decompressedSize >= 0 && static_cast<size_t>(decompressedSize) == dst.size();
+    }
+
+private:
+    std::span<const uint8_t> _dictionary;
+    LZ4_stream_t _state{};            // Scratch, overwritten by each compress()
+    LZ4_stream_t _dictionaryState{};  // Dictionary already hashed
+};
+
+/**
+ * @brief Builds a dictionary out of the byte runs most shared by the samples
+ *
+ * Simplified segment selection: every 8-byte sequence is scored by the number
+ * of samples it appears in, and the segments of segmentSize bytes with the
+ * highest total score are kept until capacity is reached. A picked segment's
+ * sequences stop scoring, so the dictionary does not repeat itself. The best
+ * segments end up last, closest to the data.
+ *
+ * Offline tool: used to regenerate SNAPSHOT_DICTIONARY from recorded packets.
+ */
+inline std::vector<uint8_t> trainDictionary(const std::vector<std::vector<uint8_t>>& samples,
+                                            size_t capacity, size_t segmentSize = 32) {
+    constexpr size_t K = 8;
+    auto kmerAt = [](const uint8_t* p) {
+        uint64_t kmer;
+        std::memcpy(&kmer, p, K);
+        return kmer;
+    };
+
+    if (segmentSize < K) {
+        return {};
+    }
+
+    // In how many samples each sequence appears
+    std::unordered_map<uint64_t, uint32_t> frequency;
+    for (const auto& sample : samples) {
+        if (sample.size() < K) {
+            continue;
+        }
+        std::unordered_set<uint64_t> seen;
+        for (size_t i = 0; i + K <= sample.size(); ++i) {
+            if (seen.insert(kmerAt(sample.data() + i)).second) {
+                ++frequency[kmerAt(sample.data() + i)];
+            }
+        }
+    }
+
+    const size_t windowKmers = segmentSize - K + 1;
+    std::vector<std::vector<uint8_t>> picked;
+    size_t pickedSize = 0;
+    while (pickedSize + segmentSize <= capacity) {
+        // Best window of segmentSize bytes, by sliding sum of its sequences' scores
+        uint64_t bestScore = 0;
+        const std::vector<uint8_t>* bestSample = nullptr;
+        size_t bestOffset = 0;
+        for (const auto& sample : samples) {
+            if (sample.size() < segmentSize) {
+                continue;
+            }
+            uint64_t score = 0;
+            for (size_t i = 0; i + K <= sample.size(); ++i) {
+                auto it = frequency.find(kmerAt(sample.data() + i));
+                score += it != frequency.end() ? it->second : 0;
+                if (i >= windowKmers) {
+                    auto out = frequency.find(kmerAt(sample.data() + i - windowKmers));
+                    score -= out != frequency.end() ? out->second : 0;
+                }
+                if (i + 1 >= windowKmers && score > bestScore) {
+                    bestScore = score;
+                    bestSample = &sample;
+                    bestOffset = i + 1 - windowKmers;
+                }
+            }
+        }
+        // Nothing shared by two samples anymore
+        if (!bestSample || bestScore <= windowKmers) {
+            break;
+        }
+
+        const uint8_t* segment = bestSample->data() + bestOffset;
+        for (size_t i = 0; i + K <= segmentSize; ++i) {
+            frequency[kmerAt(segment + i)] = 0;
+        }
+        picked.emplace_back(segment, segment + segmentSize);
+        pickedSize += segmentSize;
+    }
+
+    std::vector<uint8_t> dictionary;
+    dictionary.reserve(pickedSize);
+    for (auto it = picked.rbegin(); it != picked.rend(); ++it) {
+        dictionary.insert(dictionary.end(), it->begin(), it->end());
+    }
+    return dictionary;
+}
+
+} // namespace compression
+
+#endif /* !COMPRESSIONCONTEXT_HPP_ */
@@ -0,0 +1,315 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SnapshotDelta - XOR delta encoding of game snapshots against an acked baseline
+*/
+
+#ifndef SNAPSHOTDELTA_HPP_
+#define SNAPSHOTDELTA_HPP_
+
+#include "Protocol.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+
+namespace compression {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Snapshot image layout
+// ═══════════════════════════════════════════════════════════════════════════════
+// Counts first, then every entity list with all of its MAX_* slots at a fixed
+// offset, unused slots zeroed. Unlike the variable-length payload, a missile
+// spawning does not shift the enemies after it, and entities mostly keep their
+// index from one tick to the next: XORing two images leaves zeros everywhere
+// but the fields that changed.
+
+static constexpr size_t IMAGE_COUNTS_SIZE = 9;  // 4 list counts, wave (2), has_boss, force/bit counts
+static constexpr size_t IMAGE_PLAYERS_OFFSET = IMAGE_COUNTS_SIZE;
+static constexpr size_t IMAGE_MISSILES_OFFSET = IMAGE_PLAYERS_OFFSET + MAX_PLAYERS * PlayerState::WIRE_SIZE;
+static constexpr size_t IMAGE_ENEMIES_OFFSET = IMAGE_MISSILES_OFFSET + MAX_MISSILES * MissileState::WIRE_SIZE;
+static constexpr size_t IMAGE_ENEMY_MISSILES_OFFSET = IMAGE_ENEMIES_OFFSET + MAX_ENEMIES * EnemyState::WIRE_SIZE;
+static constexpr size_t IMAGE_BOSS_OFFSET = IMAGE_ENEMY_MISSILES_OFFSET + MAX_ENEMY_MISSILES * MissileState::WIRE_SIZE;
+static constexpr size_t IMAGE_FORCES_OFFSET = IMAGE_BOSS_OFFSET + BossState::WIRE_SIZE;
+static constexpr size_t IMAGE_BITS_OFFSET = IMAGE_FORCES_OFFSET + MAX_PLAYERS * ForceStateSnapshot::WIRE_SIZE;
+static constexpr size_t SNAPSHOT_IMAGE_SIZE = IMAGE_BITS_OFFSET + MAX_BITS * BitDeviceStateSnapshot::WIRE_SIZE;
+
+// Each [unchanged][changed] token covers at least as many image bytes as it
+// takes, except the first one and those cut at 255 changed bytes
+static constexpr size_t SNAPSHOT_DELTA_BOUND = SNAPSHOT_IMAGE_SIZE + 2 * (SNAPSHOT_IMAGE_SIZE / 255 + 2);
+
+using SnapshotImage = std::array<uint8_t, SNAPSHOT_IMAGE_SIZE>;
+
+/**
+ * @brief Writes the fixed-slot image of a snapshot
+ */
+inline void toSnapshotImage(const GameSnapshot& snapshot, SnapshotImage& image) {
+    image.fill(0);
+    const uint8_t playerCount = std::min<uint8_t>(snapshot.player_count, MAX_PLAYERS);
+    const uint8_t missileCount = std::min<uint8_t>(snapshot.missile_count, MAX_MISSILES);
+    const uint8_t enemyCount = std::min<uint8_t>(snapshot.enemy_count, MAX_ENEMIES);
+    const uint8_t enemyMissileCount = std::min<uint8_t>(snapshot.enemy_missile_count, MAX_ENEMY_MISSILES);
+    const uint8_t forceCount = std::min<uint8_t>(snapshot.force_count, MAX_PLAYERS);
+    const uint8_t bitCount = std::min<uint8_t>(snapshot.bit_count, MAX_BITS);
+
+    uint8_t* buf = image.data();
+    buf[0] = playerCount;
+    buf[1] = missileCount;
+    buf[2] = enemyCount;
+    buf[3] = enemyMissileCount;
+    uint16_t net_wave = swap16(snapshot.wave_number);
+    std::memcpy(buf + 4, &net_wave, 2);
+    buf[6] = snapshot.has_boss ? 1 : 0;
+    buf[7] = forceCount;
+    buf[8] = bitCount;
+
+    for (uint8_t i = 0; i < playerCount; ++i) {
+        snapshot.players[i].to_bytes(buf + IMAGE_PLAYERS_OFFSET + i * PlayerState::WIRE_SIZE);
+    }
+    for (uint8_t i = 0; i < missileCount; ++i) {
+        snapshot.missiles[i].to_bytes(buf + IMAGE_MISSILES_OFFSET + i * MissileState::WIRE_SIZE);
+    }
+    for (uint8_t i = 0; i < enemyCount; ++i) {
+        snapshot.enemies[i].to_bytes(buf + IMAGE_ENEMIES_OFFSET + i * EnemyState::WIRE_SIZE);
+    }
+    for (uint8_t i = 0; i < enemyMissileCount; ++i) {
+        snapshot.enemy_missiles[i].to_bytes(buf + IMAGE_ENEMY_MISSILES_OFFSET + i * MissileState::WIRE_SIZE);
+    }
+    if (snapshot.has_boss) {
+        snapshot.boss_state.to_bytes(buf + IMAGE_BOSS_OFFSET);
+    }
+    for (uint8_t i = 0; i < forceCount; ++i) {
+        snapshot.forces[i].to_bytes(buf + IMAGE_FORCES_OFFSET + i * ForceStateSnapshot::WIRE_SIZE);
+    }
+    for (uint8_t i = 0; i < bitCount; ++i) {
+        snapshot.bits[i].to_bytes(buf + IMAGE_BITS_OFFSET + i * BitDeviceStateSnapshot::WIRE_SIZE);
+    }
+}
+
+/**
+ * @brief Reads a snapshot back from its image
+ * @return The snapshot, or std::nullopt if a count is out of range
+ */
+inline std::optional<GameSnapshot> fromSnapshotImage(const SnapshotImage& image) {
+    const uint8_t* buf = image.data();
+    GameSnapshot gs{};
+    gs.player_count = buf[0];
+    gs.missile_count = buf[1];
+    gs.enemy_count = buf[2];
+    gs.enemy_missile_count = buf[3];
+    uint16_t net_wave;
+    std::memcpy(&net_wave, buf + 4, 2);
+    gs.wave_number = swap16(net_wave);
+    gs.has_boss = buf[6];
+    gs.force_count = buf[7];
+    gs.bit_count = buf[8];
+    if (gs.player_count > MAX_PLAYERS || gs.missile_count > MAX_MISSILES || gs.enemy_count > MAX_ENEMIES
+        || gs.enemy_missile_count > MAX_ENEMY_MISSILES || gs.has_boss > 1
+        || gs.force_count > MAX_PLAYERS || gs.bit_count > MAX_BITS) {
+        return std::nullopt;
+    }
+
+    for (uint8_t i = 0; i < gs.player_count; ++i) {
+        auto psOpt = PlayerState::from_bytes(buf + IMAGE_PLAYERS_OFFSET + i * PlayerState::WIRE_SIZE, PlayerState::WIRE_SIZE);
+        if (!psOpt) {
+            return std::nullopt;
+        }
+        gs.players[i] = *psOpt;
+    }
+    for (uint8_t i = 0; i < gs.missile_count; ++i) {
+        auto msOpt = MissileState::from_bytes(buf + IMAGE_MISSILES_OFFSET + i * MissileState::WIRE_SIZE, MissileState::WIRE_SIZE);
+        if (!msOpt) {
+            return std::nullopt;
+        }
+        gs.missiles[i] = *msOpt;
+    }
+    for (uint8_t i = 0; i < gs.enemy_count; ++i) {
+        auto esOpt = EnemyState::from_bytes(buf + IMAGE_ENEMIES_OFFSET + i * EnemyState::WIRE_SIZE, EnemyState::WIRE_SIZE);
+        if (!esOpt) {
+            return std::nullopt;
+        }
+        gs.enemies[i] = *esOpt;
+    }
+    for (uint8_t i = 0; i < gs.enemy_missile_count; ++i) {
+        auto msOpt = MissileState::from_bytes(buf + IMAGE_ENEMY_MISSILES_OFFSET + i * MissileState::WIRE_SIZE, MissileState::WIRE_SIZE);
+        if (!msOpt) {
+            return std::nullopt;
+        }
+        gs.enemy_missiles[i] = *msOpt;
+    }
+    if (gs.has_boss) {
+        auto bsOpt = BossState::from_bytes(buf + IMAGE_BOSS_OFFSET, BossState::WIRE_SIZE);
+        if (!bsOpt) {
+            return std::nullopt;
+        }
+        gs.boss_state = *bsOpt;
+    }
+    for (uint8_t i = 0; i < gs.force_count; ++i) {
+        auto fsOpt = ForceStateSnapshot::from_bytes(buf + IMAGE_FORCES_OFFSET + i * ForceStateSnapshot::WIRE_SIZE, ForceStateSnapshot::WIRE_SIZE);
+        if (!fsOpt) {
+            return std::nullopt;
+        }
+        gs.forces[i] = *fsOpt;
+    }
+    for (uint8_t i = 0; i < gs.bit_count; ++i) {
+        auto bsOpt = BitDeviceStateSnapshot::from_bytes(buf + IMAGE_BITS_OFFSET + i * BitDeviceStateSnapshot::WIRE_SIZE, BitDeviceStateSnapshot::WIRE_SIZE);
+        if (!bsOpt) {
+            return std::nullopt;
+        }
+        gs.bits[i] = *bsOpt;
+    }
+    return gs;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Delta encoding
+// ═══════════════════════════════════════════════════════════════════════════════
+// The delta is target XOR baseline, written as [unchanged count][changed count]
+// tokens followed by the changed (XORed) bytes, counts being one byte each.
+// Unchanged bytes after the last token are implied.
+
+/**
+ * @brief Encodes target against baseline into dst (no allocation)
+ * @param dstCapacity Size of dst, SNAPSHOT_DELTA_BOUND always fits
+ * @return Encoded size (0 when nothing changed), or SIZE_MAX if dst is too small
+ */
+inline size_t encodeSnapshotDelta(const SnapshotImage& baseline, const SnapshotImage& target,
+                                  uint8_t* dst, size_t dstCapacity) {
+    size_t out = 0;
+    size_t pos = 0;
+    while (pos < SNAPSHOT_IMAGE_SIZE) {
+        size_t next = pos;
+        while (next < SNAPSHOT_IMAGE_SIZE && baseline[next] == target[next]) {
+            next++;
+        }
+        if (next == SNAPSHOT_IMAGE_SIZE) {
+            break;  // Trailing unchanged bytes are implied
+        }
+
+        // Unchanged runs longer than a count byte take empty tokens
+        while (next - pos > 255) {
+            if (out + 2 > dstCapacity) {
+                return SIZE_MAX;
+            }
+            dst[out++] = 255;
+            dst[out++] = 0;
+            pos += 255;
+        }
+        size_t unchanged = next - pos;
+        pos = next;
+
+        // Changed run: a single unchanged byte is cheaper inline than a new token
+        size_t start = pos;
+        while (pos < SNAPSHOT_IMAGE_SIZE && pos - start < 255) {
+            if (baseline[pos] == target[pos]
+                && (pos + 1 == SNAPSHOT_IMAGE_SIZE || baseline[pos + 1] == target[pos + 1])) {
+                break;
+            }
+            pos++;
+        }
+        size_t changed = pos - start;
+
+        if (out + 2 + changed > dstCapacity) {
+            return SIZE_MAX;
+        }
+        dst[out++] = static_cast<uint8_t>(unchanged);
+        dst[out++] = static_cast<uint8_t>(changed);
+        for (size_t i = start; i < pos; i++) {
+            dst[out++] = baseline[i] ^ target[i];
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Rebuilds the target image from its baseline and an encoded delta
+ * @return false if the delta is malformed (out is then unspecified)
+ */
+inline bool decodeSnapshotDelta(const SnapshotImage& baseline, const uint8_t* src, size_t srcSize,
+                                SnapshotImage& out) {
+    out = baseline;
+    size_t pos = 0;
+    size_t in = 0;
+    while (in < srcSize) {
+        if (srcSize - in < 2) {
+            return false;
+        }
+        size_t unchanged = src[in];
+        size_t changed = src[in + 1];
+        in += 2;
+        pos += unchanged;
+        if (pos + changed > SNAPSHOT_IMAGE_SIZE || srcSize - in < changed) {
+            return false;
+        }
+        for (size_t i = 0; i < changed; i++) {
+            out[pos++] ^= src[in++];
+        }
+    }
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Snapshot history
+// ═══════════════════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Ring of the last CAPACITY snapshot images, by sequence number
+ *
+ * The server keeps one per room to encode deltas against whatever each client
+ * acked; the client keeps one to find the baseline of a received delta. An
+ * image is evicted CAPACITY sequences after it was stored, so a baseline older
+ * than that is simply not found and the server falls back to a full snapshot.
+ */
+class SnapshotHistory {
+public:
+    static constexpr size_t CAPACITY = 32;  // 1.6 s of snapshots at 20 Hz
+
+    /**
+     * @brief Slot for a new snapshot, replacing the one CAPACITY sequences back
+     */
+    SnapshotImage& store(uint16_t sequence) {
+        Entry& entry = _entries[sequence % CAPACITY];
+        entry.sequence = sequence;
+        entry.valid = true;
+        return entry.image;
+    }
+
+    const SnapshotImage* find(uint16_t sequence) const {
+        const Entry& entry = _entries[sequence % CAPACITY];
+        return entry.valid && entry.sequence == sequence ? &entry.image : nullptr;
+    }
+
+    // Drops the image that store(sequence) would replace
+    void forget(uint16_t sequence) {
+        _entries[sequence % CAPACITY].valid = false;
+    }
+
+    void clear() {
+        for (auto& entry : _entries) {
+            entry.valid = false;
+        }
+    }
+
+private:
+    struct Entry {
+        uint16_t sequence = 0;
+        bool valid = false;
+        SnapshotImage image;
+    };
+
+    std::array<Entry, CAPACITY> _entries{};
+};
+
+/**
+ * @brief Whether sequence a comes after b, across the 16-bit wrap
+ */
+inline bool isNewerSequence(uint16_t a, uint16_t b) {
+    return static_cast<int16_t>(static_cast<uint16_t>(a - b)) > 0;
+}
+
+} // namespace compression
+
+#endif /* !SNAPSHOTDELTA_HPP_ */
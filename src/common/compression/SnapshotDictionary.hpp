@@ -0,0 +1,288 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SnapshotDictionary - LZ4 dictionary shared by server and client for snapshot packets
+*/
+
+#ifndef SNAPSHOTDICTIONARY_HPP_
+#define SNAPSHOTDICTIONARY_HPP_
+
+#include <array>
+#include <cstdint>
+
+namespace compression {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Snapshot dictionary (SnapshotEncoding::Dictionary)
+// ═══════════════════════════════════════════════════════════════════════════════
+// Generated by trainDictionary(samples, 4096) over full snapshots recorded from
+// GameWorld sessions of 1 to 4 players (waves, boss, missiles, power-ups), in
+// both the byte (Snapshot) and bit-packed (SnapshotPacked) forms, each at least
+// MIN_COMPRESS_SIZE bytes.
+//
+// Part of the protocol: the server compresses with it and the client decodes
+// with it. Changing a single byte needs a new SnapshotEncoding.
+
+inline constexpr std::array<uint8_t, 4096> SNAPSHOT_DICTIONARY = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x14, 0x02, 0x67, 0x02, 0x1C, 0x23, 0x01, 0x00, 0x11,
+    0x01, 0x72, 0x02, 0x1C, 0x23, 0x01, 0x00, 0x16, 0x05, 0x61, 0x02, 0x19, 0x50, 0x04, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x14, 0x03, 0x7F, 0x01, 0x38, 0x23, 0x01, 0x00, 0x10,
+    0x00, 0x74, 0x03, 0x0C, 0x28, 0x00, 0x00, 0x16, 0x06, 0x41, 0x02, 0x12, 0x50, 0x04, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x14, 0x03, 0xF7, 0x00, 0x98, 0x23, 0x01, 0x00, 0x10,
+    0x01, 0x04, 0x03, 0x93, 0x28, 0x00, 0x00, 0x16, 0x06, 0xA1, 0x01, 0xEE, 0x50, 0x04, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x14, 0x06, 0xEF, 0x01, 0xE9, 0x23, 0x01, 0x00, 0x10, 0x04,
+    0x94, 0x03, 0x76, 0x28, 0x00, 0x00, 0x0A, 0x02, 0x2A, 0x00, 0x7D, 0x28, 0x00, 0x00, 0x09, 0x02,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0xC0, 0x0B, 0x2B, 0xB8, 0xE4, 0x3C, 0x50, 0x02, 0xB5, 0x60,
+    0xD1, 0x0A, 0x00, 0x00, 0x9D, 0x4D, 0xB8, 0x55, 0x04, 0x00, 0x21, 0x17, 0x2E, 0x5D, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x04, 0x00, 0x08, 0x0E, 0x92, 0xC0, 0x28, 0x00, 0x02,
+    0x47, 0xA4, 0x71, 0x4A, 0x00, 0x00, 0x9E, 0xED, 0xB4, 0x85, 0x04, 0x00, 0x21, 0x7F, 0x2D, 0xC5,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x28, 0x00, 0x66, 0xFD, 0x07, 0xC2, 0x80, 0x00, 0x1C, 0xCA, 0xE6,
+    0xA4, 0x64, 0xC0, 0x05, 0x41, 0x81, 0x22, 0x1E, 0x20, 0x01, 0x75, 0x7A, 0x87, 0x08, 0xC4, 0x00,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0x40, 0x0A, 0x16, 0x1A, 0x70, 0x50, 0x40, 0x02, 0x72, 0x64,
+    0x87, 0x08, 0xC4, 0x00, 0xA8, 0x57, 0x35, 0x22, 0x80, 0x00, 0x2B, 0x89, 0x46, 0x44, 0xF1, 0x40,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0x80, 0x06, 0x5B, 0xD1, 0x76, 0x1E, 0x20, 0x01, 0x61, 0xB4,
+    0x87, 0x08, 0xC4, 0x00, 0x5D, 0xF3, 0x21, 0xC2, 0x31, 0x00, 0x18, 0x9E, 0x28, 0x25, 0x41, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x28, 0x00, 0x4E, 0x3C, 0x88, 0x42, 0x31, 0x00, 0x15, 0xC5, 0x01,
+    0x3C, 0x78, 0x80, 0x02, 0xC0, 0x01, 0xA1, 0x3C, 0x50, 0x01, 0x43, 0x50, 0xC8, 0x86, 0x4C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0A, 0x01, 0x50, 0x01, 0x97, 0x23, 0x01, 0x00, 0x0E,
+    0x04, 0x6C, 0x02, 0x02, 0x28, 0x00, 0x00, 0x0B, 0x04, 0x23, 0x01, 0xA1, 0x3C, 0x05, 0x00, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0A, 0x04, 0xC5, 0x02, 0xE5, 0x23, 0x01, 0x00, 0x09,
+    0x03, 0xF6, 0x02, 0x4B, 0x28, 0x00, 0x00, 0x0B, 0x07, 0x3F, 0x01, 0xA1, 0x3C, 0x05, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x25, 0x04, 0xFA, 0x02, 0x52, 0x28, 0x00, 0x00, 0x20,
+    0x00, 0xA4, 0x02, 0x79, 0x28, 0x00, 0x00, 0x21, 0x02, 0x03, 0x02, 0x1C, 0x23, 0x01, 0x00, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x11, 0x00, 0xC2, 0x02, 0xAB, 0x28, 0x00, 0x00, 0x12,
+    0x02, 0x5C, 0x00, 0xE3, 0x19, 0x03, 0x00, 0x0F, 0x00, 0x34, 0x00, 0xDC, 0x28, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x09, 0x06, 0x11, 0x00, 0xFF, 0x23, 0x01, 0x00, 0x02,
+    0x00, 0x0C, 0x01, 0x7F, 0x28, 0x00, 0x00, 0x03, 0x00, 0x4C, 0x01, 0xCD, 0x28, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0x80, 0x04, 0xD3, 0x39, 0x92, 0x19, 0x30, 0x01, 0x46, 0x70,
+    0x8C, 0x46, 0x4C, 0x00, 0x38, 0xEE, 0x1C, 0x62, 0x80, 0x00, 0x0F, 0x6D, 0xE2, 0xCC, 0xF1, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x8A, 0x00, 0x8C, 0x50, 0x89, 0xBE, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x88, 0x9B, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xB4, 0x01, 0x40, 0x14, 0x01, 0x11, 0xBF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0A,
+    0x48, 0x50, 0x25, 0x46, 0x48, 0x37, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x41, 0xE0, 0xA0, 0x64, 0x83, 0x7B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x21, 0x05, 0x3B, 0x02, 0x3B, 0x50, 0x04, 0x00, 0x19,
+    0x01, 0xD4, 0x01, 0x66, 0x50, 0x04, 0x00, 0x23, 0x04, 0x4C, 0x02, 0x5D, 0x1E, 0x02, 0x00, 0x22,
+    0x02, 0x02, 0x00, 0x50, 0x01, 0x63, 0x28, 0x01, 0x10, 0x9A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x28, 0x00, 0x00, 0x64, 0x01, 0x10,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0x00, 0x03, 0x21, 0xF1, 0x1F, 0x23, 0x10, 0x00, 0xB6, 0x30,
+    0xC4, 0x4A, 0x00, 0x00, 0x3B, 0xA6, 0x21, 0xD2, 0x80, 0x00, 0x04, 0x00, 0x07, 0x9C, 0xA0, 0x00,
+    0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x8A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x81, 0x37, 0x26, 0x82, 0x80, 0x00, 0x21, 0x59, 0x8C, 0x14, 0xA0,
+    0x01, 0x01, 0x68, 0x00, 0xB4, 0x00, 0x00, 0x13, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x25, 0x04, 0x0A, 0x01, 0xB8, 0x28,
+    0x01, 0xFD, 0x00, 0x00, 0xF6, 0xFF, 0x02, 0x1A, 0x02, 0x30, 0x00, 0x00, 0xF9, 0xFF, 0x01, 0x48,
+    0x02, 0x19, 0x00, 0x00, 0xFB, 0xFF, 0x06, 0x6B, 0x02, 0x30, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x18, 0x00, 0x00, 0x02, 0x1C, 0x23, 0x01, 0x00, 0x20, 0x02,
+    0xFC, 0x02, 0x87, 0x28, 0x00, 0x00, 0x21, 0x03, 0xF7, 0x02, 0x1C, 0x23, 0x01, 0x00, 0x1F, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x00, 0x00, 0x02, 0x1C, 0x23, 0x01, 0x00, 0x0D,
+    0x00, 0x8D, 0x02, 0x8E, 0x1E, 0x02, 0x00, 0x0B, 0x00, 0xB0, 0x01, 0x12, 0x28, 0x00, 0x00, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x09, 0x04, 0xA9, 0x00, 0x00, 0x23, 0x01, 0x00, 0x08,
+    0x03, 0xBC, 0x02, 0x61, 0x28, 0x00, 0x00, 0x0B, 0x06, 0x62, 0x00, 0x9E, 0x28, 0x00, 0x00, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x05, 0xDF, 0x00, 0xB4, 0x23, 0x01, 0x00, 0x08,
+    0x05, 0x30, 0x02, 0x97, 0x28, 0x00, 0x00, 0x03, 0x00, 0x10, 0x01, 0xF3, 0x28, 0x00, 0x00, 0x04,
+    0x02, 0x00, 0x50, 0x01, 0xB6, 0x00, 0x00, 0x14, 0xEA, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE7, 0x00, 0x6F, 0x3C, 0x01, 0x14, 0xE9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x01, 0xC2, 0x02, 0x1C, 0x23, 0x01,
+    0x00, 0x08, 0x00, 0x44, 0x02, 0x79, 0x28, 0x00, 0x00, 0x0A, 0x03, 0x9C, 0x01, 0x0F, 0x3C, 0x05,
+    0x00, 0x50, 0x00, 0x00, 0xC2, 0x70, 0x12, 0x00, 0x28, 0xB7, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x08, 0x87, 0x07, 0x80, 0x02, 0x8B, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0x00, 0x05, 0x40, 0xF9, 0xDD, 0x1E, 0x20, 0x01, 0x64, 0xD4,
+    0x87, 0x08, 0xC4, 0x00, 0x5E, 0xBB, 0x21, 0xC2, 0x31, 0x00, 0x0F, 0x01, 0xE2, 0xCC, 0xF1, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x83, 0x68, 0x00, 0x50, 0x86, 0xEE, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x04, 0x64, 0x00, 0x06, 0x48, 0x6E, 0xD9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x45, 0xA0, 0x00, 0x64, 0x84, 0x74, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0xDC, 0x0C, 0xD2, 0x80, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x0C, 0x02, 0xAC, 0x28, 0x00, 0x00, 0x14,
+    0x02, 0xAC, 0x02, 0xCE, 0x28, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x0F, 0x3C, 0x05, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xC0, 0xA0, 0x00, 0x50, 0x8D, 0xE7, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x08, 0x6E, 0x1A, 0x45, 0x08, 0xDE, 0x71, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xC3, 0x20, 0x3C, 0x64, 0x8D, 0x87, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x08, 0x96, 0x1F, 0x45, 0x08, 0xD8, 0x71, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x12, 0x72, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0xAD, 0x6D, 0xA3, 0x21, 0xE2, 0x00, 0x27, 0x4D, 0x43, 0x80, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x06, 0xD6, 0x01, 0x36, 0x23, 0x01, 0x00, 0x0E,
+    0x01, 0xBA, 0x02, 0x6E, 0x28, 0x00, 0x00, 0x0B, 0x02, 0x1D, 0x01, 0xA1, 0x3C, 0x05, 0x00, 0x14,
+    0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x13, 0xDA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x2C, 0x00, 0xCB, 0x30, 0x1E, 0x21, 0xE2, 0x00, 0x33, 0xDB, 0x8C, 0xE4, 0xA0,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0xC0, 0x06, 0x05, 0x32, 0x1C, 0x23, 0x10, 0x02, 0x07, 0xD8,
+    0x9F, 0x0A, 0x00, 0x00, 0x86, 0x5F, 0xA1, 0xC2, 0x31, 0x00, 0x1F, 0x73, 0x49, 0x5C, 0xA0, 0x00,
+    0x02, 0x00, 0x50, 0x01, 0xB6, 0x00, 0x00, 0x13, 0x6A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x54, 0x00, 0x87, 0x3C, 0x01, 0x13, 0x69,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0xC2, 0x00, 0x85, 0x28, 0x00, 0x00, 0x02,
+    0x01, 0x44, 0x01, 0x0B, 0x28, 0x00, 0x00, 0x03, 0x01, 0x7C, 0x01, 0xB1, 0x28, 0x00, 0x00, 0x04,
+    0x00, 0x50, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x64, 0x8B, 0x17, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x08, 0x64, 0x12, 0xC6, 0x48, 0xB1, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x64, 0x8A, 0x57, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x08, 0x70, 0x04, 0x86, 0x48, 0xA5, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0D, 0x32, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x34, 0x00, 0x4C, 0x5C, 0xA1, 0xC2, 0x31, 0x00, 0x15, 0x1D, 0x00, 0x4C, 0x78,
+    0x02, 0x41, 0x00, 0x01, 0x13, 0xFF, 0x06, 0x94, 0x01, 0x0F, 0x00, 0x01, 0x12, 0xFF, 0x06, 0x94,
+    0x00, 0xFF, 0x00, 0x01, 0x15, 0xFF, 0x03, 0x82, 0x02, 0x30, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x68, 0x01, 0x54, 0x00, 0x00, 0x25, 0xF9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x21, 0x02, 0x9B, 0x02, 0x94, 0x50,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x64, 0x01, 0x10, 0x39, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x08, 0x00, 0xFD,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x64, 0x8B, 0x77, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x08, 0x8E, 0x12, 0xC6, 0x48, 0xB7, 0x71, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0xC0, 0x00, 0xF0, 0x64, 0x86, 0x67, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x08, 0x46, 0x14, 0x06, 0x48, 0x66, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xC0, 0x01, 0x50, 0x64, 0x86, 0x37, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x08, 0x4E, 0x11, 0x46, 0x48, 0x63, 0x71, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0x00, 0x0A, 0x21, 0x1A, 0x1E, 0x50, 0x40, 0x02, 0x75, 0xD4,
+    0x87, 0x08, 0xC4, 0x00, 0xA9, 0x5F, 0x31, 0x22, 0x80, 0x00, 0x2B, 0xBA, 0xC6, 0x44, 0xF1, 0x40,
+    0x01, 0x01, 0x68, 0x00, 0xB4, 0x00, 0x00, 0x0E, 0xAA, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x18, 0x04, 0x66, 0x02, 0x1C, 0x23,
+    0x24, 0x00, 0x15, 0x41, 0x48, 0x2E, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x01, 0xC0, 0x02, 0x72, 0xC9, 0x54, 0x23, 0x10, 0x00, 0x8B, 0x8C, 0x95, 0x4A, 0x00, 0x00, 0x0C,
+    0x00, 0x50, 0x00, 0x00, 0xC2, 0x70, 0x12, 0x00, 0x10, 0x27, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x08, 0xAA, 0x11, 0x85, 0x09, 0x02, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x80, 0x01, 0x40, 0x64, 0x84, 0x66, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x04, 0x50, 0x04, 0xC6, 0x48, 0x46, 0x59, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x14, 0x52, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0xCA, 0xA4, 0x1E, 0xC1, 0xE2, 0x00, 0x33, 0xBD, 0x8C, 0x10, 0xA0,
+    0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0xC2, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x34, 0x00, 0x80, 0x00, 0x2B, 0xB2, 0x80, 0x00, 0x21, 0x0B, 0x8C, 0xC4, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x02, 0xE0, 0x01, 0x7C, 0x23, 0x01, 0x00, 0x09,
+    0x01, 0xB0, 0x02, 0xA8, 0x28, 0x00, 0x00, 0x0B, 0x05, 0x8B, 0x01, 0xA1, 0x3C, 0x05, 0x00, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0x00, 0xE6, 0x00, 0xC2, 0x28, 0x00, 0x00, 0x02,
+    0x01, 0x50, 0x01, 0x89, 0x28, 0x00, 0x00, 0x03, 0x01, 0x90, 0x02, 0x1B, 0x28, 0x00, 0x00, 0x04,
+    0x50, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x27, 0xF6, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x2C, 0x00, 0xB2, 0x03, 0x38, 0x23, 0xC5, 0x00, 0x2F, 0xBD, 0x03, 0x9C, 0xA0,
+    0x50, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x12, 0xC6, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x28, 0x00, 0x03, 0xC2, 0x31, 0x00, 0x12, 0xB8, 0x4A, 0x60, 0xA0,
+    0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x11, 0x22, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0xAE, 0xF5, 0xAA, 0xA1, 0xE2, 0x00, 0x27, 0xA1, 0x44, 0x04, 0xA0,
+    0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0E, 0xCA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x34, 0x00, 0x81, 0xF7, 0x29, 0x02, 0x80, 0x00, 0x21, 0x89, 0x8C, 0xB8, 0xA0,
+    0x01, 0x01, 0x68, 0x01, 0x54, 0x00, 0x00, 0x20, 0xB9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x1D, 0x00, 0x61, 0x02, 0xB0, 0x1E,
+    0x01, 0x00, 0x3C, 0x01, 0x9C, 0x00, 0x00, 0x09, 0xA9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x09, 0x00, 0x00, 0x02, 0x1C, 0x23,
+    0x50, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x1B, 0x66, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x2C, 0x00, 0x66, 0x55, 0x0B, 0x02, 0x80, 0x00, 0x1C, 0x7D, 0xE6, 0xAC, 0x64,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xC1, 0x20, 0x70, 0x64, 0x88, 0xD7, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x08, 0x12, 0x0F, 0x06, 0x48, 0x8D, 0x71, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x08, 0x46, 0x18, 0x86, 0x48, 0x69, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x00, 0x4D, 0x21, 0x04, 0x3C, 0x86, 0x96, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x01, 0x01, 0x68, 0x00, 0xB4, 0x00, 0x00, 0x10, 0x8A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x18, 0x01, 0x46, 0x02, 0x1C, 0x23,
+    0x50, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x1C, 0xE6, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x65, 0x95, 0x0D, 0x92, 0x80, 0x00, 0x1C, 0x25, 0xE7, 0x78, 0x64,
+    0x00, 0x50, 0x00, 0x00, 0xC2, 0x70, 0x12, 0x00, 0x12, 0xC7, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x08, 0x78, 0x03, 0xC1, 0x49, 0x2C, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xC3, 0xC0, 0x3C, 0x64, 0x8C, 0xF7, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x08, 0xA0, 0x1B, 0x85, 0x08, 0xCF, 0x71, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0x00, 0x00, 0x58, 0x10, 0x76, 0x28, 0x00, 0x00, 0x26, 0x50,
+    0x57, 0x0A, 0x00, 0x00, 0x0D, 0xC8, 0x18, 0xB2, 0x80, 0x00, 0x04, 0x7D, 0x89, 0x34, 0xA0, 0x00,
+    0x14, 0x2A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x04, 0x00, 0xD8, 0x3C, 0x01, 0x14, 0x29, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x16, 0x56, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x44, 0xFC, 0x1A, 0x32, 0x80, 0x00, 0x12, 0x46, 0x49, 0x10, 0xA0,
+    0x24, 0xB4, 0x0B, 0x40, 0x00, 0x3E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x02, 0x80, 0x02, 0x54, 0xBA, 0x12, 0x23, 0x10, 0x00, 0x82, 0x80, 0x9B, 0x8A, 0x00, 0x00, 0x2D,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0x80, 0x0B, 0x14, 0x18, 0xE4, 0x3C, 0x50, 0x03, 0x59,
+    0xE8, 0x39, 0xC6, 0x4C, 0x00, 0x9C, 0x00, 0x39, 0xB5, 0x04, 0x00, 0x32, 0x9C, 0x48, 0x70, 0xA0,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x68, 0x64, 0x01, 0x08, 0x97,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x01, 0x01, 0x68, 0x00, 0xB4, 0x00, 0x00, 0x14, 0x86, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x25, 0x01, 0x0A, 0x01, 0xC1, 0x28,
+    0x01, 0x01, 0x68, 0x00, 0xB4, 0x00, 0x00, 0x12, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x25, 0x05, 0xEA, 0x01, 0xBC, 0x28,
+    0x01, 0x01, 0x68, 0x01, 0x54, 0x00, 0x00, 0x1F, 0x69, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1D, 0x01, 0xE9, 0x03, 0x3C, 0x1E,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0xC0, 0x08, 0xEB, 0x92, 0x88, 0x1E, 0x20, 0x02, 0x16, 0xF4,
+    0xDF, 0x4A, 0x00, 0x00, 0x8A, 0x82, 0x0C, 0xD1, 0xE2, 0x00, 0x18, 0x36, 0x29, 0x0D, 0x41, 0x00,
+    0x01, 0x01, 0x68, 0x01, 0x54, 0x00, 0x00, 0x1B, 0xD9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1D, 0x06, 0x11, 0x02, 0xF6, 0x1E,
+    0x01, 0x01, 0x68, 0x01, 0x54, 0x00, 0x00, 0x19, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x01, 0x27, 0x02, 0x1C, 0x23,
+    0x50, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x0E, 0x16, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x29, 0xEC, 0x80, 0x02, 0x31, 0x00, 0x09, 0x72, 0x20, 0x00, 0x8C,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x49, 0x00, 0xD0, 0x14, 0x87, 0xB6, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x18, 0x00, 0x05, 0xA0, 0x0B, 0x72, 0x80, 0x00, 0x02,
+    0x01, 0x01, 0x68, 0x01, 0x54, 0x00, 0x00, 0x22, 0x99, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x21, 0x04, 0xDB, 0x02, 0x49, 0x50,
+    0x01, 0x00, 0x3C, 0x01, 0x9C, 0x00, 0x00, 0x08, 0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x09, 0x02, 0x12, 0x02, 0x1C, 0x23,
+    0x50, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x24, 0x36, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x38, 0x00, 0x90, 0xA4, 0x24, 0x72, 0x80, 0x00, 0x21, 0x35, 0x28, 0x70, 0x8C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2C, 0x00, 0x78, 0x3C, 0x01, 0x15, 0x49, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x14,
+    0x88, 0x47, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x08, 0x00, 0x14, 0x06, 0x48,
+    0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x42, 0x80, 0x00, 0x14, 0x88,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0x00, 0x07, 0x80, 0x00, 0x85, 0x3C, 0x50, 0x02, 0x7C,
+    0x64, 0x87, 0x08, 0xC4, 0x00, 0xAB, 0x57, 0x2C, 0xD2, 0x80, 0x00, 0x26, 0x72, 0xE4, 0x84, 0x64,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0x40, 0x08, 0xF9, 0x92, 0x9C, 0x1E, 0x20, 0x02, 0x19,
+    0xF4, 0xDB, 0x0A, 0x00, 0x00, 0x5C, 0x8B, 0x21, 0xC2, 0x31, 0x00, 0x18, 0x56, 0x29, 0x3D, 0x41,
+    0x50, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x0D, 0x26, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x1C, 0x00, 0x2A, 0x50, 0x83, 0xC2, 0x31, 0x00, 0x09, 0x8B, 0x20, 0xF0, 0x8C,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x43, 0x20, 0x78, 0x14, 0x8A, 0x86, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x28, 0x00, 0x04, 0x38, 0x0C, 0x32, 0x80, 0x00, 0x02,
+    0x02, 0x02, 0x00, 0x4E, 0x03, 0x5C, 0x00, 0x00, 0x0E, 0x1E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xA4, 0x01, 0x7C, 0x50, 0x01, 0x0E,
+    0x6C, 0x1E, 0x0E, 0xC5, 0x08, 0x95, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x86, 0x40, 0x64, 0x50, 0x89, 0x52, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x04,
+    0x6C, 0x00, 0x12, 0x95, 0x08, 0x8E, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x88, 0xC0, 0xB4, 0x50, 0x88, 0xE6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x04,
+    0x01, 0x00, 0x3C, 0x01, 0x9C, 0x00, 0x00, 0x07, 0xC9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x09, 0x03, 0x02, 0x02, 0x1C, 0x23,
+    0x50, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x11, 0xD6, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x28, 0x5C, 0x90, 0xC2, 0x31, 0x00, 0x09, 0x0E, 0x24, 0x30, 0x8C,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x88, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x02, 0x40, 0x08, 0xC5, 0x12, 0x06, 0x1E, 0x20, 0x02, 0x7D, 0xF4, 0x87, 0x08, 0xC4,
+    0x01, 0x01, 0x68, 0x01, 0x54, 0x00, 0x00, 0x18, 0x19, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x14, 0x01, 0xEF, 0x02, 0x1C, 0x23,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x10, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x01, 0x80, 0x06, 0x64, 0x91, 0x58, 0x1E, 0x20, 0x01, 0x63, 0x44, 0x87, 0x08, 0xC4,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x4B, 0xE1, 0xB8, 0x64, 0x85, 0x76, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x18, 0x00, 0x06, 0xC0, 0x0F, 0x02, 0x80, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x78, 0x64, 0x01, 0x05, 0x89, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x05, 0x18,
+    0x48, 0x75, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x85, 0x00, 0x00, 0x50,
+    0x87, 0x5A, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x04, 0x1E, 0x00, 0x06, 0x48,
+    0x01, 0x01, 0x68, 0x01, 0x54, 0x00, 0x00, 0x21, 0x79, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x21, 0x05, 0x9B, 0x02, 0x44, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x47, 0x80, 0x00, 0x14, 0x8C, 0x06, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x20, 0x00, 0x2A, 0xC8, 0x80, 0x02, 0x31, 0x00, 0x09,
+    0x50, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x23, 0xA6, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x34, 0x00, 0x90, 0xEC, 0x1F, 0x62, 0x80, 0x00, 0x21, 0x44, 0x28, 0x70, 0x8C,
+    0x01, 0x01, 0x68, 0x00, 0xB4, 0x00, 0x00, 0x0C, 0xFA, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x07, 0x36, 0x02, 0x1C, 0x23,
+    0x01, 0x01, 0x68, 0x00, 0xB4, 0x00, 0x00, 0x0D, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x18, 0x05, 0xF6, 0x02, 0x1C, 0x23,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x64, 0x89, 0x97, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x08, 0x5A, 0x00, 0x06, 0x48, 0x99, 0x71, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x83, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x02, 0x80, 0x08, 0xC8, 0x92, 0x56, 0x1E, 0x20, 0x02, 0x7E, 0x94, 0x6E, 0x88, 0xC4,
+    0x50, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x29, 0x46, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x2C, 0x00, 0xB1, 0x85, 0x38, 0x23, 0xC5, 0x00, 0x2F, 0x93, 0x04, 0xB0, 0xA0,
+    0xC2, 0x88, 0x58, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x4E, 0xA8, 0x31,
+    0x64, 0x85, 0x8E, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x24, 0x00, 0x2A,
+    0x01, 0x01, 0x00, 0x3C, 0x01, 0x9C, 0x00, 0x00, 0x0C, 0x3A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x18, 0x03, 0x9F, 0x01, 0x65,
+    0x02, 0x02, 0x00, 0x50, 0x01, 0xB6, 0x00, 0x00, 0x12, 0x1A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xA0, 0x50, 0x01, 0x12,
+    0x24, 0x1E, 0x19, 0xC0, 0x00, 0x75, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x03, 0x00, 0x08, 0x2C, 0x93, 0x08, 0x28, 0x00, 0x01, 0xA0, 0x00, 0xBB, 0x4A, 0x00, 0x00, 0x64,
+    0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xCD, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x00, 0x00, 0x02, 0xC0, 0x03, 0x00, 0x00, 0x96, 0x23, 0x10, 0x01, 0x47, 0x20, 0x7E, 0x86,
+    0x01, 0x01, 0x01, 0x68, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0xCA, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x18, 0x02, 0x86, 0x02, 0x1C,
+    0x02, 0x10, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xC2, 0x70, 0x12, 0x00,
+    0x21, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x08, 0x87, 0x07, 0x80, 0x02,
+    0xC0, 0x00, 0xC1, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x0C, 0x12, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x28, 0x00, 0x4D,
+    0x01, 0x34, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x89, 0x58, 0x00, 0x00,
+    0x13, 0x4E, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x14, 0xA7, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x08, 0x87, 0x07, 0x80, 0x01,
+    0x4A, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x48, 0xB8, 0x00, 0x00, 0x14,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x68, 0x01, 0x54, 0x00, 0x00, 0x17, 0xE9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
+};
+
+} // namespace compression
+
+#endif /* !SNAPSHOTDICTIONARY_HPP_ */
@@ -0,0 +1,121 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BitPacking - Bit-level writer/reader with per-field quantization ranges
+*/
+
+#ifndef BITPACKING_HPP_
+#define BITPACKING_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+/**
+ * Inclusive [min, max] range of an integer field. A value in range takes
+ * bits() bits on the wire and comes back exactly; values outside are
+ * clamped to the nearest bound.
+ */
+struct FieldRange {
+    uint32_t min;
+    uint32_t max;
+
+    constexpr unsigned bits() const {
+        unsigned n = 0;
+        for (uint64_t span = static_cast<uint64_t>(max) - min; span > 0; span >>= 1) {
+            n++;
+        }
+        return n;
+    }
+};
+
+/**
+ * Writes fields MSB-first into a caller-provided buffer (no allocation).
+ * Writing past the capacity sets overflowed() instead of touching memory.
+ */
+class BitWriter {
+public:
+    BitWriter(uint8_t* buf, size_t capacity) : _buf(buf), _capacity(capacity) {}
+
+    void write(uint32_t value, unsigned bits) {
+        if (_bitPos + bits > _capacity * 8) {
+            _overflow = true;
+            return;
+        }
+        for (unsigned i = bits; i-- > 0;) {
+            size_t byte = _bitPos >> 3;
+            uint8_t mask = static_cast<uint8_t>(0x80u >> (_bitPos & 7));
+            if ((_bitPos & 7) == 0) {
+                _buf[byte] = 0;  // First bit of a fresh byte: no stale bits left behind
+            }
+            if ((value >> i) & 1u) {
+                _buf[byte] |= mask;
+            }
+            _bitPos++;
+        }
+    }
+
+    void write(uint32_t value, FieldRange range) {
+        uint32_t clamped = std::clamp(value, range.min, range.max);
+        write(clamped - range.min, range.bits());
+    }
+
+    void writeBool(bool value) { write(value ? 1u : 0u, 1); }
+
+    // Bytes used so far, the last one zero-padded
+    size_t size() const { return (_bitPos + 7) / 8; }
+    bool overflowed() const { return _overflow; }
+
+private:
+    uint8_t* _buf;
+    size_t _capacity;
+    size_t _bitPos = 0;
+    bool _overflow = false;
+};
+
+/**
+ * Reads what BitWriter wrote. Reading past the end returns std::nullopt.
+ */
+class BitReader {
+public:
+    BitReader(const uint8_t* buf, size_t len) : _buf(buf), _len(len) {}
+
+    std::optional<uint32_t> read(unsigned bits) {
+        if (_bitPos + bits > _len * 8) {
+            return std::nullopt;
+        }
+        uint32_t value = 0;
+        for (unsigned i = 0; i < bits; i++) {
+            uint8_t byte = _buf[_bitPos >> 3];
+            value = (value << 1) | ((byte >> (7 - (_bitPos & 7))) & 1u);
+            _bitPos++;
+        }
+        return value;
+    }
+
+    // Out-of-range raw values (a corrupt packet) are rejected, not clamped
+    std::optional<uint32_t> read(FieldRange range) {
+        auto raw = read(range.bits());
+        if (!raw || *raw > range.max - range.min) {
+            return std::nullopt;
+        }
+        return *raw + range.min;
+    }
+
+    std::optional<bool> readBool() {
+        auto bit = read(1);
+        if (!bit) {
+            return std::nullopt;
+        }
+        return *bit != 0;
+    }
+
+private:
+    const uint8_t* _buf;
+    size_t _len;
+    size_t _bitPos = 0;
+};
+
+#endif /* !BITPACKING_HPP_ */
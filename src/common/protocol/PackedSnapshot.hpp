@@ -0,0 +1,355 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** PackedSnapshot - Quantized, bit-packed GameSnapshot encoding (SnapshotEncoding::Packed)
+*/
+
+#ifndef PACKEDSNAPSHOT_HPP_
+#define PACKEDSNAPSHOT_HPP_
+
+#include "Protocol.hpp"
+#include "BitPacking.hpp"
+#include <optional>
+
+// ============================================================================
+// Field ranges
+// ============================================================================
+// Sized for what the server actually sends: every value GameWorld produces
+// round-trips exactly. Positions fit a 2048×2048 grid (the 1920×1080 screen
+// plus the off-screen spawn and exit margins).
+
+namespace packed {
+    inline constexpr FieldRange PLAYER_COUNT{0, MAX_PLAYERS};
+    inline constexpr FieldRange MISSILE_COUNT{0, MAX_MISSILES};
+    inline constexpr FieldRange ENEMY_COUNT{0, MAX_ENEMIES};
+    inline constexpr FieldRange ENEMY_MISSILE_COUNT{0, MAX_ENEMY_MISSILES};
+    inline constexpr FieldRange BIT_COUNT{0, MAX_BITS};
+
+    inline constexpr FieldRange POSITION{0, 2047};                  // 11 bits
+    inline constexpr FieldRange PLAYER_ID{0, 7};
+    inline constexpr FieldRange OWNER_ID{0, 255};                   // Players, or ENEMY_OWNER_ID
+    inline constexpr FieldRange ENTITY_ID{0, UINT16_MAX};
+    inline constexpr FieldRange HEALTH{0, 255};
+    inline constexpr FieldRange SEQUENCE{0, UINT16_MAX};
+    inline constexpr FieldRange SHIP_SKIN{0, 7};                    // 1-6
+    inline constexpr FieldRange SCORE{0, UINT32_MAX};
+    inline constexpr FieldRange KILLS{0, UINT16_MAX};
+    inline constexpr FieldRange COMBO{0, 31};                       // x10, max 30
+    inline constexpr FieldRange WEAPON{0, 7};                       // WeaponType
+    inline constexpr FieldRange LEVEL{0, 3};                        // Charge, speed and weapon levels
+    inline constexpr FieldRange SHIELD_TIMER{0, 255};
+    inline constexpr FieldRange ENEMY_TYPE{0, 15};
+    inline constexpr FieldRange WAVE{0, UINT16_MAX};
+    inline constexpr FieldRange BOSS_HEALTH{0, UINT16_MAX};
+    inline constexpr FieldRange BOSS_PHASE{0, 3};
+    inline constexpr FieldRange FORCE_LEVEL{0, 3};
+    inline constexpr FieldRange BIT_INDEX{0, 1};
+
+    inline constexpr unsigned PLAYER_BITS = PLAYER_ID.bits() + 2 * POSITION.bits() + HEALTH.bits() + 1
+        + SEQUENCE.bits() + SHIP_SKIN.bits() + SCORE.bits() + KILLS.bits() + COMBO.bits() + WEAPON.bits()
+        + 3 * LEVEL.bits() + 1 + SHIELD_TIMER.bits();
+    inline constexpr unsigned MISSILE_BITS = ENTITY_ID.bits() + OWNER_ID.bits() + 2 * POSITION.bits() + WEAPON.bits();
+    inline constexpr unsigned ENEMY_BITS = ENTITY_ID.bits() + 2 * POSITION.bits() + HEALTH.bits() + ENEMY_TYPE.bits();
+    inline constexpr unsigned BOSS_BITS = ENTITY_ID.bits() + 2 * POSITION.bits() + 2 * BOSS_HEALTH.bits()
+        + BOSS_PHASE.bits() + 1;
+    inline constexpr unsigned FORCE_BITS = OWNER_ID.bits() + 2 * POSITION.bits() + 1 + FORCE_LEVEL.bits();
+    inline constexpr unsigned BIT_DEVICE_BITS = OWNER_ID.bits() + BIT_INDEX.bits() + 2 * POSITION.bits();
+
+    inline constexpr unsigned MAX_SNAPSHOT_BITS =
+        PLAYER_COUNT.bits() + MAX_PLAYERS * PLAYER_BITS
+        + MISSILE_COUNT.bits() + MAX_MISSILES * MISSILE_BITS
+        + ENEMY_COUNT.bits() + MAX_ENEMIES * ENEMY_BITS
+        + ENEMY_MISSILE_COUNT.bits() + MAX_ENEMY_MISSILES * MISSILE_BITS
+        + WAVE.bits() + 1 + BOSS_BITS
+        + PLAYER_COUNT.bits() + MAX_PLAYERS * FORCE_BITS
+        + BIT_COUNT.bits() + MAX_BITS * BIT_DEVICE_BITS;
+}
+
+// Largest packed snapshot, the buffer size that always fits
+static constexpr size_t PACKED_SNAPSHOT_MAX_SIZE = (packed::MAX_SNAPSHOT_BITS + 7) / 8;
+
+// ============================================================================
+// Encoding
+// ============================================================================
+
+namespace packed {
+    inline void writeMissile(BitWriter& w, const MissileState& ms) {
+        w.write(ms.id, ENTITY_ID);
+        w.write(ms.owner_id, OWNER_ID);
+        w.write(ms.x, POSITION);
+        w.write(ms.y, POSITION);
+        w.write(ms.weapon_type, WEAPON);
+    }
+
+    inline std::optional<MissileState> readMissile(BitReader& r) {
+        auto id = r.read(ENTITY_ID);
+        auto owner = r.read(OWNER_ID);
+        auto x = r.read(POSITION);
+        auto y = r.read(POSITION);
+        auto weapon = r.read(WEAPON);
+        if (!id || !owner || !x || !y || !weapon) return std::nullopt;
+        return MissileState{
+            .id = static_cast<uint16_t>(*id),
+            .owner_id = static_cast<uint8_t>(*owner),
+            .x = static_cast<uint16_t>(*x),
+            .y = static_cast<uint16_t>(*y),
+            .weapon_type = static_cast<uint8_t>(*weapon)
+        };
+    }
+}
+
+/**
+ * @brief Bit-packs a snapshot into buf
+ * @param capacity Size of buf, PACKED_SNAPSHOT_MAX_SIZE always fits
+ * @return Packed size, or 0 if buf is too small
+ *
+ * Fields are written in GameSnapshot order with the ranges above; a value
+ * outside its range is clamped.
+ */
+inline size_t packSnapshot(const GameSnapshot& gs, uint8_t* buf, size_t capacity) {
+    using namespace packed;
+    BitWriter w(buf, capacity);
+
+    const uint8_t playerCount = std::min<uint8_t>(gs.player_count, MAX_PLAYERS);
+    w.write(playerCount, PLAYER_COUNT);
+    for (uint8_t i = 0; i < playerCount; ++i) {
+        const PlayerState& ps = gs.players[i];
+        w.write(ps.id, PLAYER_ID);
+        w.write(ps.x, POSITION);
+        w.write(ps.y, POSITION);
+        w.write(ps.health, HEALTH);
+        w.writeBool(ps.alive != 0);
+        w.write(ps.lastAckedInputSeq, SEQUENCE);
+        w.write(ps.shipSkin, SHIP_SKIN);
+        w.write(ps.score, SCORE);
+        w.write(ps.kills, KILLS);
+        w.write(ps.combo, COMBO);
+        w.write(ps.currentWeapon, WEAPON);
+        w.write(ps.chargeLevel, LEVEL);
+        w.write(ps.speedLevel, LEVEL);
+        w.write(ps.weaponLevel, LEVEL);
+        w.writeBool(ps.hasForce != 0);
+        w.write(ps.shieldTimer, SHIELD_TIMER);
+    }
+
+    const uint8_t missileCount = std::min<uint8_t>(gs.missile_count, MAX_MISSILES);
+    w.write(missileCount, MISSILE_COUNT);
+    for (uint8_t i = 0; i < missileCount; ++i) {
+        writeMissile(w, gs.missiles[i]);
+    }
+
+    const uint8_t enemyCount = std::min<uint8_t>(gs.enemy_count, MAX_ENEMIES);
+    w.write(enemyCount, ENEMY_COUNT);
+    for (uint8_t i = 0; i < enemyCount; ++i) {
+        const EnemyState& es = gs.enemies[i];
+        w.write(es.id, ENTITY_ID);
+        w.write(es.x, POSITION);
+        w.write(es.y, POSITION);
+        w.write(es.health, HEALTH);
+        w.write(es.enemy_type, ENEMY_TYPE);
+    }
+
+    const uint8_t enemyMissileCount = std::min<uint8_t>(gs.enemy_missile_count, MAX_ENEMY_MISSILES);
+    w.write(enemyMissileCount, ENEMY_MISSILE_COUNT);
+    for (uint8_t i = 0; i < enemyMissileCount; ++i) {
+        writeMissile(w, gs.enemy_missiles[i]);
+    }
+
+    w.write(gs.wave_number, WAVE);
+    w.writeBool(gs.has_boss != 0);
+    if (gs.has_boss) {
+        const BossState& bs = gs.boss_state;
+        w.write(bs.id, ENTITY_ID);
+        w.write(bs.x, POSITION);
+        w.write(bs.y, POSITION);
+        w.write(bs.max_health, BOSS_HEALTH);
+        w.write(bs.health, BOSS_HEALTH);
+        w.write(bs.phase, BOSS_PHASE);
+        w.writeBool(bs.is_active != 0);
+    }
+
+    const uint8_t forceCount = std::min<uint8_t>(gs.force_count, MAX_PLAYERS);
+    w.write(forceCount, PLAYER_COUNT);
+    for (uint8_t i = 0; i < forceCount; ++i) {
+        const ForceStateSnapshot& fs = gs.forces[i];
+        w.write(fs.owner_id, OWNER_ID);
+        w.write(fs.x, POSITION);
+        w.write(fs.y, POSITION);
+        w.writeBool(fs.is_attached != 0);
+        w.write(fs.level, FORCE_LEVEL);
+    }
+
+    // Bit devices are always attached when sent, like in the byte encoding
+    const uint8_t bitCount = std::min<uint8_t>(gs.bit_count, MAX_BITS);
+    w.write(bitCount, BIT_COUNT);
+    for (uint8_t i = 0; i < bitCount; ++i) {
+        const BitDeviceStateSnapshot& bs = gs.bits[i];
+        w.write(bs.owner_id, OWNER_ID);
+        w.write(bs.bit_index, BIT_INDEX);
+        w.write(bs.x, POSITION);
+        w.write(bs.y, POSITION);
+    }
+
+    return w.overflowed() ? 0 : w.size();
+}
+
+/**
+ * @brief Reads a packed snapshot
+ * @return The snapshot, or std::nullopt if the packet is truncated or a field is out of range
+ */
+inline std::optional<GameSnapshot> unpackSnapshot(const void* buf, size_t len) {
+    using namespace packed;
+    if (buf == nullptr) {
+        return std::nullopt;
+    }
+    BitReader r(static_cast<const uint8_t*>(buf), len);
+    GameSnapshot gs{};
+
+    auto playerCount = r.read(PLAYER_COUNT);
+    if (!playerCount) return std::nullopt;
+    gs.player_count = static_cast<uint8_t>(*playerCount);
+    for (uint8_t i = 0; i < gs.player_count; ++i) {
+        auto id = r.read(PLAYER_ID);
+        auto x = r.read(POSITION);
+        auto y = r.read(POSITION);
+        auto health = r.read(HEALTH);
+        auto alive = r.readBool();
+        auto seq = r.read(SEQUENCE);
+        auto skin = r.read(SHIP_SKIN);
+        auto score = r.read(SCORE);
+        auto kills = r.read(KILLS);
+        auto combo = r.read(COMBO);
+        auto weapon = r.read(WEAPON);
+        auto charge = r.read(LEVEL);
+        auto speed = r.read(LEVEL);
+        auto weaponLevel = r.read(LEVEL);
+        auto hasForce = r.readBool();
+        auto shield = r.read(SHIELD_TIMER);
+        if (!id || !x || !y || !health || !alive || !seq || !skin || !score || !kills || !combo
+            || !weapon || !charge || !speed || !weaponLevel || !hasForce || !shield) {
+            return std::nullopt;
+        }
+        gs.players[i] = PlayerState{
+            .id = static_cast<uint8_t>(*id),
+            .x = static_cast<uint16_t>(*x),
+            .y = static_cast<uint16_t>(*y),
+            .health = static_cast<uint8_t>(*health),
+            .alive = static_cast<uint8_t>(*alive ? 1 : 0),
+            .lastAckedInputSeq = static_cast<uint16_t>(*seq),
+            .shipSkin = static_cast<uint8_t>(*skin),
+            .score = *score,
+            .kills = static_cast<uint16_t>(*kills),
+            .combo = static_cast<uint8_t>(*combo),
+            .currentWeapon = static_cast<uint8_t>(*weapon),
+            .chargeLevel = static_cast<uint8_t>(*charge),
+            .speedLevel = static_cast<uint8_t>(*speed),
+            .weaponLevel = static_cast<uint8_t>(*weaponLevel),
+            .hasForce = static_cast<uint8_t>(*hasForce ? 1 : 0),
+            .shieldTimer = static_cast<uint8_t>(*shield)
+        };
+    }
+
+    auto missileCount = r.read(MISSILE_COUNT);
+    if (!missileCount) return std::nullopt;
+    gs.missile_count = static_cast<uint8_t>(*missileCount);
+    for (uint8_t i = 0; i < gs.missile_count; ++i) {
+        auto ms = readMissile(r);
+        if (!ms) return std::nullopt;
+        gs.missiles[i] = *ms;
+    }
+
+    auto enemyCount = r.read(ENEMY_COUNT);
+    if (!enemyCount) return std::nullopt;
+    gs.enemy_count = static_cast<uint8_t>(*enemyCount);
+    for (uint8_t i = 0; i < gs.enemy_count; ++i) {
+        auto id = r.read(ENTITY_ID);
+        auto x = r.read(POSITION);
+        auto y = r.read(POSITION);
+        auto health = r.read(HEALTH);
+        auto type = r.read(ENEMY_TYPE);
+        if (!id || !x || !y || !health || !type) return std::nullopt;
+        gs.enemies[i] = EnemyState{
+            .id = static_cast<uint16_t>(*id),
+            .x = static_cast<uint16_t>(*x),
+            .y = static_cast<uint16_t>(*y),
+            .health = static_cast<uint8_t>(*health),
+            .enemy_type = static_cast<uint8_t>(*type)
+        };
+    }
+
+    auto enemyMissileCount = r.read(ENEMY_MISSILE_COUNT);
+    if (!enemyMissileCount) return std::nullopt;
+    gs.enemy_missile_count = static_cast<uint8_t>(*enemyMissileCount);
+    for (uint8_t i = 0; i < gs.enemy_missile_count; ++i) {
+        auto ms = readMissile(r);
+        if (!ms) return std::nullopt;
+        gs.enemy_missiles[i] = *ms;
+    }
+
+    auto wave = r.read(WAVE);
+    auto hasBoss = r.readBool();
+    if (!wave || !hasBoss) return std::nullopt;
+    gs.wave_number = static_cast<uint16_t>(*wave);
+    gs.has_boss = *hasBoss ? 1 : 0;
+    if (gs.has_boss) {
+        auto id = r.read(ENTITY_ID);
+        auto x = r.read(POSITION);
+        auto y = r.read(POSITION);
+        auto maxHealth = r.read(BOSS_HEALTH);
+        auto health = r.read(BOSS_HEALTH);
+        auto phase = r.read(BOSS_PHASE);
+        auto active = r.readBool();
+        if (!id || !x || !y || !maxHealth || !health || !phase || !active) return std::nullopt;
+        gs.boss_state = BossState{
+            .id = static_cast<uint16_t>(*id),
+            .x = static_cast<uint16_t>(*x),
+            .y = static_cast<uint16_t>(*y),
+            .max_health = static_cast<uint16_t>(*maxHealth),
+            .health = static_cast<uint16_t>(*health),
+            .phase = static_cast<uint8_t>(*phase),
+            .is_active = static_cast<uint8_t>(*active ? 1 : 0)
+        };
+    }
+
+    auto forceCount = r.read(PLAYER_COUNT);
+    if (!forceCount) return std::nullopt;
+    gs.force_count = static_cast<uint8_t>(*forceCount);
+    for (uint8_t i = 0; i < gs.force_count; ++i) {
+        auto owner = r.read(OWNER_ID);
+        auto x = r.read(POSITION);
+        auto y = r.read(POSITION);
+        auto attached = r.readBool();
+        auto level = r.read(FORCE_LEVEL);
+        if (!owner || !x || !y || !attached || !level) return std::nullopt;
+        gs.forces[i] = ForceStateSnapshot{
+            .owner_id = static_cast<uint8_t>(*owner),
+            .x = static_cast<uint16_t>(*x),
+            .y = static_cast<uint16_t>(*y),
+            .is_attached = static_cast<uint8_t>(*attached ? 1 : 0),
+            .level = static_cast<uint8_t>(*level)
+        };
+    }
+
+    auto bitCount = r.read(BIT_COUNT);
+    if (!bitCount) return std::nullopt;
+    gs.bit_count = static_cast<uint8_t>(*bitCount);
+    for (uint8_t i = 0; i < gs.bit_count; ++i) {
+        auto owner = r.read(OWNER_ID);
+        auto index = r.read(BIT_INDEX);
+        auto x = r.read(POSITION);
+        auto y = r.read(POSITION);
+        if (!owner || !index || !x || !y) return std::nullopt;
+        gs.bits[i] = BitDeviceStateSnapshot{
+            .owner_id = static_cast<uint8_t>(*owner),
+            .bit_index = static_cast<uint8_t>(*index),
+            .x = static_cast<uint16_t>(*x),
+            .y = static_cast<uint16_t>(*y),
+            .is_attached = 1
+        };
+    }
+
+    return gs;
+}
+
+#endif /* !PACKEDSNAPSHOT_HPP_ */
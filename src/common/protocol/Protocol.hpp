@@ -8,6 +8,7 @@
 #ifndef PROTOCOL_HPP_
 #define PROTOCOL_HPP_
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <chrono>
@@ -29,6 +30,11 @@ enum class MessageType: uint16_t {
     JoinGameNack = 0x0012,
     // UDP Game messages
     Snapshot = 0x0040,
+    SnapshotDelta = 0x0041,     // S→C: Snapshot encoded against a snapshot the client acked
+    SnapshotAck = 0x0042,       // C→S: Last snapshot sequence the client decoded
+    SnapshotPacked = 0x0043,    // S→C: Snapshot in the bit-packed encoding (PackedSnapshot.hpp)
+    ReliableEvents = 0x0044,    // S→C: Game events of the reliable-ordered channel (ReliableChannel.hpp)
+    Bundle = 0x0045,            // S→C: Several messages of one tick in one datagram (BundleEntryHeader)
     PlayerInput = 0x0061,
     PlayerJoin = 0x0070,
     PlayerLeave = 0x0071,
@@ -392,21 +398,48 @@ struct SessionToken {
     }
 };
 
+// Full snapshot encodings, negotiated at JoinGame
+enum class SnapshotEncoding : uint8_t {
+    Bytes = 0,       // GameSnapshot::to_bytes, MessageType::Snapshot
+    Packed = 1,      // Quantized bit-packing, MessageType::SnapshotPacked
+    Partial = 2,     // Packed, and per-player snapshots flagged PARTIAL_SNAPSHOT_FLAG
+    Dictionary = 3,  // Partial, and LZ4 primed with compression::SNAPSHOT_DICTIONARY
+};
+static constexpr SnapshotEncoding LATEST_SNAPSHOT_ENCODING = SnapshotEncoding::Dictionary;
+
+// Both sides use the lower of the two versions; an unknown (newer) one counts as the latest known
+inline SnapshotEncoding negotiateSnapshotEncoding(uint8_t requested) {
+    return static_cast<SnapshotEncoding>(
+        std::min(requested, static_cast<uint8_t>(LATEST_SNAPSHOT_ENCODING)));
+}
+
+// Optional features, negotiated at JoinGame: the server keeps those it also supports
+namespace GameFeatures {
+    constexpr uint8_t RELIABLE_EVENTS = 0x01;  // Game events go through MessageType::ReliableEvents
+    constexpr uint8_t BUNDLES = 0x02;          // A tick's messages are coalesced into MessageType::Bundle
+    constexpr uint8_t SUPPORTED = RELIABLE_EVENTS | BUNDLES;
+}
+
 // JoinGame: Client sends token to authenticate UDP session
 struct JoinGame {
     SessionToken token;
     uint8_t shipSkin;  // Ship skin variant (1-6)
     char roomCode[ROOM_CODE_LEN];  // Room code for multi-instance routing
-    static constexpr size_t WIRE_SIZE = TOKEN_SIZE + 1 + ROOM_CODE_LEN;
+    uint8_t snapshotEncoding = 0;  // Latest SnapshotEncoding the client decodes (absent = Bytes)
+    uint8_t features = 0;          // GameFeatures the client wants (absent = none)
+    static constexpr size_t MIN_WIRE_SIZE = TOKEN_SIZE + 1 + ROOM_CODE_LEN;  // Without the optional bytes
+    static constexpr size_t WIRE_SIZE = MIN_WIRE_SIZE + 2;
 
     void to_bytes(uint8_t* buf) const {
         token.to_bytes(buf);
         buf[TOKEN_SIZE] = shipSkin;
         std::memcpy(buf + TOKEN_SIZE + 1, roomCode, ROOM_CODE_LEN);
+        buf[MIN_WIRE_SIZE] = snapshotEncoding;
+        buf[MIN_WIRE_SIZE + 1] = features;
     }
 
     static std::optional<JoinGame> from_bytes(const void* buf, size_t len) {
-        if (buf == nullptr || len < WIRE_SIZE) return std::nullopt;
+        if (buf == nullptr || len < MIN_WIRE_SIZE) return std::nullopt;
         auto tokenOpt = SessionToken::from_bytes(buf, len);
         if (!tokenOpt) return std::nullopt;
         auto* ptr = static_cast<const uint8_t*>(buf);
@@ -414,6 +447,8 @@ struct JoinGame {
         msg.token = *tokenOpt;
         msg.shipSkin = ptr[TOKEN_SIZE];
         std::memcpy(msg.roomCode, ptr + TOKEN_SIZE + 1, ROOM_CODE_LEN);
+        msg.snapshotEncoding = len > MIN_WIRE_SIZE ? ptr[MIN_WIRE_SIZE] : 0;
+        msg.features = len > MIN_WIRE_SIZE + 1 ? ptr[MIN_WIRE_SIZE + 1] : 0;
         return msg;
     }
 };
@@ -421,16 +456,25 @@ struct JoinGame {
 // JoinGameAck: Server confirms and assigns player ID
 struct JoinGameAck {
     uint8_t player_id;
-    static constexpr size_t WIRE_SIZE = 1;
+    uint8_t snapshotEncoding = 0;  // SnapshotEncoding the server will use (absent = Bytes)
+    uint8_t features = 0;          // GameFeatures in use (absent = none)
+    static constexpr size_t MIN_WIRE_SIZE = 1;  // Without the optional bytes
+    static constexpr size_t WIRE_SIZE = MIN_WIRE_SIZE + 2;
 
     void to_bytes(uint8_t* buf) const {
         buf[0] = player_id;
+        buf[1] = snapshotEncoding;
+        buf[2] = features;
     }
 
     static std::optional<JoinGameAck> from_bytes(const void* buf, size_t len) {
-        if (buf == nullptr || len < WIRE_SIZE) return std::nullopt;
+        if (buf == nullptr || len < MIN_WIRE_SIZE) return std::nullopt;
         auto* ptr = static_cast<const uint8_t*>(buf);
-        return JoinGameAck{.player_id = ptr[0]};
+        return JoinGameAck{
+            .player_id = ptr[0],
+            .snapshotEncoding = static_cast<uint8_t>(len > 1 ? ptr[1] : 0),
+            .features = static_cast<uint8_t>(len > 2 ? ptr[2] : 0)
+        };
     }
 };
 
@@ -1589,6 +1633,13 @@ struct UDPHeader {
  */
 constexpr uint16_t COMPRESSION_FLAG = 0x8000;
 
+/**
+ * @brief Flag on Snapshot, SnapshotPacked and SnapshotDelta packets carrying only part of the room's entities
+ * The room holds more than one snapshot fits: entities left out keep their last known state.
+ * Only sent to clients that negotiated SnapshotEncoding::Partial.
+ */
+constexpr uint16_t PARTIAL_SNAPSHOT_FLAG = 0x4000;
+
 /**
  * @brief Header for compressed UDP packets
  * Follows immediately after UDPHeader when COMPRESSION_FLAG is set
@@ -1618,6 +1669,187 @@ struct CompressionHeader {
     }
 };
 
+/**
+ * SnapshotAck: Client → Server
+ * Sequence (UDPHeader::sequence_num of the Snapshot / SnapshotDelta) of the
+ * last snapshot the client decoded. The server encodes the next snapshots
+ * for this client as deltas against it.
+ *
+ * Newer clients append the acks of the ReliableEvents packets
+ * (GameFeatures::RELIABLE_EVENTS): bit i of event_ack_bits set means packet
+ * event_ack - i arrived (all clear: none arrived yet).
+ */
+struct SnapshotAck {
+    uint16_t sequence;
+    uint16_t event_ack = 0;       // Newest ReliableEvents packet sequence received
+    uint32_t event_ack_bits = 0;  // The 32 packets up to event_ack
+
+    static constexpr size_t MIN_WIRE_SIZE = 2;  // Without the event acks
+    static constexpr size_t WIRE_SIZE = MIN_WIRE_SIZE + 6;
+
+    void to_bytes(uint8_t* buf) const {
+        uint16_t net_sequence = swap16(sequence);
+        std::memcpy(buf, &net_sequence, 2);
+        uint16_t net_event_ack = swap16(event_ack);
+        std::memcpy(buf + 2, &net_event_ack, 2);
+        uint32_t net_event_ack_bits = swap32(event_ack_bits);
+        std::memcpy(buf + 4, &net_event_ack_bits, 4);
+    }
+
+    static std::optional<SnapshotAck> from_bytes(const void* buf, size_t buf_len) {
+        if (buf == nullptr || buf_len < MIN_WIRE_SIZE) {
+            return std::nullopt;
+        }
+        auto* ptr = static_cast<const uint8_t*>(buf);
+        SnapshotAck ack;
+        uint16_t net_sequence;
+        std::memcpy(&net_sequence, ptr, 2);
+        ack.sequence = swap16(net_sequence);
+        if (buf_len >= WIRE_SIZE) {
+            uint16_t net_event_ack;
+            std::memcpy(&net_event_ack, ptr + 2, 2);
+            ack.event_ack = swap16(net_event_ack);
+            uint32_t net_event_ack_bits;
+            std::memcpy(&net_event_ack_bits, ptr + 4, 4);
+            ack.event_ack_bits = swap32(net_event_ack_bits);
+        }
+        return ack;
+    }
+};
+
+/**
+ * BundleEntryHeader: Server → Client
+ * A Bundle's UDPHeader is followed by entries, each a BundleEntryHeader and
+ * the message's payload, as it would follow its own UDPHeader (compression
+ * header included). Only sent to clients that negotiated GameFeatures::BUNDLES.
+ */
+struct BundleEntryHeader {
+    uint16_t type;          // UDPHeader::type of the message, flags included
+    uint16_t sequence_num;  // UDPHeader::sequence_num of the message
+    uint16_t size;          // Payload bytes that follow
+
+    static constexpr size_t WIRE_SIZE = 6;
+
+    void to_bytes(uint8_t* buf) const {
+        uint16_t net_type = swap16(type);
+        std::memcpy(buf, &net_type, 2);
+        uint16_t net_sequence = swap16(sequence_num);
+        std::memcpy(buf + 2, &net_sequence, 2);
+        uint16_t net_size = swap16(size);
+        std::memcpy(buf + 4, &net_size, 2);
+    }
+
+    static std::optional<BundleEntryHeader> from_bytes(const void* buf, size_t buf_len) {
+        if (buf == nullptr || buf_len < WIRE_SIZE) {
+            return std::nullopt;
+        }
+        auto* ptr = static_cast<const uint8_t*>(buf);
+        BundleEntryHeader head;
+        uint16_t net_type;
+        std::memcpy(&net_type, ptr, 2);
+        head.type = swap16(net_type);
+        uint16_t net_sequence;
+        std::memcpy(&net_sequence, ptr + 2, 2);
+        head.sequence_num = swap16(net_sequence);
+        uint16_t net_size;
+        std::memcpy(&net_size, ptr + 4, 2);
+        head.size = swap16(net_size);
+        return head;
+    }
+};
+
+/**
+ * ReliableEventsHeader: Server → Client
+ * Follows the UDPHeader of a ReliableEvents packet, whose sequence_num is
+ * the packet sequence the client acks. count events follow, each a
+ * ReliableEventHeader and the event's payload (see ReliableChannel.hpp).
+ */
+struct ReliableEventsHeader {
+    uint16_t first_pending;  // Oldest event the server still resends, those before are acked or given up
+    uint8_t count;
+
+    static constexpr size_t WIRE_SIZE = 3;
+
+    void to_bytes(uint8_t* buf) const {
+        uint16_t net_first = swap16(first_pending);
+        std::memcpy(buf, &net_first, 2);
+        buf[2] = count;
+    }
+
+    static std::optional<ReliableEventsHeader> from_bytes(const void* buf, size_t buf_len) {
+        if (buf == nullptr || buf_len < WIRE_SIZE) {
+            return std::nullopt;
+        }
+        auto* ptr = static_cast<const uint8_t*>(buf);
+        ReliableEventsHeader head;
+        uint16_t net_first;
+        std::memcpy(&net_first, ptr, 2);
+        head.first_pending = swap16(net_first);
+        head.count = ptr[2];
+        return head;
+    }
+};
+
+struct ReliableEventHeader {
+    uint16_t id;    // Delivery order
+    uint16_t type;  // MessageType of the event
+    uint8_t size;   // Payload bytes that follow
+
+    static constexpr size_t WIRE_SIZE = 5;
+
+    void to_bytes(uint8_t* buf) const {
+        uint16_t net_id = swap16(id);
+        std::memcpy(buf, &net_id, 2);
+        uint16_t net_type = swap16(type);
+        std::memcpy(buf + 2, &net_type, 2);
+        buf[4] = size;
+    }
+
+    static std::optional<ReliableEventHeader> from_bytes(const void* buf, size_t buf_len) {
+        if (buf == nullptr || buf_len < WIRE_SIZE) {
+            return std::nullopt;
+        }
+        auto* ptr = static_cast<const uint8_t*>(buf);
+        ReliableEventHeader head;
+        uint16_t net_id;
+        std::memcpy(&net_id, ptr, 2);
+        head.id = swap16(net_id);
+        uint16_t net_type;
+        std::memcpy(&net_type, ptr + 2, 2);
+        head.type = swap16(net_type);
+        head.size = ptr[4];
+        return head;
+    }
+};
+
+/**
+ * SnapshotDeltaHeader: Server → Client
+ * Follows the UDPHeader of a SnapshotDelta, whose sequence_num is the
+ * sequence of the snapshot it rebuilds. The encoded delta against the
+ * baseline snapshot comes right after (see compression/SnapshotDelta.hpp).
+ */
+struct SnapshotDeltaHeader {
+    uint16_t baseline_seq;  // Snapshot the delta applies to (acked by the client)
+
+    static constexpr size_t WIRE_SIZE = 2;
+
+    void to_bytes(uint8_t* buf) const {
+        uint16_t net_baseline = swap16(baseline_seq);
+        std::memcpy(buf, &net_baseline, 2);
+    }
+
+    static std::optional<SnapshotDeltaHeader> from_bytes(const void* buf, size_t buf_len) {
+        if (buf == nullptr || buf_len < WIRE_SIZE) {
+            return std::nullopt;
+        }
+        SnapshotDeltaHeader head;
+        uint16_t net_baseline;
+        std::memcpy(&net_baseline, buf, 2);
+        head.baseline_seq = swap16(net_baseline);
+        return head;
+    }
+};
+
 struct PlayerJoin {
     uint8_t player_id;
     static constexpr size_t WIRE_SIZE = 1;
@@ -0,0 +1,309 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ReliableChannel - Reliable-ordered delivery of game events over UDP (GameFeatures::RELIABLE_EVENTS)
+*/
+
+#ifndef RELIABLECHANNEL_HPP_
+#define RELIABLECHANNEL_HPP_
+
+#include "Protocol.hpp"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+// ============================================================================
+// Reliable-ordered events
+// ============================================================================
+// The server queues a player's events as they happen and packs them into one
+// ReliableEvents packet per tick, along with the events sent before that the
+// client has not acked yet and that are due for a resend. Each packet gets its
+// own sequence; the client acks packets (newest sequence + 32-bit bitfield,
+// piggybacked on SnapshotAck), and the server maps them back to the events
+// they carried. Events get an id of their own and the client delivers them in
+// id order, however the packets arrive.
+
+namespace reliable {
+
+    // Every event struct fits (WaveCannonState is the largest, 9 bytes)
+    static constexpr size_t MAX_EVENT_SIZE = 32;
+    // Unacked events kept per player; past that, the oldest is given up
+    static constexpr size_t EVENT_WINDOW = 256;
+    // Packets whose content is remembered for the acks
+    static constexpr size_t PACKET_WINDOW = 64;
+    static constexpr size_t MAX_EVENTS_PER_PACKET = 64;
+    static constexpr size_t ACK_BITS = 32;
+    // Resent when unacked that long after the last send (about two ticks)
+    static constexpr std::chrono::milliseconds RESEND_DELAY{100};
+
+    // Whether sequence a comes after b, across the wrap-around
+    inline bool isNewer(uint16_t a, uint16_t b) {
+        return static_cast<int16_t>(static_cast<uint16_t>(a - b)) > 0;
+    }
+
+    /**
+     * @brief Server side: the events of one player, until the player acks them
+     */
+    class ReliableSender {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Queues an event for the next packet
+         * @return false if the event is larger than MAX_EVENT_SIZE
+         */
+        bool queue(uint16_t type, const uint8_t* payload, size_t size) {
+            if (size > MAX_EVENT_SIZE) {
+                return false;
+            }
+            if (static_cast<uint16_t>(_nextId - _firstPending) >= EVENT_WINDOW) {
+                // The player stopped acking: the snapshots resync what the oldest event said
+                _firstPending++;
+                _givenUp++;
+                skipAcked();
+            }
+            Event& event = _events[_nextId % EVENT_WINDOW];
+            event.id = _nextId++;
+            event.type = type;
+            event.size = static_cast<uint8_t>(size);
+            std::memcpy(event.payload.data(), payload, size);
+            event.lastSent = std::nullopt;
+            event.acked = false;
+            return true;
+        }
+
+        template<typename T>
+        bool queue(MessageType type, const T& event) {
+            static_assert(T::WIRE_SIZE <= MAX_EVENT_SIZE, "Event too large for the reliable channel");
+            uint8_t buf[T::WIRE_SIZE];
+            event.to_bytes(buf);
+            return queue(static_cast<uint16_t>(type), buf, T::WIRE_SIZE);
+        }
+
+        /**
+         * @brief Writes the ReliableEvents payload (after the UDPHeader) of this tick's packet
+         * @param sequence Set to the packet sequence, the UDPHeader::sequence_num to send it with
+         * @return Bytes written, 0 when no event is new or due for a resend
+         */
+        size_t writePacket(Clock::time_point now, uint8_t* buf, size_t capacity, uint16_t& sequence) {
+            if (capacity < ReliableEventsHeader::WIRE_SIZE) {
+                return 0;
+            }
+            SentPacket& packet = _packets[_nextSequence % PACKET_WINDOW];
+            packet.count = 0;
+            size_t offset = ReliableEventsHeader::WIRE_SIZE;
+            for (uint16_t id = _firstPending; id != _nextId && packet.count < MAX_EVENTS_PER_PACKET; ++id) {
+                Event& event = _events[id % EVENT_WINDOW];
+                if (event.acked || (event.lastSent && now - *event.lastSent < RESEND_DELAY)) {
+                    continue;
+                }
+                if (offset + ReliableEventHeader::WIRE_SIZE + event.size > capacity) {
+                    break;  // Next tick
+                }
+                ReliableEventHeader{.id = event.id, .type = event.type, .size = event.size}.to_bytes(buf + offset);
+                offset += ReliableEventHeader::WIRE_SIZE;
+                std::memcpy(buf + offset, event.payload.data(), event.size);
+                offset += event.size;
+                if (event.lastSent) {
+                    _resent++;
+                }
+                event.lastSent = now;
+                packet.ids[packet.count++] = event.id;
+            }
+            if (packet.count == 0) {
+                return 0;
+            }
+            ReliableEventsHeader{.first_pending = _firstPending, .count = packet.count}.to_bytes(buf);
+            packet.sequence = _nextSequence;
+            packet.valid = true;
+            sequence = _nextSequence++;
+            return offset;
+        }
+
+        /**
+         * @brief Marks the events of every packet the client acked
+         */
+        void onAck(uint16_t ack, uint32_t ackBits) {
+            for (size_t i = 0; i < ACK_BITS; ++i) {
+                if ((ackBits & (uint32_t{1} << i)) == 0) {
+                    continue;
+                }
+                const uint16_t sequence = static_cast<uint16_t>(ack - i);
+                SentPacket& packet = _packets[sequence % PACKET_WINDOW];
+                if (!packet.valid || packet.sequence != sequence) {
+                    continue;  // Already acked, or too old to remember
+                }
+                packet.valid = false;
+                for (uint8_t j = 0; j < packet.count; ++j) {
+                    Event& event = _events[packet.ids[j] % EVENT_WINDOW];
+                    if (event.id == packet.ids[j]) {
+                        event.acked = true;
+                    }
+                }
+            }
+            skipAcked();
+        }
+
+        size_t pending() const { return static_cast<uint16_t>(_nextId - _firstPending); }
+        uint64_t resent() const { return _resent; }
+        uint64_t givenUp() const { return _givenUp; }
+
+    private:
+        struct Event {
+            uint16_t id = 0;
+            uint16_t type = 0;
+            uint8_t size = 0;
+            std::array<uint8_t, MAX_EVENT_SIZE> payload{};
+            std::optional<Clock::time_point> lastSent;
+            bool acked = false;
+        };
+
+        struct SentPacket {
+            uint16_t sequence = 0;
+            bool valid = false;
+            uint8_t count = 0;
+            std::array<uint16_t, MAX_EVENTS_PER_PACKET> ids{};
+        };
+
+        void skipAcked() {
+            while (_firstPending != _nextId && _events[_firstPending % EVENT_WINDOW].acked) {
+                _firstPending++;
+            }
+        }
+
+        std::array<Event, EVENT_WINDOW> _events{};
+        std::array<SentPacket, PACKET_WINDOW> _packets{};
+        uint16_t _nextId = 0;
+        uint16_t _firstPending = 0;
+        uint16_t _nextSequence = 0;
+        uint64_t _resent = 0;
+        uint64_t _givenUp = 0;
+    };
+
+    /**
+     * @brief Client side: acks the packets and hands the events over in order
+     */
+    class ReliableReceiver {
+    public:
+        /**
+         * @brief Reads a ReliableEvents payload (after the UDPHeader)
+         * @param sequence UDPHeader::sequence_num of the packet
+         * @param deliver Called as deliver(MessageType, const uint8_t* payload, size_t size)
+         *                for each event next in order, including those buffered until now
+         * @return false if the payload is malformed (not acked, nothing delivered)
+         */
+        template<typename Deliver>
+        bool receive(uint16_t sequence, const uint8_t* data, size_t size, Deliver&& deliver) {
+            auto headOpt = ReliableEventsHeader::from_bytes(data, size);
+            if (!headOpt) {
+                return false;
+            }
+            // Whole packet checked before anything is acked or buffered
+            size_t offset = ReliableEventsHeader::WIRE_SIZE;
+            for (uint8_t i = 0; i < headOpt->count; ++i) {
+                auto eventOpt = ReliableEventHeader::from_bytes(data + offset, size - offset);
+                if (!eventOpt || eventOpt->size > MAX_EVENT_SIZE
+                    || offset + ReliableEventHeader::WIRE_SIZE + eventOpt->size > size) {
+                    return false;
+                }
+                offset += ReliableEventHeader::WIRE_SIZE + eventOpt->size;
+            }
+
+            recordPacket(sequence);
+
+            // Events before first_pending are acked or given up: those still missing never come
+            while (isNewer(headOpt->first_pending, _nextId)) {
+                if (!deliverNext(deliver)) {
+                    _nextId++;
+                }
+            }
+
+            offset = ReliableEventsHeader::WIRE_SIZE;
+            for (uint8_t i = 0; i < headOpt->count; ++i) {
+                auto event = *ReliableEventHeader::from_bytes(data + offset, size - offset);
+                offset += ReliableEventHeader::WIRE_SIZE;
+                const uint16_t ahead = static_cast<uint16_t>(event.id - _nextId);
+                if (ahead < EVENT_WINDOW) {  // Not delivered yet (resends of delivered events are behind)
+                    Slot& slot = _slots[event.id % EVENT_WINDOW];
+                    slot.filled = true;
+                    slot.id = event.id;
+                    slot.type = event.type;
+                    slot.size = event.size;
+                    std::memcpy(slot.payload.data(), data + offset, event.size);
+                }
+                offset += event.size;
+            }
+            while (deliverNext(deliver)) {
+            }
+            return true;
+        }
+
+        bool hasAck() const { return _hasAck; }
+        uint16_t ack() const { return _ack; }
+        uint32_t ackBits() const { return _ackBits; }
+
+        // New session: the server starts over from id and sequence 0
+        void reset() {
+            _hasAck = false;
+            _ack = 0;
+            _ackBits = 0;
+            _nextId = 0;
+            for (auto& slot : _slots) {
+                slot.filled = false;
+            }
+        }
+
+    private:
+        struct Slot {
+            bool filled = false;
+            uint16_t id = 0;
+            uint16_t type = 0;
+            uint8_t size = 0;
+            std::array<uint8_t, MAX_EVENT_SIZE> payload{};
+        };
+
+        void recordPacket(uint16_t sequence) {
+            if (!_hasAck) {
+                _hasAck = true;
+                _ack = sequence;
+                _ackBits = 1;
+            } else if (isNewer(sequence, _ack)) {
+                const uint16_t shift = static_cast<uint16_t>(sequence - _ack);
+                _ackBits = shift >= ACK_BITS ? 0 : _ackBits << shift;
+                _ackBits |= 1;
+                _ack = sequence;
+            } else {
+                const uint16_t age = static_cast<uint16_t>(_ack - sequence);
+                if (age < ACK_BITS) {
+                    _ackBits |= uint32_t{1} << age;
+                }
+            }
+        }
+
+        // Delivers the event _nextId if it arrived
+        template<typename Deliver>
+        bool deliverNext(Deliver& deliver) {
+            Slot& slot = _slots[_nextId % EVENT_WINDOW];
+            if (!slot.filled || slot.id != _nextId) {
+                return false;
+            }
+            slot.filled = false;
+            _nextId++;
+            deliver(static_cast<MessageType>(slot.type), slot.payload.data(), static_cast<size_t>(slot.size));
+            return true;
+        }
+
+        std::array<Slot, EVENT_WINDOW> _slots{};
+        bool _hasAck = false;
+        uint16_t _ack = 0;
+        uint32_t _ackBits = 0;
+        uint16_t _nextId = 0;
+    };
+
+}
+
+#endif /* !RELIABLECHANNEL_HPP_ */
@@ -20,6 +20,7 @@
 #include <mutex>
 #include <set>
 #include <map>
+#include <span>
 
 #include "Protocol.hpp"
 
@@ -37,6 +38,9 @@
 #include "infrastructure/session/SessionManager.hpp"
 #include "infrastructure/room/RoomManager.hpp"
 #include "infrastructure/social/FriendManager.hpp"
+#include "infrastructure/network/CompressionPolicy.hpp"
+#include "infrastructure/network/FrameRingBuffer.hpp"
+#include "infrastructure/network/FrameWriteQueue.hpp"
 
 // Domain exceptions for error handling
 #include "domain/exceptions/DomainException.hpp"
@@ -63,12 +67,15 @@ namespace infrastructure::adapters::in::network {
     using infrastructure::session::SessionManager;
     using infrastructure::room::RoomManager;
     using infrastructure::social::FriendManager;
+    using infrastructure::network::CompressionPolicy;
+    using infrastructure::network::FrameRingBuffer;
+    using infrastructure::network::FrameWriteQueue;
 
     class Session: public std::enable_shared_from_this<Session> {
         private:
             ssl::stream<tcp::socket> _socket;
-            char _readBuffer[BUFFER_SIZE];
-            std::vector<uint8_t> _accumulator;
+            FrameRingBuffer _readRing;  // The socket reads into it, handlers get views of its frames
+            FrameWriteQueue _writeQueue;  // Every frame sent goes through it, one write in flight
             std::optional<User> _user;
             bool _isAuthenticated = false;
             std::function<void(const User&)> _onAuthSuccess;
@@ -84,6 +91,7 @@ namespace infrastructure::adapters::in::network {
             std::shared_ptr<IFriendRequestRepository> _friendRequestRepository;
             std::shared_ptr<IBlockedUserRepository> _blockedUserRepository;
             std::shared_ptr<IPrivateMessageRepository> _privateMessageRepository;
+            std::shared_ptr<CompressionPolicy> _compressionPolicy;
 
             // Session token (valid after successful login)
             std::optional<SessionToken> _sessionToken;
@@ -95,23 +103,27 @@ namespace infrastructure::adapters::in::network {
             std::function<void(Session*)> _onClose;
 
             void do_read();
+            // Queues a complete frame (Header included); safe from any thread
+            void send_frame(FrameWriteQueue::Buffer frame);
+            // Writes the queued frames, one coalesced write at a time (on the session's strand)
+            void flush_writes();
             void do_write(const MessageType&, const std::string& message);
             void do_write_auth_response(const MessageType& msgType, const AuthResponse& resp);
             void do_write_auth_response_with_token(const MessageType& msgType, const AuthResponseWithToken& resp);
             void do_write_heartbeat_ack();
             void do_write_compressed(MessageType msgType, const uint8_t* payload, size_t payloadSize);
-            void handle_command(const Header&);
+            void handle_command(const Header&, std::span<const uint8_t> payload);
             void onLoginSuccess(const User& user);
             void scheduleTimeoutCheck();
 
             // Room message handlers
-            void handleCreateRoom(const std::vector<uint8_t>& payload);
-            void handleJoinRoomByCode(const std::vector<uint8_t>& payload);
+            void handleCreateRoom(std::span<const uint8_t> payload);
+            void handleJoinRoomByCode(std::span<const uint8_t> payload);
             void handleLeaveRoom();
-            void handleSetReady(const std::vector<uint8_t>& payload);
+            void handleSetReady(std::span<const uint8_t> payload);
             void handleStartGame();
-            void handleKickPlayer(const std::vector<uint8_t>& payload);
-            void handleSetRoomConfig(const std::vector<uint8_t>& payload);
+            void handleKickPlayer(std::span<const uint8_t> payload);
+            void handleSetRoomConfig(std::span<const uint8_t> payload);
             void handleBrowsePublicRooms();
             void handleQuickJoin();
 
@@ -120,33 +132,33 @@ namespace infrastructure::adapters::in::network {
 
             // User settings handlers
             void handleGetUserSettings();
-            void handleSaveUserSettings(const std::vector<uint8_t>& payload);
+            void handleSaveUserSettings(std::span<const uint8_t> payload);
 
             // Chat handlers
-            void handleSendChatMessage(const std::vector<uint8_t>& payload);
+            void handleSendChatMessage(std::span<const uint8_t> payload);
 
             // Hidden command handlers
             void handleToggleGodMode(const std::string& email);
 
             // Friends System handlers
-            void handleSendFriendRequest(const std::vector<uint8_t>& payload);
-            void handleAcceptFriendRequest(const std::vector<uint8_t>& payload);
-            void handleRejectFriendRequest(const std::vector<uint8_t>& payload);
-            void handleRemoveFriend(const std::vector<uint8_t>& payload);
-            void handleBlockUser(const std::vector<uint8_t>& payload);
-            void handleUnblockUser(const std::vector<uint8_t>& payload);
-            void handleGetFriendsList(const std::vector<uint8_t>& payload);
+            void handleSendFriendRequest(std::span<const uint8_t> payload);
+            void handleAcceptFriendRequest(std::span<const uint8_t> payload);
+            void handleRejectFriendRequest(std::span<const uint8_t> payload);
+            void handleRemoveFriend(std::span<const uint8_t> payload);
+            void handleBlockUser(std::span<const uint8_t> payload);
+            void handleUnblockUser(std::span<const uint8_t> payload);
+            void handleGetFriendsList(std::span<const uint8_t> payload);
             void handleGetFriendRequests();
             void handleGetBlockedUsers();
 
             // Private Messaging handlers
-            void handleSendPrivateMessage(const std::vector<uint8_t>& payload);
-            void handleGetConversation(const std::vector<uint8_t>& payload);
+            void handleSendPrivateMessage(std::span<const uint8_t> payload);
+            void handleGetConversation(std::span<const uint8_t> payload);
             void handleGetConversationsList();
-            void handleMarkMessagesRead(const std::vector<uint8_t>& payload);
+            void handleMarkMessagesRead(std::span<const uint8_t> payload);
 
             // Leaderboard handlers
-            void handleGetLeaderboard(const std::vector<uint8_t>& payload);
+            void handleGetLeaderboard(std::span<const uint8_t> payload);
             void handleGetPlayerStats();
             void handleGetGameHistory();
             void handleGetAchievements();
@@ -231,6 +243,9 @@ namespace infrastructure::adapters::in::network {
 
                 void start();
 
+                // Policy deciding how do_write_compressed() payloads are compressed (set before start())
+                void setCompressionPolicy(std::shared_ptr<CompressionPolicy> policy) { _compressionPolicy = std::move(policy); }
+
                 // Close the session (cancel timer and close socket)
                 void close();
         };
@@ -253,6 +268,7 @@ namespace infrastructure::adapters::in::network {
                 std::shared_ptr<IFriendRequestRepository> _friendRequestRepository;
                 std::shared_ptr<IBlockedUserRepository> _blockedUserRepository;
                 std::shared_ptr<IPrivateMessageRepository> _privateMessageRepository;
+                std::shared_ptr<CompressionPolicy> _compressionPolicy{std::make_shared<CompressionPolicy>()};
                 tcp::acceptor _acceptor;
 
                 // Track active sessions for graceful shutdown
@@ -290,6 +306,9 @@ namespace infrastructure::adapters::in::network {
             std::shared_ptr<ILeaderboardRepository> getLeaderboardRepository() const { return _leaderboardRepository; }
             std::shared_ptr<FriendManager> getFriendManager() const { return _friendManager; }
 
+            // Shares the UDP server's policy (and its stats) with every new session; call before run()
+            void setCompressionPolicy(std::shared_ptr<CompressionPolicy> policy) { _compressionPolicy = std::move(policy); }
+
             // Session tracking for graceful shutdown
             void registerSession(std::shared_ptr<Session> session);
             void unregisterSession(Session* session);  // Takes raw pointer (called from destructor)
@@ -16,9 +16,17 @@
 #include "infrastructure/game/GameInstanceManager.hpp"
 #include "infrastructure/session/SessionManager.hpp"
 #include "infrastructure/network/NetworkStats.hpp"
+#include "infrastructure/network/SendBufferPool.hpp"
+#include "infrastructure/network/HandlerMemoryPool.hpp"
+#include "infrastructure/network/BatchedUDPIO.hpp"
+#include "infrastructure/network/ConnectionTable.hpp"
 #include "application/ports/out/persistence/ILeaderboardRepository.hpp"
 #include <memory>
+#include <span>
+#include <thread>
+#include <vector>
 
+class FrameArenaRoomFrameTest;
 
 namespace infrastructure::adapters::in::network {
     using boost::asio::ip::udp;
@@ -27,11 +35,14 @@ namespace infrastructure::adapters::in::network {
 
     class UDPServer {
         private:
+            friend class ::FrameArenaRoomFrameTest;  // Runs room frames with the allocation counter armed
+
             // Message types that require authentication (session bound to endpoint)
             // Messages NOT in this set can be processed without authentication
             static inline const std::unordered_set<uint16_t> _authRequiredMessages = {
                 static_cast<uint16_t>(MessageType::PlayerInput),
                 static_cast<uint16_t>(MessageType::ShootMissile),
+                static_cast<uint16_t>(MessageType::SnapshotAck),
                 // R-Type Authentic (Phase 3)
                 static_cast<uint16_t>(MessageType::ChargeStart),
                 static_cast<uint16_t>(MessageType::ChargeRelease),
@@ -44,26 +55,81 @@ namespace infrastructure::adapters::in::network {
             bool requiresAuth(uint16_t messageType) const {
                 return _authRequiredMessages.contains(messageType);
             }
+            // One SO_REUSEPORT socket on the game port with its own receive loop and room tick.
+            // Rooms are pinned to the shard that received their first JoinGame; that shard's
+            // io_context runs their strand and its socket sends their traffic.
+            struct Shard {
+                size_t index;
+                boost::asio::io_context& ioContext;
+                udp::socket socket;
+                udp::endpoint remoteEndpoint;
+                boost::asio::steady_timer frameTimer;  // Paces the frames of the shard's rooms at the simulation rate
+                char readBuffer[BUFFER_SIZE];
+#ifdef __linux__
+                std::unique_ptr<infrastructure::network::BatchedUDPIO> batchedIO;  // Set by enableBatchedIO()
+#endif
+
+                Shard(size_t shardIndex, boost::asio::io_context& ctx, udp::socket&& sock)
+                    : index(shardIndex), ioContext(ctx), socket(std::move(sock)), frameTimer(ctx) {}
+            };
+
             boost::asio::io_context& _io_ctx;
-            udp::socket _socket;
-            udp::endpoint _remote_endpoint;
+            // Declared before everything that may hold a strand or a socket on them
+            std::vector<std::unique_ptr<boost::asio::io_context>> _shardContexts;  // Empty with a single shard
+            std::vector<std::unique_ptr<Shard>> _shards;
+            std::vector<std::jthread> _shardThreads;
             game::GameInstanceManager _instanceManager;
+            // Endpoints of the players in a game, looked up without a lock by the receive loops
+            infrastructure::network::ConnectionTable _connections;
             std::shared_ptr<SessionManager> _sessionManager;
             std::shared_ptr<ILeaderboardRepository> _leaderboardRepository;
-            boost::asio::steady_timer _broadcastTimer;
             std::shared_ptr<infrastructure::network::NetworkStats> _networkStats;
+            infrastructure::network::SendBufferPool _sendBuffers;  // Datagrams shared by every recipient
+            infrastructure::network::HandlerMemoryPool _sendHandlers;  // asio's state of each async_send_to
+            game::SimulationRates _simulationRates;  // Given to every room's SimulationClock
             boost::asio::steady_timer _statsTimer;
             boost::asio::steady_timer _autoSaveTimer;  // Auto-save player stats every 1s
 
-            char _readBuffer[BUFFER_SIZE];
-
-            void sendTo(const udp::endpoint& endpoint, const void* data, size_t size);
+            void openShards(size_t shardCount, unsigned short port);
+            // Shard whose socket and io_context serve this room
+            Shard& shardOf(const std::shared_ptr<game::GameWorld>& gameWorld) { return *_shards[gameWorld->getShard()]; }
+
+            void sendTo(Shard& shard, const udp::endpoint& endpoint, const void* data, size_t size,
+                        infrastructure::network::NetworkStats::Slot statsSlot = infrastructure::network::NetworkStats::NO_SLOT);
+            // Sends an already serialized buffer; recipients of a broadcast share the same bytes
+            void sendShared(Shard& shard, const udp::endpoint& endpoint, infrastructure::network::NetworkStats::Slot statsSlot,
+                            const infrastructure::network::SharedSendBuffer& buffer);
+            // Through the tick's bundler when the recipient negotiated GameFeatures::BUNDLES
+            void sendToRecipient(Shard& shard, const game::Recipient& recipient,
+                                 const infrastructure::network::SharedSendBuffer& buffer);
+            // One ReliableEvents packet per player on the reliable channel, with its new and due events
+            void flushReliableEvents(const std::shared_ptr<game::GameWorld>& gameWorld);
             void sendPlayerJoin(const udp::endpoint& endpoint, uint8_t playerId, const std::shared_ptr<game::GameWorld>& gameWorld);
             void sendPlayerLeave(uint8_t playerId, const std::shared_ptr<game::GameWorld>& gameWorld);
-            void sendHeartbeatAck(const udp::endpoint& endpoint);
-            void sendJoinGameAck(const udp::endpoint& endpoint, uint8_t playerId);
-            void sendJoinGameNack(const udp::endpoint& endpoint, const std::string& reason);
+            void sendHeartbeatAck(Shard& shard, const udp::endpoint& endpoint, infrastructure::network::NetworkStats::Slot statsSlot);
+            void sendJoinGameAck(Shard& shard, const udp::endpoint& endpoint, uint8_t playerId,
+                                 SnapshotEncoding snapshotEncoding, uint8_t features);
+            void sendJoinGameNack(Shard& shard, const udp::endpoint& endpoint, const std::string& reason);
             void broadcastSnapshotForRoom(const std::string& roomCode, const std::shared_ptr<game::GameWorld>& gameWorld);
+            // Room over the snapshot caps or budget: one snapshot per player, picked by the room's prioritizer
+            void sendPrioritizedSnapshots(const game::SnapshotCandidates& candidates, uint16_t sequence,
+                                          const std::pmr::vector<game::Recipient>& recipients,
+                                          const std::shared_ptr<game::GameWorld>& gameWorld);
+            // partial: flagged PARTIAL_SNAPSHOT_FLAG, the snapshot only carries some of the room's entities
+            infrastructure::network::SharedSendBuffer buildFullSnapshot(const GameSnapshot& snapshot, SnapshotEncoding encoding,
+                                                                        uint16_t sequence, bool partial,
+                                                                        const std::shared_ptr<game::GameWorld>& gameWorld);
+            // Empty buffer if encoding failed, the caller then sends the full snapshot
+            infrastructure::network::SharedSendBuffer buildSnapshotDelta(const compression::SnapshotImage& baseline,
+                                                                         const compression::SnapshotImage& image,
+                                                                         uint16_t baselineSequence, uint16_t sequence,
+                                                                         bool partial,
+                                                                         const std::shared_ptr<game::GameWorld>& gameWorld);
+            // UDPHeader + payload, LZ4-compressed with the room's context when the CompressionPolicy says it pays
+            infrastructure::network::SharedSendBuffer buildSnapshotDatagram(uint16_t type, uint16_t sequence,
+                                                                            std::span<const uint8_t> payload,
+                                                                            bool useDictionary,
+                                                                            const std::shared_ptr<game::GameWorld>& gameWorld);
             void broadcastAllSnapshots();
             void broadcastMissileSpawned(uint16_t missileId, uint8_t ownerId, const std::shared_ptr<game::GameWorld>& gameWorld);
             void broadcastMissileDestroyed(uint16_t missileId, const std::shared_ptr<game::GameWorld>& gameWorld);
@@ -82,14 +148,19 @@ namespace infrastructure::adapters::in::network {
             template<typename T>
             void broadcastToRoom(MessageType type, const T& payload, const std::shared_ptr<game::GameWorld>& gameWorld);
 
-            void scheduleBroadcast();
+            void scheduleRoomFrames(Shard& shard);
             void scheduleStatsUpdate();
             void scheduleAutoSave();  // Periodic stats auto-save
             void autoSaveAllPlayerStats();  // Save all active players' stats
-            void updateAndBroadcastRoom(const std::string& roomCode, const std::shared_ptr<game::GameWorld>& gameWorld, float deltaTime);
+            // One pass of a room's game loop: the fixed ticks its clock owes, then the snapshot when due
+            void runRoomFrame(const std::string& roomCode, const std::shared_ptr<game::GameWorld>& gameWorld);
+            // Gameplay update of one fixed tick and the events it raised
+            void simulateRoomTick(const std::string& roomCode, const std::shared_ptr<game::GameWorld>& gameWorld, float deltaTime);
 
-            void do_read();
-            void handle_receive(const boost::system::error_code& error, std::size_t bytes_transferred);
+            void do_read(Shard& shard);
+            void handle_receive(Shard& shard, const boost::system::error_code& error, std::size_t bytes_transferred);
+            // Handles one received datagram, whichever receive path read it
+            void handleDatagram(Shard& shard, const udp::endpoint& from, const uint8_t* data, std::size_t bytes);
 
             // Helper to convert endpoint to string for SessionManager
             std::string endpointToString(const udp::endpoint& ep) const;
@@ -112,10 +183,21 @@ namespace infrastructure::adapters::in::network {
                                             uint16_t wave);
 
         public:
+            static constexpr unsigned short GAME_PORT = 4124;
+
+            // shardCount > 1 opens that many SO_REUSEPORT sockets, each on its own io_context thread (Linux only).
+            // port 0 lets the system pick a free one (single shard only: every shard would get its own)
             UDPServer(boost::asio::io_context& io_ctx,
                       std::shared_ptr<SessionManager> sessionManager,
-                      std::shared_ptr<ILeaderboardRepository> leaderboardRepository);
+                      std::shared_ptr<ILeaderboardRepository> leaderboardRepository,
+                      size_t shardCount = 1,
+                      unsigned short port = GAME_PORT);
             ~UDPServer();
+            // Linux only: recvmmsg/sendmmsg batching on the game sockets. Call before start()
+            void enableBatchedIO();
+            // Simulation tick rate, snapshot rate and catch-up cap of the rooms. Call before start()
+            void setSimulationRates(const game::SimulationRates& rates);
+            const game::SimulationRates& getSimulationRates() const { return _simulationRates; }
             void start();
             void run();
             void stop();
@@ -126,8 +208,21 @@ namespace infrastructure::adapters::in::network {
             // CLI support: get player count
             size_t getPlayerCount() const;
 
+            // Number of game sockets (and receive loops) sharing the port
+            size_t getShardCount() const { return _shards.size(); }
+
             // Network stats for monitoring
             std::shared_ptr<infrastructure::network::NetworkStats> getNetworkStats() const { return _networkStats; }
+
+            // Game loop timings of one room, for monitoring
+            struct RoomTickTimes {
+                std::string roomCode;
+                game::TickTimeHistogram::Summary ticks;
+                uint64_t ticksRun = 0;
+                uint64_t ticksSkipped = 0;
+                size_t collisionCandidatePairs = 0;  // Broadphase pairs of the last tick
+            };
+            std::vector<RoomTickTimes> getRoomTickTimes();
     };
 }
 #endif /* !UDPSERVER_HPP_ */
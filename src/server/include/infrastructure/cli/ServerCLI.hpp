@@ -76,6 +76,8 @@ private:
     void listBans();
     void listUsers();
     void listRooms();
+    void listTickTimes();
+    void listCompressionStats();
     void showRoom(const std::string& args);
     void showUser(const std::string& args);
     void closeRoom(const std::string& args);
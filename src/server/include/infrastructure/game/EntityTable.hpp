@@ -0,0 +1,157 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** EntityTable - Dense slot map keyed by the 16-bit wire IDs
+*/
+
+#ifndef ENTITYTABLE_HPP_
+#define ENTITYTABLE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace infrastructure::game {
+
+    /**
+     * @brief Drop-in replacement for std::unordered_map<uint16_t, T> on the per-tick tables.
+     *
+     * Entries live contiguously in a dense array of (id, value) pairs, a sparse
+     * array maps every 16-bit ID to its dense slot:
+     * - find/insert/erase are O(1), erase moves the last entry into the hole,
+     * - iteration walks the dense array, with structured bindings like a map,
+     * - the IDs sent on the wire stay stable, only the dense order changes.
+     *
+     * Both arrays keep their capacity, so a steady-state tick doesn't allocate.
+     * Like std::vector, inserting can invalidate references and iterators; erasing
+     * invalidates the erased entry and the last one.
+     *
+     * The `it = erase(it)` idiom keeps working: the returned iterator points at
+     * the entry moved into the erased slot, which hasn't been visited yet.
+     */
+    template<typename T>
+    class EntityTable {
+    public:
+        using key_type = uint16_t;
+        using mapped_type = T;
+        using value_type = std::pair<uint16_t, T>;
+        using iterator = typename std::vector<value_type>::iterator;
+        using const_iterator = typename std::vector<value_type>::const_iterator;
+
+        EntityTable() = default;
+
+        explicit EntityTable(std::size_t capacity) {
+            reserve(capacity);
+        }
+
+        iterator begin() { return _dense.begin(); }
+        iterator end() { return _dense.end(); }
+        const_iterator begin() const { return _dense.begin(); }
+        const_iterator end() const { return _dense.end(); }
+
+        std::size_t size() const { return _dense.size(); }
+        bool empty() const { return _dense.empty(); }
+
+        void reserve(std::size_t capacity) {
+            _dense.reserve(capacity);
+        }
+
+        /**
+         * @brief Sizes the ID index for IDs below 'count' (at most the whole 16-bit range).
+         *
+         * IDs only grow until they wrap, so a long game ends up indexing the whole
+         * range anyway; doing it upfront keeps new IDs from growing the index mid-tick.
+         */
+        void reserveIds(std::size_t count) {
+            count = std::min<std::size_t>(count, std::size_t{UINT16_MAX} + 1);
+            if (count > _sparse.size())
+                _sparse.resize(count, NONE);
+        }
+
+        void clear() {
+            for (const auto& entry : _dense)
+                _sparse[entry.first] = NONE;
+            _dense.clear();
+        }
+
+        iterator find(uint16_t id) {
+            uint16_t slot = slotOf(id);
+            return slot == NONE ? _dense.end() : _dense.begin() + slot;
+        }
+
+        const_iterator find(uint16_t id) const {
+            uint16_t slot = slotOf(id);
+            return slot == NONE ? _dense.end() : _dense.begin() + slot;
+        }
+
+        bool contains(uint16_t id) const { return slotOf(id) != NONE; }
+        std::size_t count(uint16_t id) const { return contains(id) ? 1 : 0; }
+
+        /**
+         * @brief Returns the value of 'id', default-constructing it if absent.
+         */
+        T& operator[](uint16_t id) {
+            uint16_t slot = slotOf(id);
+            if (slot != NONE)
+                return _dense[slot].second;
+            growSparse(id);
+            _sparse[id] = static_cast<uint16_t>(_dense.size());
+            _dense.emplace_back(id, T{});
+            return _dense.back().second;
+        }
+
+        /**
+         * @brief Removes 'id' if present.
+         * @return 1 if an entry was removed, 0 otherwise
+         */
+        std::size_t erase(uint16_t id) {
+            uint16_t slot = slotOf(id);
+            if (slot == NONE)
+                return 0;
+            removeSlot(slot);
+            return 1;
+        }
+
+        /**
+         * @brief Removes the entry at 'it'.
+         * @return Iterator to the entry now in that slot (end() if it was the last one)
+         */
+        iterator erase(iterator it) {
+            std::size_t slot = static_cast<std::size_t>(it - _dense.begin());
+            removeSlot(slot);
+            return _dense.begin() + static_cast<std::ptrdiff_t>(slot);
+        }
+
+    private:
+        static constexpr uint16_t NONE = UINT16_MAX;  // Dense slots stop at 65534
+
+        std::vector<value_type> _dense;
+        std::vector<uint16_t> _sparse;   // ID -> dense slot, grown up to the highest ID seen
+
+        uint16_t slotOf(uint16_t id) const {
+            return id < _sparse.size() ? _sparse[id] : NONE;
+        }
+
+        void growSparse(uint16_t id) {
+            if (id < _sparse.size())
+                return;
+            std::size_t wanted = std::max<std::size_t>({static_cast<std::size_t>(id) + 1, _sparse.size() * 2, 64});
+            _sparse.resize(std::min<std::size_t>(wanted, std::size_t{UINT16_MAX} + 1), NONE);
+        }
+
+        void removeSlot(std::size_t slot) {
+            _sparse[_dense[slot].first] = NONE;
+            if (slot + 1 != _dense.size()) {
+                _dense[slot] = std::move(_dense.back());
+                _sparse[_dense[slot].first] = static_cast<uint16_t>(slot);
+            }
+            _dense.pop_back();
+        }
+    };
+
+}
+
+#endif /* !ENTITYTABLE_HPP_ */
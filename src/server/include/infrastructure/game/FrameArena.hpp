@@ -0,0 +1,99 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** FrameArena - Monotonic allocator for the containers that only live for one tick
+*/
+
+#ifndef FRAMEARENA_HPP_
+#define FRAMEARENA_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace infrastructure::game {
+
+    /**
+     * @brief Per-room bump allocator, reset at the start of every tick.
+     *
+     * Per-tick containers (event lists, endpoint lists, packet buffers) are
+     * std::pmr containers on resource(): allocating is a pointer bump and
+     * deallocating is a no-op, everything is dropped at once by reset().
+     *
+     * When a tick needs more than the block, the extra memory comes from the
+     * heap and reset() doubles the block once to fit it, so the heap is only
+     * touched until the arena has grown to the room's peak tick.
+     *
+     * Not thread-safe: use it from the room's strand only. Anything allocated
+     * from it is invalid after the next reset().
+     */
+    class FrameArena {
+    public:
+        static constexpr std::size_t DEFAULT_CAPACITY = 64 * 1024;
+
+        explicit FrameArena(std::size_t capacity = DEFAULT_CAPACITY) {
+            allocateBlock(capacity);
+        }
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        std::pmr::memory_resource* resource() { return &*_resource; }
+
+        /**
+         * @brief Drops everything allocated since the last reset.
+         */
+        void reset() {
+            if (_overflow.used == 0) {
+                _resource->release();
+                return;
+            }
+            std::size_t wanted = _capacity;
+            while (wanted < _capacity + _overflow.used)
+                wanted *= 2;
+            allocateBlock(wanted);
+        }
+
+        std::size_t capacity() const { return _capacity; }
+
+        /**
+         * @brief Bytes that didn't fit in the block since the last reset.
+         */
+        std::size_t overflowBytes() const { return _overflow.used; }
+
+    private:
+        // Heap fallback that remembers how much the block was short
+        struct OverflowResource : std::pmr::memory_resource {
+            std::size_t used = 0;
+
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+                used += bytes;
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+            void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+                std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+            }
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+                return this == &other;
+            }
+        };
+
+        std::unique_ptr<std::byte[]> _block;
+        std::size_t _capacity = 0;
+        OverflowResource _overflow;
+        std::optional<std::pmr::monotonic_buffer_resource> _resource;
+
+        void allocateBlock(std::size_t capacity) {
+            _resource.reset();  // Returns the overflow chunks
+            _block = std::make_unique<std::byte[]>(capacity);
+            _capacity = capacity;
+            _overflow.used = 0;
+            _resource.emplace(_block.get(), _capacity, &_overflow);
+        }
+    };
+
+}
+
+#endif /* !FRAMEARENA_HPP_ */
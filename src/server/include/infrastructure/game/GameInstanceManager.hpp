@@ -49,6 +49,19 @@ public:
      */
     std::shared_ptr<GameWorld> getOrCreateInstance(const std::string& roomCode);
 
+    /**
+     * @brief Get or create a GameWorld instance pinned to a network shard
+     * @param roomCode The unique room code
+     * @param shardContext io_context of the shard, runs the new instance's strand
+     * @param shard Index of the shard
+     * @return shared_ptr to the GameWorld (never null after call)
+     *
+     * An existing instance keeps the shard it was created on.
+     * Thread-safe.
+     */
+    std::shared_ptr<GameWorld> getOrCreateInstance(const std::string& roomCode,
+                                                   boost::asio::io_context& shardContext, size_t shard);
+
     /**
      * @brief Get an existing GameWorld instance
      * @param roomCode The room code to look up
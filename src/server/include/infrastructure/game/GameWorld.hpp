@@ -9,12 +9,27 @@
 #define GAMEWORLD_HPP_
 
 #include "Protocol.hpp"
+#include "ReliableChannel.hpp"
+#include "infrastructure/game/EntityTable.hpp"
+#include "infrastructure/game/FrameArena.hpp"
+#include "infrastructure/game/SimulationClock.hpp"
+#include "infrastructure/game/TickTimeHistogram.hpp"
+#include "infrastructure/game/SnapshotPrioritizer.hpp"
+#include "compression/SnapshotDelta.hpp"
+#include "compression/CompressionContext.hpp"
+#include "compression/SnapshotDictionary.hpp"
+#include "collision/SpatialGrid.hpp"
+#include "collision/AABBBatch.hpp"
 #include <boost/asio.hpp>
+#include <algorithm>
+#include <atomic>
 #include <unordered_map>
 #include <unordered_set>
 #include <optional>
 #include <vector>
 #include <array>
+#include <memory_resource>
+#include <span>
 #include <chrono>
 #include <random>
 
@@ -82,6 +97,11 @@ namespace infrastructure::game {
         uint8_t health;
         bool alive;
         udp::endpoint endpoint;
+        uint32_t statsSlot = UINT32_MAX;  // NetworkStats counter slot, set by the server (none by default)
+        std::optional<uint16_t> ackedSnapshot = std::nullopt;  // Last snapshot the client decoded, baseline of its deltas
+        SnapshotEncoding snapshotEncoding = SnapshotEncoding::Bytes;  // Negotiated at JoinGame
+        uint8_t features = 0;  // GameFeatures negotiated at JoinGame
+        std::unique_ptr<reliable::ReliableSender> reliableEvents = nullptr;  // Set with GameFeatures::RELIABLE_EVENTS
         std::chrono::steady_clock::time_point lastActivity;
         uint8_t shipSkin = 1;  // Ship skin variant (1-6 for Ship1.png to Ship6.png)
         // Weapon system (Gameplay Phase 2)
@@ -101,6 +121,17 @@ namespace infrastructure::game {
         bool godMode = false;          // Hidden: player is invincible (no HP loss)
     };
 
+    // Where a room broadcast goes, which stats slot counts it, and how its snapshots and events are sent
+    struct Recipient {
+        uint8_t playerId;
+        udp::endpoint endpoint;
+        uint32_t statsSlot;
+        std::optional<uint16_t> ackedSnapshot;
+        SnapshotEncoding snapshotEncoding = SnapshotEncoding::Bytes;
+        reliable::ReliableSender* reliableEvents = nullptr;  // Events go through it instead of their own datagram
+        uint8_t features = 0;
+    };
+
     struct Missile {
         uint16_t id;
         uint8_t owner_id;
@@ -364,7 +395,11 @@ namespace infrastructure::game {
 
         // Get combo as uint8_t (x10, e.g., 1.5x = 15)
         uint8_t getComboEncoded() const {
-            return static_cast<uint8_t>(std::clamp(comboMultiplier * 10.0f, 10.0f, 30.0f));
+            return encodeCombo(comboMultiplier);
+        }
+
+        static uint8_t encodeCombo(float multiplier) {
+            return static_cast<uint8_t>(std::clamp(multiplier * 10.0f, 10.0f, 30.0f));
         }
 
         // Get best combo as uint16_t (x10)
@@ -544,6 +579,40 @@ namespace infrastructure::game {
         static constexpr float DRIFT_SPEED = -30.0f;  // Slow drift left
     };
 
+    // Per-enemy contact damage cooldowns of a Force Pod or Bit Device.
+    // A flat list: it only ever holds the few enemies touched in the last
+    // HIT_COOLDOWN seconds, and keeps its capacity once they expire.
+    struct HitCooldowns {
+        static constexpr std::size_t CAPACITY = 8;  // Enemies in contact at once, before growing
+
+        std::vector<std::pair<uint16_t, float>> entries;  // enemyId -> time remaining
+
+        HitCooldowns() { entries.reserve(CAPACITY); }
+
+        bool active(uint16_t enemyId) const {
+            return std::any_of(entries.begin(), entries.end(),
+                [enemyId](const auto& entry) { return entry.first == enemyId && entry.second > 0.0f; });
+        }
+
+        void start(uint16_t enemyId, float duration) {
+            for (auto& entry : entries) {
+                if (entry.first == enemyId) {
+                    entry.second = duration;
+                    return;
+                }
+            }
+            entries.emplace_back(enemyId, duration);
+        }
+
+        void update(float deltaTime) {
+            for (auto& entry : entries)
+                entry.second -= deltaTime;
+            std::erase_if(entries, [](const auto& entry) { return entry.second <= 0.0f; });
+        }
+
+        bool empty() const { return entries.empty(); }
+    };
+
     // Force Pod structure
     struct ForcePod {
         uint8_t ownerId;
@@ -555,7 +624,7 @@ namespace infrastructure::game {
         uint8_t level;        // 1-2
 
         // Damage cooldown per enemy (prevents multi-frame damage)
-        std::unordered_map<uint16_t, float> hitCooldowns;  // enemyId -> time remaining
+        HitCooldowns hitCooldowns;
         float bossHitCooldown = 0.0f;
 
         // R-Type Authentic: Force Pod shoots when player shoots
@@ -581,7 +650,7 @@ namespace infrastructure::game {
         float shootCooldown = 0.0f;
 
         // Damage cooldown per enemy (prevents multi-frame damage)
-        std::unordered_map<uint16_t, float> hitCooldowns;
+        HitCooldowns hitCooldowns;
         float bossHitCooldown = 0.0f;
 
         static constexpr float WIDTH = 24.0f;
@@ -626,13 +695,37 @@ namespace infrastructure::game {
     class GameWorld {
     public:
         // Constructor requires io_context to create the strand
-        explicit GameWorld(boost::asio::io_context& io_ctx);
+        // shard: index of the network shard the room is pinned to (the strand runs on its io_context)
+        explicit GameWorld(boost::asio::io_context& io_ctx, size_t shard = 0);
 
         // Get the strand for this GameWorld (used to serialize operations)
         boost::asio::strand<boost::asio::io_context::executor_type>& getStrand() {
             return _strand;
         }
 
+        size_t getShard() const { return _shard; }
+
+        // ═══════════════════════════════════════════════════════════════════
+        // Frame Arena (per-tick allocations)
+        // ═══════════════════════════════════════════════════════════════════
+
+        // Drops the previous frame's arena allocations, called first thing in a frame (before its ticks)
+        void beginFrame() { _frameArena.reset(); }
+
+        // Backs the per-tick containers, valid until the next beginFrame()
+        std::pmr::memory_resource* frameResource() { return _frameArena.resource(); }
+
+        // ═══════════════════════════════════════════════════════════════════
+        // Game Loop (fixed-step simulation, snapshot rate, tick timings)
+        // ═══════════════════════════════════════════════════════════════════
+
+        // Decides how many fixed ticks each frame runs and when snapshots go out (strand only)
+        SimulationClock& getSimulationClock() { return _simulationClock; }
+        const SimulationClock& getSimulationClock() const { return _simulationClock; }
+        // Duration of the room's ticks, readable from any thread
+        TickTimeHistogram& getTickTimes() { return _tickTimes; }
+        const TickTimeHistogram& getTickTimes() const { return _tickTimes; }
+
         // ═══════════════════════════════════════════════════════════════════
         // Game Speed Configuration (per-room setting)
         // ═══════════════════════════════════════════════════════════════════
@@ -643,6 +736,9 @@ namespace infrastructure::game {
         uint16_t getGameSpeedPercent() const { return _gameSpeedPercent; }
         float getGameSpeedMultiplier() const { return _gameSpeedMultiplier; }
 
+        // Reseeds the gameplay PRNG (waves, drops, patterns), for reproducible runs
+        void seedRandom(uint32_t seed) { _rng.seed(seed); }
+
         // ═══════════════════════════════════════════════════════════════════
         // Player Management
         // ═══════════════════════════════════════════════════════════════════
@@ -668,7 +764,8 @@ namespace infrastructure::game {
 
 #ifdef USE_ECS_BACKEND
         // Phase 4.7: Run ECS systems as primary driver
-        // This runs all ECS systems and syncs state back to legacy maps
+        // Positions, velocities, enemy health, weapon cooldowns and combos live in the
+        // ECS pools only; this just drops the records of entities the systems deleted
         void runECSUpdate(float deltaTime);
 #endif
 
@@ -676,25 +773,54 @@ namespace infrastructure::game {
         std::optional<udp::endpoint> getEndpointByPlayerId(uint8_t playerId) const;
 
         GameSnapshot getSnapshot() const;
-        std::vector<udp::endpoint> getAllEndpoints() const;
+        // Every entity, uncapped: what the per-player snapshots are picked from
+        SnapshotCandidates getSnapshotCandidates(
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+        std::pmr::vector<udp::endpoint> getAllEndpoints(
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+        std::pmr::vector<Recipient> getRecipients(std::pmr::memory_resource* resource) const;
+        void setPlayerStatsSlot(uint8_t playerId, uint32_t slot);
+        void setPlayerSnapshotEncoding(uint8_t playerId, SnapshotEncoding encoding);
+        // GameFeatures negotiated at JoinGame; RELIABLE_EVENTS opens the player's reliable-ordered channel
+        void setPlayerFeatures(uint8_t playerId, uint8_t features);
+        void ackReliableEvents(uint8_t playerId, uint16_t ack, uint32_t ackBits);
+
+        // Snapshot deltas: the room keeps the images of its last snapshots,
+        // each player's deltas are encoded against the last one it acked
+        uint16_t nextSnapshotSequence() { return ++_snapshotSequence; }
+        compression::SnapshotHistory& getSnapshotHistory() { return _snapshotHistory; }
+        // LZ4 state of the room's snapshots, primed with SNAPSHOT_DICTIONARY (room strand only)
+        compression::CompressionContext& getSnapshotCompressor() { return _snapshotCompressor; }
+        // Ignored unless newer than the player's current ack and still in the room's or the player's history
+        void ackSnapshot(uint8_t playerId, uint16_t sequence);
+
+        // Interest management: once the room holds more than one snapshot fits,
+        // each player gets the entities that matter most to it
+        SnapshotPrioritizer& getSnapshotPrioritizer() { return _snapshotPrioritizer; }
+        size_t getSnapshotBudget() const { return _snapshotBudget; }
+        void setSnapshotBudget(size_t budget) { _snapshotBudget = budget; }
         size_t getPlayerCount() const;
 
         uint16_t spawnMissile(uint8_t playerId);
         void updateMissiles(float deltaTime);
-        std::vector<uint16_t> getDestroyedMissiles();
+        // Event lists of the current tick, valid until the next tick
+        std::span<const uint16_t> getDestroyedMissiles() const;
         std::optional<Missile> getMissile(uint16_t missileId) const;
 
         void updateWaveSpawning(float deltaTime);
         void updateEnemies(float deltaTime);
         void checkCollisions();
-        std::vector<uint16_t> getDestroyedEnemies();
-        std::vector<std::pair<uint8_t, uint8_t>> getPlayerDamageEvents();
-        std::vector<uint8_t> getDeadPlayers();
+        // Box pairs the last checkCollisions() broadphase sent to the narrowphase
+        size_t getCollisionCandidatePairs() const;
+        std::span<const uint16_t> getDestroyedEnemies() const;
+        std::span<const std::pair<uint8_t, uint8_t>> getPlayerDamageEvents() const;
+        std::span<const uint8_t> getDeadPlayers() const;
 
         bool isPlayerAlive(uint8_t playerId) const;
+        uint8_t getPlayerHealth(uint8_t playerId) const;  // 0 for unknown players
 
         void updatePlayerActivity(uint8_t playerId);
-        std::vector<uint8_t> checkPlayerTimeouts(std::chrono::milliseconds timeout);
+        std::pmr::vector<uint8_t> checkPlayerTimeouts(std::chrono::milliseconds timeout);  // Frame arena
 
         // ═══════════════════════════════════════════════════════════════════
         // Score System (Gameplay Phase 2)
@@ -743,7 +869,7 @@ namespace infrastructure::game {
         WeaponType getPlayerWeapon(uint8_t playerId) const;
         void updateShootCooldowns(float deltaTime);
         bool canPlayerShoot(uint8_t playerId) const;
-        std::vector<uint16_t> spawnMissileWithWeapon(uint8_t playerId);  // Returns multiple IDs for spread
+        std::pmr::vector<uint16_t> spawnMissileWithWeapon(uint8_t playerId);  // Returns multiple IDs for spread (frame arena)
 
         // ═══════════════════════════════════════════════════════════════════
         // R-Type Authentic Mechanics - Phase 3
@@ -756,10 +882,11 @@ namespace infrastructure::game {
         uint16_t releaseCharge(uint8_t playerId);  // Returns WaveCannon ID (0 if none created)
         uint16_t spawnWaveCannon(uint8_t playerId, uint8_t chargeLevel);
         void updateWaveCannons(float deltaTime);
-        std::vector<uint16_t> getDestroyedWaveCannons();
+        // Taken out of the world into the frame arena
+        std::pmr::vector<uint16_t> getDestroyedWaveCannons();
         uint8_t getPlayerChargeLevel(uint8_t playerId) const;
         std::optional<WaveCannonProjectile> getWaveCannon(uint16_t id) const;
-        const std::unordered_map<uint16_t, WaveCannonProjectile>& getWaveCannons() const { return _waveCannons; }
+        const EntityTable<WaveCannonProjectile>& getWaveCannons() const { return _waveCannons; }
 
         // Power-up System
         void spawnPowerUp(float x, float y);
@@ -768,11 +895,12 @@ namespace infrastructure::game {
         void checkPowerUpCollisions();
         void applyPowerUp(uint8_t playerId, PowerUpType type);
         void spawnPOWArmor();
-        std::vector<PowerUpCollected> getCollectedPowerUps();
-        std::vector<uint16_t> getExpiredPowerUps();
-        std::vector<uint16_t> getNewlySpawnedPowerUps();  // Power-ups created this tick
+        // Taken out of the world into the frame arena
+        std::pmr::vector<PowerUpCollected> getCollectedPowerUps();
+        std::pmr::vector<uint16_t> getExpiredPowerUps();
+        std::pmr::vector<uint16_t> getNewlySpawnedPowerUps();  // Power-ups created this tick
         std::optional<PowerUp> getPowerUp(uint16_t id) const;
-        const std::unordered_map<uint16_t, PowerUp>& getPowerUps() const { return _powerUps; }
+        const EntityTable<PowerUp>& getPowerUps() const { return _powerUps; }
 
         // Force Pod System
         void giveForceToPlayer(uint8_t playerId);
@@ -783,7 +911,7 @@ namespace infrastructure::game {
         const std::unordered_map<uint8_t, ForcePod>& getForcePods() const { return _forcePods; }
 
         // Force Pod Shooting (R-Type authentic - Force shoots when player shoots)
-        std::vector<uint16_t> spawnForceMissiles(uint8_t playerId);
+        std::pmr::vector<uint16_t> spawnForceMissiles(uint8_t playerId);
 
         // Bit Device System (R-Type authentic - 2 orbiting satellites)
         void giveBitDevicesToPlayer(uint8_t playerId);
@@ -791,7 +919,7 @@ namespace infrastructure::game {
         void checkBitCollisions();
         bool playerHasBits(uint8_t playerId) const;
         const std::unordered_map<uint8_t, std::array<BitDevice, 2>>& getBitDevices() const { return _bitDevices; }
-        std::vector<uint16_t> spawnBitMissiles(uint8_t playerId);
+        std::pmr::vector<uint16_t> spawnBitMissiles(uint8_t playerId);
 
         // Speed helper
         float getPlayerMoveSpeed(uint8_t playerId) const;
@@ -816,6 +944,20 @@ namespace infrastructure::game {
         // Strand for serializing all operations on this GameWorld
         // All access to this GameWorld should go through this strand
         boost::asio::strand<boost::asio::io_context::executor_type> _strand;
+        size_t _shard;
+
+        // Per-tick allocations, reset by beginFrame()
+        FrameArena _frameArena;
+
+        SimulationClock _simulationClock;
+        TickTimeHistogram _tickTimes;
+
+        // Images of the last snapshots sent, baselines of the per-player deltas
+        compression::SnapshotHistory _snapshotHistory;
+        uint16_t _snapshotSequence = 0;
+        compression::CompressionContext _snapshotCompressor{compression::SNAPSHOT_DICTIONARY};
+        SnapshotPrioritizer _snapshotPrioritizer;
+        size_t _snapshotBudget = SnapshotPrioritizer::DEFAULT_BUDGET;
 
         // Game speed configuration
         uint16_t _gameSpeedPercent = 100;      // 50-200, default 100%
@@ -834,16 +976,53 @@ namespace infrastructure::game {
         std::unordered_map<uint8_t, uint16_t> _playerInputs;      // Player ID -> input keys bitfield
         std::unordered_map<uint8_t, uint16_t> _playerLastInputSeq; // Player ID -> last input sequence
         std::unordered_map<uint8_t, PlayerScore> _playerScores;   // Player ID -> score data
-        std::unordered_map<uint16_t, Missile> _missiles;
+        EntityTable<Missile> _missiles;
         std::vector<uint16_t> _destroyedMissiles;
         uint8_t _nextPlayerId;
         uint16_t _nextMissileId = 1;
 
-        std::unordered_map<uint16_t, Enemy> _enemies;
-        std::unordered_map<uint16_t, Missile> _enemyMissiles;
+        EntityTable<Enemy> _enemies;
+        EntityTable<Missile> _enemyMissiles;
         std::vector<uint16_t> _destroyedEnemies;
         std::vector<std::pair<uint8_t, uint8_t>> _playerDamageEvents;
         std::vector<uint8_t> _deadPlayers;
+
+
+        // Collision scratch buffers, reused every tick
+        std::atomic<size_t> _collisionCandidatePairs{0};  // Read off the room's strand for monitoring
+        std::vector<EntityTable<Enemy>::value_type*> _collisionEnemies;  // Same order as _enemyBoxes
+        collision::AABBBatch _enemyBoxes;
+        std::vector<uint32_t> _collisionHits;
+#ifndef USE_ECS_BACKEND
+        collision::SpatialGrid _collisionGrid;  // checkCollisions() broadphase over enemies
+#endif
+
+        // Gathers _enemies into _collisionEnemies/_enemyBoxes (table order)
+        void gatherEnemyBoxes();
+
+        // Copies a consumed event list into the frame arena, the list keeps its capacity
+        template<typename T>
+        std::pmr::vector<T> takeIntoFrame(std::vector<T>& events) {
+            std::pmr::vector<T> taken(events.begin(), events.end(), _frameArena.resource());
+            events.clear();
+            return taken;
+        }
+
+        // Simulated state, read and written through these in both modes: with
+        // USE_ECS_BACKEND it lives in the ECS components (the record fields only
+        // hold the spawn values), otherwise in the records themselves
+        struct Vec2 {
+            float x;
+            float y;
+        };
+        Vec2 playerPosition(const ConnectedPlayer& player) const;
+        Vec2 missilePosition(const Missile& missile) const;
+        Vec2 enemyPosition(const Enemy& enemy) const;
+        uint8_t enemyHealth(const Enemy& enemy) const;
+        uint8_t damageEnemy(Enemy& enemy, uint8_t damage);  // Returns the damage actually dealt
+        float playerCombo(uint8_t playerId) const;
+        void setPlayerCombo(uint8_t playerId, float multiplier);  // Also restarts the combo timer
+
         float _waveTimer = 0.0f;
         float _currentWaveInterval = WAVE_INTERVAL_MIN;
         uint16_t _waveNumber = 0;
@@ -857,11 +1036,11 @@ namespace infrastructure::game {
         std::vector<SpawnEntry> _spawnQueue;
 
         // R-Type Authentic Mechanics - Phase 3
-        std::unordered_map<uint16_t, WaveCannonProjectile> _waveCannons;
+        EntityTable<WaveCannonProjectile> _waveCannons;
         std::vector<uint16_t> _destroyedWaveCannons;
         uint16_t _nextWaveCannonId = 1;
 
-        std::unordered_map<uint16_t, PowerUp> _powerUps;
+        EntityTable<PowerUp> _powerUps;
         std::vector<PowerUpCollected> _collectedPowerUps;
         std::vector<uint16_t> _expiredPowerUps;
         std::vector<uint16_t> _newlySpawnedPowerUps;  // Power-ups created this tick
@@ -881,7 +1060,11 @@ namespace infrastructure::game {
         // Mapping from player ID to ECS EntityID (for entity lookup/deletion)
         std::unordered_map<uint8_t, ECS::EntityID> _playerEntityIds;
         // ECS Core (mutable to allow const methods like getSnapshot() to query entities)
+#ifdef ECS_ARCHETYPE_STORAGE
+        mutable ECS::ECS _ecs{ECS::StorageMode::Archetype};
+#else
         mutable ECS::ECS _ecs;
+#endif
 
         // Domain Services (stateless, business logic)
         domain::services::GameRule _gameRule;
@@ -920,7 +1103,7 @@ namespace infrastructure::game {
         void deleteMissileEntity(uint16_t missileId);
 
         // Mapping from missile ID to ECS EntityID
-        std::unordered_map<uint16_t, ECS::EntityID> _missileEntityIds;
+        EntityTable<ECS::EntityID> _missileEntityIds;
 
         // Enemy entity creation (Phase 4.4)
         ECS::EntityID createEnemyEntity(uint16_t enemyId, float x, float y, uint8_t health,
@@ -930,7 +1113,22 @@ namespace infrastructure::game {
         void deleteEnemyEntity(uint16_t enemyId);
 
         // Mapping from enemy ID to ECS EntityID
-        std::unordered_map<uint16_t, ECS::EntityID> _enemyEntityIds;
+        EntityTable<ECS::EntityID> _enemyEntityIds;
+
+        // Reverse mapping, indexed by ECS::entityIndex(): which missile/enemy an entity slot
+        // holds. Slots are reused, so the full handle is stored and compared.
+        struct WireRef {
+            ECS::EntityID entity = UINT64_MAX;
+            uint16_t id = 0;
+            bool isEnemy = false;
+        };
+        std::vector<WireRef> _wireRefs;
+        void setWireRef(ECS::EntityID entity, uint16_t id, bool isEnemy);
+
+        // Returns the ECS entity of a player/missile/enemy, nullopt if it has none (anymore)
+        std::optional<ECS::EntityID> playerEntity(uint8_t playerId) const;
+        std::optional<ECS::EntityID> missileEntity(uint16_t missileId) const;
+        std::optional<ECS::EntityID> enemyEntity(uint16_t enemyId) const;
 
         // ═══════════════════════════════════════════════════════════════════
         // Phase 4.7: ECS as primary driver
@@ -939,27 +1137,13 @@ namespace infrastructure::game {
         // Queue input to ECS PlayerInputSystem (called from applyPlayerInput)
         void queueInputToECS(uint8_t playerId, uint16_t keys, uint16_t sequenceNum);
 
-        // Sync positions from ECS to legacy maps (temporary, until getSnapshot reads from ECS)
-        void syncPlayersFromECS();
-        void syncMissilesFromECS();
-        void syncEnemiesFromECS();
-
-        // Phase 5.1: Sync deleted entities from ECS to legacy maps
-        // Called after ECS Update to detect entities deleted by CleanupSystem/LifetimeSystem
-        void syncDeletedMissilesFromECS();
-        void syncDeletedEnemiesFromECS();
-
         // Phase 5.3: Process kill events from DamageSystem
-        // Awards score, spawns power-ups, marks enemies as destroyed
+        // Awards score and spawns power-ups at the kill position
         void processECSKillEvents(const std::vector<ecs::systems::KillEvent>& killEvents);
 
-        // Phase 5.4: Sync combo data from ECS to legacy
-        // ScoreSystem handles combo decay, syncs to _playerScores for awardKillScore()
-        void syncComboFromECS();
-
-        // Phase 5.6: Sync weapon cooldowns from ECS to legacy
-        // WeaponSystem handles cooldown decay, syncs to _players for canPlayerShoot()
-        void syncCooldownsFromECS();
+        // Drops the missile/enemy records of the entities deleted by the last ECS Update
+        // (DamageSystem kills, CleanupSystem/LifetimeSystem removals) and reports them destroyed
+        void removeDeletedECSEntities();
 #endif
 
         uint8_t findAvailableId() const;
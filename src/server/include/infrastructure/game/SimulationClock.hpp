@@ -0,0 +1,105 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SimulationClock - Fixed-step simulation and snapshot schedule of a room
+*/
+
+#ifndef SIMULATIONCLOCK_HPP_
+#define SIMULATIONCLOCK_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace infrastructure::game {
+
+    /**
+     * @brief How often a room simulates and how often it sends snapshots.
+     */
+    struct SimulationRates {
+        static constexpr uint32_t DEFAULT_TICK_RATE = 60;
+        static constexpr uint32_t DEFAULT_SNAPSHOT_RATE = 20;
+        static constexpr uint32_t DEFAULT_MAX_CATCH_UP_TICKS = 4;
+
+        uint32_t tickRate = DEFAULT_TICK_RATE;          // Simulation ticks per second
+        uint32_t snapshotRate = DEFAULT_SNAPSHOT_RATE;  // Snapshots per second, at most tickRate
+        uint32_t maxCatchUpTicks = DEFAULT_MAX_CATCH_UP_TICKS;  // Ticks run at most per frame
+
+        bool operator==(const SimulationRates&) const = default;
+    };
+
+    /**
+     * @brief Fixed-timestep accumulator driving a room's game loop.
+     *
+     * Each frame hands advance() the current time; the elapsed time goes
+     * into an accumulator that is spent in whole ticks of 1/tickRate
+     * seconds, so the simulation always steps by the same deltaTime however
+     * late the frame runs. Snapshots have their own accumulator and are due
+     * at most once per frame.
+     *
+     * Under overload (a frame owes more than maxCatchUpTicks ticks), the
+     * room runs maxCatchUpTicks and drops the rest of the backlog: the game
+     * slows down for that frame instead of spiralling into ever longer
+     * catch-up frames.
+     *
+     * advance() must be called from the room's strand; the counters can be
+     * read from anywhere.
+     */
+    class SimulationClock {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        struct Step {
+            uint32_t ticks = 0;        // Ticks to simulate this frame
+            uint32_t skipped = 0;      // Ticks owed but dropped by the catch-up cap
+            bool snapshotDue = false;  // Send a snapshot after the ticks
+        };
+
+        explicit SimulationClock(SimulationRates rates = {});
+
+        SimulationClock(const SimulationClock&) = delete;
+        SimulationClock& operator=(const SimulationClock&) = delete;
+
+        /**
+         * @brief Changes the rates; the accumulators start over when they differ
+         */
+        void setRates(const SimulationRates& rates);
+        const SimulationRates& getRates() const { return _rates; }
+
+        /**
+         * @brief Spends the time elapsed since the last frame
+         *
+         * The first frame runs one tick and sends a snapshot.
+         */
+        Step advance(Clock::time_point now);
+
+        Clock::duration getTickInterval() const { return _tickInterval; }
+        // deltaTime of every tick, in seconds
+        float getTickSeconds() const { return _tickSeconds; }
+
+        uint64_t getTicksRun() const { return _ticksRun.load(std::memory_order_relaxed); }
+        uint64_t getTicksSkipped() const { return _ticksSkipped.load(std::memory_order_relaxed); }
+        uint64_t getSnapshotsDue() const { return _snapshotsDue.load(std::memory_order_relaxed); }
+
+        static Clock::duration intervalOf(uint32_t perSecond);
+
+    private:
+        SimulationRates _rates;
+        Clock::duration _tickInterval{};
+        Clock::duration _snapshotInterval{};
+        float _tickSeconds = 0.0f;
+
+        std::optional<Clock::time_point> _lastFrame;
+        Clock::duration _tickAccumulator{};
+        Clock::duration _snapshotAccumulator{};
+
+        std::atomic<uint64_t> _ticksRun{0};
+        std::atomic<uint64_t> _ticksSkipped{0};
+        std::atomic<uint64_t> _snapshotsDue{0};
+    };
+
+}
+
+#endif /* !SIMULATIONCLOCK_HPP_ */
@@ -0,0 +1,123 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SnapshotPrioritizer - Per-player interest management for room snapshots
+*/
+
+#ifndef SNAPSHOTPRIORITIZER_HPP_
+#define SNAPSHOTPRIORITIZER_HPP_
+
+#include "Protocol.hpp"
+#include "infrastructure/game/EntityTable.hpp"
+#include "compression/SnapshotDelta.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+namespace infrastructure::game {
+
+    /**
+     * @brief Everything a snapshot could carry, before the per-packet caps.
+     *
+     * Players, wave, boss, forces and bits always fit and go in base as is;
+     * missiles, enemies and enemy missiles are listed in full, base keeps
+     * their counts at 0.
+     */
+    struct SnapshotCandidates {
+        GameSnapshot base{};
+        std::pmr::vector<MissileState> missiles;
+        std::pmr::vector<EnemyState> enemies;
+        std::pmr::vector<MissileState> enemyMissiles;
+
+        explicit SnapshotCandidates(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : missiles(resource), enemies(resource), enemyMissiles(resource) {}
+    };
+
+    /**
+     * @brief Picks which entities each player's snapshot carries when the room
+     * holds more than one snapshot can.
+     *
+     * Every player keeps a priority accumulator per entity. Each snapshot adds
+     * the entity's weight to it, scaled up when the entity is close to the
+     * player's ship and when it moved or was hit since it was last sent to that
+     * player. The highest priorities that fit the caps and the byte budget are
+     * sent and drop back to 0; the others keep growing, so far entities still
+     * get refreshed, only less often. Entities never sent start ahead of
+     * everything else.
+     *
+     * The per-player snapshots also get their own image history, the baselines
+     * of their deltas.
+     */
+    class SnapshotPrioritizer {
+    public:
+        // Snapshot payload that keeps the datagram within 1200 bytes
+        static constexpr size_t DEFAULT_BUDGET = 1200 - UDPHeader::WIRE_SIZE - CompressionHeader::WIRE_SIZE;
+
+        // Priority gained per snapshot
+        static constexpr float MISSILE_WEIGHT = 1.0f;
+        static constexpr float ENEMY_MISSILE_WEIGHT = 1.5f;  // Can hit the player
+        static constexpr float ENEMY_WEIGHT = 2.0f;
+        static constexpr float NEW_ENTITY_PRIORITY = 1000.0f;
+
+        // Up to NEAR_BOOST times the weight within INTEREST_RADIUS of the ship
+        static constexpr float INTEREST_RADIUS = 600.0f;
+        static constexpr float NEAR_BOOST = 3.0f;
+        // Each CHANGE_SCALE of position error (px, a health point counts for 4)
+        // adds the weight once more, up to MAX_CHANGE_BOOST times
+        static constexpr float CHANGE_SCALE = 32.0f;
+        static constexpr float MAX_CHANGE_BOOST = 4.0f;
+
+        // Whether all the candidates fit one snapshot, which every player can then share
+        static bool fitsWhole(const SnapshotCandidates& candidates, size_t budget);
+        // The first candidates that fit the caps, in world order
+        static void takeFirst(const SnapshotCandidates& candidates, GameSnapshot& out);
+
+        /**
+         * @brief Fills out with the entities this player needs most
+         * @param budget Max wire size of out (byte encoding)
+         * @param scratch Where the per-call sort buffer lives (the room's frame arena)
+         */
+        void select(uint8_t playerId, const SnapshotCandidates& candidates, size_t budget,
+                    std::pmr::memory_resource* scratch, GameSnapshot& out);
+
+        compression::SnapshotHistory& history(uint8_t playerId);
+        const compression::SnapshotHistory* findHistory(uint8_t playerId) const;
+        // A room-wide snapshot went out under this sequence: drop the per-player images it replaces
+        void forget(uint16_t sequence);
+        void removePlayer(uint8_t playerId);
+
+    private:
+        struct Interest {
+            float priority = 0.0f;
+            uint16_t sentX = 0;
+            uint16_t sentY = 0;
+            uint8_t sentHealth = 0;
+            uint32_t seen = 0;  // Last select() that listed the entity
+        };
+
+        struct Viewer {
+            EntityTable<Interest> missiles{MAX_MISSILES * 4};
+            EntityTable<Interest> enemies{MAX_ENEMIES * 2};
+            EntityTable<Interest> enemyMissiles{MAX_ENEMY_MISSILES * 2};
+            std::unique_ptr<compression::SnapshotHistory> history = std::make_unique<compression::SnapshotHistory>();
+            uint32_t stamp = 0;
+
+            // Indexed over every ID upfront, like the room's tables: new IDs never allocate mid-tick
+            Viewer() {
+                constexpr size_t ALL_IDS = size_t{UINT16_MAX} + 1;
+                missiles.reserveIds(ALL_IDS);
+                enemies.reserveIds(ALL_IDS);
+                enemyMissiles.reserveIds(ALL_IDS);
+            }
+        };
+
+        std::unordered_map<uint8_t, Viewer> _viewers;
+    };
+
+}
+
+#endif /* !SNAPSHOTPRIORITIZER_HPP_ */
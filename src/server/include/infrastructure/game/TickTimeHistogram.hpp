@@ -0,0 +1,97 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** TickTimeHistogram - Distribution of a room's simulation tick durations
+*/
+
+#ifndef TICKTIMEHISTOGRAM_HPP_
+#define TICKTIMEHISTOGRAM_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace infrastructure::game {
+
+    /**
+     * @brief Fixed-bucket histogram of how long the room's ticks take.
+     *
+     * Recorded from the room's strand, read from anywhere (CLI, monitoring):
+     * the counters are relaxed atomics, so a reading may be a few ticks
+     * behind but never torn.
+     */
+    class TickTimeHistogram {
+    public:
+        // Upper bound of each bucket in microseconds; the last bucket takes everything above
+        static constexpr std::array<uint32_t, 10> BOUNDS_US = {
+            100, 250, 500, 1000, 2000, 4000, 8000, 16000, 33000, 50000
+        };
+        static constexpr std::size_t BUCKETS = BOUNDS_US.size() + 1;
+
+        struct Summary {
+            std::array<uint64_t, BUCKETS> counts{};
+            uint64_t total = 0;
+            uint64_t sumUs = 0;
+            uint64_t maxUs = 0;
+
+            uint64_t meanUs() const { return total == 0 ? 0 : sumUs / total; }
+
+            /**
+             * @brief Upper bound of the bucket holding the q-th quantile (0 < q <= 1)
+             * @return maxUs for the last bucket, 0 when nothing was recorded
+             */
+            uint64_t quantileUs(double q) const {
+                if (total == 0) {
+                    return 0;
+                }
+                const auto rank = static_cast<uint64_t>(q * static_cast<double>(total) + 0.5);
+                uint64_t seen = 0;
+                for (std::size_t i = 0; i < BOUNDS_US.size(); ++i) {
+                    seen += counts[i];
+                    if (seen >= rank) {
+                        return BOUNDS_US[i];
+                    }
+                }
+                return maxUs;
+            }
+        };
+
+        void record(std::chrono::nanoseconds duration) {
+            const auto us = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+            std::size_t bucket = 0;
+            while (bucket < BOUNDS_US.size() && us > BOUNDS_US[bucket]) {
+                bucket++;
+            }
+            _counts[bucket].fetch_add(1, std::memory_order_relaxed);
+            _total.fetch_add(1, std::memory_order_relaxed);
+            _sumUs.fetch_add(us, std::memory_order_relaxed);
+            uint64_t max = _maxUs.load(std::memory_order_relaxed);
+            while (us > max && !_maxUs.compare_exchange_weak(max, us, std::memory_order_relaxed)) {
+            }
+        }
+
+        Summary summary() const {
+            Summary s;
+            for (std::size_t i = 0; i < BUCKETS; ++i) {
+                s.counts[i] = _counts[i].load(std::memory_order_relaxed);
+            }
+            s.total = _total.load(std::memory_order_relaxed);
+            s.sumUs = _sumUs.load(std::memory_order_relaxed);
+            s.maxUs = _maxUs.load(std::memory_order_relaxed);
+            return s;
+        }
+
+    private:
+        std::array<std::atomic<uint64_t>, BUCKETS> _counts{};
+        std::atomic<uint64_t> _total{0};
+        std::atomic<uint64_t> _sumUs{0};
+        std::atomic<uint64_t> _maxUs{0};
+    };
+
+}
+
+#endif /* !TICKTIMEHISTOGRAM_HPP_ */
@@ -0,0 +1,145 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BatchedUDPIO - recvmmsg/sendmmsg batching for the game socket (Linux only)
+*/
+
+#ifndef BATCHEDUDPIO_HPP_
+#define BATCHEDUDPIO_HPP_
+
+#ifdef __linux__
+
+#include <boost/asio.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include "infrastructure/network/SendBufferPool.hpp"
+
+namespace infrastructure::network {
+
+using boost::asio::ip::udp;
+
+/**
+ * @brief Batched datagram I/O on an Asio UDP socket.
+ *
+ * Receiving: the socket is switched to non-blocking mode and watched with
+ * async_wait(wait_read). Each wakeup drains up to BATCH_SIZE datagrams per
+ * recvmmsg call, repeating until the socket is empty or MAX_BATCHES_PER_WAKEUP
+ * is reached, then flushes the replies the handler queued.
+ *
+ * Sending: queue() appends the datagram to a pending list and flush() hands
+ * it to sendmmsg, BATCH_SIZE datagrams per syscall. Room frames and receive
+ * batches run inside a FlushScope and flush once when it ends; any send
+ * queued outside a scope is picked up by a flush posted on the io_context,
+ * so nothing waits for the next tick. When the
+ * kernel send buffer is full, the rest of the batch falls back to
+ * async_send_to, which waits for the socket to be writable.
+ *
+ * Thread-safe: queue() and flush() can be called from any strand.
+ */
+class BatchedUDPIO {
+public:
+    static constexpr std::size_t BATCH_SIZE = 32;
+    static constexpr std::size_t MAX_BATCHES_PER_WAKEUP = 8;  // Lets other handlers run under flood
+    static constexpr std::size_t PENDING_CAPACITY = 1024;
+
+    using ReceiveHandler = std::function<void(const udp::endpoint&, const uint8_t*, std::size_t)>;
+    using ErrorHandler = std::function<void(const boost::system::error_code&)>;
+
+    BatchedUDPIO(boost::asio::io_context& io_ctx, udp::socket& socket, std::size_t datagramCapacity);
+
+    BatchedUDPIO(const BatchedUDPIO&) = delete;
+    BatchedUDPIO& operator=(const BatchedUDPIO&) = delete;
+
+    /**
+     * @brief Starts the receive loop. onDatagram runs once per datagram, on
+     * the thread that drained the batch; the data is only valid during the call.
+     */
+    void startReceiving(ReceiveHandler onDatagram, ErrorHandler onError);
+
+    /**
+     * @brief Queues a datagram for the next flush.
+     */
+    void queue(const udp::endpoint& endpoint, const SharedSendBuffer& buffer);
+
+    /**
+     * @brief Sends every queued datagram.
+     */
+    void flush();
+
+    /**
+     * @brief Marks the current thread as sending a batch for this socket.
+     *
+     * Datagrams queued on this thread while the scope is alive skip the
+     * posted flush: another io_context thread would otherwise run it
+     * mid-batch and split the batch across several sendmmsg calls. The
+     * scope flushes once when it ends. A null BatchedUDPIO makes it a no-op.
+     */
+    class FlushScope {
+    public:
+        explicit FlushScope(BatchedUDPIO* io);
+        ~FlushScope();
+
+        FlushScope(const FlushScope&) = delete;
+        FlushScope& operator=(const FlushScope&) = delete;
+
+    private:
+        BatchedUDPIO* _io;
+        BatchedUDPIO* _previous;  // Scope of an enclosing batch on this thread
+    };
+
+    // Counters for monitoring the batching ratio
+    uint64_t getReceiveSyscalls() const { return _receiveSyscalls.load(std::memory_order_relaxed); }
+    uint64_t getDatagramsReceived() const { return _datagramsReceived.load(std::memory_order_relaxed); }
+    uint64_t getSendSyscalls() const { return _sendSyscalls.load(std::memory_order_relaxed); }
+    uint64_t getDatagramsSent() const { return _datagramsSent.load(std::memory_order_relaxed); }
+
+private:
+    struct Outgoing {
+        udp::endpoint endpoint;
+        SharedSendBuffer buffer;
+    };
+
+    boost::asio::io_context& _io_ctx;
+    udp::socket& _socket;
+
+    // Receive side (only touched by the receive loop, one wakeup at a time)
+    std::size_t _datagramCapacity;
+    std::vector<uint8_t> _receiveBuffers;                 // BATCH_SIZE slots of _datagramCapacity bytes
+    std::array<mmsghdr, BATCH_SIZE> _receiveHeaders{};
+    std::array<iovec, BATCH_SIZE> _receiveIovecs{};
+    std::array<sockaddr_storage, BATCH_SIZE> _receiveAddrs{};
+    ReceiveHandler _onDatagram;
+    ErrorHandler _onError;
+
+    // Send side
+    std::mutex _pendingMutex;
+    std::vector<Outgoing> _pending;
+    std::mutex _flushMutex;                               // One flush at a time, owns _draining
+    std::vector<Outgoing> _draining;
+    std::atomic<bool> _flushPosted{false};
+
+    std::atomic<uint64_t> _receiveSyscalls{0};
+    std::atomic<uint64_t> _datagramsReceived{0};
+    std::atomic<uint64_t> _sendSyscalls{0};
+    std::atomic<uint64_t> _datagramsSent{0};
+
+    void waitReadable();
+    void drain();
+    void sendBatch(std::size_t first, std::size_t count);
+    void sendOne(const Outgoing& datagram);
+};
+
+} // namespace infrastructure::network
+
+#endif /* __linux__ */
+
+#endif /* !BATCHEDUDPIO_HPP_ */
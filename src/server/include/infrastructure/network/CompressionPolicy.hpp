@@ -0,0 +1,129 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** CompressionPolicy - Per-message-type choice of LZ4 fast, LZ4 HC or no compression
+*/
+
+#ifndef COMPRESSIONPOLICY_HPP_
+#define COMPRESSIONPOLICY_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "compression/CompressionContext.hpp"
+
+namespace infrastructure::network {
+
+/**
+ * @brief Decides, message by message, whether and how a payload is compressed
+ *
+ * Every payload of a given MessageType is either sent raw, compressed with
+ * LZ4 fast, or compressed with LZ4 HC. Both codecs produce the same LZ4
+ * block format, so receivers do not care which one was used.
+ *
+ * The policy learns from what it sends: each type keeps the bytes in, bytes
+ * out and CPU time of every codec. A type whose payloads save less than
+ * MIN_SAVING once compressed stops being compressed, except for one probe
+ * every PROBE_INTERVAL messages in case its content changed. HC is kept for
+ * large payloads, as long as it stays under HIGH_MAX_NANOS_PER_BYTE.
+ *
+ * Thread-safe and lock-free: counters are relaxed atomics in a fixed table
+ * of MAX_TYPES slots, claimed by the first message of each type.
+ */
+class CompressionPolicy {
+public:
+    enum class Codec : uint8_t {
+        None = 0,
+        Fast = 1,   // LZ4 fast (acceleration 1)
+        High = 2    // LZ4 HC, default level
+    };
+    static constexpr size_t CODEC_COUNT = 3;
+
+    static constexpr size_t MIN_SIZE = 32;                  // Smaller payloads are always sent raw
+    static constexpr size_t MAX_SIZE = UINT16_MAX;          // CompressionHeader::originalSize limit
+    static constexpr size_t HIGH_MIN_SIZE = 1024;           // HC only pays for itself on large payloads
+    static constexpr uint64_t HIGH_MAX_NANOS_PER_BYTE = 50; // Above (~20 MB/s), the type falls back to fast
+    static constexpr double MIN_SAVING = 0.10;              // Below, the type is no longer compressed
+    static constexpr uint64_t WARMUP_MESSAGES = 8;          // Samples before a codec's numbers are trusted
+    static constexpr uint64_t PROBE_INTERVAL = 64;          // A type that is not worth it is re-tried this often
+    static constexpr size_t MAX_TYPES = 64;
+
+    struct CodecStats {
+        uint64_t messages{0};
+        uint64_t bytesIn{0};   // Payload bytes
+        uint64_t bytesOut{0};  // Bytes sent in their place (raw size when compression did not pay)
+        uint64_t nanos{0};     // Time spent compressing
+
+        double ratio() const { return bytesIn > 0 ? static_cast<double>(bytesOut) / static_cast<double>(bytesIn) : 1.0; }
+        uint64_t nanosPerByte() const { return bytesIn > 0 ? nanos / bytesIn : 0; }
+    };
+
+    struct TypeStats {
+        uint16_t type{0};
+        std::array<CodecStats, CODEC_COUNT> codecs{};
+
+        const CodecStats& of(Codec codec) const { return codecs[static_cast<size_t>(codec)]; }
+        uint64_t messages() const;
+        uint64_t bytesIn() const;
+        uint64_t bytesOut() const;
+        double ratio() const;
+    };
+
+    CompressionPolicy() = default;
+
+    // Disable copy
+    CompressionPolicy(const CompressionPolicy&) = delete;
+    CompressionPolicy& operator=(const CompressionPolicy&) = delete;
+
+    /**
+     * @brief Codec for the next payload of this type
+     * @param allowHigh false when the caller needs its own context (e.g. a dictionary): High becomes Fast
+     */
+    Codec choose(uint16_t type, size_t payloadSize, bool allowHigh = true);
+
+    // Accounts one payload of this type, sent as sentSize bytes
+    void record(uint16_t type, Codec codec, size_t payloadSize, size_t sentSize, uint64_t nanos);
+
+    /**
+     * @brief Compresses src into dst if the policy says so, and accounts for it
+     * @param context Fast-codec context (nullptr: a per-thread one without dictionary)
+     * @param useDictionary Passed to context; a dictionary-primed payload is never sent through HC
+     * @return Compressed size, or 0 to send src raw. Non-zero only if the compressed
+     *         payload plus its CompressionHeader is smaller than src.
+     */
+    size_t compress(uint16_t type, std::span<const uint8_t> src, std::span<uint8_t> dst,
+                    compression::CompressionContext* context = nullptr, bool useDictionary = false);
+
+    // Every type seen so far, most bytes first
+    std::vector<TypeStats> getStats() const;
+
+    static const char* codecName(Codec codec);
+
+private:
+    struct CodecCounters {
+        std::atomic<uint64_t> messages{0};
+        std::atomic<uint64_t> bytesIn{0};
+        std::atomic<uint64_t> bytesOut{0};
+        std::atomic<uint64_t> nanos{0};
+    };
+
+    struct alignas(64) TypeSlot {
+        static constexpr uint32_t EMPTY = UINT32_MAX;
+        std::atomic<uint32_t> type{EMPTY};
+        std::array<CodecCounters, CODEC_COUNT> codecs{};
+        std::atomic<uint64_t> skipped{0};  // Payloads not compressed because the type does not pay
+    };
+
+    // Slot of the type, claimed on first use; nullptr when the table is full
+    TypeSlot* slotFor(uint16_t type);
+
+    std::array<TypeSlot, MAX_TYPES> _slots{};
+};
+
+} // namespace infrastructure::network
+
+#endif /* !COMPRESSIONPOLICY_HPP_ */
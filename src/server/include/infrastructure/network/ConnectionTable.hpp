@@ -0,0 +1,163 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ConnectionTable - Lock-free endpoint -> in-game connection lookup for the UDP receive path
+*/
+
+#ifndef CONNECTIONTABLE_HPP_
+#define CONNECTIONTABLE_HPP_
+
+#include <boost/asio.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "infrastructure/network/NetworkStats.hpp"
+
+namespace infrastructure::game {
+class GameWorld;
+}
+
+namespace infrastructure::network {
+
+using boost::asio::ip::udp;
+
+/**
+ * @brief Binary key of a UDP endpoint: address bytes and port, no string.
+ *
+ * IPv4 addresses are stored v4-mapped, so a client is the same key whichever
+ * form the socket reports it in.
+ */
+struct EndpointKey {
+    std::array<uint8_t, 16> address{};
+    uint16_t port = 0;
+
+    static EndpointKey from(const udp::endpoint& endpoint);
+    std::size_t hash() const;
+    bool operator==(const EndpointKey&) const = default;
+};
+
+/**
+ * @brief What the receive path needs about an endpoint that joined a game.
+ */
+struct Connection {
+    uint8_t playerId = 0;
+    std::weak_ptr<game::GameWorld> gameWorld;  // Expired once the room instance is removed
+    NetworkStats::Slot statsSlot = NetworkStats::NO_SLOT;
+    std::string endpoint;                      // SessionManager / NetworkStats key
+
+    /**
+     * @brief Whether the session's activity is due for a refresh
+     *
+     * True at most once per ConnectionTable::SESSION_TOUCH_INTERVAL, for one
+     * caller, so the SessionManager lock is not taken on every packet.
+     */
+    bool shouldTouchSession(std::chrono::steady_clock::time_point now) const;
+
+private:
+    mutable std::atomic<int64_t> _lastSessionTouch{0};  // steady_clock ticks
+};
+
+/**
+ * @brief Read-mostly endpoint -> Connection table.
+ *
+ * Readers (the receive loops, one per shard) find a connection with one
+ * probe of an immutable open-addressing table: no lock, no allocation, no
+ * endpoint formatting. Writers (joins and leaves, rare) copy the table,
+ * change the copy and publish it with an atomic swap (RCU).
+ *
+ * A replaced table is retired, not freed: each reader announces the epoch it
+ * entered at, and a retired table is only freed once every reader that may
+ * still hold it has left. Writers never wait for readers.
+ *
+ * Each reader index must be used by one thread at a time, without nesting:
+ * the receive loop of a shard handles one datagram at a time.
+ */
+class ConnectionTable {
+private:
+    struct Table;
+    struct alignas(64) ReaderSlot {
+        std::atomic<uint64_t> epoch{0};  // 0 when outside a read
+    };
+
+public:
+    // Sessions time out after 30 s of inactivity, refreshing them every second is plenty
+    static constexpr std::chrono::seconds SESSION_TOUCH_INTERVAL{1};
+
+    /**
+     * @brief Read-side critical section; the connections it finds stay valid until it is destroyed
+     */
+    class Reader {
+    public:
+        ~Reader();
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        const Connection* find(const udp::endpoint& endpoint) const;
+
+    private:
+        friend class ConnectionTable;
+        Reader(ReaderSlot& slot, const Table* table) : _slot(slot), _table(table) {}
+
+        ReaderSlot& _slot;
+        const Table* _table;
+    };
+
+    // readers: number of reader indexes (receive loops)
+    explicit ConnectionTable(std::size_t readers);
+    ~ConnectionTable();
+
+    ConnectionTable(const ConnectionTable&) = delete;
+    ConnectionTable& operator=(const ConnectionTable&) = delete;
+
+    Reader read(std::size_t reader);
+
+    // Adds or replaces the endpoint's connection
+    void insert(const udp::endpoint& endpoint, uint8_t playerId, std::weak_ptr<game::GameWorld> gameWorld,
+                NetworkStats::Slot statsSlot, std::string endpointName);
+    // By the SessionManager endpoint string, as the session side knows it
+    void erase(const std::string& endpointName);
+
+    std::size_t size() const;
+    // Replaced tables not freed yet (a reader may still hold them)
+    std::size_t retiredCount() const;
+
+private:
+    struct Entry {
+        EndpointKey key;
+        std::shared_ptr<const Connection> connection;  // Null for an empty slot
+    };
+
+    struct Table {
+        std::vector<Entry> entries;  // Power-of-two size, linear probing
+        std::size_t count = 0;
+
+        const Connection* find(const EndpointKey& key) const;
+    };
+
+    struct Retired {
+        const Table* table;
+        uint64_t epoch;
+    };
+
+    // Rebuilds the table from the live connections, minus/plus one change, and publishes it
+    void publish(std::vector<Entry> connections);
+    void reclaim();
+
+    std::vector<ReaderSlot> _readers;
+    std::atomic<const Table*> _current;
+    std::atomic<uint64_t> _epoch{1};
+
+    mutable std::mutex _writeMutex;  // Writers only
+    std::vector<Retired> _retired;
+};
+
+} // namespace infrastructure::network
+
+#endif /* !CONNECTIONTABLE_HPP_ */
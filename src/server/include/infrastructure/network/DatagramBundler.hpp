@@ -0,0 +1,89 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** DatagramBundler - Coalesces a tick's datagrams to each client into MessageType::Bundle datagrams
+*/
+
+#ifndef DATAGRAMBUNDLER_HPP_
+#define DATAGRAMBUNDLER_HPP_
+
+#include <boost/asio.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include "Protocol.hpp"
+#include "infrastructure/network/SendBufferPool.hpp"
+
+namespace infrastructure::network {
+
+using boost::asio::ip::udp;
+
+/**
+ * @brief Per-client outgoing bundle for one room tick.
+ *
+ * add() takes the datagrams the tick sends to a client (events, reliable
+ * events, snapshot) and appends them to that client's open bundle. A bundle
+ * is sent once the next datagram would push it past MAX_DATAGRAM, and
+ * whatever is left goes out on flush(), at the end of the tick. A bundle that
+ * ended up with a single datagram sends that datagram as is, still shared
+ * with the other recipients of a broadcast.
+ *
+ * Not thread-safe: one bundler per room tick, on the room's strand.
+ */
+class DatagramBundler {
+public:
+    // Same bound as the snapshots, well under the usual path MTU
+    static constexpr std::size_t MAX_DATAGRAM = 1200;
+    static constexpr std::size_t MAX_CLIENTS = MAX_PLAYERS;
+
+    using Emit = std::function<void(const udp::endpoint&, uint32_t statsSlot, const SharedSendBuffer&)>;
+
+    DatagramBundler(SendBufferPool& pool, Emit emit);
+    ~DatagramBundler();
+
+    DatagramBundler(const DatagramBundler&) = delete;
+    DatagramBundler& operator=(const DatagramBundler&) = delete;
+
+    /**
+     * @brief Queues a full datagram (UDPHeader included) for this client
+     */
+    void add(uint8_t clientId, const udp::endpoint& endpoint, uint32_t statsSlot, const SharedSendBuffer& datagram);
+
+    /**
+     * @brief Sends every open bundle
+     */
+    void flush();
+
+    // Datagrams handed to add(), and datagrams actually sent for them
+    uint64_t getDatagramsAdded() const { return _added; }
+    uint64_t getDatagramsSent() const { return _sent; }
+
+private:
+    struct Open {
+        bool used = false;
+        uint8_t clientId = 0;
+        udp::endpoint endpoint;
+        uint32_t statsSlot = 0;
+        SharedSendBuffer first;   // Sent alone if nothing joins it
+        SharedSendBuffer bundle;  // Built once a second datagram joins
+        std::size_t size = 0;     // Bundle size so far
+        std::size_t count = 0;
+    };
+
+    SendBufferPool& _pool;
+    Emit _emit;
+    std::array<Open, MAX_CLIENTS> _open{};
+    uint64_t _added = 0;
+    uint64_t _sent = 0;
+
+    Open* openFor(uint8_t clientId, const udp::endpoint& endpoint, uint32_t statsSlot);
+    void append(Open& open, const SharedSendBuffer& datagram);
+    void close(Open& open);
+    static std::size_t entrySize(const SharedSendBuffer& datagram);
+};
+
+} // namespace infrastructure::network
+
+#endif /* !DATAGRAMBUNDLER_HPP_ */
@@ -0,0 +1,84 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** FrameRingBuffer - Receive ring of a TCP session, hands out frames without copying them
+*/
+
+#ifndef FRAMERINGBUFFER_HPP_
+#define FRAMERINGBUFFER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace infrastructure::network {
+
+/**
+ * @brief Ring buffer the socket reads into and frames are parsed from in place
+ *
+ * The socket reads straight into writable(), commit() publishes the bytes.
+ * peek() returns a view of buffered bytes: directly into the ring when they
+ * are contiguous, or a copy in a scratch buffer kept by the ring when they
+ * straddle the wrap point (the only case that copies). consume() drops a
+ * parsed frame by moving an index, nothing is shifted.
+ *
+ * A frame larger than the ring does not fit: reserve() grows it, keeping the
+ * buffered bytes. An empty ring restarts at offset 0, so a session that reads
+ * whole frames never wraps.
+ *
+ * Not thread-safe: one ring per session, used from its read handler.
+ */
+class FrameRingBuffer {
+public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 4096;
+
+    // Capacity is rounded up to a power of two
+    explicit FrameRingBuffer(std::size_t capacity = DEFAULT_CAPACITY);
+
+    FrameRingBuffer(const FrameRingBuffer&) = delete;
+    FrameRingBuffer& operator=(const FrameRingBuffer&) = delete;
+
+    /**
+     * @brief Free space right after the buffered bytes, up to the wrap point
+     * @return Empty when the ring is full
+     */
+    std::span<uint8_t> writable();
+
+    // Publishes bytes written into writable()
+    void commit(std::size_t bytes);
+
+    /**
+     * @brief length buffered bytes, starting offset bytes in
+     * @return View valid until the next call that modifies the ring or peeks again
+     *         (the caller checks size() first)
+     */
+    std::span<const uint8_t> peek(std::size_t offset, std::size_t length);
+
+    // Drops the first bytes (a parsed frame)
+    void consume(std::size_t bytes);
+
+    // Grows the ring so that at least bytes fit, keeping what is buffered
+    void reserve(std::size_t bytes);
+
+    std::size_t size() const { return static_cast<std::size_t>(_write - _read); }
+    std::size_t capacity() const { return _buffer.size(); }
+    bool empty() const { return _write == _read; }
+
+    // peek() calls that had to copy because of the wrap point
+    uint64_t getWrappedPeeks() const { return _wrappedPeeks; }
+
+private:
+    std::size_t mask() const { return _buffer.size() - 1; }
+
+    std::vector<uint8_t> _buffer;
+    std::vector<uint8_t> _scratch;  // Straddling peeks, only grows
+    uint64_t _read = 0;             // Monotonic, masked on access
+    uint64_t _write = 0;
+    uint64_t _wrappedPeeks = 0;
+};
+
+} // namespace infrastructure::network
+
+#endif /* !FRAMERINGBUFFER_HPP_ */
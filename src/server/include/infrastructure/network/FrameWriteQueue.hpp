@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** FrameWriteQueue - Ordered outbound frames of a TCP session, coalesced into one write per flush
+*/
+
+#ifndef FRAMEWRITEQUEUE_HPP_
+#define FRAMEWRITEQUEUE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace infrastructure::network {
+
+/**
+ * @brief Outbound queue of a TCP session: one write in flight, frames in order
+ *
+ * Frames are built in buffers from acquire() and handed to push(). The push
+ * that finds the queue idle tells its caller to start a flush; pushes made
+ * while a write is in flight only queue their frame. beginFlush() coalesces
+ * the pending frames into one contiguous buffer, up to MAX_FLUSH_SIZE (the
+ * plaintext of one TLS record), so a burst goes out as one record instead of
+ * one per frame. endFlush() says whether frames arrived in the meantime.
+ *
+ * Frame and flush buffers come back to a small pool owned by the queue, so
+ * a session in steady state does not allocate to send.
+ *
+ * Thread-safe: frames may be pushed from any thread (room and friend
+ * broadcasts come from other sessions). The flush itself is driven from the
+ * session's strand.
+ */
+class FrameWriteQueue {
+public:
+    using Buffer = std::vector<uint8_t>;
+
+    static constexpr std::size_t MAX_FLUSH_SIZE = 16 * 1024;        // TLS record plaintext limit
+    static constexpr std::size_t MAX_POOLED = 16;
+    static constexpr std::size_t MAX_POOLED_CAPACITY = 64 * 1024;  // Larger buffers are not kept
+
+    FrameWriteQueue() = default;
+
+    FrameWriteQueue(const FrameWriteQueue&) = delete;
+    FrameWriteQueue& operator=(const FrameWriteQueue&) = delete;
+
+    // Zero-filled buffer of size bytes, recycled when possible
+    Buffer acquire(std::size_t size);
+
+    /**
+     * @brief Queues a complete frame (Header included)
+     * @return true if no flush was running: the caller must start one
+     */
+    bool push(Buffer frame);
+
+    /**
+     * @brief Bytes of the next write: the oldest frame and as many following ones as fit
+     * @return Valid until endFlush() or reset(). Empty if nothing is pending.
+     */
+    std::span<const uint8_t> beginFlush();
+
+    /**
+     * @brief The write started by beginFlush() completed
+     * @return true if frames are pending: the caller flushes again
+     */
+    bool endFlush();
+
+    // Drops every pending frame after a failed write; the next push starts a flush again
+    void reset();
+
+    std::size_t pendingFrames() const;
+    uint64_t getFramesQueued() const;
+    uint64_t getFlushes() const;
+
+private:
+    void recycle(Buffer buffer);  // _mutex held
+
+    mutable std::mutex _mutex;
+    std::deque<Buffer> _pending;
+    Buffer _inFlight;           // What the running write sends
+    std::vector<Buffer> _pool;
+    bool _flushing = false;
+    uint64_t _framesQueued = 0;
+    uint64_t _flushes = 0;
+};
+
+} // namespace infrastructure::network
+
+#endif /* !FRAMEWRITEQUEUE_HPP_ */
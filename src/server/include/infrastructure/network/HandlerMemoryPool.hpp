@@ -0,0 +1,167 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** HandlerMemoryPool - Recycled memory for the operations asio allocates on every async send
+*/
+
+#ifndef HANDLERMEMORYPOOL_HPP_
+#define HANDLERMEMORYPOOL_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace infrastructure::network {
+
+/**
+ * @brief Free list of fixed-size blocks for asio's per-operation state.
+ *
+ * Every async_send_to allocates an operation object holding the handler,
+ * the buffers and the endpoint. asio only caches two such blocks per
+ * thread, so a frame that sends more than two datagrams goes to the heap
+ * for the rest. Handlers wrapped with makePooledHandler() take their
+ * operation from this pool instead: once the free list has grown to the
+ * number of sends in flight, sending does not touch the heap.
+ *
+ * Thread-safe: sends start on the rooms' strands and complete on any
+ * io_context thread. Operations still pending when the pool is destroyed
+ * (closed sockets, io_context torn down later) free their block themselves.
+ */
+class HandlerMemoryPool {
+public:
+    static constexpr std::size_t BLOCK_SIZE = 512;  // Larger requests go to the heap
+
+    HandlerMemoryPool() : _state(std::make_shared<State>()) {}
+
+    HandlerMemoryPool(const HandlerMemoryPool&) = delete;
+    HandlerMemoryPool& operator=(const HandlerMemoryPool&) = delete;
+
+    ~HandlerMemoryPool() {
+        std::vector<void*> idle;
+        {
+            std::lock_guard<std::mutex> lock(_state->mutex);
+            _state->closed = true;
+            idle.swap(_state->free);
+        }
+        for (void* block : idle)
+            ::operator delete(block);
+    }
+
+    // Preallocates blocks for that many operations in flight, so the first busy frames do not allocate
+    void reserve(std::size_t blocks) {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        _state->free.reserve(_state->created + blocks);
+        for (std::size_t i = 0; i < blocks; ++i) {
+            _state->free.push_back(::operator new(BLOCK_SIZE));
+        }
+        _state->created += blocks;
+    }
+
+    std::size_t idleCount() const {
+        std::lock_guard<std::mutex> lock(_state->mutex);
+        return _state->free.size();
+    }
+
+private:
+    template<typename T>
+    friend class HandlerAllocator;
+
+    // Shared with the allocators of the operations in flight
+    struct State {
+        std::mutex mutex;
+        std::vector<void*> free;
+        std::size_t created = 0;  // The free list never outgrows it
+        bool closed = false;
+
+        void* allocate(std::size_t size) {
+            if (size <= BLOCK_SIZE) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!free.empty()) {
+                    void* block = free.back();
+                    free.pop_back();
+                    return block;
+                }
+                free.reserve(++created);
+            }
+            return ::operator new(std::max(size, BLOCK_SIZE));
+        }
+
+        void deallocate(void* block, std::size_t size) {
+            if (size <= BLOCK_SIZE) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!closed) {
+                    free.push_back(block);
+                    return;
+                }
+            }
+            ::operator delete(block);
+        }
+    };
+
+    std::shared_ptr<State> _state;
+};
+
+/**
+ * @brief Standard allocator over a HandlerMemoryPool, what asio asks a handler for.
+ */
+template<typename T>
+class HandlerAllocator {
+public:
+    using value_type = T;
+
+    explicit HandlerAllocator(const HandlerMemoryPool& pool) noexcept : _state(pool._state) {}
+    template<typename U>
+    HandlerAllocator(const HandlerAllocator<U>& other) noexcept : _state(other._state) {}
+
+    T* allocate(std::size_t n) { return static_cast<T*>(_state->allocate(sizeof(T) * n)); }
+    void deallocate(T* p, std::size_t n) noexcept { _state->deallocate(p, sizeof(T) * n); }
+
+    template<typename U>
+    bool operator==(const HandlerAllocator<U>& other) const noexcept { return _state == other._state; }
+    template<typename U>
+    bool operator!=(const HandlerAllocator<U>& other) const noexcept { return _state != other._state; }
+
+private:
+    template<typename U>
+    friend class HandlerAllocator;
+
+    std::shared_ptr<HandlerMemoryPool::State> _state;
+};
+
+/**
+ * @brief Completion handler whose operation memory comes from a HandlerMemoryPool.
+ */
+template<typename Handler>
+class PooledHandler {
+public:
+    using allocator_type = HandlerAllocator<Handler>;
+
+    PooledHandler(const HandlerMemoryPool& pool, Handler handler)
+        : _allocator(pool), _handler(std::move(handler)) {}
+
+    allocator_type get_allocator() const noexcept { return _allocator; }
+
+    template<typename... Args>
+    void operator()(Args&&... args) {
+        _handler(std::forward<Args>(args)...);
+    }
+
+private:
+    allocator_type _allocator;
+    Handler _handler;
+};
+
+template<typename Handler>
+PooledHandler<std::decay_t<Handler>> makePooledHandler(const HandlerMemoryPool& pool, Handler&& handler) {
+    return PooledHandler<std::decay_t<Handler>>(pool, std::forward<Handler>(handler));
+}
+
+} // namespace infrastructure::network
+
+#endif /* !HANDLERMEMORYPOOL_HPP_ */
@@ -9,6 +9,7 @@
 #define NETWORKSTATS_HPP_
 
 #include <atomic>
+#include <memory>
 #include <chrono>
 #include <unordered_map>
 #include <mutex>
@@ -17,6 +18,7 @@
 #include <vector>
 #include <optional>
 #include <cstdint>
+#include "infrastructure/network/CompressionPolicy.hpp"
 
 namespace infrastructure::network {
 
@@ -25,6 +27,7 @@ namespace infrastructure::network {
  */
 struct PlayerNetworkStats {
     std::string endpoint;
+    uint32_t slot{0};         // Counter slot the hot paths report to
 
     // RTT (milliseconds)
     uint32_t rttCurrent{0};
@@ -67,9 +70,18 @@ struct RoomNetworkStats {
  *
  * Tracks bandwidth and RTT metrics both globally and per-player.
  * Uses atomic counters for global stats (lock-free) and mutex for per-player stats.
+ * Per-player byte counters live in a fixed array of slots handed out by
+ * registerPlayer(), so the send/receive paths count bytes without a lock
+ * or a formatted endpoint string.
+ * Also owns the CompressionPolicy shared by the UDP and TCP servers, with its
+ * per-message-type compression stats.
  */
 class NetworkStats {
 public:
+    using Slot = uint32_t;
+    static constexpr Slot NO_SLOT = UINT32_MAX;
+    static constexpr size_t MAX_SLOTS = 256;
+
     NetworkStats() = default;
     ~NetworkStats() = default;
 
@@ -88,11 +100,15 @@ public:
     // Per-Player Stats (mutex-protected)
     // ═══════════════════════════════════════════════════════════════════
 
-    void addBytesSentTo(const std::string& endpoint, size_t bytes);
-    void addBytesReceivedFrom(const std::string& endpoint, size_t bytes);
+    // Slot-keyed counters (lock-free, NO_SLOT is ignored)
+    void addBytesSentTo(Slot slot, size_t bytes);
+    void addBytesReceivedFrom(Slot slot, size_t bytes);
+
     void updatePlayerRTT(const std::string& endpoint, uint32_t rttMs);
-    void registerPlayer(const std::string& endpoint);
+    // Returns the player's slot (the existing one if already registered), NO_SLOT when all are taken
+    Slot registerPlayer(const std::string& endpoint);
     void unregisterPlayer(const std::string& endpoint);
+    Slot getSlot(const std::string& endpoint) const;
 
     // ═══════════════════════════════════════════════════════════════════
     // Rate Calculation (called every second by timer)
@@ -126,6 +142,13 @@ public:
 
     RoomNetworkStats getRoomStats(const std::vector<std::string>& endpoints) const;
 
+    // ═══════════════════════════════════════════════════════════════════
+    // Compression (per message type)
+    // ═══════════════════════════════════════════════════════════════════
+
+    std::shared_ptr<CompressionPolicy> getCompressionPolicy() const { return _compressionPolicy; }
+    std::vector<CompressionPolicy::TypeStats> getCompressionStats() const { return _compressionPolicy->getStats(); }
+
 private:
     // Global counters (atomics for lock-free access)
     std::atomic<uint64_t> _totalBytesSent{0};
@@ -146,11 +169,25 @@ private:
     size_t _rateHistoryIndex{0};
     size_t _rateHistoryCount{0};  // How many samples we have (up to RATE_HISTORY_SIZE)
 
+    // Per-player byte counters, indexed by slot
+    struct SlotCounters {
+        std::atomic<uint64_t> bytesSent{0};
+        std::atomic<uint64_t> bytesReceived{0};
+    };
+    std::array<SlotCounters, MAX_SLOTS> _slotCounters{};
+
     // Per-player stats (protected by mutex)
     mutable std::mutex _playerStatsMutex;
     std::unordered_map<std::string, PlayerNetworkStats> _playerStats;
+    std::vector<Slot> _freeSlots;  // Unused slots, lowest last
+    Slot _nextSlot{0};             // Slots below this have been handed out at least once
+
+    // Copies the slot counters into the player's stats (mutex held)
+    void syncCounters(PlayerNetworkStats& stats) const;
 
     std::chrono::steady_clock::time_point _startTime{std::chrono::steady_clock::now()};
+
+    std::shared_ptr<CompressionPolicy> _compressionPolicy{std::make_shared<CompressionPolicy>()};
 };
 
 } // namespace infrastructure::network
@@ -0,0 +1,177 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SendBufferPool - Pooled, ref-counted datagram buffers shared by every recipient of a broadcast
+*/
+
+#ifndef SENDBUFFERPOOL_HPP_
+#define SENDBUFFERPOOL_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace infrastructure::network {
+
+/**
+ * @brief Handle on a pooled send buffer.
+ *
+ * Copying a handle only bumps an atomic reference count, so one serialized
+ * datagram can be captured by every async_send_to of a broadcast. When the
+ * last handle goes away (usually in the last send completion handler), the
+ * buffer goes back to its pool with its capacity intact.
+ *
+ * The bytes are written while the handle is still unique, then treated as
+ * immutable once copied.
+ */
+class SharedSendBuffer {
+public:
+    SharedSendBuffer() = default;
+    SharedSendBuffer(const SharedSendBuffer& other) noexcept : _block(other._block) {
+        if (_block)
+            _block->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    SharedSendBuffer(SharedSendBuffer&& other) noexcept : _block(std::exchange(other._block, nullptr)) {}
+    SharedSendBuffer& operator=(SharedSendBuffer other) noexcept {
+        std::swap(_block, other._block);
+        return *this;
+    }
+    ~SharedSendBuffer() { release(); }
+
+    uint8_t* data() { return _block->bytes.data(); }
+    const uint8_t* data() const { return _block->bytes.data(); }
+    std::size_t size() const { return _block->bytes.size(); }
+    explicit operator bool() const { return _block != nullptr; }
+
+    /**
+     * @brief Shrinks or grows the datagram. Only valid before the buffer is shared.
+     */
+    void resize(std::size_t size) { _block->bytes.resize(size); }
+
+    std::size_t useCount() const { return _block ? _block->refs.load(std::memory_order_relaxed) : 0; }
+
+private:
+    friend class SendBufferPool;
+
+    struct Pool;
+
+    struct Block {
+        std::atomic<uint32_t> refs{0};
+        std::vector<uint8_t> bytes;
+        std::shared_ptr<Pool> pool;  // Keeps the free list alive for in-flight sends
+    };
+
+    // Free list, shared between the pool and the blocks it handed out
+    struct Pool {
+        std::mutex mutex;
+        std::vector<Block*> free;
+        bool closed = false;
+
+        void recycle(Block* block) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!closed) {
+                    free.push_back(block);
+                    return;
+                }
+            }
+            delete block;
+        }
+    };
+
+    explicit SharedSendBuffer(Block* block) : _block(block) {}
+
+    void release() {
+        if (_block && _block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            _block->pool->recycle(_block);
+        _block = nullptr;
+    }
+
+    Block* _block = nullptr;
+};
+
+/**
+ * @brief Recycles SharedSendBuffer storage across broadcasts.
+ *
+ * acquire() takes a buffer off the free list (or creates one) and sizes it.
+ * Once every buffer has grown to the largest datagram it carries, sending
+ * does not touch the heap. Thread-safe: rooms acquire from their own strands
+ * and completion handlers release from any io_context thread.
+ *
+ * Buffers still in flight when the pool is destroyed free themselves when
+ * their last handle goes away.
+ */
+class SendBufferPool {
+public:
+    static constexpr std::size_t DEFAULT_BUFFER_CAPACITY = 2048;
+
+    explicit SendBufferPool(std::size_t bufferCapacity = DEFAULT_BUFFER_CAPACITY)
+        : _pool(std::make_shared<SharedSendBuffer::Pool>()), _bufferCapacity(bufferCapacity) {}
+
+    SendBufferPool(const SendBufferPool&) = delete;
+    SendBufferPool& operator=(const SendBufferPool&) = delete;
+
+    ~SendBufferPool() {
+        std::vector<SharedSendBuffer::Block*> idle;
+        {
+            std::lock_guard<std::mutex> lock(_pool->mutex);
+            _pool->closed = true;
+            idle.swap(_pool->free);
+        }
+        for (auto* block : idle)
+            delete block;
+    }
+
+    // Preallocates that many buffers, so the first busy frames do not allocate
+    void reserve(std::size_t buffers) {
+        std::lock_guard<std::mutex> lock(_pool->mutex);
+        _pool->free.reserve(_created + buffers);
+        for (std::size_t i = 0; i < buffers; ++i) {
+            auto* block = new SharedSendBuffer::Block();
+            block->bytes.reserve(_bufferCapacity);
+            block->pool = _pool;
+            _pool->free.push_back(block);
+        }
+        _created += buffers;
+    }
+
+    SharedSendBuffer acquire(std::size_t size) {
+        SharedSendBuffer::Block* block = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(_pool->mutex);
+            if (!_pool->free.empty()) {
+                block = _pool->free.back();
+                _pool->free.pop_back();
+            }
+        }
+        if (!block) {
+            block = new SharedSendBuffer::Block();
+            block->bytes.reserve(_bufferCapacity);
+            block->pool = _pool;
+            std::lock_guard<std::mutex> lock(_pool->mutex);
+            _pool->free.reserve(++_created);
+        }
+        block->refs.store(1, std::memory_order_relaxed);
+        block->bytes.resize(size);
+        return SharedSendBuffer(block);
+    }
+
+    std::size_t idleCount() const {
+        std::lock_guard<std::mutex> lock(_pool->mutex);
+        return _pool->free.size();
+    }
+
+private:
+    std::shared_ptr<SharedSendBuffer::Pool> _pool;
+    std::size_t _bufferCapacity;
+    std::size_t _created = 0;  // Guarded by _pool->mutex; the free list never outgrows it
+};
+
+} // namespace infrastructure::network
+
+#endif /* !SENDBUFFERPOOL_HPP_ */
@@ -60,6 +60,10 @@ using PlayerLeaveGameCallback = std::function<void(uint8_t playerId, const std::
 // Parameters: playerId, roomCode, enabled
 using GodModeChangedCallback = std::function<void(uint8_t playerId, const std::string& roomCode, bool enabled)>;
 
+// Callback type for when a UDP endpoint stops being bound to a session (used by UDPServer to drop its connection)
+// Called with the SessionManager lock held: it must not call back into SessionManager
+using UDPBindingRemovedCallback = std::function<void(const std::string& endpoint)>;
+
 // Player game stats for leaderboard persistence
 struct PlayerGameStats {
     std::string email;
@@ -132,7 +136,8 @@ public:
     std::optional<Session> getSessionByEndpoint(const std::string& endpoint);
 
     // Assigns a playerId to a session (after GameWorld.addPlayer)
-    void assignPlayerId(const std::string& endpoint, uint8_t playerId);
+    // Returns false if the endpoint is no longer bound to a session
+    bool assignPlayerId(const std::string& endpoint, uint8_t playerId);
 
     // Gets playerId by endpoint (quick lookup for message handling)
     std::optional<uint8_t> getPlayerIdByEndpoint(const std::string& endpoint);
@@ -249,6 +254,13 @@ public:
     // Register callback for when a player's GodMode changes (called by UDPServer)
     void setGodModeChangedCallback(GodModeChangedCallback callback);
 
+    // ═══════════════════════════════════════════════════════════════════
+    // UDP binding removal (for UDPServer's endpoint lookup table)
+    // ═══════════════════════════════════════════════════════════════════
+
+    // Register callback for when an endpoint's binding goes away (leave, kick, expiry, ban...)
+    void setUDPBindingRemovedCallback(UDPBindingRemovedCallback callback);
+
     // ═══════════════════════════════════════════════════════════════════
     // Stats persistence (for leaderboard)
     // ═══════════════════════════════════════════════════════════════════
@@ -284,11 +296,17 @@ private:
     // Callback for GodMode changes (called to notify UDPServer)
     GodModeChangedCallback _godModeChangedCallback;
 
+    // Callback for endpoints losing their session binding (called to notify UDPServer)
+    UDPBindingRemovedCallback _udpBindingRemovedCallback;
+
     // Callback for saving player stats (called when player leaves game)
     SavePlayerStatsCallback _savePlayerStatsCallback;
 
     // Generates a cryptographically secure random token using OpenSSL RAND_bytes
     SessionToken generateToken();
+
+    // Drops the endpoint index entry and notifies the callback (_mutex held)
+    void unbindEndpoint(const std::string& endpoint);
 };
 
 } // namespace infrastructure::session
@@ -15,6 +15,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <span>
 #include <vector>
 #include <openssl/ssl.h>
 
@@ -141,29 +142,36 @@ namespace infrastructure::adapters::in::network {
         auto self = shared_from_this();
         auto logger = server::logging::Logger::getNetworkLogger();
 
+        // Full ring: a frame larger than it is still incomplete, grow with what actually arrives
+        if (_readRing.writable().empty()) {
+            _readRing.reserve(_readRing.capacity() * 2);
+        }
+        auto space = _readRing.writable();
+
         _socket.async_read_some(
-            boost::asio::buffer(_readBuffer, BUFFER_SIZE),
+            boost::asio::buffer(space.data(), space.size()),
             [this, self, logger](boost::system::error_code ec, std::size_t bytes) {
                 if (!ec) {
                     _lastActivity = std::chrono::steady_clock::now();
 
-                    _accumulator.insert(_accumulator.end(), _readBuffer, _readBuffer + bytes);
+                    _readRing.commit(bytes);
 
-                    while (_accumulator.size() >= Header::WIRE_SIZE) {
-                        auto headOpt = Header::from_bytes(_accumulator.data(), _accumulator.size());
+                    while (_readRing.size() >= Header::WIRE_SIZE) {
+                        auto headOpt = Header::from_bytes(_readRing.peek(0, Header::WIRE_SIZE).data(), Header::WIRE_SIZE);
                         if (!headOpt) {
                             break;
                         }
                         Header head = *headOpt;
                         size_t totalSize = Header::WIRE_SIZE + head.payload_size;
 
-                        if (_accumulator.size() < totalSize) {
+                        if (_readRing.size() < totalSize) {
                             break;
                         }
 
-                        handle_command(head);
+                        // The payload is read in place, copied only if it wraps around the ring
+                        handle_command(head, _readRing.peek(Header::WIRE_SIZE, head.payload_size));
 
-                        _accumulator.erase(_accumulator.begin(), _accumulator.begin() + totalSize);
+                        _readRing.consume(totalSize);
                     }
 
                     do_read();
@@ -186,6 +194,36 @@ namespace infrastructure::adapters::in::network {
         );
     }
 
+    void Session::send_frame(FrameWriteQueue::Buffer frame) {
+        if (!_writeQueue.push(std::move(frame))) {
+            return;  // The running flush picks it up
+        }
+        // Writes only start from the session's strand, whoever sends (broadcasts come from other sessions)
+        auto self = shared_from_this();
+        boost::asio::dispatch(_socket.get_executor(), [this, self]() {
+            flush_writes();
+        });
+    }
+
+    void Session::flush_writes() {
+        auto self = shared_from_this();
+        auto data = _writeQueue.beginFlush();
+        boost::asio::async_write(_socket, boost::asio::buffer(data.data(), data.size()),
+            [this, self](boost::system::error_code ec, std::size_t) {
+                if (ec) {
+                    if (ec != boost::asio::error::operation_aborted) {
+                        auto logger = server::logging::Logger::getNetworkLogger();
+                        logger->error("Write error: {}", ec.message());
+                    }
+                    _writeQueue.reset();
+                    return;
+                }
+                if (_writeQueue.endFlush()) {
+                    flush_writes();
+                }
+            });
+    }
+
     void Session::onLoginSuccess(const User& user) {
         _isAuthenticated = true;
         _user = user;
@@ -202,21 +240,12 @@ namespace infrastructure::adapters::in::network {
         };
 
         const size_t totalSize = Header::WIRE_SIZE + message.length();
-        auto buf = std::make_shared<std::vector<uint8_t>>(totalSize);
+        auto buf = _writeQueue.acquire(totalSize);
 
-        head.to_bytes(buf->data());
-        memcpy(buf->data() + Header::WIRE_SIZE, message.c_str(), message.length());
+        head.to_bytes(buf.data());
+        memcpy(buf.data() + Header::WIRE_SIZE, message.c_str(), message.length());
 
-        auto self = shared_from_this();
-        boost::asio::async_write(
-            _socket,
-            boost::asio::buffer(buf->data(), totalSize),
-            [this, self, buf](boost::system::error_code ec, std::size_t /*length*/) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("Write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_auth_response(const MessageType& msgType, const AuthResponse& resp) {
@@ -230,21 +259,12 @@ namespace infrastructure::adapters::in::network {
         };
 
         const size_t totalSize = Header::WIRE_SIZE + AuthResponse::WIRE_SIZE;
-        auto buf = std::make_shared<std::vector<uint8_t>>(totalSize);
+        auto buf = _writeQueue.acquire(totalSize);
 
-        head.to_bytes(buf->data());
-        resp.to_bytes(buf->data() + Header::WIRE_SIZE);
+        head.to_bytes(buf.data());
+        resp.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(
-            _socket,
-            boost::asio::buffer(buf->data(), totalSize),
-            [this, self, buf](boost::system::error_code ec, std::size_t /*length*/) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("Write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_auth_response_with_token(const MessageType& msgType, const AuthResponseWithToken& resp) {
@@ -258,21 +278,12 @@ namespace infrastructure::adapters::in::network {
         };
 
         const size_t totalSize = Header::WIRE_SIZE + AuthResponseWithToken::WIRE_SIZE;
-        auto buf = std::make_shared<std::vector<uint8_t>>(totalSize);
+        auto buf = _writeQueue.acquire(totalSize);
 
-        head.to_bytes(buf->data());
-        resp.to_bytes(buf->data() + Header::WIRE_SIZE);
+        head.to_bytes(buf.data());
+        resp.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(
-            _socket,
-            boost::asio::buffer(buf->data(), totalSize),
-            [this, self, buf](boost::system::error_code ec, std::size_t /*length*/) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("Write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_heartbeat_ack() {
@@ -282,78 +293,60 @@ namespace infrastructure::adapters::in::network {
             .payload_size = 0
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE);
+        head.to_bytes(buf.data());
 
-        auto self = shared_from_this();
-        boost::asio::async_write(
-            _socket,
-            boost::asio::buffer(buf->data(), Header::WIRE_SIZE),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("HeartBeatAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_compressed(MessageType msgType, const uint8_t* payload, size_t payloadSize) {
         auto logger = server::logging::Logger::getNetworkLogger();
-        std::shared_ptr<std::vector<uint8_t>> buf;
-
-        // Try to compress if payload is large enough
-        if (payloadSize >= compression::MIN_COMPRESS_SIZE) {
-            auto compressed = compression::compress(payload, payloadSize);
-            if (!compressed.empty()) {
-                // Compression successful - use compressed format
-                // Format: Header (with TCP_COMPRESSION_FLAG) + originalSize (2 bytes) + compressed data
-                size_t totalSize = Header::WIRE_SIZE + CompressionHeader::WIRE_SIZE + compressed.size();
-                buf = std::make_shared<std::vector<uint8_t>>(totalSize);
+        FrameWriteQueue::Buffer buf;
+
+        // The policy decides per message type: raw, LZ4 fast or LZ4 HC (same format for the client)
+        if (_compressionPolicy) {
+            // Format: Header (with TCP_COMPRESSION_FLAG) + originalSize (2 bytes) + compressed data
+            constexpr size_t headersSize = Header::WIRE_SIZE + CompressionHeader::WIRE_SIZE;
+            buf = _writeQueue.acquire(headersSize + compression::compressBound(payloadSize));
+            size_t compressedSize = _compressionPolicy->compress(static_cast<uint16_t>(msgType),
+                std::span<const uint8_t>(payload, payloadSize),
+                std::span<uint8_t>(buf.data() + headersSize, buf.size() - headersSize));
+            if (compressedSize > 0) {
+                buf.resize(headersSize + compressedSize);
 
                 Header head = {
                     .isAuthenticated = _isAuthenticated,
                     .type = static_cast<uint16_t>(static_cast<uint16_t>(msgType) | TCP_COMPRESSION_FLAG),
-                    .payload_size = static_cast<uint32_t>(CompressionHeader::WIRE_SIZE + compressed.size())
+                    .payload_size = static_cast<uint32_t>(CompressionHeader::WIRE_SIZE + compressedSize)
                 };
-                head.to_bytes(buf->data());
+                head.to_bytes(buf.data());
 
                 CompressionHeader compHead{.originalSize = static_cast<uint16_t>(payloadSize)};
-                compHead.to_bytes(buf->data() + Header::WIRE_SIZE);
-
-                std::memcpy(buf->data() + Header::WIRE_SIZE + CompressionHeader::WIRE_SIZE,
-                           compressed.data(), compressed.size());
+                compHead.to_bytes(buf.data() + Header::WIRE_SIZE);
 
                 logger->trace("TCP compressed: {} -> {} bytes ({}%)",
-                    payloadSize, compressed.size(),
-                    100 - (compressed.size() * 100 / payloadSize));
+                    payloadSize, compressedSize,
+                    100 - (compressedSize * 100 / payloadSize));
+            } else {
+                buf.clear();
             }
         }
 
-        // Fallback to uncompressed if compression failed or not worth it
-        if (!buf) {
+        // Fallback to uncompressed if compression failed or not worth it (the compression buffer is large enough)
+        if (buf.empty()) {
             size_t totalSize = Header::WIRE_SIZE + payloadSize;
-            buf = std::make_shared<std::vector<uint8_t>>(totalSize);
+            buf.resize(totalSize);
 
             Header head = {
                 .isAuthenticated = _isAuthenticated,
                 .type = static_cast<uint16_t>(msgType),
                 .payload_size = static_cast<uint32_t>(payloadSize)
             };
-            head.to_bytes(buf->data());
-            std::memcpy(buf->data() + Header::WIRE_SIZE, payload, payloadSize);
+            head.to_bytes(buf.data());
+            std::memcpy(buf.data() + Header::WIRE_SIZE, payload, payloadSize);
         }
 
-        auto self = shared_from_this();
-        boost::asio::async_write(
-            _socket,
-            boost::asio::buffer(buf->data(), buf->size()),
-            [self, buf, msgType](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("Compressed write error (type=0x{:04X}): {}",
-                        static_cast<uint16_t>(msgType), ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::scheduleTimeoutCheck() {
@@ -388,7 +381,7 @@ namespace infrastructure::adapters::in::network {
         });
     }
 
-    void Session::handle_command(const Header& head) {
+    void Session::handle_command(const Header& head, std::span<const uint8_t> payload) {
         using application::use_cases::auth::Login;
         using application::use_cases::auth::Register;
         auto networkLogger = server::logging::Logger::getNetworkLogger();
@@ -399,10 +392,6 @@ namespace infrastructure::adapters::in::network {
             return;
         }
 
-        // Extract payload for room handlers
-        std::vector<uint8_t> payload(_accumulator.begin() + Header::WIRE_SIZE,
-                                     _accumulator.begin() + Header::WIRE_SIZE + head.payload_size);
-
         // Handle room messages (requires authentication)
         if (_isAuthenticated && _user.has_value()) {
             switch (static_cast<MessageType>(head.type)) {
@@ -892,8 +881,9 @@ namespace infrastructure::adapters::in::network {
     void TCPAuthServer::start_accept() {
         auto networkLogger = server::logging::Logger::getNetworkLogger();
 
-        // Create a new ssl::stream for each incoming connection
-        auto sslSocket = std::make_shared<ssl::stream<tcp::socket>>(_io_ctx, _sslContext);
+        // Create a new ssl::stream for each incoming connection, on its own strand: reads,
+        // writes and the timeout timer of a session never run concurrently
+        auto sslSocket = std::make_shared<ssl::stream<tcp::socket>>(boost::asio::make_strand(_io_ctx), _sslContext);
 
         _acceptor.async_accept(
             sslSocket->lowest_layer(),  // Accept on the underlying TCP socket
@@ -955,6 +945,7 @@ namespace infrastructure::adapters::in::network {
                         );
 
                         // Register and start the session
+                        session->setCompressionPolicy(_compressionPolicy);
                         registerSession(session);
                         session->start();
                     }
@@ -970,7 +961,7 @@ namespace infrastructure::adapters::in::network {
     // Room Handlers Implementation
     // =========================================================================
 
-    void Session::handleCreateRoom(const std::vector<uint8_t>& payload) {
+    void Session::handleCreateRoom(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
         std::string email = _user->getEmail().value();
         std::string displayName = _user->getUsername().value();
@@ -1035,7 +1026,7 @@ namespace infrastructure::adapters::in::network {
         broadcastRoomUpdate(result->room);
     }
 
-    void Session::handleJoinRoomByCode(const std::vector<uint8_t>& payload) {
+    void Session::handleJoinRoomByCode(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
         std::string email = _user->getEmail().value();
         std::string displayName = _user->getUsername().value();
@@ -1110,7 +1101,7 @@ namespace infrastructure::adapters::in::network {
         do_write_leave_room_ack();
     }
 
-    void Session::handleSetReady(const std::vector<uint8_t>& payload) {
+    void Session::handleSetReady(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
         std::string email = _user->getEmail().value();
 
@@ -1191,18 +1182,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(CreateRoomAck::WIRE_SIZE)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + CreateRoomAck::WIRE_SIZE);
-        head.to_bytes(buf->data());
-        ack.to_bytes(buf->data() + Header::WIRE_SIZE);
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + CreateRoomAck::WIRE_SIZE);
+        head.to_bytes(buf.data());
+        ack.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("CreateRoomAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_join_room_ack(const JoinRoomAck& ack) {
@@ -1213,18 +1197,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
-        ack.to_bytes(buf->data() + Header::WIRE_SIZE);
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
+        ack.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("JoinRoomAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_join_room_nack(const JoinRoomNack& nack) {
@@ -1234,18 +1211,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(JoinRoomNack::WIRE_SIZE)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + JoinRoomNack::WIRE_SIZE);
-        head.to_bytes(buf->data());
-        nack.to_bytes(buf->data() + Header::WIRE_SIZE);
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + JoinRoomNack::WIRE_SIZE);
+        head.to_bytes(buf.data());
+        nack.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("JoinRoomNack write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_leave_room_ack() {
@@ -1255,17 +1225,10 @@ namespace infrastructure::adapters::in::network {
             .payload_size = 0
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE);
+        head.to_bytes(buf.data());
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("LeaveRoomAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_set_ready_ack(const SetReadyAck& ack) {
@@ -1275,18 +1238,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(SetReadyAck::WIRE_SIZE)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + SetReadyAck::WIRE_SIZE);
-        head.to_bytes(buf->data());
-        ack.to_bytes(buf->data() + Header::WIRE_SIZE);
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + SetReadyAck::WIRE_SIZE);
+        head.to_bytes(buf.data());
+        ack.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("SetReadyAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_start_game_ack() {
@@ -1296,17 +1252,10 @@ namespace infrastructure::adapters::in::network {
             .payload_size = 0
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE);
+        head.to_bytes(buf.data());
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("StartGameAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_start_game_nack(const StartGameNack& nack) {
@@ -1316,40 +1265,17 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(StartGameNack::WIRE_SIZE)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + StartGameNack::WIRE_SIZE);
-        head.to_bytes(buf->data());
-        nack.to_bytes(buf->data() + Header::WIRE_SIZE);
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + StartGameNack::WIRE_SIZE);
+        head.to_bytes(buf.data());
+        nack.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("StartGameNack write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_room_update(const RoomUpdate& update) {
-        size_t payloadSize = update.wire_size();
-        Header head = {
-            .isAuthenticated = _isAuthenticated,
-            .type = static_cast<uint16_t>(MessageType::RoomUpdate),
-            .payload_size = static_cast<uint32_t>(payloadSize)
-        };
-
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
-        update.to_bytes(buf->data() + Header::WIRE_SIZE);
-
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("RoomUpdate write error: {}", ec.message());
-                }
-            });
+        std::vector<uint8_t> payload(update.wire_size());
+        update.to_bytes(payload.data());
+        do_write_compressed(MessageType::RoomUpdate, payload.data(), payload.size());
     }
 
     void Session::do_write_game_starting(const GameStarting& gs) {
@@ -1359,18 +1285,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(GameStarting::WIRE_SIZE)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + GameStarting::WIRE_SIZE);
-        head.to_bytes(buf->data());
-        gs.to_bytes(buf->data() + Header::WIRE_SIZE);
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + GameStarting::WIRE_SIZE);
+        head.to_bytes(buf.data());
+        gs.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("GameStarting write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     // =========================================================================
@@ -1395,7 +1314,7 @@ namespace infrastructure::adapters::in::network {
     // Kick System Implementation (Phase 2)
     // =========================================================================
 
-    void Session::handleKickPlayer(const std::vector<uint8_t>& payload) {
+    void Session::handleKickPlayer(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
         std::string email = _user->getEmail().value();
 
@@ -1436,17 +1355,10 @@ namespace infrastructure::adapters::in::network {
             .payload_size = 0
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE);
+        head.to_bytes(buf.data());
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("KickPlayerAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_player_kicked(const PlayerKickedNotification& notif) {
@@ -1456,25 +1368,18 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(PlayerKickedNotification::WIRE_SIZE)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + PlayerKickedNotification::WIRE_SIZE);
-        head.to_bytes(buf->data());
-        notif.to_bytes(buf->data() + Header::WIRE_SIZE);
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + PlayerKickedNotification::WIRE_SIZE);
+        head.to_bytes(buf.data());
+        notif.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("PlayerKicked write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     // =========================================================================
     // Room Configuration Implementation
     // =========================================================================
 
-    void Session::handleSetRoomConfig(const std::vector<uint8_t>& payload) {
+    void Session::handleSetRoomConfig(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
         std::string email = _user->getEmail().value();
 
@@ -1512,18 +1417,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(SetRoomConfigAck::WIRE_SIZE)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + SetRoomConfigAck::WIRE_SIZE);
-        head.to_bytes(buf->data());
-        ack.to_bytes(buf->data() + Header::WIRE_SIZE);
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + SetRoomConfigAck::WIRE_SIZE);
+        head.to_bytes(buf.data());
+        ack.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("SetRoomConfigAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     // =========================================================================
@@ -1619,20 +1517,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
-        ack.to_bytes(buf->data() + Header::WIRE_SIZE);
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
+        ack.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf, ackType](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("{} write error: {}",
-                        ackType == MessageType::QuickJoinAck ? "QuickJoinAck" : "JoinRoomAck",
-                        ec.message());
-                }
-            });
+        send_frame(std::move(buf));
 
         // Send chat history to the joining player
         std::string roomCode = result.room->getCode();
@@ -1658,25 +1547,9 @@ namespace infrastructure::adapters::in::network {
     }
 
     void Session::do_write_browse_public_rooms(const BrowsePublicRoomsResponse& resp) {
-        size_t payloadSize = resp.wire_size();
-        Header head = {
-            .isAuthenticated = _isAuthenticated,
-            .type = static_cast<uint16_t>(MessageType::BrowsePublicRoomsAck),
-            .payload_size = static_cast<uint32_t>(payloadSize)
-        };
-
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
-        resp.to_bytes(buf->data() + Header::WIRE_SIZE);
-
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("BrowsePublicRoomsAck write error: {}", ec.message());
-                }
-            });
+        std::vector<uint8_t> payload(resp.wire_size());
+        resp.to_bytes(payload.data());
+        do_write_compressed(MessageType::BrowsePublicRoomsAck, payload.data(), payload.size());
     }
 
     void Session::do_write_quick_join_nack(const QuickJoinNack& nack) {
@@ -1686,18 +1559,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(QuickJoinNack::WIRE_SIZE)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + QuickJoinNack::WIRE_SIZE);
-        head.to_bytes(buf->data());
-        nack.to_bytes(buf->data() + Header::WIRE_SIZE);
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + QuickJoinNack::WIRE_SIZE);
+        head.to_bytes(buf.data());
+        nack.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("QuickJoinNack write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     // =========================================================================
@@ -1769,7 +1635,7 @@ namespace infrastructure::adapters::in::network {
         do_write_get_user_settings_response(resp);
     }
 
-    void Session::handleSaveUserSettings(const std::vector<uint8_t>& payload) {
+    void Session::handleSaveUserSettings(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
         std::string email = _user->getEmail().value();
 
@@ -1839,18 +1705,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(GetUserSettingsResponse::WIRE_SIZE)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + GetUserSettingsResponse::WIRE_SIZE);
-        head.to_bytes(buf->data());
-        resp.to_bytes(buf->data() + Header::WIRE_SIZE);
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + GetUserSettingsResponse::WIRE_SIZE);
+        head.to_bytes(buf.data());
+        resp.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("GetUserSettingsAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_save_user_settings_response(const SaveUserSettingsResponse& resp) {
@@ -1860,25 +1719,18 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(SaveUserSettingsResponse::WIRE_SIZE)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + SaveUserSettingsResponse::WIRE_SIZE);
-        head.to_bytes(buf->data());
-        resp.to_bytes(buf->data() + Header::WIRE_SIZE);
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + SaveUserSettingsResponse::WIRE_SIZE);
+        head.to_bytes(buf.data());
+        resp.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("SaveUserSettingsAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     // =========================================================================
     // Chat System Implementation (Phase 2)
     // =========================================================================
 
-    void Session::handleSendChatMessage(const std::vector<uint8_t>& payload) {
+    void Session::handleSendChatMessage(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
         std::string email = _user->getEmail().value();
 
@@ -1936,17 +1788,10 @@ namespace infrastructure::adapters::in::network {
             .payload_size = 0
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE);
+        head.to_bytes(buf.data());
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("SendChatMessageAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_chat_message(const ChatMessagePayload& msg) {
@@ -1956,44 +1801,22 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(ChatMessagePayload::WIRE_SIZE)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + ChatMessagePayload::WIRE_SIZE);
-        head.to_bytes(buf->data());
-        msg.to_bytes(buf->data() + Header::WIRE_SIZE);
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + ChatMessagePayload::WIRE_SIZE);
+        head.to_bytes(buf.data());
+        msg.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("ChatMessageBroadcast write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_chat_history(const ChatHistoryResponse& hist) {
-        Header head = {
-            .isAuthenticated = _isAuthenticated,
-            .type = static_cast<uint16_t>(MessageType::ChatHistory),
-            .payload_size = static_cast<uint32_t>(hist.wire_size())
-        };
-
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + hist.wire_size());
-        head.to_bytes(buf->data());
-        hist.to_bytes(buf->data() + Header::WIRE_SIZE);
-
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("ChatHistory write error: {}", ec.message());
-                }
-            });
+        std::vector<uint8_t> payload(hist.wire_size());
+        hist.to_bytes(payload.data());
+        do_write_compressed(MessageType::ChatHistory, payload.data(), payload.size());
     }
 
     // ========== LEADERBOARD HANDLERS ==========
 
-    void Session::handleGetLeaderboard(const std::vector<uint8_t>& payload) {
+    void Session::handleGetLeaderboard(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
 
         if (!_isAuthenticated || !_user.has_value()) {
@@ -2159,18 +1982,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(PlayerStatsWire::WIRE_SIZE)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + PlayerStatsWire::WIRE_SIZE);
-        head.to_bytes(buf->data());
-        wire.to_bytes(buf->data() + Header::WIRE_SIZE);
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + PlayerStatsWire::WIRE_SIZE);
+        head.to_bytes(buf.data());
+        wire.to_bytes(buf.data() + Header::WIRE_SIZE);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("PlayerStatsData write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_game_history_response(
@@ -2186,10 +2002,10 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
 
-        uint8_t* ptr = buf->data() + Header::WIRE_SIZE;
+        uint8_t* ptr = buf.data() + Header::WIRE_SIZE;
         *ptr++ = count;
 
         for (size_t i = 0; i < count; ++i) {
@@ -2206,14 +2022,7 @@ namespace infrastructure::adapters::in::network {
             ptr += GameHistoryEntryWire::WIRE_SIZE;
         }
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("GameHistoryData write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_achievements_response(
@@ -2236,20 +2045,13 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
 
         uint32_t netBitfield = swap32(bitfield);
-        std::memcpy(buf->data() + Header::WIRE_SIZE, &netBitfield, 4);
+        std::memcpy(buf.data() + Header::WIRE_SIZE, &netBitfield, 4);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("AchievementsData write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     // ========== FRIENDS SYSTEM HANDLERS ==========
@@ -2272,7 +2074,7 @@ namespace infrastructure::adapters::in::network {
         return static_cast<uint8_t>(FriendOnlineStatus::Online);
     }
 
-    void Session::handleSendFriendRequest(const std::vector<uint8_t>& payload) {
+    void Session::handleSendFriendRequest(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
 
         if (!_isAuthenticated || !_user.has_value()) {
@@ -2384,7 +2186,7 @@ namespace infrastructure::adapters::in::network {
         logger->info("Friend request sent: {} -> {}", fromEmail, toEmail);
     }
 
-    void Session::handleAcceptFriendRequest(const std::vector<uint8_t>& payload) {
+    void Session::handleAcceptFriendRequest(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
 
         if (!_isAuthenticated || !_user.has_value()) {
@@ -2454,7 +2256,7 @@ namespace infrastructure::adapters::in::network {
         logger->info("Friend request accepted: {} accepted {}", myEmail, fromEmail);
     }
 
-    void Session::handleRejectFriendRequest(const std::vector<uint8_t>& payload) {
+    void Session::handleRejectFriendRequest(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
 
         if (!_isAuthenticated || !_user.has_value()) {
@@ -2495,7 +2297,7 @@ namespace infrastructure::adapters::in::network {
         logger->info("Friend request rejected: {} rejected {}", myEmail, fromEmail);
     }
 
-    void Session::handleRemoveFriend(const std::vector<uint8_t>& payload) {
+    void Session::handleRemoveFriend(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
 
         if (!_isAuthenticated || !_user.has_value()) {
@@ -2542,7 +2344,7 @@ namespace infrastructure::adapters::in::network {
         logger->info("Friend removed: {} removed {}", myEmail, friendEmail);
     }
 
-    void Session::handleBlockUser(const std::vector<uint8_t>& payload) {
+    void Session::handleBlockUser(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
 
         if (!_isAuthenticated || !_user.has_value()) {
@@ -2602,7 +2404,7 @@ namespace infrastructure::adapters::in::network {
         logger->info("User blocked: {} blocked {}", myEmail, targetEmail);
     }
 
-    void Session::handleUnblockUser(const std::vector<uint8_t>& payload) {
+    void Session::handleUnblockUser(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
 
         if (!_isAuthenticated || !_user.has_value()) {
@@ -2643,7 +2445,7 @@ namespace infrastructure::adapters::in::network {
         logger->info("User unblocked: {} unblocked {}", myEmail, targetEmail);
     }
 
-    void Session::handleGetFriendsList(const std::vector<uint8_t>& payload) {
+    void Session::handleGetFriendsList(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
 
         if (!_isAuthenticated || !_user.has_value()) {
@@ -2780,7 +2582,7 @@ namespace infrastructure::adapters::in::network {
 
     // ========== PRIVATE MESSAGING HANDLERS ==========
 
-    void Session::handleSendPrivateMessage(const std::vector<uint8_t>& payload) {
+    void Session::handleSendPrivateMessage(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
 
         if (!_isAuthenticated || !_user.has_value()) {
@@ -2849,7 +2651,7 @@ namespace infrastructure::adapters::in::network {
         logger->debug("Private message sent: {} -> {} (id: {})", fromEmail, toEmail, messageId);
     }
 
-    void Session::handleGetConversation(const std::vector<uint8_t>& payload) {
+    void Session::handleGetConversation(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
 
         if (!_isAuthenticated || !_user.has_value()) {
@@ -2969,7 +2771,7 @@ namespace infrastructure::adapters::in::network {
         logger->debug("GetConversationsList: {} conversations", wireConversations.size());
     }
 
-    void Session::handleMarkMessagesRead(const std::vector<uint8_t>& payload) {
+    void Session::handleMarkMessagesRead(std::span<const uint8_t> payload) {
         auto logger = server::logging::Logger::getNetworkLogger();
 
         if (!_isAuthenticated || !_user.has_value()) {
@@ -3038,22 +2840,15 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
 
-        uint8_t* ptr = buf->data() + Header::WIRE_SIZE;
+        uint8_t* ptr = buf.data() + Header::WIRE_SIZE;
         ptr[0] = errorCode;
         std::memset(ptr + 1, 0, MAX_EMAIL_LEN);
         std::strncpy(reinterpret_cast<char*>(ptr + 1), targetEmail.c_str(), MAX_EMAIL_LEN - 1);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("SendFriendRequestAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_friend_request_received(const std::string& fromEmail, const std::string& fromDisplayName) {
@@ -3064,22 +2859,15 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
 
-        uint8_t* ptr = buf->data() + Header::WIRE_SIZE;
+        uint8_t* ptr = buf.data() + Header::WIRE_SIZE;
         std::memset(ptr, 0, payloadSize);
         std::strncpy(reinterpret_cast<char*>(ptr), fromEmail.c_str(), MAX_EMAIL_LEN - 1);
         std::strncpy(reinterpret_cast<char*>(ptr + MAX_EMAIL_LEN), fromDisplayName.c_str(), PLAYER_NAME_LEN - 1);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("FriendRequestReceived write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_accept_friend_request_ack(uint8_t errorCode) {
@@ -3090,18 +2878,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
-        buf->at(Header::WIRE_SIZE) = errorCode;
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
+        buf.at(Header::WIRE_SIZE) = errorCode;
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("AcceptFriendRequestAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_friend_request_accepted(const std::string& friendEmail, const std::string& displayName, uint8_t onlineStatus) {
@@ -3112,23 +2893,16 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
 
-        uint8_t* ptr = buf->data() + Header::WIRE_SIZE;
+        uint8_t* ptr = buf.data() + Header::WIRE_SIZE;
         std::memset(ptr, 0, payloadSize);
         std::strncpy(reinterpret_cast<char*>(ptr), friendEmail.c_str(), MAX_EMAIL_LEN - 1);
         std::strncpy(reinterpret_cast<char*>(ptr + MAX_EMAIL_LEN), displayName.c_str(), PLAYER_NAME_LEN - 1);
         ptr[MAX_EMAIL_LEN + PLAYER_NAME_LEN] = onlineStatus;
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("FriendRequestAccepted write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_reject_friend_request_ack(uint8_t errorCode) {
@@ -3139,18 +2913,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
-        buf->at(Header::WIRE_SIZE) = errorCode;
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
+        buf.at(Header::WIRE_SIZE) = errorCode;
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("RejectFriendRequestAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_remove_friend_ack(uint8_t errorCode) {
@@ -3161,18 +2928,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
-        buf->at(Header::WIRE_SIZE) = errorCode;
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
+        buf.at(Header::WIRE_SIZE) = errorCode;
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("RemoveFriendAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_friend_removed(const std::string& friendEmail) {
@@ -3183,21 +2943,14 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
 
-        uint8_t* ptr = buf->data() + Header::WIRE_SIZE;
+        uint8_t* ptr = buf.data() + Header::WIRE_SIZE;
         std::memset(ptr, 0, MAX_EMAIL_LEN);
         std::strncpy(reinterpret_cast<char*>(ptr), friendEmail.c_str(), MAX_EMAIL_LEN - 1);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("FriendRemoved write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_block_user_ack(uint8_t errorCode) {
@@ -3208,18 +2961,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
-        buf->at(Header::WIRE_SIZE) = errorCode;
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
+        buf.at(Header::WIRE_SIZE) = errorCode;
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("BlockUserAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_unblock_user_ack(uint8_t errorCode) {
@@ -3230,18 +2976,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
-        buf->at(Header::WIRE_SIZE) = errorCode;
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
+        buf.at(Header::WIRE_SIZE) = errorCode;
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("UnblockUserAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_friends_list(const std::vector<FriendInfoWire>& friends, uint8_t totalCount) {
@@ -3275,10 +3014,10 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
 
-        uint8_t* ptr = buf->data() + Header::WIRE_SIZE;
+        uint8_t* ptr = buf.data() + Header::WIRE_SIZE;
         ptr[0] = incomingCount;
         ptr[1] = outgoingCount;
         ptr += 2;
@@ -3293,14 +3032,7 @@ namespace infrastructure::adapters::in::network {
             ptr += FriendRequestInfoWire::WIRE_SIZE;
         }
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("FriendRequestsData write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_blocked_users(const std::vector<FriendInfoWire>& blockedUsers) {
@@ -3313,10 +3045,10 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
 
-        uint8_t* ptr = buf->data() + Header::WIRE_SIZE;
+        uint8_t* ptr = buf.data() + Header::WIRE_SIZE;
         ptr[0] = count;
         ptr += 1;
 
@@ -3325,14 +3057,7 @@ namespace infrastructure::adapters::in::network {
             ptr += FriendInfoWire::WIRE_SIZE;
         }
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("BlockedUsersData write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_friend_status_changed(const std::string& friendEmail, uint8_t newStatus, const std::string& roomCode) {
@@ -3343,23 +3068,16 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
 
-        uint8_t* ptr = buf->data() + Header::WIRE_SIZE;
+        uint8_t* ptr = buf.data() + Header::WIRE_SIZE;
         std::memset(ptr, 0, payloadSize);
         std::strncpy(reinterpret_cast<char*>(ptr), friendEmail.c_str(), MAX_EMAIL_LEN - 1);
         ptr[MAX_EMAIL_LEN] = newStatus;
         std::strncpy(reinterpret_cast<char*>(ptr + MAX_EMAIL_LEN + 1), roomCode.c_str(), ROOM_CODE_LEN - 1);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("FriendStatusChanged write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     // ========== PRIVATE MESSAGING RESPONSE WRITERS ==========
@@ -3372,22 +3090,15 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
 
-        uint8_t* ptr = buf->data() + Header::WIRE_SIZE;
+        uint8_t* ptr = buf.data() + Header::WIRE_SIZE;
         ptr[0] = errorCode;
         uint64_t netId = swap64(messageId);
         std::memcpy(ptr + 1, &netId, 8);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("SendPrivateMessageAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_private_message_received(const std::string& senderEmail, const std::string& senderDisplayName, const std::string& message, uint64_t timestamp) {
@@ -3400,10 +3111,10 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
 
-        uint8_t* ptr = buf->data() + Header::WIRE_SIZE;
+        uint8_t* ptr = buf.data() + Header::WIRE_SIZE;
         std::memset(ptr, 0, MAX_EMAIL_LEN + MAX_USERNAME_LEN);
         std::strncpy(reinterpret_cast<char*>(ptr), senderEmail.c_str(), MAX_EMAIL_LEN - 1);
         std::strncpy(reinterpret_cast<char*>(ptr + MAX_EMAIL_LEN), senderDisplayName.c_str(), MAX_USERNAME_LEN - 1);
@@ -3419,14 +3130,7 @@ namespace infrastructure::adapters::in::network {
 
         std::memcpy(ptr, message.c_str(), msgLen);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("PrivateMessageReceived write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_conversation(const std::vector<PrivateMessageWire>& messages, bool hasMore) {
@@ -3476,18 +3180,11 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
-        buf->at(Header::WIRE_SIZE) = errorCode;
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
+        buf.at(Header::WIRE_SIZE) = errorCode;
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("MarkMessagesReadAck write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
     void Session::do_write_messages_read_notification(const std::string& readerEmail) {
@@ -3498,21 +3195,14 @@ namespace infrastructure::adapters::in::network {
             .payload_size = static_cast<uint32_t>(payloadSize)
         };
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(Header::WIRE_SIZE + payloadSize);
-        head.to_bytes(buf->data());
+        auto buf = _writeQueue.acquire(Header::WIRE_SIZE + payloadSize);
+        head.to_bytes(buf.data());
 
-        uint8_t* ptr = buf->data() + Header::WIRE_SIZE;
+        uint8_t* ptr = buf.data() + Header::WIRE_SIZE;
         std::memset(ptr, 0, MAX_EMAIL_LEN);
         std::strncpy(reinterpret_cast<char*>(ptr), readerEmail.c_str(), MAX_EMAIL_LEN - 1);
 
-        auto self = shared_from_this();
-        boost::asio::async_write(_socket, boost::asio::buffer(*buf),
-            [self, buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    auto logger = server::logging::Logger::getNetworkLogger();
-                    logger->error("MessagesReadNotification write error: {}", ec.message());
-                }
-            });
+        send_frame(std::move(buf));
     }
 
 }
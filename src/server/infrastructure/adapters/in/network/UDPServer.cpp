@@ -9,9 +9,18 @@
 #include "infrastructure/logging/Logger.hpp"
 #include "Protocol.hpp"
 #include "compression/Compression.hpp"
+#include "compression/CompressionContext.hpp"
+#include "compression/SnapshotDelta.hpp"
+#include "PackedSnapshot.hpp"
+#include "infrastructure/network/DatagramBundler.hpp"
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <memory_resource>
+#include <span>
 
 #ifdef _WIN32
     #include <winsock2.h>
@@ -20,7 +29,20 @@
 
 namespace infrastructure::adapters::in::network {
 
-    static constexpr int BROADCAST_INTERVAL_MS = 50;
+    // A ReliableEvents packet stays within the snapshots' datagram size; the rest waits for the next tick
+    static constexpr size_t RELIABLE_EVENTS_MAX_DATAGRAM = 1200;
+
+    // Full snapshots differ by payload form (bytes / packed) and by the dictionary they are compressed with
+    static constexpr size_t FULL_SNAPSHOT_VARIANTS = 3;
+    static size_t fullSnapshotVariant(SnapshotEncoding encoding) {
+        if (encoding >= SnapshotEncoding::Dictionary) {
+            return 2;
+        }
+        return encoding >= SnapshotEncoding::Packed ? 1 : 0;
+    }
+
+    // Bundler of the room tick running on this thread: a strand handler runs on one thread from start to end
+    static thread_local infrastructure::network::DatagramBundler* t_tickBundler = nullptr;
 
     // ════════════════════════════════════════════════════════════════════════
     // Generic broadcast method implementation (reduces code duplication)
@@ -30,48 +52,53 @@ namespace infrastructure::adapters::in::network {
                                      const std::shared_ptr<game::GameWorld>& gameWorld) {
         if (!gameWorld) return;
 
-        const size_t totalSize = UDPHeader::WIRE_SIZE + T::WIRE_SIZE;
-        std::vector<uint8_t> buf(totalSize);
-
-        UDPHeader head{
-            .type = static_cast<uint16_t>(type),
-            .sequence_num = 0,
-            .timestamp = UDPHeader::getTimestamp()
-        };
-        head.to_bytes(buf.data());
-        payload.to_bytes(buf.data() + UDPHeader::WIRE_SIZE);
+        // Called from the room's strand, like every GameWorld access
+        Shard& shard = shardOf(gameWorld);
+        auto recipients = gameWorld->getRecipients(gameWorld->frameResource());
+        infrastructure::network::SharedSendBuffer buf;
+        for (const auto& recipient : recipients) {
+            // Goes out with the player's other events in its next ReliableEvents packet
+            if (recipient.reliableEvents) {
+                recipient.reliableEvents->queue(type, payload);
+                continue;
+            }
 
-        auto endpoints = gameWorld->getAllEndpoints();
-        for (const auto& ep : endpoints) {
-            sendTo(ep, buf.data(), buf.size());
+            // Serialized once, every other recipient's send shares the buffer
+            if (!buf) {
+                buf = _sendBuffers.acquire(UDPHeader::WIRE_SIZE + T::WIRE_SIZE);
+                UDPHeader head{
+                    .type = static_cast<uint16_t>(type),
+                    .sequence_num = 0,
+                    .timestamp = UDPHeader::getTimestamp()
+                };
+                head.to_bytes(buf.data());
+                payload.to_bytes(buf.data() + UDPHeader::WIRE_SIZE);
+            }
+            sendToRecipient(shard, recipient, buf);
         }
     }
 
+    // Sends in flight a busy server reaches; the buffer and handler pools grow past it if needed
+    static constexpr size_t PREALLOCATED_SENDS = 256;
     static constexpr int PLAYER_TIMEOUT_MS = 2000;
     static constexpr int AUTO_SAVE_INTERVAL_MS = 1000;  // Auto-save every 1 second
 
     UDPServer::UDPServer(boost::asio::io_context& io_ctx,
                          std::shared_ptr<SessionManager> sessionManager,
-                         std::shared_ptr<ILeaderboardRepository> leaderboardRepository)
+                         std::shared_ptr<ILeaderboardRepository> leaderboardRepository,
+                         size_t shardCount,
+                         unsigned short port)
         : _io_ctx(io_ctx),
-          _socket(io_ctx, udp::endpoint(udp::v4(), 4124)),
           _instanceManager(io_ctx),
+          _connections(std::max<size_t>(shardCount, 1)),
           _sessionManager(sessionManager),
           _leaderboardRepository(leaderboardRepository),
-          _broadcastTimer(io_ctx),
           _networkStats(std::make_shared<infrastructure::network::NetworkStats>()),
           _statsTimer(io_ctx),
           _autoSaveTimer(io_ctx) {
-        // Windows: désactiver ICMP Port Unreachable qui cause des erreurs sur UDP
-        #ifdef _WIN32
-            BOOL bNewBehavior = FALSE;
-            DWORD dwBytesReturned = 0;
-            WSAIoctl(
-                _socket.native_handle(), SIO_UDP_CONNRESET,
-                &bNewBehavior, sizeof(bNewBehavior),
-                NULL, 0, &dwBytesReturned, NULL, NULL
-            );
-        #endif
+        openShards(shardCount, port);
+        _sendBuffers.reserve(PREALLOCATED_SENDS);
+        _sendHandlers.reserve(PREALLOCATED_SENDS);
 
         // Register callback to handle player leaving game via TCP
         if (_sessionManager) {
@@ -85,6 +112,13 @@ namespace infrastructure::adapters::in::network {
                 }
             );
 
+            // Mirror the session side's endpoint bindings: leave, kick, expiry and ban all go through it
+            _sessionManager->setUDPBindingRemovedCallback(
+                [this](const std::string& endpoint) {
+                    _connections.erase(endpoint);
+                }
+            );
+
             // Register callback to handle GodMode changes in real-time
             _sessionManager->setGodModeChangedCallback(
                 [this](uint8_t playerId, const std::string& roomCode, bool enabled) {
@@ -102,6 +136,12 @@ namespace infrastructure::adapters::in::network {
     }
 
     UDPServer::~UDPServer() {
+        // Shard threads must not outlive the server they run handlers for
+        for (auto& ctx : _shardContexts) {
+            ctx->stop();
+        }
+        _shardThreads.clear();
+
         // Clear callbacks to prevent use-after-free during shutdown
         // When io_context is destroyed, it may trigger Session destructors which call
         // notifyPlayerLeaveGame(). If the callback still references this UDPServer,
@@ -109,6 +149,7 @@ namespace infrastructure::adapters::in::network {
         if (_sessionManager) {
             _sessionManager->setPlayerLeaveGameCallback(nullptr);
             _sessionManager->setGodModeChangedCallback(nullptr);
+            _sessionManager->setUDPBindingRemovedCallback(nullptr);
         }
     }
 
@@ -116,11 +157,97 @@ namespace infrastructure::adapters::in::network {
         return ep.address().to_string() + ":" + std::to_string(ep.port());
     }
 
+    void UDPServer::openShards(size_t shardCount, unsigned short port) {
+#ifndef __linux__
+        if (shardCount > 1) {
+            server::logging::Logger::getNetworkLogger()->warn(
+                "UDP sharding relies on Linux SO_REUSEPORT load balancing, using a single socket");
+            shardCount = 1;
+        }
+#endif
+        if (shardCount <= 1) {
+            // Single socket on the shared io_context, served by the main thread pool
+            _shards.push_back(std::make_unique<Shard>(0, _io_ctx, udp::socket(_io_ctx, udp::endpoint(udp::v4(), port))));
+        } else {
+            // Every socket binds the same port: the kernel spreads incoming flows by 4-tuple hash,
+            // so a given client endpoint always reaches the same shard
+            for (size_t i = 0; i < shardCount; i++) {
+                auto& ctx = *_shardContexts.emplace_back(std::make_unique<boost::asio::io_context>(1));
+                udp::socket socket(ctx);
+                socket.open(udp::v4());
+#ifdef __linux__
+                int enable = 1;
+                if (::setsockopt(socket.native_handle(), SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) != 0) {
+                    throw boost::system::system_error(errno, boost::system::system_category(), "SO_REUSEPORT");
+                }
+#endif
+                socket.bind(udp::endpoint(udp::v4(), port));
+                _shards.push_back(std::make_unique<Shard>(i, ctx, std::move(socket)));
+            }
+            server::logging::Logger::getNetworkLogger()->info(
+                "UDP game port {} sharded across {} SO_REUSEPORT sockets", port, shardCount);
+        }
+
+        // Windows: désactiver ICMP Port Unreachable qui cause des erreurs sur UDP
+        #ifdef _WIN32
+            BOOL bNewBehavior = FALSE;
+            DWORD dwBytesReturned = 0;
+            WSAIoctl(
+                _shards.front()->socket.native_handle(), SIO_UDP_CONNRESET,
+                &bNewBehavior, sizeof(bNewBehavior),
+                NULL, 0, &dwBytesReturned, NULL, NULL
+            );
+        #endif
+    }
+
+    void UDPServer::enableBatchedIO() {
+#ifdef __linux__
+        for (auto& shard : _shards) {
+            shard->batchedIO = std::make_unique<infrastructure::network::BatchedUDPIO>(
+                shard->ioContext, shard->socket, BUFFER_SIZE);
+        }
+        server::logging::Logger::getNetworkLogger()->info(
+            "Batched UDP I/O enabled (recvmmsg/sendmmsg, {} datagrams per syscall)",
+            infrastructure::network::BatchedUDPIO::BATCH_SIZE);
+#else
+        server::logging::Logger::getNetworkLogger()->warn("Batched UDP I/O is only available on Linux, ignoring");
+#endif
+    }
+
+    void UDPServer::setSimulationRates(const game::SimulationRates& rates) {
+        _simulationRates = game::SimulationClock(rates).getRates();  // Clamped the way the rooms' clocks take them
+        server::logging::Logger::getGameLogger()->info(
+            "Game loop: {} ticks/s, {} snapshots/s, catch-up capped at {} ticks per frame",
+            _simulationRates.tickRate, _simulationRates.snapshotRate, _simulationRates.maxCatchUpTicks);
+    }
+
     void UDPServer::start() {
-        do_read();
-        scheduleBroadcast();
+        for (auto& shardPtr : _shards) {
+            Shard& shard = *shardPtr;
+#ifdef __linux__
+            if (shard.batchedIO) {
+                shard.batchedIO->startReceiving(
+                    [this, &shard](const udp::endpoint& from, const uint8_t* data, std::size_t bytes) {
+                        handleDatagram(shard, from, data, bytes);
+                    },
+                    [](const boost::system::error_code& error) {
+                        server::logging::Logger::getNetworkLogger()->error("Receive error: {}", error.message());
+                    });
+            } else {
+                do_read(shard);
+            }
+#else
+            do_read(shard);
+#endif
+            scheduleRoomFrames(shard);
+        }
         scheduleStatsUpdate();
         scheduleAutoSave();
+
+        // One thread per shard io_context: its receive loop, room ticks and sends
+        for (auto& ctx : _shardContexts) {
+            _shardThreads.emplace_back([&ctx = *ctx]() { ctx.run(); });
+        }
     }
 
     void UDPServer::run() {
@@ -128,34 +255,90 @@ namespace infrastructure::adapters::in::network {
     }
 
     void UDPServer::stop() {
-        _broadcastTimer.cancel();
         _statsTimer.cancel();
         _autoSaveTimer.cancel();
-        _socket.close();
+
+        // Sharded: stop the shard threads first, then nothing else touches their sockets
+        for (auto& ctx : _shardContexts) {
+            ctx->stop();
+        }
+        _shardThreads.clear();
+
+        for (auto& shard : _shards) {
+            shard->frameTimer.cancel();
+            shard->socket.close();
+        }
     }
 
-    void UDPServer::sendTo(const udp::endpoint& endpoint, const void* data, size_t size) {
+    void UDPServer::sendTo(Shard& shard, const udp::endpoint& endpoint, const void* data, size_t size,
+                           infrastructure::network::NetworkStats::Slot statsSlot) {
+        auto buf = _sendBuffers.acquire(size);
+        std::memcpy(buf.data(), data, size);
+        sendShared(shard, endpoint, statsSlot, buf);
+    }
+
+    void UDPServer::sendShared(Shard& shard, const udp::endpoint& endpoint, infrastructure::network::NetworkStats::Slot statsSlot,
+                               const infrastructure::network::SharedSendBuffer& buffer) {
         // Track network stats
-        std::string endpointStr = endpointToString(endpoint);
-        _networkStats->addBytesSent(size);
-        _networkStats->addBytesSentTo(endpointStr, size);
+        _networkStats->addBytesSent(buffer.size());
+        _networkStats->addBytesSentTo(statsSlot, buffer.size());
 
-        auto buf = std::make_shared<std::vector<uint8_t>>(
-            static_cast<const uint8_t*>(data),
-            static_cast<const uint8_t*>(data) + size
-        );
+#ifdef __linux__
+        if (shard.batchedIO) {
+            shard.batchedIO->queue(endpoint, buffer);
+            return;
+        }
+#endif
 
-        _socket.async_send_to(
-            boost::asio::buffer(buf->data(), buf->size()),
+        // The handler holds a reference until the send completes, then the buffer goes back to the pool.
+        // The operation itself comes from _sendHandlers: asio's own cache only covers two sends per thread
+        shard.socket.async_send_to(
+            boost::asio::buffer(buffer.data(), buffer.size()),
             endpoint,
-            [buf](boost::system::error_code ec, std::size_t) {
-                if (ec) {
-                    server::logging::Logger::getNetworkLogger()->error("Send error: {}", ec.message());
-                }
-            }
+            infrastructure::network::makePooledHandler(_sendHandlers,
+                [buffer](boost::system::error_code ec, std::size_t) {
+                    if (ec) {
+                        server::logging::Logger::getNetworkLogger()->error("Send error: {}", ec.message());
+                    }
+                })
         );
     }
 
+    void UDPServer::sendToRecipient(Shard& shard, const game::Recipient& recipient,
+                                    const infrastructure::network::SharedSendBuffer& buffer) {
+        if (t_tickBundler && (recipient.features & GameFeatures::BUNDLES)) {
+            t_tickBundler->add(recipient.playerId, recipient.endpoint, recipient.statsSlot, buffer);
+            return;
+        }
+        sendShared(shard, recipient.endpoint, recipient.statsSlot, buffer);
+    }
+
+    void UDPServer::flushReliableEvents(const std::shared_ptr<game::GameWorld>& gameWorld) {
+        Shard& shard = shardOf(gameWorld);
+        const auto now = std::chrono::steady_clock::now();
+        auto recipients = gameWorld->getRecipients(gameWorld->frameResource());
+        for (const auto& recipient : recipients) {
+            if (!recipient.reliableEvents) {
+                continue;
+            }
+            auto buf = _sendBuffers.acquire(RELIABLE_EVENTS_MAX_DATAGRAM);
+            uint16_t sequence = 0;
+            size_t size = recipient.reliableEvents->writePacket(now, buf.data() + UDPHeader::WIRE_SIZE,
+                RELIABLE_EVENTS_MAX_DATAGRAM - UDPHeader::WIRE_SIZE, sequence);
+            if (size == 0) {
+                continue;  // Nothing new, nothing due for a resend
+            }
+            UDPHeader head{
+                .type = static_cast<uint16_t>(MessageType::ReliableEvents),
+                .sequence_num = sequence,
+                .timestamp = UDPHeader::getTimestamp()
+            };
+            head.to_bytes(buf.data());
+            buf.resize(UDPHeader::WIRE_SIZE + size);
+            sendToRecipient(shard, recipient, buf);
+        }
+    }
+
     void UDPServer::sendPlayerJoin(const udp::endpoint& endpoint, uint8_t playerId, const std::shared_ptr<game::GameWorld>& gameWorld) {
         if (!gameWorld) return;
 
@@ -176,9 +359,8 @@ namespace infrastructure::adapters::in::network {
         server::logging::Logger::getNetworkLogger()->info("Player {} left", static_cast<int>(playerId));
     }
 
-    void UDPServer::sendHeartbeatAck(const udp::endpoint& endpoint) {
-        const size_t totalSize = UDPHeader::WIRE_SIZE;
-        std::vector<uint8_t> buf(totalSize);
+    void UDPServer::sendHeartbeatAck(Shard& shard, const udp::endpoint& endpoint, infrastructure::network::NetworkStats::Slot statsSlot) {
+        auto buf = _sendBuffers.acquire(UDPHeader::WIRE_SIZE);
 
         UDPHeader head{
             .type = static_cast<uint16_t>(MessageType::HeartBeatAck),
@@ -187,10 +369,11 @@ namespace infrastructure::adapters::in::network {
         };
         head.to_bytes(buf.data());
 
-        sendTo(endpoint, buf.data(), buf.size());
+        sendShared(shard, endpoint, statsSlot, buf);
     }
 
-    void UDPServer::sendJoinGameAck(const udp::endpoint& endpoint, uint8_t playerId) {
+    void UDPServer::sendJoinGameAck(Shard& shard, const udp::endpoint& endpoint, uint8_t playerId,
+                                    SnapshotEncoding snapshotEncoding, uint8_t features) {
         const size_t totalSize = UDPHeader::WIRE_SIZE + JoinGameAck::WIRE_SIZE;
         std::vector<uint8_t> buf(totalSize);
 
@@ -201,17 +384,22 @@ namespace infrastructure::adapters::in::network {
         };
         head.to_bytes(buf.data());
 
-        JoinGameAck ack{.player_id = playerId};
+        JoinGameAck ack{
+            .player_id = playerId,
+            .snapshotEncoding = static_cast<uint8_t>(snapshotEncoding),
+            .features = features
+        };
         ack.to_bytes(buf.data() + UDPHeader::WIRE_SIZE);
 
-        sendTo(endpoint, buf.data(), buf.size());
+        sendTo(shard, endpoint, buf.data(), buf.size());
 
         server::logging::Logger::getNetworkLogger()->debug(
-            "JoinGameAck sent to {}:{} (playerId={})",
-            endpoint.address().to_string(), endpoint.port(), static_cast<int>(playerId));
+            "JoinGameAck sent to {}:{} (playerId={}, snapshot encoding {}, features {:#04x})",
+            endpoint.address().to_string(), endpoint.port(), static_cast<int>(playerId),
+            static_cast<int>(snapshotEncoding), features);
     }
 
-    void UDPServer::sendJoinGameNack(const udp::endpoint& endpoint, const std::string& reason) {
+    void UDPServer::sendJoinGameNack(Shard& shard, const udp::endpoint& endpoint, const std::string& reason) {
         const size_t totalSize = UDPHeader::WIRE_SIZE + JoinGameNack::WIRE_SIZE;
         std::vector<uint8_t> buf(totalSize);
 
@@ -226,69 +414,212 @@ namespace infrastructure::adapters::in::network {
         std::snprintf(nack.reason, sizeof(nack.reason), "%s", reason.c_str());
         nack.to_bytes(buf.data() + UDPHeader::WIRE_SIZE);
 
-        sendTo(endpoint, buf.data(), buf.size());
+        sendTo(shard, endpoint, buf.data(), buf.size());
 
         server::logging::Logger::getNetworkLogger()->warn(
             "JoinGameNack sent to {}:{} (reason: {})",
             endpoint.address().to_string(), endpoint.port(), reason);
     }
 
-    void UDPServer::broadcastSnapshotForRoom(const std::string& roomCode, const std::shared_ptr<game::GameWorld>& gameWorld) {
+    void UDPServer::broadcastSnapshotForRoom([[maybe_unused]] const std::string& roomCode, const std::shared_ptr<game::GameWorld>& gameWorld) {
         if (!gameWorld || gameWorld->getPlayerCount() == 0) {
             return;
         }
 
-        GameSnapshot snapshot = gameWorld->getSnapshot();
-        const size_t payloadSize = snapshot.wire_size();
+        auto candidates = gameWorld->getSnapshotCandidates(gameWorld->frameResource());
+        const uint16_t sequence = gameWorld->nextSnapshotSequence();
+        auto recipients = gameWorld->getRecipients(gameWorld->frameResource());
 
-        // Serialize payload first
-        std::vector<uint8_t> payloadBuf(payloadSize);
-        snapshot.to_bytes(payloadBuf.data());
+        if (!game::SnapshotPrioritizer::fitsWhole(candidates, gameWorld->getSnapshotBudget())) {
+            sendPrioritizedSnapshots(candidates, sequence, recipients, gameWorld);
+            return;
+        }
 
-        // Try to compress if payload is large enough
-        std::vector<uint8_t> finalBuf;
-        if (payloadSize >= compression::MIN_COMPRESS_SIZE) {
-            auto compressed = compression::compress(payloadBuf.data(), payloadSize);
-            if (!compressed.empty()) {
-                // Compression successful and worthwhile
-                // Format: UDPHeader (with COMPRESSION_FLAG) + CompressionHeader + compressed payload
-                const size_t totalSize = UDPHeader::WIRE_SIZE + CompressionHeader::WIRE_SIZE + compressed.size();
-                finalBuf.resize(totalSize);
+        // Everything fits: one snapshot for the whole room
+        GameSnapshot snapshot;
+        game::SnapshotPrioritizer::takeFirst(candidates, snapshot);
+        gameWorld->getSnapshotPrioritizer().forget(sequence);
 
-                UDPHeader head{
-                    .type = static_cast<uint16_t>(static_cast<uint16_t>(MessageType::Snapshot) | COMPRESSION_FLAG),
-                    .sequence_num = 0,
-                    .timestamp = UDPHeader::getTimestamp()
-                };
-                head.to_bytes(finalBuf.data());
+        // Kept as the baseline of the deltas sent once clients ack this snapshot
+        auto& history = gameWorld->getSnapshotHistory();
+        compression::SnapshotImage& image = history.store(sequence);
+        compression::toSnapshotImage(snapshot, image);
+
+        Shard& shard = shardOf(gameWorld);
+
+        // Full snapshot in each encoding, built on first use: new players and those whose baseline left the history
+        std::array<infrastructure::network::SharedSendBuffer, FULL_SNAPSHOT_VARIANTS> fullBufs;
+        auto fullSnapshot = [&](SnapshotEncoding encoding) -> const infrastructure::network::SharedSendBuffer& {
+            auto& buf = fullBufs[fullSnapshotVariant(encoding)];
+            if (!buf) {
+                buf = buildFullSnapshot(snapshot, encoding, sequence, false, gameWorld);
+            }
+            return buf;
+        };
 
-                CompressionHeader compHead{.originalSize = static_cast<uint16_t>(payloadSize)};
-                compHead.to_bytes(finalBuf.data() + UDPHeader::WIRE_SIZE);
+        // Players that acked the same snapshot share one encoded delta (and fallback encoding)
+        struct EncodedDelta {
+            uint16_t baseline;
+            SnapshotEncoding encoding;
+            infrastructure::network::SharedSendBuffer buffer;
+        };
+        std::pmr::vector<EncodedDelta> deltas(gameWorld->frameResource());
+        deltas.reserve(recipients.size());
+
+        for (const auto& recipient : recipients) {
+            const compression::SnapshotImage* baseline =
+                recipient.ackedSnapshot ? history.find(*recipient.ackedSnapshot) : nullptr;
+            if (!baseline) {
+                sendToRecipient(shard, recipient, fullSnapshot(recipient.snapshotEncoding));
+                continue;
+            }
 
-                std::memcpy(finalBuf.data() + UDPHeader::WIRE_SIZE + CompressionHeader::WIRE_SIZE,
-                           compressed.data(), compressed.size());
+            auto it = std::find_if(deltas.begin(), deltas.end(),
+                [&](const EncodedDelta& delta) {
+                    return delta.baseline == *recipient.ackedSnapshot && delta.encoding == recipient.snapshotEncoding;
+                });
+            if (it == deltas.end()) {
+                it = deltas.insert(deltas.end(), {*recipient.ackedSnapshot, recipient.snapshotEncoding,
+                    buildSnapshotDelta(*baseline, image, *recipient.ackedSnapshot, sequence, false, gameWorld)});
+                // Not worth it when the world changed more than it stayed: send the full snapshot
+                const auto& full = fullSnapshot(recipient.snapshotEncoding);
+                if (!it->buffer || it->buffer.size() >= full.size()) {
+                    it->buffer = full;
+                }
             }
+            sendToRecipient(shard, recipient, it->buffer);
         }
+    }
+
+    void UDPServer::sendPrioritizedSnapshots(const game::SnapshotCandidates& candidates, uint16_t sequence,
+                                             const std::pmr::vector<game::Recipient>& recipients,
+                                             const std::shared_ptr<game::GameWorld>& gameWorld) {
+        // No room-wide image under this sequence: acks of it only match the player's own history
+        gameWorld->getSnapshotHistory().forget(sequence);
+
+        auto& prioritizer = gameWorld->getSnapshotPrioritizer();
+        Shard& shard = shardOf(gameWorld);
+
+        // Clients that predate partial snapshots would drop what they miss: they keep the first entities, in full
+        std::array<infrastructure::network::SharedSendBuffer, FULL_SNAPSHOT_VARIANTS> truncatedBufs;
+
+        for (const auto& recipient : recipients) {
+            GameSnapshot snapshot;
+            if (recipient.snapshotEncoding < SnapshotEncoding::Partial) {
+                auto& buf = truncatedBufs[fullSnapshotVariant(recipient.snapshotEncoding)];
+                if (!buf) {
+                    game::SnapshotPrioritizer::takeFirst(candidates, snapshot);
+                    buf = buildFullSnapshot(snapshot, recipient.snapshotEncoding, sequence, false, gameWorld);
+                }
+                sendToRecipient(shard, recipient, buf);
+                continue;
+            }
+
+            prioritizer.select(recipient.playerId, candidates, gameWorld->getSnapshotBudget(),
+                               gameWorld->frameResource(), snapshot);
+
+            auto& history = prioritizer.history(recipient.playerId);
+            compression::SnapshotImage& image = history.store(sequence);
+            compression::toSnapshotImage(snapshot, image);
 
-        // Fallback to uncompressed if compression failed or not worth it
-        if (finalBuf.empty()) {
-            const size_t totalSize = UDPHeader::WIRE_SIZE + payloadSize;
-            finalBuf.resize(totalSize);
+            auto buffer = buildFullSnapshot(snapshot, recipient.snapshotEncoding, sequence, true, gameWorld);
+            const compression::SnapshotImage* baseline =
+                recipient.ackedSnapshot ? history.find(*recipient.ackedSnapshot) : nullptr;
+            if (baseline) {
+                auto delta = buildSnapshotDelta(*baseline, image, *recipient.ackedSnapshot, sequence, true, gameWorld);
+                if (delta && delta.size() < buffer.size()) {
+                    buffer = delta;
+                }
+            }
+            sendToRecipient(shard, recipient, buffer);
+        }
+    }
+
+    infrastructure::network::SharedSendBuffer UDPServer::buildFullSnapshot(const GameSnapshot& snapshot, SnapshotEncoding encoding,
+                                                                           uint16_t sequence, bool partial,
+                                                                           const std::shared_ptr<game::GameWorld>& gameWorld) {
+        // The uncompressed payload lives in the room's frame arena: nothing to free, no heap traffic
+        std::pmr::vector<uint8_t> payloadBuf(gameWorld->frameResource());
+        uint16_t type = static_cast<uint16_t>(MessageType::Snapshot);
+        if (encoding >= SnapshotEncoding::Packed) {
+            type = static_cast<uint16_t>(MessageType::SnapshotPacked);
+            payloadBuf.resize(PACKED_SNAPSHOT_MAX_SIZE);
+            payloadBuf.resize(packSnapshot(snapshot, payloadBuf.data(), payloadBuf.size()));
+        } else {
+            payloadBuf.resize(snapshot.wire_size());
+            snapshot.to_bytes(payloadBuf.data());
+        }
+        if (partial) {
+            type |= PARTIAL_SNAPSHOT_FLAG;
+        }
+        return buildSnapshotDatagram(type, sequence, payloadBuf, encoding >= SnapshotEncoding::Dictionary, gameWorld);
+    }
+
+    infrastructure::network::SharedSendBuffer UDPServer::buildSnapshotDatagram(uint16_t type, uint16_t sequence,
+                                                                               std::span<const uint8_t> payload,
+                                                                               bool useDictionary,
+                                                                               const std::shared_ptr<game::GameWorld>& gameWorld) {
+        // The datagram is built once in a pooled buffer that every recipient's send shares
+        // Format: UDPHeader (with COMPRESSION_FLAG) + CompressionHeader + compressed payload
+        constexpr size_t headersSize = UDPHeader::WIRE_SIZE + CompressionHeader::WIRE_SIZE;
+        infrastructure::network::SharedSendBuffer finalBuf =
+            _sendBuffers.acquire(headersSize + compression::compressBound(payload.size()));
+
+        // The policy learns per type whether compressing pays (a partial snapshot counts as its full type)
+        size_t compressedSize = _networkStats->getCompressionPolicy()->compress(
+            static_cast<uint16_t>(type & ~PARTIAL_SNAPSHOT_FLAG), payload,
+            std::span<uint8_t>(finalBuf.data() + headersSize, finalBuf.size() - headersSize),
+            &gameWorld->getSnapshotCompressor(), useDictionary);
+        if (compressedSize > 0) {
+            finalBuf.resize(headersSize + compressedSize);
 
             UDPHeader head{
-                .type = static_cast<uint16_t>(MessageType::Snapshot),
-                .sequence_num = 0,
+                .type = static_cast<uint16_t>(type | COMPRESSION_FLAG),
+                .sequence_num = sequence,
                 .timestamp = UDPHeader::getTimestamp()
             };
             head.to_bytes(finalBuf.data());
-            std::memcpy(finalBuf.data() + UDPHeader::WIRE_SIZE, payloadBuf.data(), payloadSize);
+
+            CompressionHeader compHead{.originalSize = static_cast<uint16_t>(payload.size())};
+            compHead.to_bytes(finalBuf.data() + UDPHeader::WIRE_SIZE);
+            return finalBuf;
         }
 
-        // Only send to players in THIS game instance
-        auto endpoints = gameWorld->getAllEndpoints();
-        for (const auto& ep : endpoints) {
-            sendTo(ep, finalBuf.data(), finalBuf.size());
+        // Not compressed: the buffer is large enough for the raw datagram too
+        finalBuf.resize(UDPHeader::WIRE_SIZE + payload.size());
+        UDPHeader head{
+            .type = type,
+            .sequence_num = sequence,
+            .timestamp = UDPHeader::getTimestamp()
+        };
+        head.to_bytes(finalBuf.data());
+        std::memcpy(finalBuf.data() + UDPHeader::WIRE_SIZE, payload.data(), payload.size());
+        return finalBuf;
+    }
+
+    infrastructure::network::SharedSendBuffer UDPServer::buildSnapshotDelta(const compression::SnapshotImage& baseline,
+                                                                            const compression::SnapshotImage& image,
+                                                                            uint16_t baselineSequence, uint16_t sequence,
+                                                                            bool partial,
+                                                                            const std::shared_ptr<game::GameWorld>& gameWorld) {
+        // Payload: SnapshotDeltaHeader + encoded delta, in the room's frame arena
+        std::pmr::vector<uint8_t> payloadBuf(SnapshotDeltaHeader::WIRE_SIZE + compression::SNAPSHOT_DELTA_BOUND,
+                                             gameWorld->frameResource());
+        size_t encodedSize = compression::encodeSnapshotDelta(baseline, image,
+            payloadBuf.data() + SnapshotDeltaHeader::WIRE_SIZE, payloadBuf.size() - SnapshotDeltaHeader::WIRE_SIZE);
+        if (encodedSize == SIZE_MAX) {
+            return {};
         }
+        payloadBuf.resize(SnapshotDeltaHeader::WIRE_SIZE + encodedSize);
+
+        SnapshotDeltaHeader deltaHead{.baseline_seq = baselineSequence};
+        deltaHead.to_bytes(payloadBuf.data());
+
+        // The runs of changed bytes still repeat (ids, flags, neighbouring positions): LZ4 takes them out too.
+        // Trained on full snapshots, the dictionary does not help deltas.
+        uint16_t type = static_cast<uint16_t>(static_cast<uint16_t>(MessageType::SnapshotDelta)
+                                              | (partial ? PARTIAL_SNAPSHOT_FLAG : 0));
+        return buildSnapshotDatagram(type, sequence, payloadBuf, false, gameWorld);
     }
 
     void UDPServer::broadcastAllSnapshots() {
@@ -301,9 +632,39 @@ namespace infrastructure::adapters::in::network {
         }
     }
 
-    void UDPServer::updateAndBroadcastRoom(const std::string& roomCode, const std::shared_ptr<game::GameWorld>& gameWorld, float deltaTime) {
+    void UDPServer::runRoomFrame(const std::string& roomCode, const std::shared_ptr<game::GameWorld>& gameWorld) {
         if (!gameWorld) return;
 
+        // Everything the previous frame allocated from the frame arena is dropped here
+        gameWorld->beginFrame();
+
+        game::SimulationClock& clock = gameWorld->getSimulationClock();
+        const game::SimulationClock::Step step = clock.advance(std::chrono::steady_clock::now());
+        if (step.skipped > 0) {
+            server::logging::Logger::getGameLogger()->warn(
+                "Room '{}' is {} tick(s) behind, skipped them (catch-up capped at {})",
+                roomCode, step.skipped, clock.getRates().maxCatchUpTicks);
+        }
+        if (step.ticks == 0 && !step.snapshotDue) {
+            return;
+        }
+
+        // What this frame sends to clients that negotiated GameFeatures::BUNDLES is coalesced per client
+        Shard& shard = shardOf(gameWorld);
+#ifdef __linux__
+        // The whole frame's events and snapshot go out in a few sendmmsg calls, once the bundler is flushed
+        infrastructure::network::BatchedUDPIO::FlushScope flushScope(shard.batchedIO.get());
+#endif
+        infrastructure::network::DatagramBundler bundler(_sendBuffers,
+            [this, &shard](const udp::endpoint& endpoint, uint32_t statsSlot,
+                           const infrastructure::network::SharedSendBuffer& buffer) {
+                sendShared(shard, endpoint, statsSlot, buffer);
+            });
+        struct TickBundlerScope {
+            explicit TickBundlerScope(infrastructure::network::DatagramBundler* bundler) { t_tickBundler = bundler; }
+            ~TickBundlerScope() { t_tickBundler = nullptr; }
+        } bundlerScope(&bundler);
+
         // Check for timed out players (even when paused - players can still disconnect)
         auto timedOutPlayers = gameWorld->checkPlayerTimeouts(
             std::chrono::milliseconds(PLAYER_TIMEOUT_MS)
@@ -315,6 +676,31 @@ namespace infrastructure::adapters::in::network {
                 static_cast<int>(playerId), roomCode);
         }
 
+        // Every tick steps by the same deltaTime, however late this frame runs
+        auto tickStart = std::chrono::steady_clock::now();
+        for (uint32_t tick = 0; tick < step.ticks; ++tick) {
+            tickStart = std::chrono::steady_clock::now();
+            simulateRoomTick(roomCode, gameWorld, clock.getTickSeconds());
+            if (tick + 1 < step.ticks) {
+                gameWorld->getTickTimes().record(std::chrono::steady_clock::now() - tickStart);
+            }
+        }
+
+        // This frame's events, and the older ones due for a resend, ahead of the snapshot
+        flushReliableEvents(gameWorld);
+
+        // Broadcast snapshot for this room when due (even when paused - shows pause state)
+        if (step.snapshotDue) {
+            broadcastSnapshotForRoom(roomCode, gameWorld);
+        }
+        // The frame's last tick is timed with the sends that follow it
+        if (step.ticks > 0) {
+            gameWorld->getTickTimes().record(std::chrono::steady_clock::now() - tickStart);
+        }
+        bundler.flush();
+    }
+
+    void UDPServer::simulateRoomTick(const std::string& roomCode, const std::shared_ptr<game::GameWorld>& gameWorld, float deltaTime) {
         // ═══════════════════════════════════════════════════════════════════
         // PAUSE SYSTEM: Skip gameplay updates when game is paused
         // Solo: paused if single player presses Escape
@@ -414,17 +800,16 @@ namespace infrastructure::adapters::in::network {
             // Note: We don't broadcast WaveCannon destruction - it's handled client-side when off-screen
         }
         // End of pause-skippable gameplay updates
-
-        // Broadcast snapshot for this room (always, even when paused - shows pause state)
-        broadcastSnapshotForRoom(roomCode, gameWorld);
     }
 
-    void UDPServer::scheduleBroadcast() {
-        _broadcastTimer.expires_after(std::chrono::milliseconds(BROADCAST_INTERVAL_MS));
-        _broadcastTimer.async_wait([this](boost::system::error_code ec) {
+    void UDPServer::scheduleRoomFrames(Shard& shard) {
+        // Absolute deadlines one tick apart, so the timer does not drift by the handler's run time.
+        // Behind schedule, the next frame runs right away and the rooms' clocks catch up.
+        const auto now = std::chrono::steady_clock::now();
+        auto deadline = shard.frameTimer.expiry() + game::SimulationClock::intervalOf(_simulationRates.tickRate);
+        shard.frameTimer.expires_at(std::max(deadline, now));
+        shard.frameTimer.async_wait([this, &shard](boost::system::error_code ec) {
             if (!ec) {
-                float deltaTime = BROADCAST_INTERVAL_MS / 1000.0f;
-
                 // Get all active room codes (snapshot to avoid modification during iteration)
                 auto roomCodes = _instanceManager.getActiveRoomCodes();
 
@@ -432,14 +817,14 @@ namespace infrastructure::adapters::in::network {
                 // This allows rooms to be processed IN PARALLEL on different threads
                 for (const auto& roomCode : roomCodes) {
                     auto gameWorld = _instanceManager.getInstance(roomCode);
-                    if (!gameWorld) continue;
+                    if (!gameWorld || gameWorld->getShard() != shard.index) continue;  // Ticked by its own shard
 
-                    // Post the update work to this room's strand
+                    // Post the frame to this room's strand
                     // Each room's strand serializes its own operations
                     // but different rooms can run concurrently on different threads
                     boost::asio::post(gameWorld->getStrand(),
-                        [this, roomCode, gameWorld, deltaTime]() {
-                            updateAndBroadcastRoom(roomCode, gameWorld, deltaTime);
+                        [this, roomCode, gameWorld]() {
+                            runRoomFrame(roomCode, gameWorld);
 
                             // Cleanup empty instances (post to main io_context for thread safety)
                             if (gameWorld->getPlayerCount() == 0) {
@@ -452,7 +837,7 @@ namespace infrastructure::adapters::in::network {
                         });
                 }
 
-                scheduleBroadcast();
+                scheduleRoomFrames(shard);
             }
         });
     }
@@ -490,20 +875,10 @@ namespace infrastructure::adapters::in::network {
     void UDPServer::broadcastPlayerDamaged(uint8_t playerId, uint8_t damage, const std::shared_ptr<game::GameWorld>& gameWorld) {
         if (!gameWorld) return;
 
-        // Get current health from snapshot
-        auto snapshot = gameWorld->getSnapshot();
-        uint8_t newHealth = 0;
-        for (uint8_t i = 0; i < snapshot.player_count; ++i) {
-            if (snapshot.players[i].id == playerId) {
-                newHealth = snapshot.players[i].health;
-                break;
-            }
-        }
-
         PlayerDamaged pd{
             .player_id = playerId,
             .damage = damage,
-            .new_health = newHealth
+            .new_health = gameWorld->getPlayerHealth(playerId)
         };
         broadcastToRoom(MessageType::PlayerDamaged, pd, gameWorld);
     }
@@ -626,52 +1001,63 @@ namespace infrastructure::adapters::in::network {
             isPaused, voterCount, totalPlayers);
     }
 
-    void UDPServer::do_read() {
-        _socket.async_receive_from(
-            boost::asio::buffer(_readBuffer, BUFFER_SIZE),
-            _remote_endpoint,
-            [this](const boost::system::error_code& error, std::size_t bytes) {
-                handle_receive(error, bytes);
+    void UDPServer::do_read(Shard& shard) {
+        shard.socket.async_receive_from(
+            boost::asio::buffer(shard.readBuffer, BUFFER_SIZE),
+            shard.remoteEndpoint,
+            [this, &shard](const boost::system::error_code& error, std::size_t bytes) {
+                handle_receive(shard, error, bytes);
             }
         );
     }
 
-    void UDPServer::handle_receive(const boost::system::error_code& error, std::size_t bytes) {
+    void UDPServer::handle_receive(Shard& shard, const boost::system::error_code& error, std::size_t bytes) {
         if (error) {
             if (error != boost::asio::error::operation_aborted) {
                 server::logging::Logger::getNetworkLogger()->error("Receive error: {}", error.message());
-                do_read();
+                do_read(shard);
             }
             return;
         }
 
+        handleDatagram(shard, shard.remoteEndpoint, reinterpret_cast<const uint8_t*>(shard.readBuffer), bytes);
+        do_read(shard);
+    }
+
+    void UDPServer::handleDatagram(Shard& shard, const udp::endpoint& from, const uint8_t* data, std::size_t bytes) {
         if (bytes < UDPHeader::WIRE_SIZE) {
-            do_read();
             return;
         }
 
-        auto headOpt = UDPHeader::from_bytes(_readBuffer, bytes);
+        auto headOpt = UDPHeader::from_bytes(data, bytes);
         if (!headOpt) {
-            do_read();
             return;
         }
 
         UDPHeader head = *headOpt;
         size_t payload_size = bytes - UDPHeader::WIRE_SIZE;
-        const uint8_t* payload = reinterpret_cast<const uint8_t*>(_readBuffer) + UDPHeader::WIRE_SIZE;
+        const uint8_t* payload = data + UDPHeader::WIRE_SIZE;
 
-        std::string endpointStr = endpointToString(_remote_endpoint);
+        // One lock-free lookup of the sender: its player, room and stats slot once it joined a game.
+        // The connection stays valid until this datagram is handled
+        auto connections = _connections.read(shard.index);
+        const infrastructure::network::Connection* connection = connections.find(from);
 
         // Track network stats (bytes received)
+        auto statsSlot = connection ? connection->statsSlot : infrastructure::network::NetworkStats::NO_SLOT;
         _networkStats->addBytesReceived(bytes);
-        _networkStats->addBytesReceivedFrom(endpointStr, bytes);
+        _networkStats->addBytesReceivedFrom(statsSlot, bytes);
 
         // ═══════════════════════════════════════════════════════════════════
         // CASE 1: HeartBeat - No authentication required (connection check)
         // But if the endpoint has an active session, update activity timestamp
         // ═══════════════════════════════════════════════════════════════════
         if (head.type == static_cast<uint16_t>(MessageType::HeartBeat)) {
-            sendHeartbeatAck(_remote_endpoint);
+            sendHeartbeatAck(shard, from, statsSlot);
+
+            if (!connection) {
+                return;
+            }
 
             // Calculate one-way RTT (client → server) from HeartBeat timestamp
             uint64_t serverNow = UDPHeader::getTimestamp();
@@ -680,31 +1066,23 @@ namespace infrastructure::adapters::in::network {
                 uint32_t rttMs = static_cast<uint32_t>(serverNow - clientTimestamp);
                 // Cap RTT at a reasonable max (10 seconds) to filter outliers
                 if (rttMs < 10000) {
-                    _networkStats->updatePlayerRTT(endpointStr, rttMs);
+                    _networkStats->updatePlayerRTT(connection->endpoint, rttMs);
                 }
             }
 
-            // Update activity if this endpoint has an active session
-            auto playerIdOpt = _sessionManager->getPlayerIdByEndpoint(endpointStr);
-            if (playerIdOpt) {
-                _sessionManager->updateActivity(endpointStr);
-
-                // Get the room code to find the correct GameWorld
-                auto roomCodeOpt = _sessionManager->getRoomCodeByEndpoint(endpointStr);
-                if (roomCodeOpt) {
-                    auto gameWorld = _instanceManager.getInstance(*roomCodeOpt);
-                    if (gameWorld) {
-                        // Post to room's strand for thread safety
-                        uint8_t playerId = *playerIdOpt;
-                        boost::asio::post(gameWorld->getStrand(),
-                            [gameWorld, playerId]() {
-                                gameWorld->updatePlayerActivity(playerId);
-                            });
-                    }
-                }
+            // Update activity of this endpoint's session and player
+            if (connection->shouldTouchSession(std::chrono::steady_clock::now())) {
+                _sessionManager->updateActivity(connection->endpoint);
+            }
+            if (auto gameWorld = connection->gameWorld.lock()) {
+                // Post to room's strand for thread safety
+                uint8_t playerId = connection->playerId;
+                boost::asio::post(gameWorld->getStrand(),
+                    [gameWorld, playerId]() {
+                        gameWorld->updatePlayerActivity(playerId);
+                    });
             }
 
-            do_read();
             return;
         }
 
@@ -712,81 +1090,90 @@ namespace infrastructure::adapters::in::network {
         // CASE 2: JoinGame - Authentication with token (creates player)
         // ═══════════════════════════════════════════════════════════════════
         if (head.type == static_cast<uint16_t>(MessageType::JoinGame)) {
-            if (payload_size < JoinGame::WIRE_SIZE) {
-                sendJoinGameNack(_remote_endpoint, "Invalid packet");
-                do_read();
+            if (payload_size < JoinGame::MIN_WIRE_SIZE) {
+                sendJoinGameNack(shard, from, "Invalid packet");
                 return;
             }
 
             auto joinOpt = JoinGame::from_bytes(payload, payload_size);
             if (!joinOpt) {
-                sendJoinGameNack(_remote_endpoint, "Invalid packet");
-                do_read();
+                sendJoinGameNack(shard, from, "Invalid packet");
                 return;
             }
 
             // Extract room code from JoinGame message
             std::string roomCode(joinOpt->roomCode, ROOM_CODE_LEN);
+            std::string endpointStr = endpointToString(from);
 
             // Validate token via SessionManager
             auto validateResult = _sessionManager->validateAndBindUDP(joinOpt->token, endpointStr);
             if (!validateResult) {
-                sendJoinGameNack(_remote_endpoint, "Invalid or expired token");
-                do_read();
+                sendJoinGameNack(shard, from, "Invalid or expired token");
                 return;
             }
 
             // Get or create the GameWorld for this room
-            auto gameWorld = _instanceManager.getOrCreateInstance(roomCode);
+            // A new room is pinned to the shard its first player's packets arrive on
+            auto gameWorld = _instanceManager.getOrCreateInstance(roomCode, shard.ioContext, shard.index);
             if (!gameWorld) {
-                sendJoinGameNack(_remote_endpoint, "Failed to create game instance");
+                sendJoinGameNack(shard, from, "Failed to create game instance");
                 _sessionManager->removeSessionByEndpoint(endpointStr);
-                do_read();
                 return;
             }
 
-            // Capture endpoint for lambda (remote_endpoint is a member, may change before lambda runs)
-            auto remoteEndpoint = _remote_endpoint;
+            // Capture endpoint for lambda (from refers to the receive state, may change before lambda runs)
+            auto remoteEndpoint = from;
             uint8_t shipSkin = joinOpt->shipSkin;
+            SnapshotEncoding snapshotEncoding = negotiateSnapshotEncoding(joinOpt->snapshotEncoding);
+            uint8_t features = static_cast<uint8_t>(joinOpt->features & GameFeatures::SUPPORTED);
             uint16_t gameSpeedPercent = _sessionManager->getRoomGameSpeedByEndpoint(endpointStr);
             std::string displayName = validateResult->displayName;
             std::string email = validateResult->email;
 
             // Post player creation to room's strand for thread safety
             boost::asio::post(gameWorld->getStrand(),
-                [this, gameWorld, roomCode, remoteEndpoint, endpointStr, shipSkin,
+                [this, gameWorld, roomCode, remoteEndpoint, endpointStr, shipSkin, snapshotEncoding, features,
                  gameSpeedPercent, displayName, email]() {
 
                     // Create player in the room's GameWorld
                     auto playerIdOpt = gameWorld->addPlayer(remoteEndpoint);
                     if (!playerIdOpt) {
-                        sendJoinGameNack(remoteEndpoint, "Room full");
+                        sendJoinGameNack(shardOf(gameWorld), remoteEndpoint, "Room full");
                         _sessionManager->removeSessionByEndpoint(endpointStr);
                         return;
                     }
 
-                    // Apply room game speed to this GameWorld instance
+                    // Apply room game speed and the server's game loop rates to this GameWorld instance
                     gameWorld->setGameSpeedPercent(gameSpeedPercent);
+                    gameWorld->getSimulationClock().setRates(_simulationRates);
                     server::logging::Logger::getGameLogger()->info(
                         "Room '{}' game speed set to {}% (multiplier: {:.2f})",
                         roomCode, gameSpeedPercent, gameWorld->getGameSpeedMultiplier());
 
                     // Set player's ship skin (from JoinGame message)
                     gameWorld->setPlayerSkin(*playerIdOpt, shipSkin);
+                    gameWorld->setPlayerSnapshotEncoding(*playerIdOpt, snapshotEncoding);
+                    gameWorld->setPlayerFeatures(*playerIdOpt, features);
 
                     // Set player's GodMode state from session (hidden feature)
                     if (_sessionManager->isGodModeEnabled(email)) {
                         gameWorld->setPlayerGodMode(*playerIdOpt, true);
                     }
 
-                    // Bind playerId to session (SessionManager is thread-safe)
-                    _sessionManager->assignPlayerId(endpointStr, *playerIdOpt);
+                    // Register player in network stats for monitoring; broadcasts count against its slot
+                    auto playerStatsSlot = _networkStats->registerPlayer(endpointStr);
+                    gameWorld->setPlayerStatsSlot(*playerIdOpt, playerStatsSlot);
 
-                    // Register player in network stats for monitoring
-                    _networkStats->registerPlayer(endpointStr);
+                    // Route the endpoint's packets to this player, then bind playerId to session (thread-safe).
+                    // Inserted first: a binding removed after the assignment erases it through the callback,
+                    // one removed before fails the assignment
+                    _connections.insert(remoteEndpoint, *playerIdOpt, gameWorld, playerStatsSlot, endpointStr);
+                    if (!_sessionManager->assignPlayerId(endpointStr, *playerIdOpt)) {
+                        _connections.erase(endpointStr);
+                    }
 
                     // Send confirmation (sendTo uses async_send_to, thread-safe)
-                    sendJoinGameAck(remoteEndpoint, *playerIdOpt);
+                    sendJoinGameAck(shardOf(gameWorld), remoteEndpoint, *playerIdOpt, snapshotEncoding, features);
 
                     // Broadcast to other players in the same room
                     sendPlayerJoin(remoteEndpoint, *playerIdOpt, gameWorld);
@@ -796,7 +1183,6 @@ namespace infrastructure::adapters::in::network {
                         displayName, email, roomCode, static_cast<int>(*playerIdOpt));
                 });
 
-            do_read();
             return;
         }
 
@@ -804,30 +1190,21 @@ namespace infrastructure::adapters::in::network {
         // MESSAGES REQUIRING AUTHENTICATION: Check if endpoint has session
         // ═══════════════════════════════════════════════════════════════════
         if (requiresAuth(head.type)) {
-            auto playerIdOpt = _sessionManager->getPlayerIdByEndpoint(endpointStr);
-            if (!playerIdOpt) {
-                // Endpoint not authenticated - silently ignore
-                do_read();
-                return;
-            }
-
-            uint8_t playerId = *playerIdOpt;
-
-            // Get the room code to find the correct GameWorld
-            auto roomCodeOpt = _sessionManager->getRoomCodeByEndpoint(endpointStr);
-            if (!roomCodeOpt) {
-                do_read();
+            if (!connection) {
+                // Endpoint not in a game - silently ignore
                 return;
             }
 
-            auto gameWorld = _instanceManager.getInstance(*roomCodeOpt);
+            uint8_t playerId = connection->playerId;
+            auto gameWorld = connection->gameWorld.lock();
             if (!gameWorld) {
-                do_read();
                 return;
             }
 
-            // Update activity timestamp (SessionManager is thread-safe)
-            _sessionManager->updateActivity(endpointStr);
+            // Update activity timestamp (SessionManager is thread-safe), at most once a second
+            if (connection->shouldTouchSession(std::chrono::steady_clock::now())) {
+                _sessionManager->updateActivity(connection->endpoint);
+            }
 
             // ═══════════════════════════════════════════════════════════════
             // PlayerInput (server authoritative movement)
@@ -852,6 +1229,23 @@ namespace infrastructure::adapters::in::network {
                 }
             }
             // ═══════════════════════════════════════════════════════════════
+            // SnapshotAck (baseline of this player's next snapshot deltas)
+            // ═══════════════════════════════════════════════════════════════
+            else if (head.type == static_cast<uint16_t>(MessageType::SnapshotAck)) {
+                auto ackOpt = SnapshotAck::from_bytes(payload, payload_size);
+                if (ackOpt) {
+                    SnapshotAck ack = *ackOpt;
+                    bool hasEventAck = payload_size >= SnapshotAck::WIRE_SIZE;
+                    boost::asio::post(gameWorld->getStrand(),
+                        [gameWorld, playerId, ack, hasEventAck]() {
+                            gameWorld->ackSnapshot(playerId, ack.sequence);
+                            if (hasEventAck) {
+                                gameWorld->ackReliableEvents(playerId, ack.event_ack, ack.event_ack_bits);
+                            }
+                        });
+                }
+            }
+            // ═══════════════════════════════════════════════════════════════
             // ShootMissile
             // ═══════════════════════════════════════════════════════════════
             else if (head.type == static_cast<uint16_t>(MessageType::ShootMissile)) {
@@ -862,7 +1256,7 @@ namespace infrastructure::adapters::in::network {
                         gameWorld->updatePlayerActivity(playerId);
                         if (gameWorld->isPlayerAlive(playerId)) {
                             // Use weapon-based spawning (may spawn multiple for spread)
-                            std::vector<uint16_t> missileIds = gameWorld->spawnMissileWithWeapon(playerId);
+                            auto missileIds = gameWorld->spawnMissileWithWeapon(playerId);
                             for (uint16_t missileId : missileIds) {
                                 if (missileId > 0) {
                                     // broadcastMissileSpawned uses async_send_to, thread-safe
@@ -945,8 +1339,6 @@ namespace infrastructure::adapters::in::network {
         // MESSAGES NOT REQUIRING AUTH: Process directly
         // (Currently none besides HeartBeat which is handled above)
         // ═══════════════════════════════════════════════════════════════════
-
-        do_read();
     }
 
     void UDPServer::kickPlayer(uint8_t playerId) {
@@ -994,6 +1386,19 @@ namespace infrastructure::adapters::in::network {
         return _instanceManager.getTotalPlayerCount();
     }
 
+    std::vector<UDPServer::RoomTickTimes> UDPServer::getRoomTickTimes() {
+        std::vector<RoomTickTimes> rooms;
+        for (const auto& roomCode : _instanceManager.getActiveRoomCodes()) {
+            auto gameWorld = _instanceManager.getInstance(roomCode);
+            if (!gameWorld) continue;
+            // Counters only: safe off the room's strand
+            const auto& clock = gameWorld->getSimulationClock();
+            rooms.push_back({roomCode, gameWorld->getTickTimes().summary(), clock.getTicksRun(), clock.getTicksSkipped(),
+                             gameWorld->getCollisionCandidatePairs()});
+        }
+        return rooms;
+    }
+
     void UDPServer::scheduleStatsUpdate() {
         _statsTimer.expires_after(std::chrono::seconds(1));
         _statsTimer.async_wait([this](boost::system::error_code ec) {
@@ -31,6 +31,7 @@
 #include "infrastructure/tui/LogBuffer.hpp"
 #include "infrastructure/logging/Logger.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <cstdlib>
 #include <cstring>
@@ -136,7 +137,29 @@ namespace infrastructure::bootstrap {
                 tcpAuthServer.start();
 
                 // Start UDP Game Server on port 4124 (shares SessionManager with TCP, has leaderboard for stats)
-                UDPServer udpServer(io_ctx, sessionManager, leaderboardRepo);
+                // Optional SO_REUSEPORT sharding of the game port, one socket and thread per shard (Linux only)
+                const char* udpShards = std::getenv("UDP_SHARDS");
+                size_t shardCount = udpShards != nullptr ? std::strtoul(udpShards, nullptr, 10) : 1;
+                UDPServer udpServer(io_ctx, sessionManager, leaderboardRepo, std::max<size_t>(shardCount, 1));
+                // One compression policy for both servers, its per-type stats show in the CLI
+                tcpAuthServer.setCompressionPolicy(udpServer.getNetworkStats()->getCompressionPolicy());
+                // Opt-in batched datagram I/O (recvmmsg/sendmmsg, Linux only)
+                const char* batchedIO = std::getenv("UDP_BATCHED_IO");
+                if (batchedIO != nullptr && std::strcmp(batchedIO, "1") == 0) {
+                    udpServer.enableBatchedIO();
+                }
+                // Game loop: fixed simulation rate, snapshot rate and catch-up cap (defaults 60 Hz, 20 Hz, 4 ticks)
+                game::SimulationRates simulationRates;
+                if (const char* tickRate = std::getenv("SIM_TICK_RATE")) {
+                    simulationRates.tickRate = static_cast<uint32_t>(std::strtoul(tickRate, nullptr, 10));
+                }
+                if (const char* snapshotRate = std::getenv("SNAPSHOT_RATE")) {
+                    simulationRates.snapshotRate = static_cast<uint32_t>(std::strtoul(snapshotRate, nullptr, 10));
+                }
+                if (const char* maxCatchUp = std::getenv("SIM_MAX_CATCH_UP")) {
+                    simulationRates.maxCatchUpTicks = static_cast<uint32_t>(std::strtoul(maxCatchUp, nullptr, 10));
+                }
+                udpServer.setSimulationRates(simulationRates);
                 udpServer.start();
 
                 // Start Voice UDP Server on port 4126 (shares SessionManager with TCP)
@@ -61,6 +61,8 @@ ServerCLI::ServerCLI(std::shared_ptr<SessionManager> sessionManager,
     _commands["status"] = [this](const std::string&) { printStatus(); };
     _commands["sessions"] = [this](const std::string&) { listSessions(); };
     _commands["rooms"] = [this](const std::string&) { listRooms(); };
+    _commands["ticks"] = [this](const std::string&) { listTickTimes(); };
+    _commands["compression"] = [this](const std::string&) { listCompressionStats(); };
     _commands["room"] = [this](const std::string& args) { showRoom(args); };
     _commands["closeroom"] = [this](const std::string& args) { closeRoom(args); };
     _commands["kickfromroom"] = [this](const std::string& args) { kickFromRoom(args); };
@@ -277,6 +279,8 @@ void ServerCLI::printHelp() {
     output("║ status               - Show server status                    ║");
     output("║ sessions             - List all active sessions              ║");
     output("║ rooms                - List all active rooms                 ║");
+    output("║ ticks                - Per-room game loop tick times (µs)    ║");
+    output("║ compression          - Compression ratio/cost per msg type   ║");
     output("║ room <code>          - Show room details + chat history      ║");
     output("║ closeroom <code>     - Force close a room (kicks all)        ║");
     output("║ users                - List all registered users (DB)        ║");
@@ -853,6 +857,136 @@ void ServerCLI::listRooms() {
     }
 }
 
+void ServerCLI::listTickTimes() {
+    auto rooms = _udpServer.getRoomTickTimes();
+    const auto& rates = _udpServer.getSimulationRates();
+
+    if (rooms.empty()) {
+        output("");
+        output("[CLI] No active game instances.");
+        output("");
+        return;
+    }
+
+    output("");
+    output("╔══════════════════════════════════════════════════════════════════════════════════════════╗");
+    output("║                                   ROOM TICK TIMES (µs)                                   ║");
+    output("╠══════════════════════════════════════════════════════════════════════════════════════════╣");
+
+    std::ostringstream header;
+    header << "║ " << std::left << std::setw(8) << "Code"
+           << std::setw(12) << "Ticks"
+           << std::setw(10) << "Skipped"
+           << std::setw(10) << "Mean"
+           << std::setw(10) << "p50"
+           << std::setw(10) << "p90"
+           << std::setw(10) << "p99"
+           << std::setw(10) << "Max"
+           << std::setw(8) << "Pairs" << " ║";
+    output(header.str());
+    output("╠══════════════════════════════════════════════════════════════════════════════════════════╣");
+
+    for (const auto& room : rooms) {
+        // Percentiles are bucket upper bounds, see TickTimeHistogram::BOUNDS_US
+        std::ostringstream row;
+        row << "║ " << std::left << std::setw(8) << tui::utf8::truncateWithEllipsis(room.roomCode, 7)
+            << std::setw(12) << room.ticksRun
+            << std::setw(10) << room.ticksSkipped
+            << std::setw(10) << room.ticks.meanUs()
+            << std::setw(10) << room.ticks.quantileUs(0.50)
+            << std::setw(10) << room.ticks.quantileUs(0.90)
+            << std::setw(10) << room.ticks.quantileUs(0.99)
+            << std::setw(10) << room.ticks.maxUs
+            << std::setw(8) << room.collisionCandidatePairs << " ║";
+        output(row.str());
+    }
+
+    output("╚══════════════════════════════════════════════════════════════════════════════════════════╝");
+    output("");
+    output("[CLI] " + std::to_string(rates.tickRate) + " ticks/s, " + std::to_string(rates.snapshotRate)
+           + " snapshots/s, catch-up capped at " + std::to_string(rates.maxCatchUpTicks) + " ticks per frame");
+    output("[CLI] Pairs: collision candidate pairs the broadphase kept on the last tick");
+    output("");
+}
+
+namespace {
+    // Message types that go through the CompressionPolicy
+    std::string compressedTypeName(uint16_t type) {
+        switch (static_cast<MessageType>(type)) {
+            case MessageType::Snapshot: return "Snapshot";
+            case MessageType::SnapshotDelta: return "SnapshotDelta";
+            case MessageType::SnapshotPacked: return "SnapshotPacked";
+            case MessageType::RoomUpdate: return "RoomUpdate";
+            case MessageType::BrowsePublicRoomsAck: return "BrowsePublicRooms";
+            case MessageType::ChatHistory: return "ChatHistory";
+            case MessageType::LeaderboardData: return "LeaderboardData";
+            case MessageType::FriendsListData: return "FriendsListData";
+            case MessageType::ConversationData: return "ConversationData";
+            case MessageType::ConversationsListData: return "ConversationsList";
+            default: break;
+        }
+        std::ostringstream hex;
+        hex << "0x" << std::hex << std::uppercase << std::setw(4) << std::setfill('0') << type;
+        return hex.str();
+    }
+}
+
+void ServerCLI::listCompressionStats() {
+    using infrastructure::network::CompressionPolicy;
+
+    auto networkStats = _udpServer.getNetworkStats();
+    auto types = networkStats ? networkStats->getCompressionStats() : std::vector<CompressionPolicy::TypeStats>{};
+    if (types.empty()) {
+        output("");
+        output("[CLI] No message compressed or considered for compression yet.");
+        output("");
+        return;
+    }
+
+    output("");
+    output("╔══════════════════════════════════════════════════════════════════════════════════╗");
+    output("║                          COMPRESSION BY MESSAGE TYPE                             ║");
+    output("╠══════════════════════════════════════════════════════════════════════════════════╣");
+
+    std::ostringstream header;
+    header << "║ " << std::left << std::setw(20) << "Type"
+           << std::setw(10) << "Messages"
+           << std::setw(10) << "In (KB)"
+           << std::setw(10) << "Out (KB)"
+           << std::setw(8) << "Ratio"
+           << std::setw(8) << "LZ4"
+           << std::setw(7) << "HC"
+           << std::setw(7) << "ns/B" << " ║";
+    output(header.str());
+    output("╠══════════════════════════════════════════════════════════════════════════════════╣");
+
+    for (const auto& type : types) {
+        const auto& fast = type.of(CompressionPolicy::Codec::Fast);
+        const auto& high = type.of(CompressionPolicy::Codec::High);
+        // CPU cost per byte of the payloads that went through a codec
+        const uint64_t compressedIn = fast.bytesIn + high.bytesIn;
+        const uint64_t nanosPerByte = compressedIn > 0 ? (fast.nanos + high.nanos) / compressedIn : 0;
+
+        std::ostringstream row;
+        row << "║ " << std::left << std::setw(20) << compressedTypeName(type.type)
+            << std::setw(10) << type.messages()
+            << std::setw(10) << type.bytesIn() / 1024
+            << std::setw(10) << type.bytesOut() / 1024
+            << std::setw(8) << std::fixed << std::setprecision(2) << type.ratio()
+            << std::setw(8) << fast.messages
+            << std::setw(7) << high.messages
+            << std::setw(7) << nanosPerByte << " ║";
+        output(row.str());
+    }
+
+    output("╚══════════════════════════════════════════════════════════════════════════════════╝");
+    output("");
+    output("[CLI] Ratio = bytes sent / payload bytes. Types saving under "
+           + std::to_string(static_cast<int>(CompressionPolicy::MIN_SAVING * 100))
+           + "% are sent raw, re-tried every " + std::to_string(CompressionPolicy::PROBE_INTERVAL) + " messages.");
+    output("");
+}
+
 void ServerCLI::showRoom(const std::string& args) {
     if (args.empty()) {
         output("[CLI] Usage: room <code>");
@@ -0,0 +1,588 @@
+/*
+ *  Archetype
+ *
+ *  Blob ECS is a lightweight Entity Component System library
+ *  Copyright (C) 2025 LECOCQ Guillaume
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+*/
+
+#ifndef ARCHETYPE_HPP_
+    #define ARCHETYPE_HPP_
+
+#include "Includes.hpp"
+#include "Errors.hpp"
+#include "Component.hpp"
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+
+    // Size of a single archetype chunk (fits comfortably in L1/L2)
+    constexpr std::size_t CHUNK_SIZE_BYTES = 16 * 1024;
+
+    // Every column inside a chunk starts on its own cache line
+    constexpr std::size_t CHUNK_COLUMN_ALIGN = 64;
+
+    constexpr uint32_t NO_ARCHETYPE = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * @brief Type-erased description of a component, used to move columns between archetypes
+     */
+    struct ComponentInfo {
+        uint16_t type_id;
+        std::size_t size;
+        std::size_t align;
+        const char *name;
+        void (*construct)(void *dst);
+        void (*relocate)(void *dst, void *src);     // Move-constructs dst from src then destroys src
+        void (*destroy)(void *ptr);
+    };
+
+    /**
+     * @brief Returns the ComponentInfo of a type
+     *
+     * @tparam T The component type
+     * @return const ComponentInfo& The static description of T
+     */
+    template<ComponentType T>
+    const ComponentInfo &componentInfo() {
+        static const ComponentInfo info{
+            ComponentTypeId::get<T>(),
+            sizeof(T),
+            alignof(T),
+            typeid(T).name(),
+            [](void *dst) { new (dst) T(); },
+            [](void *dst, void *src) {
+                T *from = static_cast<T*>(src);
+                new (dst) T(std::move(*from));
+                from->~T();
+            },
+            [](void *ptr) { static_cast<T*>(ptr)->~T(); }
+        };
+        return info;
+    }
+
+    /**
+     * @brief Stores every entity sharing one exact component signature
+     *
+     * Rows are packed in fixed-size chunks. Inside a chunk each component type
+     * has its own contiguous column (SoA), preceded by the column of entity IDs.
+     * Row r lives in chunk r / capacity at row r % capacity.
+     * Signature bits are the component slots of the owning ArchetypeStorage,
+     * columns are ordered by slot.
+     */
+    class Archetype {
+        public:
+            /**
+             * @param signature The component slots stored by this archetype
+             * @param components One description per set bit of 'signature', in slot order
+             */
+            Archetype(const Signature &signature, std::vector<const ComponentInfo*> components)
+            : m_signature(signature), m_components(std::move(components))
+            {
+                m_column_of.fill(-1);
+                m_add_edges.fill(NO_ARCHETYPE);
+                m_remove_edges.fill(NO_ARCHETYPE);
+                for (std::size_t slot = 0; slot < MAX_COMPONENT_TYPES; slot++) {
+                    if (!signature.test(slot))
+                        continue;
+                    m_column_of[slot] = static_cast<int16_t>(m_slots.size());
+                    m_slots.push_back(static_cast<uint8_t>(slot));
+                }
+                computeLayout();
+            }
+
+            ~Archetype() {
+                for (std::size_t row = 0; row < m_count; row++) {
+                    for (std::size_t col = 0; col < m_components.size(); col++)
+                        m_components[col]->destroy(at(col, row));
+                }
+                for (std::byte *chunk : m_chunks)
+                    ::operator delete(chunk, std::align_val_t{CHUNK_COLUMN_ALIGN});
+            }
+
+            Archetype(const Archetype &) = delete;
+            Archetype &operator=(const Archetype &) = delete;
+
+            const Signature &signature() const { return m_signature; }
+            const std::vector<const ComponentInfo*> &components() const { return m_components; }
+            std::size_t size() const { return m_count; }
+            std::size_t chunkCapacity() const { return m_chunk_capacity; }
+            std::size_t chunkCount() const { return m_chunks.size(); }
+
+            /**
+             * @brief Amount of used rows in a chunk
+             */
+            std::size_t chunkSize(std::size_t chunk) const {
+                std::size_t first = chunk * m_chunk_capacity;
+                if (first >= m_count)
+                    return 0;
+                return std::min(m_chunk_capacity, m_count - first);
+            }
+
+            /**
+             * @brief Column index of a component slot, -1 if the archetype doesn't hold it
+             */
+            int16_t columnOf(std::size_t slot) const {
+                return slot < MAX_COMPONENT_TYPES ? m_column_of[slot] : -1;
+            }
+
+            /**
+             * @brief Component slot stored in a column
+             */
+            std::size_t slotAt(std::size_t col) const {
+                return m_slots[col];
+            }
+
+            EntityID *entities(std::size_t chunk) {
+                return reinterpret_cast<EntityID*>(m_chunks[chunk]);
+            }
+
+            template<ComponentType T>
+            T *column(std::size_t chunk, std::size_t slot) {
+                int16_t col = columnOf(slot);
+                return reinterpret_cast<T*>(m_chunks[chunk] + m_column_offsets[col]);
+            }
+
+            void *at(std::size_t col, std::size_t row) {
+                std::byte *chunk = m_chunks[row / m_chunk_capacity];
+                return chunk + m_column_offsets[col] + (row % m_chunk_capacity) * m_components[col]->size;
+            }
+
+            EntityID entityAt(std::size_t row) {
+                return entities(row / m_chunk_capacity)[row % m_chunk_capacity];
+            }
+
+            /**
+             * @brief Reserves a new row for an entity, components are left unconstructed
+             *
+             * @return std::size_t The row index
+             */
+            std::size_t pushRow(EntityID e) {
+                std::size_t row = m_count;
+                if (row / m_chunk_capacity >= m_chunks.size()) {
+                    m_chunks.push_back(static_cast<std::byte*>(
+                        ::operator new(m_chunk_bytes, std::align_val_t{CHUNK_COLUMN_ALIGN})));
+                }
+                entities(row / m_chunk_capacity)[row % m_chunk_capacity] = e;
+                m_count++;
+                return row;
+            }
+
+            /**
+             * @brief Removes a row whose components were already destroyed or relocated
+             *
+             * The last row is relocated into the hole to keep rows packed.
+             *
+             * @return EntityID The entity now stored at 'row', NULL_ENTITY if none was moved
+             */
+            EntityID eraseRow(std::size_t row) {
+                std::size_t last = m_count - 1;
+                EntityID moved = NULL_ENTITY;
+
+                if (row != last) {
+                    for (std::size_t col = 0; col < m_components.size(); col++)
+                        m_components[col]->relocate(at(col, row), at(col, last));
+                    moved = entityAt(last);
+                    entities(row / m_chunk_capacity)[row % m_chunk_capacity] = moved;
+                }
+                m_count--;
+                // Keep a single spare chunk to avoid thrashing on spawn/despawn bursts
+                std::size_t needed = (m_count + m_chunk_capacity - 1) / m_chunk_capacity;
+                while (m_chunks.size() > needed + 1) {
+                    ::operator delete(m_chunks.back(), std::align_val_t{CHUNK_COLUMN_ALIGN});
+                    m_chunks.pop_back();
+                }
+                return moved;
+            }
+
+            // Cached archetype transitions, indexed by component type ID
+            uint32_t &addEdge(std::size_t slot) { return m_add_edges[slot]; }
+            uint32_t &removeEdge(std::size_t slot) { return m_remove_edges[slot]; }
+
+            static constexpr EntityID NULL_ENTITY = std::numeric_limits<EntityID>::max();
+
+        private:
+            Signature m_signature;
+            std::vector<const ComponentInfo*> m_components;
+            std::array<int16_t, MAX_COMPONENT_TYPES> m_column_of;
+            std::vector<uint8_t> m_slots;                   // Column -> component slot
+            std::array<uint32_t, MAX_COMPONENT_TYPES> m_add_edges;
+            std::array<uint32_t, MAX_COMPONENT_TYPES> m_remove_edges;
+            std::vector<std::size_t> m_column_offsets;
+            std::vector<std::byte*> m_chunks;
+            std::size_t m_chunk_capacity = 1;
+            std::size_t m_chunk_bytes = CHUNK_SIZE_BYTES;
+            std::size_t m_count = 0;
+
+            static std::size_t alignUp(std::size_t value, std::size_t align) {
+                return (value + align - 1) / align * align;
+            }
+
+            std::size_t layoutBytes(std::size_t capacity) {
+                std::size_t offset = alignUp(sizeof(EntityID) * capacity, CHUNK_COLUMN_ALIGN);
+                m_column_offsets.clear();
+                for (const ComponentInfo *info : m_components) {
+                    m_column_offsets.push_back(offset);
+                    offset = alignUp(offset + info->size * capacity, CHUNK_COLUMN_ALIGN);
+                }
+                return offset;
+            }
+
+            void computeLayout() {
+                std::size_t row_bytes = sizeof(EntityID);
+                for (const ComponentInfo *info : m_components)
+                    row_bytes += info->size;
+
+                std::size_t capacity = std::max<std::size_t>(1, CHUNK_SIZE_BYTES / row_bytes);
+                while (capacity > 1 && layoutBytes(capacity) > CHUNK_SIZE_BYTES)
+                    capacity--;
+                m_chunk_capacity = capacity;
+                m_chunk_bytes = std::max(CHUNK_SIZE_BYTES, layoutBytes(capacity));
+            }
+    };
+
+    /**
+     * @brief Archetype based component storage
+     *
+     * Entities with the same set of components live in the same Archetype,
+     * so iterating a query walks contiguous SoA columns instead of jumping
+     * between one sparse set per component type.
+     * Adding or removing a component moves the entity to another archetype.
+     * Chunks never move, but an entity leaving an archetype relocates that
+     * archetype's last row: component references held across a delete or an
+     * add/remove of components must be fetched again.
+     */
+    class ArchetypeStorage {
+        public:
+            ArchetypeStorage() {
+                m_infos.fill(nullptr);
+            }
+
+            /**
+             * @brief Checks if a specific entity has the component
+             */
+            template<ComponentType T>
+            bool hasComponent(EntityID e) const {
+                uint8_t slot = findSlot(ComponentTypeId::get<T>());
+                return slot != NO_SLOT && signature(e).test(slot);
+            }
+
+            /**
+             * @brief Adds the component to the specified entity, moving it to its new archetype
+             *
+             * @return T& Reference to the newly created component
+             * @throw ERROR::ComponentAlreadyAttached => if the component is ALREADY attached to the entity
+             */
+            template<ComponentType T>
+            T &addComponent(EntityID e) {
+                const ComponentInfo &info = componentInfo<T>();
+                if (hasComponent<T>(e))
+                    throw ERROR::ComponentAlreadyAttached(e, info.name);
+                std::size_t slot = slotOf<T>();
+
+                if (entityIndex(e) >= m_records.size())
+                    m_records.resize(std::max<std::size_t>(entityIndex(e) + 1, m_records.size() * 2));
+
+                uint32_t src = m_records[entityIndex(e)].archetype;
+                uint32_t dst;
+                if (src == NO_ARCHETYPE) {
+                    Signature sig;
+                    sig.set(slot);
+                    dst = findOrCreate(sig);
+                } else {
+                    dst = m_archetypes[src]->addEdge(slot);
+                    if (dst == NO_ARCHETYPE) {
+                        Signature sig = m_archetypes[src]->signature();
+                        sig.set(slot);
+                        dst = findOrCreate(sig);
+                        m_archetypes[src]->addEdge(slot) = dst;
+                    }
+                }
+                std::size_t row = moveEntity(e, dst);
+                Archetype &arch = *m_archetypes[dst];
+                void *ptr = arch.at(static_cast<std::size_t>(arch.columnOf(slot)), row);
+                info.construct(ptr);
+                return *static_cast<T*>(ptr);
+            }
+
+            /**
+             * @brief Get the Component object attached to the specified entity
+             *
+             * @throw ERROR::ComponentNotAttached => if the entity doesn't have this component
+             */
+            template<ComponentType T>
+            T &getComponent(EntityID e) {
+                if (!hasComponent<T>(e))
+                    throw ERROR::ComponentNotAttached(e, typeid(T).name());
+                const Record &rec = m_records[entityIndex(e)];
+                Archetype &arch = *m_archetypes[rec.archetype];
+                return *static_cast<T*>(arch.at(
+                    static_cast<std::size_t>(arch.columnOf(findSlot(ComponentTypeId::get<T>()))), rec.row));
+            }
+
+            /**
+             * @brief Removes the attached component from the entity, moving it to its new archetype
+             */
+            template<ComponentType T>
+            void removeComponent(EntityID e) {
+                if (!hasComponent<T>(e))
+                    return;
+                std::size_t slot = findSlot(ComponentTypeId::get<T>());
+                uint32_t src = m_records[entityIndex(e)].archetype;
+                uint32_t dst = m_archetypes[src]->removeEdge(slot);
+                if (dst == NO_ARCHETYPE) {
+                    Signature sig = m_archetypes[src]->signature();
+                    sig.reset(slot);
+                    dst = sig.none() ? NO_ARCHETYPE : findOrCreate(sig);
+                    // The empty signature is never stored, cache it as "no archetype"
+                    if (dst != NO_ARCHETYPE)
+                        m_archetypes[src]->removeEdge(slot) = dst;
+                }
+                moveEntity(e, dst);
+            }
+
+            /**
+             * @brief Removes every component attached to an entity
+             */
+            void disableEntity(EntityID e) {
+                if (entityIndex(e) >= m_records.size() || m_records[entityIndex(e)].archetype == NO_ARCHETYPE)
+                    return;
+                moveEntity(e, NO_ARCHETYPE);
+            }
+
+            /**
+             * @brief Returns the component signature of an entity (empty if it has no component)
+             */
+            const Signature &signature(EntityID e) const {
+                static const Signature empty;
+                if (entityIndex(e) >= m_records.size() || m_records[entityIndex(e)].archetype == NO_ARCHETYPE)
+                    return empty;
+                return m_archetypes[m_records[entityIndex(e)].archetype]->signature();
+            }
+
+            /**
+             * @brief Calls fn(count, entities, Ts*...) once per non-empty chunk matching the query
+             *
+             * Each pointer addresses 'count' contiguous values. Structural changes
+             * (create/delete/add/remove component) are not allowed during the call.
+             */
+            template<ComponentType... Ts, typename Func>
+            void forEachChunk(Func &&fn) {
+                std::optional<Signature> query = findSignature<Ts...>();
+                if (!query)
+                    return;
+                for (uint32_t index : matching(*query)) {
+                    Archetype *arch = m_archetypes[index].get();
+                    if (arch->size() == 0)
+                        continue;
+                    for (std::size_t chunk = 0; chunk < arch->chunkCount(); chunk++) {
+                        std::size_t count = arch->chunkSize(chunk);
+                        if (count == 0)
+                            break;
+                        fn(count, arch->entities(chunk), arch->template column<Ts>(chunk, slotIndex<Ts>())...);
+                    }
+                }
+            }
+
+            /**
+             * @brief Appends every entity whose signature contains 'all' and intersects 'any' (if not empty)
+             */
+            void collectEntities(const Signature &all, const Signature &any, std::vector<EntityID> &out) {
+                auto collect = [&out](Archetype &arch) {
+                    for (std::size_t chunk = 0; chunk < arch.chunkCount(); chunk++) {
+                        std::size_t count = arch.chunkSize(chunk);
+                        const EntityID *ids = arch.entities(chunk);
+                        out.insert(out.end(), ids, ids + count);
+                    }
+                };
+                if (any.none()) {
+                    for (uint32_t index : matching(all))
+                        collect(*m_archetypes[index]);
+                    return;
+                }
+                for (auto &arch : m_archetypes) {
+                    const Signature &sig = arch->signature();
+                    if (arch->size() == 0 || (sig & all) != all || (sig & any).none())
+                        continue;
+                    collect(*arch);
+                }
+            }
+
+            /**
+             * @brief Returns the indices of every archetype whose signature contains 'query'
+             *
+             * The list is built on first use and kept up to date when new archetypes are
+             * created, so repeated queries never rescan the archetype list. The returned
+             * reference stays valid for the lifetime of the storage. Safe to call from
+             * systems running concurrently.
+             */
+            const std::vector<uint32_t> &matching(const Signature &query) {
+                std::lock_guard<std::mutex> lock(m_query_mutex);
+                auto it = m_queries.find(query);
+                if (it != m_queries.end())
+                    return it->second;
+                std::vector<uint32_t> indices;
+                for (uint32_t index = 0; index < m_archetypes.size(); index++) {
+                    if ((m_archetypes[index]->signature() & query) == query)
+                        indices.push_back(index);
+                }
+                return m_queries.emplace(query, std::move(indices)).first->second;
+            }
+
+            /**
+             * @brief Returns the archetype stored at 'index' (see matching())
+             */
+            Archetype &archetype(uint32_t index) { return *m_archetypes[index]; }
+
+            std::size_t archetypeCount() const { return m_archetypes.size(); }
+
+            /**
+             * @brief Builds the signature matching every listed component type
+             *
+             * Never assigns slots, so it is safe to call from concurrent systems.
+             *
+             * @return std::optional<Signature> nullopt if one of the types was never stored (nothing can match)
+             */
+            template<ComponentType... Ts>
+            std::optional<Signature> findSignature() const {
+                Signature sig;
+                for (uint8_t slot : {findSlot(ComponentTypeId::get<Ts>())...}) {
+                    if (slot == NO_SLOT)
+                        return std::nullopt;
+                    sig.set(slot);
+                }
+                return sig;
+            }
+
+            /**
+             * @brief Returns the signature bit of a component type already stored (see findSignature())
+             */
+            template<ComponentType T>
+            std::size_t slotIndex() const {
+                return findSlot(ComponentTypeId::get<T>());
+            }
+
+        private:
+            static constexpr uint8_t NO_SLOT = std::numeric_limits<uint8_t>::max();
+
+            struct Record {
+                uint32_t archetype = NO_ARCHETYPE;
+                uint32_t row = 0;
+            };
+
+            std::vector<std::unique_ptr<Archetype>> m_archetypes;
+            std::unordered_map<Signature, uint32_t> m_archetype_index;
+            std::vector<Record> m_records;
+            std::array<const ComponentInfo*, MAX_COMPONENT_TYPES> m_infos;     // Slot -> component description
+            std::vector<uint8_t> m_slot_of;                                     // ComponentTypeId -> slot
+            std::size_t m_slot_count = 0;
+            // Query signature -> matching archetype indices (node based, references stay valid)
+            std::unordered_map<Signature, std::vector<uint32_t>> m_queries;
+            std::mutex m_query_mutex;
+
+            /**
+             * @brief Returns the signature bit of a component type, assigning the next free one on first use
+             *
+             * @throw ERROR::TooManyComponentTypes => if MAX_COMPONENT_TYPES types are already in use
+             */
+            template<ComponentType T>
+            std::size_t slotOf() {
+                const ComponentInfo &info = componentInfo<T>();
+                uint8_t slot = findSlot(info.type_id);
+                if (slot != NO_SLOT)
+                    return slot;
+                if (m_slot_count >= MAX_COMPONENT_TYPES)
+                    throw ERROR::TooManyComponentTypes(info.name, MAX_COMPONENT_TYPES);
+                if (info.type_id >= m_slot_of.size())
+                    m_slot_of.resize(info.type_id + 1, NO_SLOT);
+                slot = static_cast<uint8_t>(m_slot_count++);
+                m_slot_of[info.type_id] = slot;
+                m_infos[slot] = &info;
+                return slot;
+            }
+
+            uint8_t findSlot(uint16_t type_id) const {
+                return type_id < m_slot_of.size() ? m_slot_of[type_id] : NO_SLOT;
+            }
+
+            uint32_t findOrCreate(const Signature &sig) {
+                auto it = m_archetype_index.find(sig);
+                if (it != m_archetype_index.end())
+                    return it->second;
+
+                std::vector<const ComponentInfo*> components;
+                for (std::size_t slot = 0; slot < MAX_COMPONENT_TYPES; slot++) {
+                    if (sig.test(slot))
+                        components.push_back(m_infos[slot]);
+                }
+                uint32_t index = static_cast<uint32_t>(m_archetypes.size());
+                m_archetypes.push_back(std::make_unique<Archetype>(sig, std::move(components)));
+                m_archetype_index.emplace(sig, index);
+                std::lock_guard<std::mutex> lock(m_query_mutex);
+                for (auto &[query, indices] : m_queries) {
+                    if ((sig & query) == query)
+                        indices.push_back(index);
+                }
+                return index;
+            }
+
+            /**
+             * @brief Moves an entity's row to another archetype (NO_ARCHETYPE drops it)
+             *
+             * Shared components are relocated, the others are destroyed.
+             * Components only present in the destination are left unconstructed.
+             *
+             * @return std::size_t The entity's row in the destination archetype
+             */
+            std::size_t moveEntity(EntityID e, uint32_t dst_index) {
+                Record &rec = m_records[entityIndex(e)];
+                Archetype *dst = dst_index == NO_ARCHETYPE ? nullptr : m_archetypes[dst_index].get();
+                std::size_t dst_row = dst ? dst->pushRow(e) : 0;
+
+                if (rec.archetype != NO_ARCHETYPE) {
+                    Archetype &src = *m_archetypes[rec.archetype];
+                    const auto &components = src.components();
+                    for (std::size_t col = 0; col < components.size(); col++) {
+                        int16_t dst_col = dst ? dst->columnOf(src.slotAt(col)) : -1;
+                        if (dst_col >= 0)
+                            components[col]->relocate(dst->at(static_cast<std::size_t>(dst_col), dst_row), src.at(col, rec.row));
+                        else
+                            components[col]->destroy(src.at(col, rec.row));
+                    }
+                    EntityID moved = src.eraseRow(rec.row);
+                    if (moved != Archetype::NULL_ENTITY)
+                        m_records[entityIndex(moved)].row = rec.row;
+                }
+                rec.archetype = dst_index;
+                rec.row = static_cast<uint32_t>(dst_row);
+                return dst_row;
+            }
+    };
+}
+
+#endif /* !ARCHETYPE_HPP_ */
@@ -71,7 +71,7 @@ namespace ECS {
     template<ComponentType T>
     struct SparseSetData {
         std::vector<DenseComponent<T>> dense_components;           // Packed components
-        std::vector<uint32_t> sparse;                           // EntityID -> dense index mapping
+        std::vector<uint32_t> sparse;                           // Entity index -> dense index mapping
     };
     constexpr uint32_t NULL_INDEX = std::numeric_limits<uint32_t>::max();
 
@@ -90,7 +90,7 @@ namespace ECS {
      * @tparam T The type of component the pool is storing
      */
     template <ComponentType T>
-    class ComponentPool : public IComponentPool {
+    class ComponentPool final : public IComponentPool {
         public:
             ComponentPool() : m_cache_dirty(true) {
                 m_data.dense_components.reserve(10000);
@@ -108,7 +108,9 @@ namespace ECS {
              * @return false The entity does not have the component
              */
             bool hasComponent(EntityID e) {
-                return e < m_data.sparse.size() && m_data.sparse[e] != NULL_INDEX;
+                uint32_t index = entityIndex(e);
+                return index < m_data.sparse.size() && m_data.sparse[index] != NULL_INDEX
+                    && m_data.dense_components[m_data.sparse[index]].entity == e;
             }
 
             /**
@@ -121,15 +123,16 @@ namespace ECS {
                 if (hasComponent(e))
                     throw ERROR::ComponentAlreadyAttached(e, std::string(typeid(T).name()));
 
-                if (e >= m_data.sparse.size())
-                    sparseGrow(e);
+                uint32_t index = entityIndex(e);
+                if (index >= m_data.sparse.size())
+                    sparseGrow(index);
 
                 uint32_t new_dense_index = static_cast<uint32_t>(m_data.dense_components.size());
                 m_data.dense_components.emplace_back();
 
                 m_data.dense_components[new_dense_index].entity = e;
 
-                m_data.sparse[e] = new_dense_index;
+                m_data.sparse[index] = new_dense_index;
 
                 m_cache_dirty = true;
                 return m_data.dense_components.back().component;
@@ -143,19 +146,19 @@ namespace ECS {
             void removeComponent(EntityID e) {
                 if (!hasComponent(e)) return;
 
-                uint32_t dense_index = m_data.sparse[e];
+                uint32_t dense_index = m_data.sparse[entityIndex(e)];
                 uint32_t last_index = static_cast<uint32_t>(m_data.dense_components.size() - 1);
 
                 if (dense_index != last_index) {
                     m_data.dense_components[dense_index] = std::move(m_data.dense_components[last_index]);
                     
                     EntityID moved_entity = m_data.dense_components[dense_index].entity;
-                    m_data.sparse[moved_entity] = dense_index;
+                    m_data.sparse[entityIndex(moved_entity)] = dense_index;
                 }
 
                 m_data.dense_components.pop_back();
 
-                m_data.sparse[e] = NULL_INDEX;
+                m_data.sparse[entityIndex(e)] = NULL_INDEX;
 
                 m_cache_dirty = true;
             }
@@ -171,7 +174,34 @@ namespace ECS {
                 if (!hasComponent(e)) {
                     throw ERROR::ComponentNotAttached(e, typeid(T).name());
                 }
-                return m_data.dense_components[m_data.sparse[e]].component;
+                return m_data.dense_components[m_data.sparse[entityIndex(e)]].component;
+            }
+
+            /**
+             * @brief Get the component attached to the specified entity without checking it exists
+             *
+             * @param e The entity ID, hasComponent(e) must be true
+             * @return T& Reference to the component
+             */
+            T &getComponentUnchecked(EntityID e) {
+                return m_data.dense_components[m_data.sparse[entityIndex(e)]].component;
+            }
+
+            /**
+             * @brief Returns the amount of components stored in the pool
+             */
+            std::size_t size() const {
+                return m_data.dense_components.size();
+            }
+
+            /**
+             * @brief Returns the entity owning the component at a dense index
+             *
+             * @param index Dense index, must be lower than size()
+             * @return EntityID The owner
+             */
+            EntityID entityAt(std::size_t index) const {
+                return m_data.dense_components[index].entity;
             }
 
             /**
@@ -215,7 +245,7 @@ namespace ECS {
             std::vector<EntityID> m_cached_entities;
             bool m_cache_dirty;
 
-            void sparseGrow(EntityID new_standard) {
+            void sparseGrow(uint32_t new_standard) {
                 std::size_t curr_size = m_data.sparse.size();
                 if (curr_size == 0)
                     curr_size = 8192;
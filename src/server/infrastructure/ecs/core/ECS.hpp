@@ -25,15 +25,20 @@
 
 #include <cstddef>
 #include <vector>
-#include <queue>
 #include <unordered_map>
 #include <string>
 #include <exception>
 #include <system_error>
 #include <algorithm>
+#include <tuple>
+#include <mutex>
+#include <utility>
 #include <unistd.h>
 
 #include "Registry.hpp"
+#include "Archetype.hpp"
+#include "View.hpp"
+#include "JobSystem.hpp"
 #include "Errors.hpp"
 #include "Includes.hpp"
 #include "Component.hpp"
@@ -58,6 +63,16 @@ namespace ECS {
                 }
             }
 
+            /**
+             * @brief Construct a new ECS object using a specific component storage
+             *
+             * @param mode SparseSet (one pool per component type) or Archetype (SoA chunks per component signature)
+             */
+            explicit ECS(StorageMode mode) : ECS()
+            {
+                m_storage_mode = mode;
+            }
+
             ~ECS() {
                 // Delete all registered systems to prevent memory leaks
                 for (auto& systemData : m_systems) {
@@ -67,6 +82,16 @@ namespace ECS {
                 m_systems.clear();
             }
 
+            /**
+             * @brief Returns the component storage used by this ECS
+             *
+             * @return StorageMode The storage mode chosen at construction
+             */
+            StorageMode storageMode() const
+            {
+                return m_storage_mode;
+            }
+
             /**
              * @brief Returns the amount of currently active entities
              * 
@@ -77,45 +102,66 @@ namespace ECS {
                 return m_active_entities;
             }
 
+            /**
+             * @brief Preallocates the bookkeeping of 'count' live entities
+             *
+             * The entity table, free list, group caches and deletion logs otherwise
+             * grow the first time the world reaches a new peak, in the middle of an Update().
+             *
+             * @param count Expected peak of live entities
+             */
+            void reserveEntities(std::size_t count)
+            {
+                m_entities.reserve(count);
+                m_free_list.reserve(count);
+                m_deferred_deletes.reserve(count);
+                m_update_deletes.reserve(count);
+                for (auto &group : m_group_cache)
+                    group.reserve(count);
+            }
+
             /**
              * @brief Checks if the specified entity's ID match an active entity
+             *
+             * Handles of deleted entities stay invalid even once their slot is reused,
+             * the generation stored in the handle no longer matches.
              * 
              * @param e EntityID
              * @return true if it exists
              * @return false if it doesn't
              */
-            bool entityIsActive(EntityID e)
+            bool entityIsActive(EntityID e) const
             {
-                if (m_entities.size() <= e)
+                uint32_t index = entityIndex(e);
+                if (m_entities.size() <= index)
                     return false;
-                return m_entities[e].isActive;
+                return m_entities[index].isActive && m_entities[index].generation == entityGeneration(e);
             }
 
             /**
              * @brief Create a new entity and returns its ID
+             *
+             * Slots are reused last-freed first, which keeps the live index range
+             * (and therefore the component sparse arrays) as dense as possible.
              * 
              * @return EntityID 
              */
             EntityID entityCreate()
             {
-                EntityID newId;
+                uint32_t index;
 
-                if (m_available_ids.size() == 0) {
-                    newId = m_id_counter++;
+                if (m_free_list.empty()) {
+                    index = m_id_counter++;
+                    if (index >= m_entities.size())
+                        m_entities.resize(m_entities.size() * 2);
                 } else {
-                    newId = m_available_ids.front();
-                    m_available_ids.pop();
-                }
-                if (m_active_entities >= m_entities.size()) {
-                    std::size_t current_capacity = m_entities.size();
-                    for (std::size_t i = 0; i < current_capacity; i++) {
-                        m_entities.push_back(Entity());
-                    }
+                    index = m_free_list.back();
+                    m_free_list.pop_back();
                 }
-                m_entities[newId].isActive = true;
-                m_entities[newId].group = NONE;
+                m_entities[index].isActive = true;
+                m_entities[index].group = NONE;
                 m_active_entities++;
-                return newId;
+                return makeEntityID(index, m_entities[index].generation);
             }
 
             /**
@@ -135,6 +181,19 @@ namespace ECS {
                 return e;
             }
 
+            /**
+             * @brief Get the group of an entity
+             *
+             * @param id The ID of the entity
+             * @return EntityGroup The group of the entity, NONE if it doesn't exist
+             */
+            EntityGroup entityGetGroup(EntityID id) const
+            {
+                if (!entityIsActive(id))
+                    return NONE;
+                return m_entities[entityIndex(id)].group;
+            }
+
             /**
              * @brief Set the group of an entity
              *
@@ -143,17 +202,18 @@ namespace ECS {
              */
             void entitySetGroup(EntityID id, EntityGroup group)
             {
-                if (m_entities.size() <= id)
+                if (!entityIsActive(id))
                     return;
-                EntityGroup oldGroup = m_entities[id].group;
+                Entity &entity = m_entities[entityIndex(id)];
+                EntityGroup oldGroup = entity.group;
                 if (oldGroup == group)
                     return; // No change
                 // Update cache: remove from old, add to new
-                if (m_entities[id].isActive && oldGroup != NONE) {
+                if (oldGroup != NONE) {
                     removeFromGroupCache(id, oldGroup);
                 }
-                m_entities[id].group = group;
-                if (m_entities[id].isActive && group != NONE) {
+                entity.group = group;
+                if (group != NONE) {
                     addToGroupCache(id, group);
                 }
             }
@@ -165,20 +225,48 @@ namespace ECS {
              */
             void entityDelete(EntityID e)
             {
-                if (m_entities.size() <= e)
-                    return;
                 if (!entityIsActive(e))
                     return;
+                Entity &entity = m_entities[entityIndex(e)];
                 // Remove from group cache before marking inactive
-                EntityGroup group = m_entities[e].group;
-                if (group != NONE) {
-                    removeFromGroupCache(e, group);
+                if (entity.group != NONE) {
+                    removeFromGroupCache(e, entity.group);
                 }
-                m_entities[e].isActive = false;
-                m_entities[e].group = NONE;
-                m_available_ids.push(e);
+                entity.isActive = false;
+                entity.group = NONE;
+                entity.generation++;
+                m_free_list.push_back(entityIndex(e));
                 m_active_entities--;
+                if (m_updating)
+                    m_update_deletes.push_back(e);
+                if (m_storage_mode == StorageMode::Archetype) {
+                    m_archetypes.disableEntity(e);
+                    return;
+                }
                 registry.disableEntity(e);
+                for (auto &[query, entities] : m_query_cache)
+                    queryCacheErase(entities, e);
+            }
+
+            /**
+             * @brief Deletes an entity once the current system stage is over
+             *
+             * Systems running in a parallel stage must not delete entities directly,
+             * they queue the deletion instead. Queued deletions are applied after the
+             * stage, ordered by system then by entity, whatever the amount of worker threads.
+             * Outside of Update() the entity is deleted immediately.
+             *
+             * @param by The ID of the calling system
+             * @param e EntityID
+             */
+            void entityDeleteDeferred(SystemID by, EntityID e)
+            {
+                if (!m_updating) {
+                    entityDelete(e);
+                    return;
+                }
+                std::lock_guard<std::mutex> lock(m_deferred_mutex);
+                m_deferred_deletes.emplace_back(by, e);
             }
 
             /**
@@ -197,6 +285,10 @@ namespace ECS {
 
             /**
              * @brief Returns a vector containing the IDs of entities that have ALL specified components
+             *
+             * The sorted result of each query is cached and kept up to date on component
+             * add/remove and entity deletion, so repeated calls only copy the cached list.
+             * Prefer view() in hot loops, it doesn't allocate at all.
              * 
              * @tparam Components The component types to check for (variadic template)
              * @return std::vector<EntityID> The list of entities that have all specified components
@@ -207,39 +299,33 @@ namespace ECS {
                 if constexpr (sizeof...(Components) == 0) {
                     return {};
                 }
-                
-                std::vector<std::vector<EntityID>> component_lists;
-                
-                (component_lists.push_back(
-                    componentExists<Components>()
-                    ? registry.getPool<Components>().getActiveEntities()
-                    : std::vector<EntityID>{}
-                ), ...);
 
-                if (component_lists.empty()) {
-                    return {};
+                if (m_storage_mode == StorageMode::Archetype) {
+                    if (!(componentExists<Components>() && ...))
+                        return {};
+                    std::optional<Signature> query = m_archetypes.findSignature<Components...>();
+                    if (!query)
+                        return {};
+                    std::vector<EntityID> result;
+                    m_archetypes.collectEntities(*query, Signature(), result);
+                    std::sort(result.begin(), result.end());
+                    return result;
                 }
-                
-                auto smallest_it = std::min_element(component_lists.begin(), component_lists.end(),
-                    [](const std::vector<EntityID>& a, const std::vector<EntityID>& b) {
-                        return a.size() < b.size();
-                    });
-
-                std::vector<EntityID> result = *smallest_it;
 
-                for (const auto& comp_list : component_lists) {
-                    if (&comp_list == &(*smallest_it)) continue;
-                    
-                    std::vector<EntityID> intersection;
-                    std::set_intersection(result.begin(), result.end(),
-                                        comp_list.begin(), comp_list.end(),
-                                        std::back_inserter(intersection));
-                    result = std::move(intersection);
-                    
-                    if (result.empty()) break;
+                if (!(componentExists<Components>() && ...))
+                    return {};
+                Signature query;
+                (query.set(registry.slotOf<Components>()), ...);
+                std::lock_guard<std::mutex> lock(m_query_mutex);
+                auto it = m_query_cache.find(query);
+                if (it == m_query_cache.end()) {
+                    std::vector<EntityID> entities;
+                    for (const auto &row : view<Components...>())
+                        entities.push_back(std::get<0>(row));
+                    std::sort(entities.begin(), entities.end());
+                    it = m_query_cache.emplace(query, std::move(entities)).first;
                 }
-
-                return result;
+                return it->second;
             }
 
             /**
@@ -256,22 +342,29 @@ namespace ECS {
                 }
 
                 std::vector<EntityID> result;
-                
-                auto addEntities = [&result](const std::vector<EntityID>& entities) {
-                    for (EntityID id : entities) {
-                        if (std::find(result.begin(), result.end(), id) == result.end()) {
-                            result.push_back(id);
-                        }
+
+                if (m_storage_mode == StorageMode::Archetype) {
+                    Signature any;
+                    for (std::optional<Signature> sig : {m_archetypes.findSignature<Components>()...}) {
+                        if (sig)
+                            any |= *sig;
                     }
-                };
-                
-                ((componentExists<Components>()
-                    ? addEntities(registry.getPool<Components>().getActiveEntities())
-                    : void()
-                ), ...);
-                
-                std::sort(result.begin(), result.end());
+                    if (any.none())
+                        return {};
+                    m_archetypes.collectEntities(Signature(), any, result);
+                    std::sort(result.begin(), result.end());
+                    return result;
+                }
                 
+                Signature any;
+                ((componentExists<Components>() ? void(any.set(registry.slotOf<Components>())) : void()), ...);
+                if (any.none())
+                    return {};
+                const auto &signatures = registry.signatures();
+                for (uint32_t index = 0; index < signatures.size(); index++) {
+                    if ((signatures[index] & any).any())
+                        result.push_back(makeEntityID(index, m_entities[index].generation));
+                }
                 return result;
             }
 
@@ -302,7 +395,14 @@ namespace ECS {
              * @return false Either if the entity doesn't exists or if the component isn't attached to it
              */
             template<ComponentType T>
-            bool entityHasComponent(EntityID e) { return registry.getPool<T>().hasComponent(e); }
+            bool entityHasComponent(EntityID e)
+            {
+                if (m_storage_mode == StorageMode::Archetype) {
+                    requireRegistered<T>();
+                    return entityIsActive(e) && m_archetypes.hasComponent<T>(e);
+                }
+                return registry.hasComponent<T>(e) && entityIsActive(e);
+            }
 
             /**
              * @brief Add a new component to the specified entity
@@ -311,10 +411,23 @@ namespace ECS {
              * @param e EntityID - The entity to add the component to
              * @return T& Reference to the newly created Component
              * @throw ERROR::UnregisteredComponent => if the component isn't registered
+             * @throw ERROR::InvalidEntityID => if the entity was deleted (or never created)
              * @throw ERROR::ComponentAlreadyAttached => if the component is ALREADY attached to the entity
              */
             template<ComponentType T>
-            T &entityAddComponent(EntityID e) { return registry.getPool<T>().addComponent(e); }
+            T &entityAddComponent(EntityID e)
+            {
+                if (!entityIsActive(e))
+                    throw ERROR::InvalidEntityID(e);
+                if (m_storage_mode == StorageMode::Archetype) {
+                    requireRegistered<T>();
+                    return m_archetypes.addComponent<T>(e);
+                }
+                T &component = registry.addComponent<T>(e);
+                if (!m_query_cache.empty())
+                    queryCacheOnAdd(e, registry.slotOf<T>());
+                return component;
+            }
 
             /**
              * @brief Gets the attached specified component to the specified entity
@@ -323,10 +436,20 @@ namespace ECS {
              * @param e EntityID - The entity's ID
              * @return T& Reference to the associated component
              * @throw ERROR::UnregisteredComponent => if the component isn't registered
+             * @throw ERROR::InvalidEntityID => if the entity was deleted (or never created)
              * @throw ERROR::ComponentNotAttached => if the component is NOT attached to the entity
              */
             template<ComponentType T>
-            T &entityGetComponent(EntityID e) { return registry.getPool<T>().getComponent(e); }
+            T &entityGetComponent(EntityID e)
+            {
+                if (!entityIsActive(e))
+                    throw ERROR::InvalidEntityID(e);
+                if (m_storage_mode == StorageMode::Archetype) {
+                    requireRegistered<T>();
+                    return m_archetypes.getComponent<T>(e);
+                }
+                return registry.getPool<T>().getComponent(e);
+            }
 
             /**
              * @brief Removes the attached component from the entity
@@ -335,17 +458,158 @@ namespace ECS {
              * @param e The entity ID
              */
             template<ComponentType T>
-            void entityRemoveComponent(EntityID e) { registry.getPool<T>().removeComponent(e); }
+            void entityRemoveComponent(EntityID e)
+            {
+                if (!entityIsActive(e))
+                    return;
+                if (m_storage_mode == StorageMode::Archetype) {
+                    requireRegistered<T>();
+                    m_archetypes.removeComponent<T>(e);
+                    return;
+                }
+                registry.removeComponent<T>(e);
+                std::size_t slot = registry.slotOf<T>();
+                for (auto &[query, entities] : m_query_cache) {
+                    if (query.test(slot))
+                        queryCacheErase(entities, e);
+                }
+            }
 
             /**
              * @brief Get the Pool object
+             *
+             * Components must be added and removed through the ECS, not directly
+             * through the pool, or the query caches will miss the change.
              * 
              * @tparam T The component type of the Pool
              * @return ComponentPool<T>* The pointer to the pool
              * @throw ERROR::UnregisteredComponent => if the component isn't registered
+             * @throw ERROR::StorageModeMismatch => if the ECS uses archetype storage (there are no pools)
              */
             template<ComponentType T>
-            ComponentPool<T> &getPool() { return registry.getPool<T>(); }
+            ComponentPool<T> &getPool()
+            {
+                if (m_storage_mode == StorageMode::Archetype)
+                    throw ERROR::StorageModeMismatch("getPool");
+                return registry.getPool<T>();
+            }
+
+            /**
+             * @brief Returns a view over every entity having all the components
+             *
+             * Iterating the view yields std::tuple<EntityID, Ts&...> without any heap
+             * allocation. The view is invalidated by structural changes (see View).
+             *
+             * @tparam Ts The component types to fetch
+             * @return View<Ts...> The view, empty if one of the components isn't registered
+             */
+            template<ComponentType... Ts>
+            View<Ts...> view()
+            {
+                static_assert(sizeof...(Ts) > 0, "A view needs at least one component type");
+                if (!(componentExists<Ts>() && ...))
+                    return View<Ts...>();
+                if (m_storage_mode == StorageMode::Archetype) {
+                    std::optional<Signature> query = m_archetypes.findSignature<Ts...>();
+                    if (!query)
+                        return View<Ts...>();
+                    return View<Ts...>(m_archetypes, m_archetypes.matching(*query));
+                }
+                Signature query;
+                (query.set(registry.slotOf<Ts>()), ...);
+                return View<Ts...>(registry.signatures(), query, &registry.getPool<Ts>()...);
+            }
+
+            /**
+             * @brief Calls fn(count, entities, Ts*...) for each run of entities having all the components
+             *
+             * With archetype storage every call covers one chunk and each pointer addresses
+             * 'count' contiguous values, which lets the compiler vectorize the inner loop.
+             * With sparse-set storage fn is called once per entity (count == 1).
+             * Entities must not be created, deleted or change components during the call.
+             *
+             * @tparam Ts The component types to fetch
+             * @param fn Callable taking (std::size_t count, const EntityID *entities, Ts *...columns)
+             */
+            template<ComponentType... Ts, typename Func>
+            void forEachChunk(Func &&fn)
+            {
+                if (m_storage_mode == StorageMode::Archetype) {
+                    if (!(componentExists<Ts>() && ...))
+                        return;
+                    m_archetypes.forEachChunk<Ts...>(fn);
+                    return;
+                }
+                for (auto row : view<Ts...>()) {
+                    std::apply([&fn](EntityID e, Ts &...components) {
+                        fn(std::size_t{1}, &e, &components...);
+                    }, row);
+                }
+            }
+
+            /**
+             * @brief Calls fn(EntityID, Ts&...) for every entity having all the components
+             *
+             * Entities must not be created, deleted or change components during the call.
+             *
+             * @tparam Ts The component types to fetch
+             * @param fn Callable taking (EntityID, Ts&...)
+             */
+            template<ComponentType... Ts, typename Func>
+            void forEach(Func &&fn)
+            {
+                if (m_storage_mode == StorageMode::SparseSet) {
+                    for (auto row : view<Ts...>())
+                        std::apply(fn, row);
+                    return;
+                }
+                forEachChunk<Ts...>([&fn](std::size_t count, const EntityID *entities, Ts *...columns) {
+                    for (std::size_t i = 0; i < count; i++)
+                        fn(entities[i], columns[i]...);
+                });
+            }
+
+            /**
+             * @brief Same as forEach(), but splits the entities between the jobs of the attached JobSystem
+             *
+             * Archetype storage submits one job per chunk, sparse-set storage one job per
+             * 'rows_per_job' rows of the smallest pool. fn is called concurrently, it must
+             * only touch the components it is given. Without a JobSystem (or without worker
+             * threads) this is a plain forEach().
+             *
+             * @tparam Ts The component types to fetch
+             * @param fn Callable taking (EntityID, Ts&...)
+             * @param rows_per_job Sparse-set storage only: amount of rows handled by one job
+             */
+            template<ComponentType... Ts, typename Func>
+            void parallelForEach(Func &&fn, std::size_t rows_per_job = 1024)
+            {
+                if (m_jobs == nullptr || m_jobs->workerCount() == 0) {
+                    forEach<Ts...>(fn);
+                    return;
+                }
+                JobSystem::Batch batch;
+                View<Ts...> rows;   // Read by the sparse-set jobs, must outlive wait()
+                if (m_storage_mode == StorageMode::Archetype) {
+                    forEachChunk<Ts...>([this, &batch, &fn](std::size_t count, const EntityID *entities, Ts *...columns) {
+                        m_jobs->submit(batch, [&fn, count, entities, columns...]() {
+                            for (std::size_t i = 0; i < count; i++)
+                                fn(entities[i], columns[i]...);
+                        });
+                    });
+                } else {
+                    rows = view<Ts...>();
+                    std::size_t total = rows.rowCount();
+                    rows_per_job = std::max<std::size_t>(rows_per_job, 1);
+                    for (std::size_t first = 0; first < total; first += rows_per_job) {
+                        std::size_t last = std::min(first + rows_per_job, total);
+                        m_jobs->submit(batch, [&fn, &rows, first, last]() {
+                            rows.forEachInRows(first, last, fn);
+                        });
+                    }
+                }
+                m_jobs->wait(batch);
+            }
 
             /**
              * @brief Adds a new system to the ECS
@@ -363,6 +627,7 @@ namespace ECS {
                 data.sys = new T();
                 data.tickrate = tickrate;
                 data.skipped_ticks = 0;
+                data.access = data.sys->access();
                 m_systems.push_back(data);
                 return m_systems.size() - 1;
             }
@@ -385,6 +650,7 @@ namespace ECS {
                 data.sys = new T(std::forward<Args>(args)...);
                 data.tickrate = tickrate;
                 data.skipped_ticks = 0;
+                data.access = data.sys->access();
                 m_systems.push_back(data);
                 return m_systems.size() - 1;
             }
@@ -430,36 +696,182 @@ namespace ECS {
                 return m_systems[sys].enabled;
             }
 
+            /**
+             * @brief Forbids 'system' and 'dependency' to ever run in the same parallel stage
+             *
+             * Used when a system consumes results another one produces outside of
+             * the components (e.g. the collision pairs consumed by the damage system).
+             *
+             * @param system The dependent system
+             * @param dependency The system it depends on
+             */
+            void systemAddDependency(SystemID system, SystemID dependency)
+            {
+                if (system >= m_systems.size() || dependency >= m_systems.size())
+                    return;
+                m_systems[system].dependencies.push_back(dependency);
+            }
+
+            /**
+             * @brief Attaches the thread pool used to run systems and parallelForEach() jobs
+             *
+             * The pool is not owned and may be shared between several ECS instances.
+             *
+             * @param jobs The pool, nullptr to run everything on the calling thread
+             */
+            void setJobSystem(JobSystem *jobs)
+            {
+                m_jobs = jobs;
+            }
+
+            /**
+             * @brief Returns the attached thread pool, nullptr if none
+             */
+            JobSystem *jobSystem() const
+            {
+                return m_jobs;
+            }
+
+            /**
+             * @brief Returns the entities deleted during the last Update(), in deletion order
+             *
+             * Lets the owner of the ECS react to deletions made by systems (kills, cleanup, lifetime)
+             * without scanning its own entity handles. Cleared when the next Update() starts;
+             * deletions made outside of Update() are not listed.
+             */
+            const std::vector<EntityID>& lastUpdateDeletions() const
+            {
+                return m_update_deletes;
+            }
+
             /**
              * @brief Updates every active systems
-             * 
+             *
+             * The systems ticking this update are cut into stages, in registration order:
+             * a system joins the current stage unless it conflicts (see SystemAccess) with
+             * one of its systems or depends on it. With a JobSystem the systems of a stage
+             * run concurrently, otherwise one after the other; deletions queued with
+             * entityDeleteDeferred() are applied at the end of each stage in both cases,
+             * so results don't depend on the amount of threads.
              */
             void Update(uint32_t msecs = 0)
             {
+                m_ticking.clear();
                 for (SystemID i = 0; i < m_systems.size(); i++) {
-                    auto &it = m_systems.at(i);
+                    auto &it = m_systems[i];
                     if (!it.enabled)
                         continue;
                     if (it.skipped_ticks >= it.tickrate) {
-                        it.sys->Update(*this, i, msecs);
+                        m_ticking.push_back(i);
                         it.skipped_ticks = 0;
                     } else {
                         it.skipped_ticks++;
                     }
                 }
+                m_update_deletes.clear();
+                m_updating = true;
+                try {
+                    std::size_t begin = 0;
+                    while (begin < m_ticking.size()) {
+                        std::size_t end = begin + 1;
+                        while (end < m_ticking.size() && !conflictsWithStage(m_ticking[end], begin, end))
+                            end++;
+                        runStage(begin, end, msecs);
+                        flushDeferredDeletes();
+                        begin = end;
+                    }
+                } catch (...) {
+                    m_updating = false;
+                    m_deferred_deletes.clear();
+                    throw;
+                }
+                m_updating = false;
             }
 
             Registry registry;
         private:
-            EntityID m_id_counter = 0;
-            std::queue<EntityID> m_available_ids;
+            StorageMode m_storage_mode = StorageMode::SparseSet;
+            ArchetypeStorage m_archetypes;
+            uint32_t m_id_counter = 0;
+            std::vector<uint32_t> m_free_list;     // Freed entity slots, reused LIFO
             std::size_t m_active_entities = 0;
             std::vector<Entity> m_entities;
             std::vector<SystemData> m_systems;
 
+            // Parallel scheduling
+            JobSystem *m_jobs = nullptr;
+            bool m_updating = false;
+            std::vector<SystemID> m_ticking;                        // Systems ticking this update, in order
+            std::vector<std::pair<SystemID, EntityID>> m_deferred_deletes;
+            std::vector<EntityID> m_update_deletes;                 // Deleted during the last Update()
+            std::mutex m_deferred_mutex;
+
             // Group cache: O(1) access to entities by group
             std::vector<EntityID> m_group_cache[MAX_ENTITY_GROUPS];
 
+            // Query cache (sparse-set storage): registry signature -> sorted matching entities
+            std::unordered_map<Signature, std::vector<EntityID>> m_query_cache;
+            std::mutex m_query_mutex;
+
+            // Helper: checks if system 'id' may not run alongside m_ticking[begin, end)
+            bool conflictsWithStage(SystemID id, std::size_t begin, std::size_t end) const {
+                const SystemData &data = m_systems[id];
+                for (std::size_t i = begin; i < end; i++) {
+                    const SystemData &other = m_systems[m_ticking[i]];
+                    if (data.access.conflictsWith(other.access)
+                        || std::find(data.dependencies.begin(), data.dependencies.end(), m_ticking[i]) != data.dependencies.end()
+                        || std::find(other.dependencies.begin(), other.dependencies.end(), id) != other.dependencies.end())
+                        return true;
+                }
+                return false;
+            }
+
+            // Helper: runs the systems m_ticking[begin, end), concurrently if a JobSystem is attached
+            void runStage(std::size_t begin, std::size_t end, uint32_t msecs) {
+                if (m_jobs == nullptr || m_jobs->workerCount() == 0 || end - begin == 1) {
+                    for (std::size_t i = begin; i < end; i++)
+                        m_systems[m_ticking[i]].sys->Update(*this, m_ticking[i], msecs);
+                    return;
+                }
+                JobSystem::Batch batch;
+                for (std::size_t i = begin; i < end; i++) {
+                    SystemID id = m_ticking[i];
+                    ISystem *sys = m_systems[id].sys;
+                    m_jobs->submit(batch, [this, sys, id, msecs]() { sys->Update(*this, id, msecs); });
+                }
+                m_jobs->wait(batch);
+            }
+
+            // Helper: applies the deletions queued during a stage, by system then by entity
+            void flushDeferredDeletes() {
+                if (m_deferred_deletes.empty())
+                    return;
+                // Jobs push in any order: sorting keeps the free list (so the next IDs) deterministic
+                std::sort(m_deferred_deletes.begin(), m_deferred_deletes.end());
+                for (const auto &[by, e] : m_deferred_deletes)
+                    entityDelete(e);
+                m_deferred_deletes.clear();
+            }
+
+            // Helper: insert the entity in every cached query its signature now matches
+            void queryCacheOnAdd(EntityID e, std::size_t slot) {
+                const Signature &sig = registry.signature(e);
+                for (auto &[query, entities] : m_query_cache) {
+                    if (!query.test(slot) || (sig & query) != query)
+                        continue;
+                    auto it = std::lower_bound(entities.begin(), entities.end(), e);
+                    if (it == entities.end() || *it != e)
+                        entities.insert(it, e);
+                }
+            }
+
+            // Helper: remove an entity from a sorted cached query
+            static void queryCacheErase(std::vector<EntityID> &entities, EntityID e) {
+                auto it = std::lower_bound(entities.begin(), entities.end(), e);
+                if (it != entities.end() && *it == e)
+                    entities.erase(it);
+            }
+
             // Helper: remove entity from its current group cache
             void removeFromGroupCache(EntityID id, EntityGroup group) {
                 if (group >= MAX_ENTITY_GROUPS) return;
@@ -472,6 +884,13 @@ namespace ECS {
                 }
             }
 
+            // Helper: archetype storage still relies on the registry to know registered types
+            template<ComponentType T>
+            void requireRegistered() {
+                if (!registry.componentExists<T>())
+                    throw ERROR::UnregisteredComponent(typeid(T).name());
+            }
+
             // Helper: add entity to group cache
             void addToGroupCache(EntityID id, EntityGroup group) {
                 if (group >= MAX_ENTITY_GROUPS) return;
@@ -87,6 +87,36 @@ namespace ECS {
             private:
                 std::string message;
         };
+
+        class TooManyComponentTypes : public std::exception {
+            public:
+                TooManyComponentTypes(const std::string& comp_name, std::size_t limit)
+                : message("Component '" + comp_name + "' exceeds the limit of " + std::to_string(limit) + " component types!")
+                {}
+                ~TooManyComponentTypes() {}
+
+                const char *what() const noexcept override
+                {
+                    return message.c_str();
+                }
+            private:
+                std::string message;
+        };
+
+        class StorageModeMismatch : public std::exception {
+            public:
+                StorageModeMismatch(const std::string& operation)
+                : message("'" + operation + "' isn't available with the current storage mode!")
+                {}
+                ~StorageModeMismatch() {}
+
+                const char *what() const noexcept override
+                {
+                    return message.c_str();
+                }
+            private:
+                std::string message;
+        };
     }
 }
 
@@ -28,6 +28,7 @@
     #include <type_traits>
     #include <typeindex>
     #include <cstdint>
+    #include <bitset>
     #include <atomic>
 
 namespace ECS {
@@ -43,12 +44,31 @@ namespace ECS {
     template<typename T>
     concept ComponentType = std::is_default_constructible_v<T>;
 
-    // Alias for uint32_t, used to represent, locate and perform actions on entities
-    using EntityID = uint32_t;
+    // Entity handle: slot index in the low 32 bits, generation in the high 32 bits.
+    // The generation is bumped when the entity is deleted, so handles kept after
+    // a delete never alias the entity that later reuses the slot.
+    using EntityID = uint64_t;
+
+    // Slot of an entity, used to index every per-entity array
+    constexpr uint32_t entityIndex(EntityID e) { return static_cast<uint32_t>(e); }
+
+    // Generation of an entity handle
+    constexpr uint32_t entityGeneration(EntityID e) { return static_cast<uint32_t>(e >> 32); }
+
+    // Builds an entity handle from its slot index and generation
+    constexpr EntityID makeEntityID(uint32_t index, uint32_t generation) {
+        return (static_cast<EntityID>(generation) << 32) | index;
+    }
 
     // Alias for uint16_t, used to represent a System within the ECS
     using SystemID = uint16_t;
 
+    // Maximum amount of component types a signature can describe
+    constexpr std::size_t MAX_COMPONENT_TYPES = 64;
+
+    // One bit per component type, set when the component is attached
+    using Signature = std::bitset<MAX_COMPONENT_TYPES>;
+
     // Entity groups for R-Type game entities
     enum EntityGroup : uint8_t {
         NONE = 0,
@@ -67,17 +87,22 @@ namespace ECS {
         This is how an entity is stored within the ECS
         isActive represents if an entity exists or not
         group represents a group which the entity belongs to
+        generation is the generation of the current (or next) handle of this slot
     */
     struct Entity {
         bool isActive = false;
         EntityGroup group = NONE;
+        uint32_t generation = 0;
     };
 
-    struct SystemData {
-        bool enabled;
-        ISystem *sys;
-        int tickrate;
-        int skipped_ticks;
+    /*
+        How components are laid out in memory
+        SparseSet stores every component type in its own ComponentPool
+        Archetype stores entities sharing the same component signature together in SoA chunks
+    */
+    enum class StorageMode : uint8_t {
+        SparseSet = 0,
+        Archetype = 1
     };
 }
 
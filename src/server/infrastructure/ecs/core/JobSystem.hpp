@@ -0,0 +1,219 @@
+/*
+ *  JobSystem
+ *
+ *  Blob ECS is a lightweight Entity Component System library
+ *  Copyright (C) 2025 LECOCQ Guillaume
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+*/
+
+#ifndef JOB_SYSTEM_HPP_
+    #define JOB_SYSTEM_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ECS {
+
+    /**
+     * @brief Small work-stealing thread pool used to run systems and chunk jobs in parallel
+     *
+     * Every worker owns a deque: it pops its own jobs from the back and steals
+     * from the front of the other deques when it runs dry. wait() never blocks
+     * idly, the calling thread keeps running queued jobs until its batch is
+     * done, so a JobSystem can be shared by many ECS instances (one per room)
+     * driven from an io_context strand without deadlocking.
+     */
+    class JobSystem {
+        public:
+            /**
+             * @brief Groups jobs so their completion can be awaited with wait()
+             */
+            class Batch {
+                public:
+                    Batch() = default;
+                    Batch(const Batch &) = delete;
+                    Batch &operator=(const Batch &) = delete;
+
+                private:
+                    friend class JobSystem;
+
+                    std::atomic<std::size_t> m_pending{0};
+                    std::mutex m_error_mutex;
+                    std::exception_ptr m_error;
+            };
+
+            /**
+             * @brief Starts the worker threads
+             *
+             * @param workers Amount of worker threads (0 = run every job on the waiting thread)
+             */
+            explicit JobSystem(std::size_t workers)
+            {
+                m_queues.reserve(workers + 1);
+                for (std::size_t i = 0; i < workers + 1; i++)
+                    m_queues.push_back(std::make_unique<Queue>());
+                m_workers.reserve(workers);
+                for (std::size_t i = 0; i < workers; i++)
+                    m_workers.emplace_back([this, i]() { workerLoop(i + 1); });
+            }
+
+            ~JobSystem()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_sleep_mutex);
+                    m_stopping = true;
+                }
+                m_wakeup.notify_all();
+                for (auto &worker : m_workers)
+                    worker.join();
+            }
+
+            JobSystem(const JobSystem &) = delete;
+            JobSystem &operator=(const JobSystem &) = delete;
+
+            /**
+             * @brief Amount of worker threads (the waiting thread comes on top of them)
+             */
+            std::size_t workerCount() const
+            {
+                return m_workers.size();
+            }
+
+            /**
+             * @brief Queues a job belonging to 'batch'
+             *
+             * @param batch The batch to wait on, must outlive the job
+             * @param job The work to run, exceptions are rethrown by wait()
+             */
+            void submit(Batch &batch, std::function<void()> job)
+            {
+                batch.m_pending.fetch_add(1, std::memory_order_relaxed);
+                // Workers push to their own deque, other threads share queue 0
+                Queue &queue = *m_queues[t_worker_index < m_queues.size() ? t_worker_index : 0];
+                {
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    queue.jobs.push_back({std::move(job), &batch});
+                }
+                m_queued.fetch_add(1, std::memory_order_release);
+                // Taking the lock orders the increment with a worker about to sleep
+                { std::lock_guard<std::mutex> lock(m_sleep_mutex); }
+                m_wakeup.notify_one();
+            }
+
+            /**
+             * @brief Runs queued jobs on the calling thread until every job of 'batch' is done
+             *
+             * @throw The first exception thrown by one of the batch's jobs
+             */
+            void wait(Batch &batch)
+            {
+                while (batch.m_pending.load(std::memory_order_acquire) != 0) {
+                    if (!runOne(t_worker_index < m_queues.size() ? t_worker_index : 0))
+                        std::this_thread::yield();
+                }
+                if (batch.m_error) {
+                    std::exception_ptr error = batch.m_error;
+                    batch.m_error = nullptr;
+                    std::rethrow_exception(error);
+                }
+            }
+
+        private:
+            struct Job {
+                std::function<void()> fn;
+                Batch *batch;
+            };
+
+            struct Queue {
+                std::mutex mutex;
+                std::deque<Job> jobs;
+            };
+
+            // 0 for threads that aren't workers of this pool
+            inline static thread_local std::size_t t_worker_index = 0;
+
+            std::vector<std::unique_ptr<Queue>> m_queues;
+            std::vector<std::thread> m_workers;
+            std::atomic<std::size_t> m_queued{0};
+            std::mutex m_sleep_mutex;
+            std::condition_variable m_wakeup;
+            bool m_stopping = false;
+
+            void workerLoop(std::size_t index)
+            {
+                t_worker_index = index;
+                while (true) {
+                    if (runOne(index))
+                        continue;
+                    std::unique_lock<std::mutex> lock(m_sleep_mutex);
+                    m_wakeup.wait(lock, [this]() {
+                        return m_stopping || m_queued.load(std::memory_order_acquire) != 0;
+                    });
+                    if (m_stopping)
+                        return;
+                }
+            }
+
+            // Pops from the back of our own deque, otherwise steals from the front of another one
+            bool runOne(std::size_t self)
+            {
+                Job job;
+                if (!pop(*m_queues[self], job, true)) {
+                    bool stolen = false;
+                    for (std::size_t i = 1; i < m_queues.size() && !stolen; i++)
+                        stolen = pop(*m_queues[(self + i) % m_queues.size()], job, false);
+                    if (!stolen)
+                        return false;
+                }
+                m_queued.fetch_sub(1, std::memory_order_relaxed);
+                try {
+                    job.fn();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(job.batch->m_error_mutex);
+                    if (!job.batch->m_error)
+                        job.batch->m_error = std::current_exception();
+                }
+                job.batch->m_pending.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+
+            static bool pop(Queue &queue, Job &out, bool back)
+            {
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.jobs.empty())
+                    return false;
+                if (back) {
+                    out = std::move(queue.jobs.back());
+                    queue.jobs.pop_back();
+                } else {
+                    out = std::move(queue.jobs.front());
+                    queue.jobs.pop_front();
+                }
+                return true;
+            }
+    };
+}
+
+#endif /* !JOB_SYSTEM_HPP_ */
@@ -23,7 +23,10 @@
 #include <atomic>
 #include <cstdint>
 #include <vector>
-#include <array>
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <typeinfo>
 
 #include "Component.hpp"
 
@@ -32,13 +35,20 @@
 
 namespace ECS {
 
+    /**
+     * @brief Stores the component pools and the component signature of every entity
+     *
+     * Each registered component type gets a slot (its registration rank), pools are
+     * kept in a dense list indexed by slot and every entity owns a Signature where
+     * bit 'slot' is set when the component is attached. Checking a component is a
+     * bit test and disabling an entity only visits the pools it belongs to.
+     */
     class Registry {
         public:
             Registry() {}
             ~Registry() {
-                for (const auto &it : m_pool_list) {
-                    if (it != nullptr)
-                        delete it;
+                for (const auto &it : m_pools) {
+                    delete it;
                 }
             }
 
@@ -51,8 +61,8 @@ namespace ECS {
              * @param type_id The unique identifier for the component type to check.
              * @return true if the component type exists and has an associated pool, false otherwise.
              */
-            bool componentExists(uint16_t type_id) {
-                return m_pool_list[type_id] != nullptr;
+            bool componentExists(uint16_t type_id) const {
+                return type_id < m_slot_of.size() && m_slot_of[type_id] != NO_SLOT;
             }
 
             /**
@@ -66,7 +76,7 @@ namespace ECS {
              * @return true if a component of type T exists, false otherwise.
              */
             template <ComponentType T>
-            bool componentExists() {
+            bool componentExists() const {
                 uint16_t type_id = ComponentTypeId::get<T>();
                 return componentExists(type_id);
             }
@@ -77,14 +87,20 @@ namespace ECS {
              * @tparam T The type to register
              * @return true If the component has been registered successfully
              * @return false If the component was already registered
+             * @throw ERROR::TooManyComponentTypes => if MAX_COMPONENT_TYPES types are already registered
              */
             template <ComponentType T>
             bool registerComponent() {
                 if (componentExists<T>())
                     return false;
+                if (m_pools.size() >= MAX_COMPONENT_TYPES)
+                    throw ERROR::TooManyComponentTypes(typeid(T).name(), MAX_COMPONENT_TYPES);
 
                 uint16_t type_id = ComponentTypeId::get<T>();
-                m_pool_list[type_id] = static_cast<IComponentPool*>(new ComponentPool<T>());
+                if (type_id >= m_slot_of.size())
+                    m_slot_of.resize(type_id + 1, NO_SLOT);
+                m_slot_of[type_id] = static_cast<uint8_t>(m_pools.size());
+                m_pools.push_back(static_cast<IComponentPool*>(new ComponentPool<T>()));
                 return true;
             }
 
@@ -96,26 +112,103 @@ namespace ECS {
              */
             template <ComponentType T>
             ComponentPool<T> &getPool() {
-                if (!componentExists<T>())
+                return *(static_cast<ComponentPool<T>*>(m_pools[slotOf<T>()]));
+            }
+
+            /**
+             * @brief Returns the signature bit used for a component type
+             *
+             * @tparam T The component type
+             * @return std::size_t The slot of the component type
+             * @throw ERROR::UnregisteredComponent => if the component isn't registered
+             */
+            template <ComponentType T>
+            std::size_t slotOf() const {
+                uint16_t type_id = ComponentTypeId::get<T>();
+                if (!componentExists(type_id))
                     throw ERROR::UnregisteredComponent(typeid(T).name());
-                return *(static_cast<ComponentPool<T>*>(m_pool_list[ComponentTypeId::get<T>()]));
+                return m_slot_of[type_id];
+            }
+
+            /**
+             * @brief Checks if an entity has a component attached (a single bit test)
+             *
+             * @throw ERROR::UnregisteredComponent => if the component isn't registered
+             */
+            template <ComponentType T>
+            bool hasComponent(EntityID e) const {
+                std::size_t slot = slotOf<T>();
+                return entityIndex(e) < m_signatures.size() && m_signatures[entityIndex(e)].test(slot);
             }
 
             /**
-             * @brief Disables an entity from being computed
+             * @brief Adds a component to an entity and updates its signature
+             *
+             * @throw ERROR::UnregisteredComponent => if the component isn't registered
+             * @throw ERROR::ComponentAlreadyAttached => if the component is ALREADY attached to the entity
+             */
+            template <ComponentType T>
+            T &addComponent(EntityID e) {
+                std::size_t slot = slotOf<T>();
+                T &component = static_cast<ComponentPool<T>*>(m_pools[slot])->addComponent(e);
+                uint32_t index = entityIndex(e);
+                if (index >= m_signatures.size())
+                    m_signatures.resize(std::max<std::size_t>(index + 1, m_signatures.size() * 2));
+                m_signatures[index].set(slot);
+                return component;
+            }
+
+            /**
+             * @brief Removes a component from an entity and updates its signature
+             *
+             * @throw ERROR::UnregisteredComponent => if the component isn't registered
+             */
+            template <ComponentType T>
+            void removeComponent(EntityID e) {
+                std::size_t slot = slotOf<T>();
+                uint32_t index = entityIndex(e);
+                if (index >= m_signatures.size() || !m_signatures[index].test(slot))
+                    return;
+                static_cast<ComponentPool<T>*>(m_pools[slot])->removeComponent(e);
+                m_signatures[index].reset(slot);
+            }
+
+            /**
+             * @brief Returns the component signature of an entity (empty if it has no component)
+             */
+            const Signature &signature(EntityID e) const {
+                static const Signature empty;
+                return entityIndex(e) < m_signatures.size() ? m_signatures[entityIndex(e)] : empty;
+            }
+
+            /**
+             * @brief Returns every entity signature, indexed by entity index (may be shorter than the entity count)
+             */
+            const std::vector<Signature> &signatures() const {
+                return m_signatures;
+            }
+
+            /**
+             * @brief Disables an entity from being computed, only the pools it belongs to are visited
              * 
              * @param e Entity ID
              */
             void disableEntity(EntityID e) {
-                for (const auto &it : m_pool_list) {
-                    if (it != nullptr)
-                        it->disableEntity(e);
-                }
+                uint32_t index = entityIndex(e);
+                if (index >= m_signatures.size())
+                    return;
+                for (uint64_t bits = m_signatures[index].to_ullong(); bits != 0; bits &= bits - 1)
+                    m_pools[std::countr_zero(bits)]->disableEntity(e);
+                m_signatures[index].reset();
             }
 
         protected:
         private:
-            IComponentPool *m_pool_list[UINT16_MAX]{nullptr};
+            static constexpr uint8_t NO_SLOT = std::numeric_limits<uint8_t>::max();
+
+            std::vector<IComponentPool*> m_pools;       // Registered pools, indexed by slot
+            std::vector<uint8_t> m_slot_of;             // ComponentTypeId -> slot (NO_SLOT if unregistered)
+            std::vector<Signature> m_signatures;        // Entity index -> attached components
     };
 }
 
@@ -24,13 +24,69 @@
     #define SYSTEM_HPP_
 
 #include <cstdint>
+#include <algorithm>
+#include <vector>
 #include "Includes.hpp"  // For SystemID typedef
+#include "Component.hpp"
 
 namespace ECS {
 
     // Forward declaration to break circular dependency
     class ECS;
 
+    /**
+     * @brief Components a system reads and writes, used to decide which systems may run concurrently
+     *
+     * Two systems conflict when one writes a component the other one reads or
+     * writes, or when either of them is exclusive. Exclusive systems create or
+     * delete entities, add or remove components, or touch state shared outside
+     * the ECS: they never run alongside another system.
+     */
+    struct SystemAccess {
+        std::vector<uint16_t> reads;
+        std::vector<uint16_t> writes;
+        bool exclusive = false;
+
+        /**
+         * @brief Access of a system that may do anything (the default for systems that don't declare one)
+         */
+        static SystemAccess all()
+        {
+            SystemAccess access;
+            access.exclusive = true;
+            return access;
+        }
+
+        template<ComponentType... Ts>
+        SystemAccess &read()
+        {
+            (reads.push_back(ComponentTypeId::get<Ts>()), ...);
+            return *this;
+        }
+
+        template<ComponentType... Ts>
+        SystemAccess &write()
+        {
+            (writes.push_back(ComponentTypeId::get<Ts>()), ...);
+            return *this;
+        }
+
+        /**
+         * @brief Checks if two systems must not run at the same time
+         */
+        bool conflictsWith(const SystemAccess &other) const
+        {
+            auto overlaps = [](const std::vector<uint16_t> &a, const std::vector<uint16_t> &b) {
+                return std::any_of(a.begin(), a.end(), [&b](uint16_t id) {
+                    return std::find(b.begin(), b.end(), id) != b.end();
+                });
+            };
+            return exclusive || other.exclusive
+                || overlaps(writes, other.reads) || overlaps(writes, other.writes)
+                || overlaps(reads, other.writes);
+        }
+    };
+
     /**
      * @brief System Interface, every system should inherit from this class
      */
@@ -39,8 +95,29 @@ namespace ECS {
             virtual ~ISystem() = default;
 
             virtual void Update(ECS &, SystemID thisID, uint32_t msecs) = 0;
+
+            /**
+             * @brief Declares the components Update() reads and writes
+             *
+             * Queried once when the system is added. Systems that don't override it
+             * are exclusive and keep the strictly sequential behaviour.
+             */
+            virtual SystemAccess access() const { return SystemAccess::all(); }
         protected:
         private:
     };
+
+    /*
+        This is how a system is stored within the ECS
+        access and dependencies decide which systems share a parallel stage
+    */
+    struct SystemData {
+        bool enabled;
+        ISystem *sys;
+        int tickrate;
+        int skipped_ticks;
+        SystemAccess access;
+        std::vector<SystemID> dependencies;     // Systems this one must never overlap with
+    };
 }
 #endif /* !SYSTEM_HPP_ */
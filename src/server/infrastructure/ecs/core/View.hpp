@@ -0,0 +1,249 @@
+/*
+ *  View
+ *
+ *  Blob ECS is a lightweight Entity Component System library
+ *  Copyright (C) 2025 LECOCQ Guillaume
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+*/
+
+#ifndef VIEW_HPP_
+    #define VIEW_HPP_
+
+#include "Includes.hpp"
+#include "Component.hpp"
+#include "Archetype.hpp"
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+
+    /**
+     * @brief Non-owning range over every entity having all the components Ts
+     *
+     * Iterating yields std::tuple<EntityID, Ts&...>. Building and walking a view
+     * never allocates:
+     * - sparse-set storage walks the dense array of the smallest pool and skips
+     *   entities whose registry signature lacks one of the other components,
+     * - archetype storage walks the chunks of the cached matching archetypes.
+     *
+     * A view is only valid until the next structural change (entity creation,
+     * deletion, component add or remove). Systems that delete while iterating
+     * must collect the entities first.
+     *
+     * @tparam Ts The component types to fetch
+     */
+    template<ComponentType... Ts>
+    class View {
+        public:
+            using value_type = std::tuple<EntityID, Ts&...>;
+
+            class Iterator {
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = View::value_type;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = void;
+                    using reference = value_type;
+
+                    Iterator() = default;
+
+                    value_type operator*() const {
+                        if (m_view->m_archetypes == nullptr) {
+                            EntityID e = m_view->driverEntity(m_index);
+                            return value_type(e, std::get<ComponentPool<Ts>*>(m_view->m_pools)->getComponentUnchecked(e)...);
+                        }
+                        return derefArchetype(currentArchetype(), std::index_sequence_for<Ts...>{});
+                    }
+
+                    Iterator &operator++() {
+                        if (m_view->m_archetypes == nullptr) {
+                            m_index++;
+                            skipSparse();
+                        } else {
+                            m_row++;
+                            skipArchetype();
+                        }
+                        return *this;
+                    }
+
+                    Iterator operator++(int) {
+                        Iterator tmp = *this;
+                        ++(*this);
+                        return tmp;
+                    }
+
+                    bool operator==(const Iterator &other) const {
+                        return m_index == other.m_index && m_chunk == other.m_chunk && m_row == other.m_row;
+                    }
+
+                private:
+                    friend class View;
+
+                    const View *m_view = nullptr;
+                    std::size_t m_index = 0;    // Sparse: dense index in the driver pool, archetype: index in the matching list
+                    std::size_t m_chunk = 0;
+                    std::size_t m_row = 0;
+
+                    Iterator(const View *view, std::size_t index) : m_view(view), m_index(index) {
+                        if (m_view->m_archetypes == nullptr)
+                            skipSparse();
+                        else
+                            skipArchetype();
+                    }
+
+                    template<std::size_t... Is>
+                    value_type derefArchetype(Archetype &arch, std::index_sequence<Is...>) const {
+                        return value_type(arch.entities(m_chunk)[m_row],
+                            arch.template column<Ts>(m_chunk, m_view->m_slots[Is])[m_row]...);
+                    }
+
+                    Archetype &currentArchetype() const {
+                        return m_view->m_archetypes->archetype((*m_view->m_matching)[m_index]);
+                    }
+
+                    void skipSparse() {
+                        std::size_t size = m_view->driverSize();
+                        while (m_index < size && !m_view->matches(m_view->driverEntity(m_index)))
+                            m_index++;
+                    }
+
+                    void skipArchetype() {
+                        std::size_t size = m_view->m_matching->size();
+                        while (m_index < size) {
+                            Archetype &arch = currentArchetype();
+                            if (m_chunk < arch.chunkCount() && m_row < arch.chunkSize(m_chunk))
+                                return;
+                            if (m_chunk + 1 < arch.chunkCount() && arch.chunkSize(m_chunk + 1) > 0) {
+                                m_chunk++;
+                            } else {
+                                m_index++;
+                                m_chunk = 0;
+                            }
+                            m_row = 0;
+                        }
+                        m_chunk = 0;
+                        m_row = 0;
+                    }
+            };
+
+            /**
+             * @brief Construct an empty view (one of the components is not registered)
+             */
+            View() = default;
+
+            /**
+             * @brief Construct a view over sparse-set pools, the smallest pool drives the iteration
+             *
+             * @param signatures The registry's per-entity signatures
+             * @param query The signature bits of Ts
+             */
+            View(const std::vector<Signature> &signatures, const Signature &query, ComponentPool<Ts> *...pools)
+                : m_pools(pools...), m_signatures(&signatures), m_query(query) {
+                std::size_t sizes[] = {pools->size()...};
+                for (std::size_t i = 1; i < sizeof...(Ts); i++) {
+                    if (sizes[i] < sizes[m_driver])
+                        m_driver = i;
+                }
+            }
+
+            /**
+             * @brief Construct a view over the archetypes listed in 'matching'
+             */
+            View(ArchetypeStorage &storage, const std::vector<uint32_t> &matching)
+                : m_archetypes(&storage), m_matching(&matching), m_slots{storage.template slotIndex<Ts>()...} {}
+
+            Iterator begin() const {
+                if (isEmptyView())
+                    return Iterator();
+                return Iterator(this, 0);
+            }
+
+            Iterator end() const {
+                if (isEmptyView())
+                    return Iterator();
+                return Iterator(this, m_archetypes ? m_matching->size() : driverSize());
+            }
+
+            /**
+             * @brief Checks if no entity matches the view
+             */
+            bool empty() const {
+                return begin() == end();
+            }
+
+            /**
+             * @brief Sparse-set views only: amount of rows of the driving pool
+             *
+             * Rows [0, rowCount()) can be split between jobs with forEachInRows().
+             */
+            std::size_t rowCount() const {
+                return isEmptyView() || m_archetypes ? 0 : driverSize();
+            }
+
+            /**
+             * @brief Sparse-set views only: calls fn(EntityID, Ts&...) for the matching entities of rows [first, last)
+             */
+            template<typename Func>
+            void forEachInRows(std::size_t first, std::size_t last, Func &&fn) const {
+                for (std::size_t row = first; row < last; row++) {
+                    EntityID e = driverEntity(row);
+                    if (matches(e))
+                        fn(e, std::get<ComponentPool<Ts>*>(m_pools)->getComponentUnchecked(e)...);
+                }
+            }
+
+        private:
+            std::tuple<ComponentPool<Ts>*...> m_pools{};
+            std::size_t m_driver = 0;
+            const std::vector<Signature> *m_signatures = nullptr;
+            Signature m_query;
+            ArchetypeStorage *m_archetypes = nullptr;
+            const std::vector<uint32_t> *m_matching = nullptr;
+            std::array<std::size_t, sizeof...(Ts)> m_slots{};
+
+            bool isEmptyView() const {
+                return m_archetypes == nullptr && std::get<0>(m_pools) == nullptr;
+            }
+
+            std::size_t driverSize() const {
+                return driverDispatch([](auto *pool) { return pool->size(); },
+                    std::index_sequence_for<Ts...>{});
+            }
+
+            EntityID driverEntity(std::size_t index) const {
+                return driverDispatch([index](auto *pool) { return pool->entityAt(index); },
+                    std::index_sequence_for<Ts...>{});
+            }
+
+            bool matches(EntityID e) const {
+                return ((*m_signatures)[entityIndex(e)] & m_query) == m_query;
+            }
+
+            template<typename Func, std::size_t... Is>
+            auto driverDispatch(Func &&fn, std::index_sequence<Is...>) const {
+                decltype(fn(std::get<0>(m_pools))) result{};
+                ((m_driver == Is ? (result = fn(std::get<Is>(m_pools)), true) : false) || ...);
+                return result;
+            }
+    };
+}
+
+#endif /* !VIEW_HPP_ */
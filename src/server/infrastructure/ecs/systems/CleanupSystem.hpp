@@ -21,7 +21,7 @@ namespace infrastructure::ecs::systems {
      *
      * Checks if entities are fully outside screen bounds using DomainBridge.
      * Does NOT delete PLAYERS (players are handled differently).
-     * Uses deferred deletion to avoid modifying collections during iteration.
+     * Deletions are deferred to the end of the stage (ECS::entityDeleteDeferred).
      */
     class CleanupSystem : public ECS::ISystem {
     public:
@@ -36,11 +36,16 @@ namespace infrastructure::ecs::systems {
          * @brief Remove out-of-bounds entities.
          *
          * @param ecs The ECS instance
-         * @param thisID This system's ID (unused)
+         * @param thisID This system's ID (owner of the deferred deletions)
          * @param msecs Delta time in milliseconds (unused)
          */
         void Update(ECS::ECS& ecs, ECS::SystemID thisID, uint32_t msecs) override;
 
+        /**
+         * @brief Components touched by Update(), used by the parallel scheduler.
+         */
+        ECS::SystemAccess access() const override;
+
     private:
         bridge::DomainBridge& _bridge;
     };
@@ -9,88 +9,108 @@
 #include "core/ECS.hpp"
 #include "components/PositionComp.hpp"
 #include "components/HitboxComp.hpp"
+#include <algorithm>
 
 namespace infrastructure::ecs::systems {
 
     CollisionSystem::CollisionSystem(bridge::DomainBridge& bridge)
         : _bridge(bridge)
-    {}
+    {
+        // Sized for a busy wave so a steady-state frame doesn't allocate
+        _collisions.reserve(GROUP_CAPACITY);
+        for (std::size_t group = 0; group < ECS::MAX_ENTITY_GROUPS; group++) {
+            _entities[group].reserve(GROUP_CAPACITY);
+            _boxes[group].reserve(GROUP_CAPACITY);
+        }
+        _grid.reserve(GROUP_CAPACITY);
+        _hits.reserve(GROUP_CAPACITY);
+    }
+
+    ECS::SystemAccess CollisionSystem::access() const {
+        return ECS::SystemAccess()
+            .read<components::PositionComp, components::HitboxComp>();
+    }
 
     void CollisionSystem::Update(ECS::ECS& ecs, [[maybe_unused]] ECS::SystemID thisID, [[maybe_unused]] uint32_t msecs) {
         _collisions.clear();
+        _candidatePairs = 0;
 
-        // Fetch entity groups ONCE per frame (avoiding repeated lookups)
-        auto missiles = ecs.getEntityGroup(ECS::EntityGroup::MISSILES);
-        auto enemies = ecs.getEntityGroup(ECS::EntityGroup::ENEMIES);
-        auto players = ecs.getEntityGroup(ECS::EntityGroup::PLAYERS);
-        auto enemyMissiles = ecs.getEntityGroup(ECS::EntityGroup::ENEMY_MISSILES);
-        auto waveCannons = ecs.getEntityGroup(ECS::EntityGroup::WAVE_CANNONS);
-        auto forcePods = ecs.getEntityGroup(ECS::EntityGroup::FORCE_PODS);
+        // Gather each group's boxes ONCE per frame (avoiding per-pair lookups)
+        gatherBoxes(ecs, ECS::EntityGroup::MISSILES);
+        gatherBoxes(ecs, ECS::EntityGroup::ENEMIES);
+        gatherBoxes(ecs, ECS::EntityGroup::PLAYERS);
+        gatherBoxes(ecs, ECS::EntityGroup::ENEMY_MISSILES);
+        gatherBoxes(ecs, ECS::EntityGroup::WAVE_CANNONS);
+        gatherBoxes(ecs, ECS::EntityGroup::FORCE_PODS);
+        gatherBoxes(ecs, ECS::EntityGroup::POWERUPS);
 
         // Only check RELEVANT collision pairs (like legacy GameWorld)
         // This avoids checking missiles vs missiles, enemies vs enemies, etc.
 
         // 1. MISSILES vs ENEMIES → Enemy takes damage
-        checkPairs(ecs, missiles, enemies,
-                   ECS::EntityGroup::MISSILES, ECS::EntityGroup::ENEMIES);
+        checkPairs(ECS::EntityGroup::MISSILES, ECS::EntityGroup::ENEMIES);
 
         // 2. WAVE_CANNONS vs ENEMIES → Enemy takes damage (wave cannon persists)
-        checkPairs(ecs, waveCannons, enemies,
-                   ECS::EntityGroup::WAVE_CANNONS, ECS::EntityGroup::ENEMIES);
+        checkPairs(ECS::EntityGroup::WAVE_CANNONS, ECS::EntityGroup::ENEMIES);
 
         // 3. PLAYERS vs ENEMY_MISSILES → Player takes damage
-        checkPairs(ecs, players, enemyMissiles,
-                   ECS::EntityGroup::PLAYERS, ECS::EntityGroup::ENEMY_MISSILES);
+        checkPairs(ECS::EntityGroup::PLAYERS, ECS::EntityGroup::ENEMY_MISSILES);
 
         // 4. FORCE_PODS vs ENEMIES → Enemy takes contact damage
-        checkPairs(ecs, forcePods, enemies,
-                   ECS::EntityGroup::FORCE_PODS, ECS::EntityGroup::ENEMIES);
+        checkPairs(ECS::EntityGroup::FORCE_PODS, ECS::EntityGroup::ENEMIES);
 
         // 5. PLAYERS vs POWERUPS → Player collects power-up
-        auto powerups = ecs.getEntityGroup(ECS::EntityGroup::POWERUPS);
-        checkPairs(ecs, players, powerups,
-                   ECS::EntityGroup::PLAYERS, ECS::EntityGroup::POWERUPS);
+        checkPairs(ECS::EntityGroup::PLAYERS, ECS::EntityGroup::POWERUPS);
     }
 
-    void CollisionSystem::checkPairs(ECS::ECS& ecs,
-                                     const std::vector<ECS::EntityID>& groupA,
-                                     const std::vector<ECS::EntityID>& groupB,
-                                     ECS::EntityGroup typeA,
-                                     ECS::EntityGroup typeB) {
-        for (auto entityA : groupA) {
-            // Skip if entity was deleted or doesn't have required components
-            if (!ecs.entityIsActive(entityA) ||
-                !ecs.entityHasComponent<components::PositionComp>(entityA) ||
-                !ecs.entityHasComponent<components::HitboxComp>(entityA)) {
+    void CollisionSystem::gatherBoxes(ECS::ECS& ecs, ECS::EntityGroup group) {
+        auto& entities = _entities[group];
+        auto& boxes = _boxes[group];
+        entities.clear();
+        boxes.clear();
+
+        // Group caches only hold active entities, no need to re-check activity
+        for (auto entity : ecs.getEntityGroup(group)) {
+            if (!ecs.entityHasComponent<components::PositionComp>(entity) ||
+                !ecs.entityHasComponent<components::HitboxComp>(entity)) {
                 continue;
             }
 
-            const auto& posA = ecs.entityGetComponent<components::PositionComp>(entityA);
-            const auto& hitboxA = ecs.entityGetComponent<components::HitboxComp>(entityA);
-
-            float x1 = posA.x + hitboxA.offsetX;
-            float y1 = posA.y + hitboxA.offsetY;
-
-            for (auto entityB : groupB) {
-                // Skip if entity was deleted or doesn't have required components
-                if (!ecs.entityIsActive(entityB) ||
-                    !ecs.entityHasComponent<components::PositionComp>(entityB) ||
-                    !ecs.entityHasComponent<components::HitboxComp>(entityB)) {
-                    continue;
-                }
+            const auto& pos = ecs.entityGetComponent<components::PositionComp>(entity);
+            const auto& hitbox = ecs.entityGetComponent<components::HitboxComp>(entity);
+            entities.push_back(entity);
+            boxes.push({pos.x + hitbox.offsetX, pos.y + hitbox.offsetY,
+                        hitbox.width, hitbox.height});
+        }
+    }
 
-                const auto& posB = ecs.entityGetComponent<components::PositionComp>(entityB);
-                const auto& hitboxB = ecs.entityGetComponent<components::HitboxComp>(entityB);
+    void CollisionSystem::checkPairs(ECS::EntityGroup typeA, ECS::EntityGroup typeB) {
+        const collision::AABBArrays boxesA = _boxes[typeA].arrays();
+        const collision::AABBArrays boxesB = _boxes[typeB].arrays();
+        if (boxesA.count == 0 || boxesB.count == 0) {
+            return;
+        }
 
-                float x2 = posB.x + hitboxB.offsetX;
-                float y2 = posB.y + hitboxB.offsetY;
+        // Few A boxes (players, force pods): a SIMD sweep over B beats building the grid
+        if (boxesA.count <= SIMD_SWEEP_MAX) {
+            collision::forEachIntersectingPair(boxesA, boxesB, [&](uint32_t a, uint32_t b) {
+                _collisions.push_back({_entities[typeA][a], _entities[typeB][b], typeA, typeB});
+            });
+            _candidatePairs += boxesA.count * boxesB.count;
+            return;
+        }
 
-                if (_bridge.checkCollision(x1, y1, hitboxA.width, hitboxA.height,
-                                          x2, y2, hitboxB.width, hitboxB.height)) {
-                    _collisions.push_back({entityA, entityB, typeA, typeB});
-                }
+        _grid.build(boxesB);
+        for (std::size_t a = 0; a < boxesA.count; ++a) {
+            _hits.clear();
+            _grid.query(boxesA.at(a), [this](uint32_t b) { _hits.push_back(b); });
+            // The grid reports hits in cell order, keep the group order instead
+            std::sort(_hits.begin(), _hits.end());
+            for (uint32_t b : _hits) {
+                _collisions.push_back({_entities[typeA][a], _entities[typeB][b], typeA, typeB});
             }
         }
+        _candidatePairs += _grid.candidateCount();
     }
 
     const std::vector<CollisionEvent>& CollisionSystem::getCollisions() const {
@@ -101,4 +121,8 @@ namespace infrastructure::ecs::systems {
         _collisions.clear();
     }
 
+    std::size_t CollisionSystem::getCandidatePairCount() const {
+        return _candidatePairs;
+    }
+
 }  // namespace infrastructure::ecs::systems
@@ -8,8 +8,10 @@
 #ifndef COLLISION_SYSTEM_HPP_
 #define COLLISION_SYSTEM_HPP_
 
-#include "core/System.hpp"
+#include "core/ECS.hpp"
 #include "bridge/DomainBridge.hpp"
+#include "collision/SpatialGrid.hpp"
+#include "collision/AABBBatch.hpp"
 #include <vector>
 
 namespace infrastructure::ecs::systems {
@@ -39,7 +41,10 @@ namespace infrastructure::ecs::systems {
      * - PLAYERS vs POWERUPS
      *
      * This reduces comparisons from n*(n-1)/2 to only meaningful pairs.
-     * Entity groups are fetched once per frame, avoiding repeated lookups.
+     * Each group's boxes are gathered once per frame into a contiguous array,
+     * so the pair loops never go back to the component storage. Every pair of
+     * groups then goes through a uniform grid broadphase (collision::SpatialGrid),
+     * so the cost grows with the amount of nearby boxes instead of N×M.
      */
     class CollisionSystem : public ECS::ISystem {
     public:
@@ -59,6 +64,11 @@ namespace infrastructure::ecs::systems {
          */
         void Update(ECS::ECS& ecs, ECS::SystemID thisID, uint32_t msecs) override;
 
+        /**
+         * @brief Components touched by Update(), used by the parallel scheduler.
+         */
+        ECS::SystemAccess access() const override;
+
         /**
          * @brief Get the list of collisions detected this frame.
          * @return Vector of collision events (cleared on next Update)
@@ -70,24 +80,45 @@ namespace infrastructure::ecs::systems {
          */
         void clearCollisions();
 
+        /**
+         * @brief Box pairs that reached the narrowphase during the last Update.
+         */
+        std::size_t getCandidatePairCount() const;
+
     private:
         bridge::DomainBridge& _bridge;
         std::vector<CollisionEvent> _collisions;
 
+        // World-space hitboxes gathered once per frame, indexed by EntityGroup (reused every frame)
+        std::vector<ECS::EntityID> _entities[ECS::MAX_ENTITY_GROUPS];
+        collision::AABBBatch _boxes[ECS::MAX_ENTITY_GROUPS];
+
+        // Initial capacity of the per-group buffers
+        static constexpr std::size_t GROUP_CAPACITY = 128;
+
+        // Up to this many A boxes, checkPairs() sweeps B with the batch kernel instead of the grid
+        static constexpr std::size_t SIMD_SWEEP_MAX = 8;
+
+        collision::SpatialGrid _grid;
+        std::vector<uint32_t> _hits;
+        std::size_t _candidatePairs = 0;
+
+        /**
+         * @brief Gather the boxes of every entity of a group having Position and Hitbox.
+         *
+         * Keeps the group order so collision events stay deterministic.
+         */
+        void gatherBoxes(ECS::ECS& ecs, ECS::EntityGroup group);
+
         /**
          * @brief Check collisions between two groups of entities.
          *
-         * @param ecs The ECS instance
-         * @param groupA First group of entity IDs
-         * @param groupB Second group of entity IDs
-         * @param typeA EntityGroup type for groupA
-         * @param typeB EntityGroup type for groupB
+         * Events are emitted in (A order, B order), like a nested loop would.
+         *
+         * @param typeA EntityGroup of the first gathered group
+         * @param typeB EntityGroup of the second gathered group (indexed in the grid)
          */
-        void checkPairs(ECS::ECS& ecs,
-                        const std::vector<ECS::EntityID>& groupA,
-                        const std::vector<ECS::EntityID>& groupB,
-                        ECS::EntityGroup typeA,
-                        ECS::EntityGroup typeB);
+        void checkPairs(ECS::EntityGroup typeA, ECS::EntityGroup typeB);
     };
 
 }  // namespace infrastructure::ecs::systems
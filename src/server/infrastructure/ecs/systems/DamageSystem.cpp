@@ -11,6 +11,7 @@
 #include "components/MissileTag.hpp"
 #include "components/EnemyTag.hpp"
 #include "components/OwnerComp.hpp"
+#include "components/PositionComp.hpp"
 #include "components/WaveCannonTag.hpp"
 #include <vector>
 #include <algorithm>
@@ -28,7 +29,7 @@ namespace infrastructure::ecs::systems {
         std::vector<ECS::EntityID> toDelete;
 
         for (const auto& collision : collisions) {
-            // Skip if either entity was already deleted this frame
+            // Skip if either entity was already deleted this frame (stale handles fail the generation check)
             if (!ecs.entityIsActive(collision.entityA) || !ecs.entityIsActive(collision.entityB)) {
                 continue;
             }
@@ -80,20 +81,7 @@ namespace infrastructure::ecs::systems {
             auto result = _bridge.applyDamage(health, damage);
 
             if (result.died) {
-                // Record kill event
-                KillEvent kill;
-                kill.killerEntity = missile;
-                kill.killedEntity = enemy;
-                kill.killerPlayerId = getOwnerPlayerId(ecs, missile);
-                if (ecs.entityHasComponent<components::EnemyTag>(enemy)) {
-                    auto& enemyTag = ecs.entityGetComponent<components::EnemyTag>(enemy);
-                    kill.killedType = enemyTag.type;
-                    kill.basePoints = enemyTag.points;
-                } else {
-                    kill.killedType = 0;
-                    kill.basePoints = 100;
-                }
-                _killEvents.push_back(kill);
+                recordKill(ecs, missile, enemy);
 
                 // Delete enemy
                 ecs.entityDelete(enemy);
@@ -132,19 +120,7 @@ namespace infrastructure::ecs::systems {
             auto result = _bridge.applyDamage(health, damage);
 
             if (result.died) {
-                KillEvent kill;
-                kill.killerEntity = waveCannon;
-                kill.killedEntity = enemy;
-                kill.killerPlayerId = getOwnerPlayerId(ecs, waveCannon);
-                if (ecs.entityHasComponent<components::EnemyTag>(enemy)) {
-                    auto& enemyTag = ecs.entityGetComponent<components::EnemyTag>(enemy);
-                    kill.killedType = enemyTag.type;
-                    kill.basePoints = enemyTag.points;
-                } else {
-                    kill.killedType = 0;
-                    kill.basePoints = 100;
-                }
-                _killEvents.push_back(kill);
+                recordKill(ecs, waveCannon, enemy);
 
                 ecs.entityDelete(enemy);
             }
@@ -213,19 +189,7 @@ namespace infrastructure::ecs::systems {
             auto result = _bridge.applyDamage(health, FORCE_CONTACT_DAMAGE);
 
             if (result.died) {
-                KillEvent kill;
-                kill.killerEntity = forcePod;
-                kill.killedEntity = enemy;
-                kill.killerPlayerId = getOwnerPlayerId(ecs, forcePod);
-                if (ecs.entityHasComponent<components::EnemyTag>(enemy)) {
-                    auto& enemyTag = ecs.entityGetComponent<components::EnemyTag>(enemy);
-                    kill.killedType = enemyTag.type;
-                    kill.basePoints = enemyTag.points;
-                } else {
-                    kill.killedType = 0;
-                    kill.basePoints = 100;
-                }
-                _killEvents.push_back(kill);
+                recordKill(ecs, forcePod, enemy);
 
                 ecs.entityDelete(enemy);
             }
@@ -240,6 +204,27 @@ namespace infrastructure::ecs::systems {
         // These collisions are ignored
     }
 
+    void DamageSystem::recordKill(ECS::ECS& ecs, ECS::EntityID killer, ECS::EntityID enemy) {
+        KillEvent kill;
+        kill.killerEntity = killer;
+        kill.killedEntity = enemy;
+        kill.killerPlayerId = getOwnerPlayerId(ecs, killer);
+        if (ecs.entityHasComponent<components::EnemyTag>(enemy)) {
+            auto& enemyTag = ecs.entityGetComponent<components::EnemyTag>(enemy);
+            kill.killedType = enemyTag.type;
+            kill.basePoints = enemyTag.points;
+        } else {
+            kill.killedType = 0;
+            kill.basePoints = 100;
+        }
+        if (ecs.entityHasComponent<components::PositionComp>(enemy)) {
+            auto& pos = ecs.entityGetComponent<components::PositionComp>(enemy);
+            kill.x = pos.x;
+            kill.y = pos.y;
+        }
+        _killEvents.push_back(kill);
+    }
+
     uint8_t DamageSystem::getMissileDamage(ECS::ECS& ecs, ECS::EntityID missile) {
         if (ecs.entityHasComponent<components::MissileTag>(missile)) {
             return ecs.entityGetComponent<components::MissileTag>(missile).baseDamage;
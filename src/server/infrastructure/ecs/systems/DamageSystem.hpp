@@ -24,6 +24,8 @@ namespace infrastructure::ecs::systems {
         uint8_t killerPlayerId;      // Player ID who gets the points (from OwnerComp)
         uint8_t killedType;          // EnemyTag::type or similar
         uint16_t basePoints;         // Base score value
+        float x = 0.0f;              // Position of the killed entity when it died
+        float y = 0.0f;
     };
 
     /**
@@ -82,6 +84,11 @@ namespace infrastructure::ecs::systems {
          */
         void processCollision(ECS::ECS& ecs, const CollisionEvent& collision);
 
+        /**
+         * @brief Record that 'killer' killed 'enemy' (read before 'enemy' is deleted).
+         */
+        void recordKill(ECS::ECS& ecs, ECS::EntityID killer, ECS::EntityID enemy);
+
         /**
          * @brief Get missile damage from MissileTag component.
          */
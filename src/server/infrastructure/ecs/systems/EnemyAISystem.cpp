@@ -24,35 +24,44 @@ namespace infrastructure::ecs::systems {
     // Enemy missile spawn offset
     constexpr float MISSILE_SPAWN_OFFSET_X = -30.0f;  // Spawn in front (left) of enemy
 
+    // Initial capacity of the per-frame buffers
+    constexpr std::size_t MISSILE_REQUEST_CAPACITY = 32;
+    constexpr std::size_t PLAYER_CAPACITY = 4;
+
     EnemyAISystem::EnemyAISystem(bridge::DomainBridge& bridge)
         : _bridge(bridge)
-    {}
+    {
+        // Sized for a busy wave so a steady-state frame doesn't allocate
+        _missileRequests.reserve(MISSILE_REQUEST_CAPACITY);
+        _playerPositions.reserve(PLAYER_CAPACITY);
+    }
+
+    ECS::SystemAccess EnemyAISystem::access() const {
+        return ECS::SystemAccess()
+            .read<components::PlayerTag, components::EnemyTag>()
+            .write<components::EnemyAIComp, components::PositionComp, components::VelocityComp>();
+    }
 
     void EnemyAISystem::Update(ECS::ECS& ecs, [[maybe_unused]] ECS::SystemID thisID, uint32_t msecs) {
         float deltaTime = static_cast<float>(msecs) / 1000.0f;
 
         // Update player positions for tracker targeting
         _playerPositions.clear();
-        auto players = ecs.getEntitiesByComponentsAllOf<components::PlayerTag, components::PositionComp>();
-        for (auto playerEntity : players) {
-            const auto& pos = ecs.entityGetComponent<components::PositionComp>(playerEntity);
-            _playerPositions.push_back({0, pos.x, pos.y});  // playerId not needed for targeting
-        }
-
-        // Get all enemies
-        auto enemies = ecs.getEntitiesByComponentsAllOf<
-            components::EnemyTag,
-            components::EnemyAIComp,
-            components::PositionComp
-        >();
+        ecs.forEach<components::PlayerTag, components::PositionComp>(
+            [this](ECS::EntityID, const components::PlayerTag&, const components::PositionComp& pos) {
+                _playerPositions.push_back({0, pos.x, pos.y});  // playerId not needed for targeting
+            });
 
-        for (auto entityId : enemies) {
-            // Update movement
-            updateEnemyMovement(ecs, entityId, deltaTime);
+        // Iterate all enemies (no entity is created/deleted here, spawns are queued as requests)
+        ecs.forEach<components::EnemyTag, components::EnemyAIComp, components::PositionComp>(
+            [this, &ecs, deltaTime](ECS::EntityID entityId, const components::EnemyTag& tag,
+                                    components::EnemyAIComp& ai, components::PositionComp& pos) {
+                // Update movement
+                updateEnemyMovement(ecs, entityId, tag, ai, pos, deltaTime);
 
-            // Update shooting
-            updateEnemyShooting(ecs, entityId, deltaTime);
-        }
+                // Update shooting
+                updateEnemyShooting(tag, ai, pos, deltaTime);
+            });
     }
 
     std::vector<EnemyMissileRequest> EnemyAISystem::getMissileRequests() {
@@ -97,11 +106,9 @@ namespace infrastructure::ecs::systems {
         return nearestY;
     }
 
-    void EnemyAISystem::updateEnemyMovement(ECS::ECS& ecs, ECS::EntityID entityId, float deltaTime) {
-        const auto& tag = ecs.entityGetComponent<components::EnemyTag>(entityId);
-        auto& ai = ecs.entityGetComponent<components::EnemyAIComp>(entityId);
-        auto& pos = ecs.entityGetComponent<components::PositionComp>(entityId);
-
+    void EnemyAISystem::updateEnemyMovement(ECS::ECS& ecs, ECS::EntityID entityId,
+                                            const components::EnemyTag& tag, components::EnemyAIComp& ai,
+                                            components::PositionComp& pos, float deltaTime) {
         // Update alive time
         ai.aliveTime += deltaTime;
 
@@ -157,11 +164,8 @@ namespace infrastructure::ecs::systems {
         }
     }
 
-    void EnemyAISystem::updateEnemyShooting(ECS::ECS& ecs, ECS::EntityID entityId, float deltaTime) {
-        const auto& tag = ecs.entityGetComponent<components::EnemyTag>(entityId);
-        auto& ai = ecs.entityGetComponent<components::EnemyAIComp>(entityId);
-        const auto& pos = ecs.entityGetComponent<components::PositionComp>(entityId);
-
+    void EnemyAISystem::updateEnemyShooting(const components::EnemyTag& tag, components::EnemyAIComp& ai,
+                                            const components::PositionComp& pos, float deltaTime) {
         // Decrement shoot cooldown
         ai.shootCooldown -= deltaTime;
 
@@ -10,6 +10,9 @@
 
 #include "core/System.hpp"
 #include "bridge/DomainBridge.hpp"
+#include "components/EnemyTag.hpp"
+#include "components/EnemyAIComp.hpp"
+#include "components/PositionComp.hpp"
 #include <cstdint>
 #include <vector>
 #include <functional>
@@ -52,6 +55,11 @@ namespace infrastructure::ecs::systems {
          */
         void Update(ECS::ECS& ecs, ECS::SystemID thisID, uint32_t msecs) override;
 
+        /**
+         * @brief Components touched by Update(), used by the parallel scheduler.
+         */
+        ECS::SystemAccess access() const override;
+
         /**
          * @brief Get pending missile spawn requests (for WeaponSystem or GameWorld).
          * @return Vector of missile requests
@@ -92,13 +100,18 @@ namespace infrastructure::ecs::systems {
 
         /**
          * @brief Update movement for a single enemy.
+         *
+         * Components are passed in by the query so the hot loop does no lookups.
          */
-        void updateEnemyMovement(ECS::ECS& ecs, ECS::EntityID entityId, float deltaTime);
+        void updateEnemyMovement(ECS::ECS& ecs, ECS::EntityID entityId,
+                                 const components::EnemyTag& tag, components::EnemyAIComp& ai,
+                                 components::PositionComp& pos, float deltaTime);
 
         /**
          * @brief Update shooting for a single enemy.
          */
-        void updateEnemyShooting(ECS::ECS& ecs, ECS::EntityID entityId, float deltaTime);
+        void updateEnemyShooting(const components::EnemyTag& tag, components::EnemyAIComp& ai,
+                                 const components::PositionComp& pos, float deltaTime);
     };
 
 }  // namespace infrastructure::ecs::systems
@@ -20,7 +20,7 @@ namespace infrastructure::ecs::systems {
      *
      * Decrements LifetimeComp::remaining by deltaTime.
      * When remaining <= 0, the entity is deleted.
-     * Uses deferred deletion to avoid modifying collections during iteration.
+     * Deletions are deferred to the end of the stage (ECS::entityDeleteDeferred).
      */
     class LifetimeSystem : public ECS::ISystem {
     public:
@@ -31,10 +31,16 @@ namespace infrastructure::ecs::systems {
          * @brief Update all entities with Lifetime components.
          *
          * @param ecs The ECS instance
-         * @param thisID This system's ID (unused)
+         * @param thisID This system's ID (owner of the deferred deletions)
          * @param msecs Delta time in milliseconds
          */
         void Update(ECS::ECS& ecs, ECS::SystemID thisID, uint32_t msecs) override;
+
+        /**
+         * @brief Components touched by Update(), used by the parallel scheduler.
+         */
+        ECS::SystemAccess access() const override;
+
     };
 
 }  // namespace infrastructure::ecs::systems
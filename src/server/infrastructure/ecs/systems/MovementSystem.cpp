@@ -12,24 +12,25 @@
 
 namespace infrastructure::ecs::systems {
 
+    ECS::SystemAccess MovementSystem::access() const {
+        return ECS::SystemAccess()
+            .read<components::VelocityComp>()
+            .write<components::PositionComp>();
+    }
+
     void MovementSystem::Update(ECS::ECS& ecs, [[maybe_unused]] ECS::SystemID thisID, uint32_t msecs) {
         // Convert milliseconds to seconds for physics calculations
         float deltaTime = static_cast<float>(msecs) / 1000.0f;
 
-        // Query all entities with both Position and Velocity components
-        auto entities = ecs.getEntitiesByComponentsAllOf<
-            components::PositionComp,
-            components::VelocityComp
-        >();
-
-        // Update positions based on velocity
-        for (auto entityId : entities) {
-            auto& pos = ecs.entityGetComponent<components::PositionComp>(entityId);
-            const auto& vel = ecs.entityGetComponent<components::VelocityComp>(entityId);
-
-            pos.x += vel.x * deltaTime;
-            pos.y += vel.y * deltaTime;
-        }
+        // Walk Position/Velocity columns chunk by chunk (contiguous with archetype storage)
+        ecs.forEachChunk<components::PositionComp, components::VelocityComp>(
+            [deltaTime](std::size_t count, [[maybe_unused]] const ECS::EntityID* entities,
+                        components::PositionComp* pos, const components::VelocityComp* vel) {
+                for (std::size_t i = 0; i < count; i++) {
+                    pos[i].x += vel[i].x * deltaTime;
+                    pos[i].y += vel[i].y * deltaTime;
+                }
+            });
     }
 
 }  // namespace infrastructure::ecs::systems
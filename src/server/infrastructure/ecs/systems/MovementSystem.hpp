@@ -34,6 +34,11 @@ namespace infrastructure::ecs::systems {
          * @param msecs Delta time in milliseconds
          */
         void Update(ECS::ECS& ecs, ECS::SystemID thisID, uint32_t msecs) override;
+
+        /**
+         * @brief Components touched by Update(), used by the parallel scheduler.
+         */
+        ECS::SystemAccess access() const override;
     };
 
 }  // namespace infrastructure::ecs::systems
@@ -19,6 +19,12 @@ namespace infrastructure::ecs::systems {
         : _bridge(bridge)
     {}
 
+    ECS::SystemAccess PlayerInputSystem::access() const {
+        return ECS::SystemAccess()
+            .read<components::PlayerTag, components::HitboxComp, components::SpeedLevelComp>()
+            .write<components::VelocityComp, components::PositionComp>();
+    }
+
     void PlayerInputSystem::Update(ECS::ECS& ecs, [[maybe_unused]] ECS::SystemID thisID, [[maybe_unused]] uint32_t msecs) {
         // Process all pending inputs
         while (!_inputQueue.empty()) {
@@ -28,13 +34,7 @@ namespace infrastructure::ecs::systems {
 
         // Clamp all player positions to screen bounds
         if (_clampEnabled) {
-            auto players = ecs.getEntitiesByComponentsAllOf<
-                components::PlayerTag,
-                components::PositionComp
-            >();
-
-            for (auto entityId : players) {
-                auto& pos = ecs.entityGetComponent<components::PositionComp>(entityId);
+            for (auto [entityId, tag, pos] : ecs.view<components::PlayerTag, components::PositionComp>()) {
 
                 // Get hitbox dimensions if available
                 float width = 50.0f;   // Default player width
@@ -65,10 +65,7 @@ namespace infrastructure::ecs::systems {
     }
 
     std::optional<ECS::EntityID> PlayerInputSystem::findPlayerByID(ECS::ECS& ecs, uint8_t playerId) {
-        auto players = ecs.getEntitiesByComponentsAllOf<components::PlayerTag>();
-
-        for (auto entityId : players) {
-            const auto& tag = ecs.entityGetComponent<components::PlayerTag>(entityId);
+        for (auto [entityId, tag] : ecs.view<components::PlayerTag>()) {
             if (tag.playerId == playerId) {
                 return entityId;
             }
@@ -65,6 +65,11 @@ namespace infrastructure::ecs::systems {
          */
         void Update(ECS::ECS& ecs, ECS::SystemID thisID, uint32_t msecs) override;
 
+        /**
+         * @brief Components touched by Update(), used by the parallel scheduler.
+         */
+        ECS::SystemAccess access() const override;
+
         /**
          * @brief Queue an input event for processing.
          * @param event The input event to process
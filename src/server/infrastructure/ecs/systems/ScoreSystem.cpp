@@ -16,6 +16,12 @@ namespace infrastructure::ecs::systems {
         : _bridge(bridge)
     {}
 
+    ECS::SystemAccess ScoreSystem::access() const {
+        return ECS::SystemAccess()
+            .read<components::PlayerTag>()
+            .write<components::ScoreComp>();
+    }
+
     void ScoreSystem::Update(ECS::ECS& ecs, [[maybe_unused]] ECS::SystemID thisID, uint32_t msecs) {
         float deltaTime = static_cast<float>(msecs) / 1000.0f;
 
@@ -59,10 +65,7 @@ namespace infrastructure::ecs::systems {
     }
 
     std::optional<ECS::EntityID> ScoreSystem::findPlayerByID(ECS::ECS& ecs, uint8_t playerId) {
-        auto players = ecs.getEntitiesByComponentsAllOf<components::PlayerTag>();
-
-        for (auto entityId : players) {
-            const auto& tag = ecs.entityGetComponent<components::PlayerTag>(entityId);
+        for (auto [entityId, tag] : ecs.view<components::PlayerTag>()) {
             if (tag.playerId == playerId) {
                 return entityId;
             }
@@ -71,15 +74,9 @@ namespace infrastructure::ecs::systems {
     }
 
     void ScoreSystem::updateComboDecay(ECS::ECS& ecs, float deltaTime) {
-        auto players = ecs.getEntitiesByComponentsAllOf<
-            components::PlayerTag,
-            components::ScoreComp
-        >();
-
         float graceTime = _bridge.getComboGraceTime();
 
-        for (auto entityId : players) {
-            auto& score = ecs.entityGetComponent<components::ScoreComp>(entityId);
+        for (auto [entityId, tag, score] : ecs.view<components::PlayerTag, components::ScoreComp>()) {
 
             // Update combo timer
             score.comboTimer += deltaTime;
@@ -64,6 +64,11 @@ namespace infrastructure::ecs::systems {
          */
         void Update(ECS::ECS& ecs, ECS::SystemID thisID, uint32_t msecs) override;
 
+        /**
+         * @brief Components touched by Update(), used by the parallel scheduler.
+         */
+        ECS::SystemAccess access() const override;
+
         /**
          * @brief Queue a kill event to award points.
          * @param event The kill score event
@@ -111,10 +111,7 @@ namespace infrastructure::ecs::systems {
     }
 
     std::optional<ECS::EntityID> WeaponSystem::findPlayerByID(ECS::ECS& ecs, uint8_t playerId) {
-        auto players = ecs.getEntitiesByComponentsAllOf<components::PlayerTag>();
-
-        for (auto entityId : players) {
-            const auto& tag = ecs.entityGetComponent<components::PlayerTag>(entityId);
+        for (auto [entityId, tag] : ecs.view<components::PlayerTag>()) {
             if (tag.playerId == playerId) {
                 return entityId;
             }
@@ -123,13 +120,7 @@ namespace infrastructure::ecs::systems {
     }
 
     void WeaponSystem::updateCooldowns(ECS::ECS& ecs, float deltaTime) {
-        auto players = ecs.getEntitiesByComponentsAllOf<
-            components::PlayerTag,
-            components::WeaponComp
-        >();
-
-        for (auto entityId : players) {
-            auto& weapon = ecs.entityGetComponent<components::WeaponComp>(entityId);
+        for (auto [entityId, tag, weapon] : ecs.view<components::PlayerTag, components::WeaponComp>()) {
             if (weapon.shootCooldown > 0.0f) {
                 weapon.shootCooldown -= deltaTime;
                 if (weapon.shootCooldown < 0.0f) {
@@ -140,13 +131,7 @@ namespace infrastructure::ecs::systems {
     }
 
     void WeaponSystem::updateChargeTimes(ECS::ECS& ecs, float deltaTime) {
-        auto players = ecs.getEntitiesByComponentsAllOf<
-            components::PlayerTag,
-            components::WeaponComp
-        >();
-
-        for (auto entityId : players) {
-            auto& weapon = ecs.entityGetComponent<components::WeaponComp>(entityId);
+        for (auto [entityId, tag, weapon] : ecs.view<components::PlayerTag, components::WeaponComp>()) {
             if (weapon.isCharging) {
                 weapon.chargeTime += deltaTime;
             }
@@ -378,13 +363,15 @@ namespace infrastructure::ecs::systems {
                 tag.width = WaveCannon::WIDTH_LV3;
                 break;
         }
+        // Copy before adding more components (references don't survive archetype moves)
+        float beamWidth = tag.width;
 
         // Hitbox (width varies by charge level)
         auto& hitbox = ecs.entityAddComponent<components::HitboxComp>(entity);
         hitbox.width = 100.0f;  // Beam is long
-        hitbox.height = tag.width;  // Height based on charge level
+        hitbox.height = beamWidth;  // Height based on charge level
         hitbox.offsetX = 0.0f;
-        hitbox.offsetY = -tag.width / 2.0f;  // Center the hitbox
+        hitbox.offsetY = -beamWidth / 2.0f;  // Center the hitbox
 
         // Owner
         auto& owner = ecs.entityAddComponent<components::OwnerComp>(entity);
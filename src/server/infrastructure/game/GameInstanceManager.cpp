@@ -11,6 +11,11 @@
 namespace infrastructure::game {
 
 std::shared_ptr<GameWorld> GameInstanceManager::getOrCreateInstance(const std::string& roomCode) {
+    return getOrCreateInstance(roomCode, _io_ctx, 0);
+}
+
+std::shared_ptr<GameWorld> GameInstanceManager::getOrCreateInstance(const std::string& roomCode,
+                                                                    boost::asio::io_context& shardContext, size_t shard) {
     std::lock_guard<std::mutex> lock(_mutex);
 
     auto it = _instances.find(roomCode);
@@ -18,12 +23,12 @@ std::shared_ptr<GameWorld> GameInstanceManager::getOrCreateInstance(const std::s
         return it->second;
     }
 
-    // Create new instance with io_context (for strand creation)
-    auto gameWorld = std::make_shared<GameWorld>(_io_ctx);
+    // Create new instance with the shard's io_context (for strand creation)
+    auto gameWorld = std::make_shared<GameWorld>(shardContext, shard);
     _instances.emplace(roomCode, gameWorld);
 
     server::logging::Logger::getGameLogger()->info(
-        "GameInstanceManager: Created new game instance for room '{}'", roomCode);
+        "GameInstanceManager: Created new game instance for room '{}' on shard {}", roomCode, shard);
 
     return gameWorld;
 }
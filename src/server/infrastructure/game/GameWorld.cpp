@@ -9,18 +9,59 @@
 #include "collision/AABB.hpp"
 #include <algorithm>
 #include <cmath>
+#include <thread>
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
 namespace infrastructure::game {
 
-    GameWorld::GameWorld(boost::asio::io_context& io_ctx)
+    GameWorld::GameWorld(boost::asio::io_context& io_ctx, size_t shard)
         : _strand(boost::asio::make_strand(io_ctx))
+        , _shard(shard)
         , _nextPlayerId(1)
     {
         // RNG initialized in header with std::random_device
 
+        // Size the entity tables for a busy wave upfront: spawns then never allocate
+        _missiles.reserve(MAX_MISSILES * 4);
+        _enemies.reserve(MAX_ENEMIES * 2);
+        _enemyMissiles.reserve(MAX_ENEMY_MISSILES * 2);
+        _waveCannons.reserve(MAX_PLAYERS * 2);
+        _powerUps.reserve(MAX_POWERUPS * 2);
+        constexpr std::size_t ALL_IDS = std::size_t{UINT16_MAX} + 1;
+        _missiles.reserveIds(ALL_IDS);
+        _enemies.reserveIds(ALL_IDS);
+        _enemyMissiles.reserveIds(ALL_IDS);
+        _waveCannons.reserveIds(ALL_IDS);
+        _powerUps.reserveIds(ALL_IDS);
+
+        // Same for the per-tick event lists and collision scratch buffers
+        _destroyedMissiles.reserve(MAX_MISSILES * 4);
+        _destroyedEnemies.reserve(MAX_ENEMIES * 2);
+        _playerDamageEvents.reserve(MAX_PLAYERS * 4);
+        _deadPlayers.reserve(MAX_PLAYERS);
+        _destroyedWaveCannons.reserve(MAX_PLAYERS * 2);
+        _collectedPowerUps.reserve(MAX_POWERUPS * 2);
+        _expiredPowerUps.reserve(MAX_POWERUPS * 2);
+        _newlySpawnedPowerUps.reserve(MAX_POWERUPS * 2);
+        _collisionEnemies.reserve(MAX_ENEMIES * 2);
+        _enemyBoxes.reserve(MAX_ENEMIES * 2);
+        _collisionHits.reserve(MAX_ENEMIES * 2);
+        _spawnQueue.reserve(MAX_ENEMIES * 2);  // A wave's queue, plus what is left of the previous one
+#ifdef USE_ECS_BACKEND
+        _missileEntityIds.reserve(MAX_MISSILES * 4);
+        _missileEntityIds.reserveIds(ALL_IDS);
+        _enemyEntityIds.reserve(MAX_ENEMIES * 2);
+        _enemyEntityIds.reserveIds(ALL_IDS);
+        constexpr std::size_t ENTITY_CAPACITY = MAX_MISSILES * 4 + MAX_ENEMIES * 2 + MAX_ENEMY_MISSILES * 2
+                                              + MAX_POWERUPS * 2 + MAX_PLAYERS * 4;
+        _wireRefs.reserve(ENTITY_CAPACITY);
+        _ecs.reserveEntities(ENTITY_CAPACITY);
+#else
+        _collisionGrid.reserve(MAX_ENEMIES * 2);
+#endif
+
 #ifdef USE_ECS_BACKEND
         initializeECS();
 #endif
@@ -101,6 +142,15 @@ namespace infrastructure::game {
         // Priority 800: ScoreSystem - Score calculations and combo decay
         _scoreSystemId = _ecs.addSystemWithArgs<ScoreSystem>(0, *_domainBridge);
 
+        // DamageSystem consumes CollisionSystem's pairs: never put them in the same stage
+        _ecs.systemAddDependency(_damageSystemId, _collisionSystemId);
+
+#ifdef ECS_PARALLEL_SYSTEMS
+        // One pool shared by every room, the room's strand runs jobs too while waiting
+        static ECS::JobSystem jobs(std::max(1u, std::thread::hardware_concurrency()) - 1);
+        _ecs.setJobSystem(&jobs);
+#endif
+
         // ═══════════════════════════════════════════════════════════════════
         // Phase 5.5: All 9 systems active
         // EnemyAISystem handles enemy movement patterns (Basic, Tracker, Zigzag, etc.)
@@ -214,6 +264,7 @@ namespace infrastructure::game {
 
         // Store mapping for later lookup
         _missileEntityIds[missileId] = entity;
+        setWireRef(entity, missileId, false);
 
         return entity;
     }
@@ -280,6 +331,7 @@ namespace infrastructure::game {
 
         // Store mapping
         _enemyEntityIds[enemyId] = entity;
+        setWireRef(entity, enemyId, true);
 
         return entity;
     }
@@ -290,12 +342,53 @@ namespace infrastructure::game {
             // Guard: Only delete if entity is still active
             // DamageSystem may have already deleted the entity via KillEvent
             if (_ecs.entityIsActive(it->second)) {
+                // The record may still be read this tick (power-up drop, later hits): leave it the final state
+                auto enemyIt = _enemies.find(enemyId);
+                if (enemyIt != _enemies.end()) {
+                    const auto& pos = _ecs.entityGetComponent<ecs::components::PositionComp>(it->second);
+                    const auto& health = _ecs.entityGetComponent<ecs::components::HealthComp>(it->second);
+                    enemyIt->second.x = pos.x;
+                    enemyIt->second.y = pos.y;
+                    enemyIt->second.health = static_cast<uint8_t>(std::min<uint16_t>(health.current, UINT8_MAX));
+                }
                 _ecs.entityDelete(it->second);
             }
             _enemyEntityIds.erase(it);
         }
     }
 
+    void GameWorld::setWireRef(ECS::EntityID entity, uint16_t id, bool isEnemy) {
+        uint32_t index = ECS::entityIndex(entity);
+        if (index >= _wireRefs.size()) {
+            _wireRefs.resize(static_cast<size_t>(index) + 1);
+        }
+        _wireRefs[index] = WireRef{entity, id, isEnemy};
+    }
+
+    std::optional<ECS::EntityID> GameWorld::playerEntity(uint8_t playerId) const {
+        auto it = _playerEntityIds.find(playerId);
+        if (it == _playerEntityIds.end() || !_ecs.entityIsActive(it->second)) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    std::optional<ECS::EntityID> GameWorld::missileEntity(uint16_t missileId) const {
+        auto it = _missileEntityIds.find(missileId);
+        if (it == _missileEntityIds.end() || !_ecs.entityIsActive(it->second)) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    std::optional<ECS::EntityID> GameWorld::enemyEntity(uint16_t enemyId) const {
+        auto it = _enemyEntityIds.find(enemyId);
+        if (it == _enemyEntityIds.end() || !_ecs.entityIsActive(it->second)) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
     // ═══════════════════════════════════════════════════════════════════════════
     // Phase 4.7: ECS as primary driver
     // ═══════════════════════════════════════════════════════════════════════════
@@ -311,87 +404,6 @@ namespace infrastructure::game {
         }
     }
 
-    void GameWorld::syncPlayersFromECS() {
-        // Query all player entities and sync positions from ECS to legacy
-        // NOTE: Health is synced Legacy → ECS (not ECS → Legacy)
-        // because legacy checkCollisions() is source of truth for player damage
-        auto playerEntities = _ecs.getEntitiesByComponentsAllOf<
-            ecs::components::PlayerTag,
-            ecs::components::PositionComp,
-            ecs::components::HealthComp
-        >();
-
-        for (auto entityId : playerEntities) {
-            const auto& playerTag = _ecs.entityGetComponent<ecs::components::PlayerTag>(entityId);
-            const auto& pos = _ecs.entityGetComponent<ecs::components::PositionComp>(entityId);
-            auto& health = _ecs.entityGetComponent<ecs::components::HealthComp>(entityId);
-            auto& playerTagMut = _ecs.entityGetComponent<ecs::components::PlayerTag>(entityId);
-
-            auto it = _players.find(playerTag.playerId);
-            if (it != _players.end()) {
-                // Sync position: ECS → Legacy (ECS is source of truth for movement)
-                it->second.x = static_cast<uint16_t>(pos.x);
-                it->second.y = static_cast<uint16_t>(pos.y);
-
-                // Sync health: Legacy → ECS (Legacy checkCollisions is source of truth)
-                // This ensures ECS HealthComp stays in sync for snapshot generation
-                health.current = it->second.health;
-                playerTagMut.isAlive = it->second.alive;
-            }
-        }
-    }
-
-    void GameWorld::syncMissilesFromECS() {
-        // Query all missile entities and sync their positions back to legacy map
-        auto missileEntities = _ecs.getEntitiesByComponentsAllOf<
-            ecs::components::MissileTag,
-            ecs::components::PositionComp
-        >();
-
-        for (auto entityId : missileEntities) {
-            const auto& pos = _ecs.entityGetComponent<ecs::components::PositionComp>(entityId);
-
-            // Find the missile ID from our mapping (reverse lookup)
-            for (const auto& [missileId, ecsId] : _missileEntityIds) {
-                if (ecsId == entityId) {
-                    auto it = _missiles.find(missileId);
-                    if (it != _missiles.end()) {
-                        it->second.x = pos.x;
-                        it->second.y = pos.y;
-                    }
-                    break;
-                }
-            }
-        }
-    }
-
-    void GameWorld::syncEnemiesFromECS() {
-        // Query all enemy entities and sync their positions back to legacy map
-        auto enemyEntities = _ecs.getEntitiesByComponentsAllOf<
-            ecs::components::EnemyTag,
-            ecs::components::PositionComp,
-            ecs::components::HealthComp
-        >();
-
-        for (auto entityId : enemyEntities) {
-            const auto& pos = _ecs.entityGetComponent<ecs::components::PositionComp>(entityId);
-            const auto& health = _ecs.entityGetComponent<ecs::components::HealthComp>(entityId);
-
-            // Find the enemy ID from our mapping (reverse lookup)
-            for (const auto& [enemyId, ecsId] : _enemyEntityIds) {
-                if (ecsId == entityId) {
-                    auto it = _enemies.find(enemyId);
-                    if (it != _enemies.end()) {
-                        it->second.x = pos.x;
-                        it->second.y = pos.y;
-                        it->second.health = health.current;
-                    }
-                    break;
-                }
-            }
-        }
-    }
-
     void GameWorld::runECSUpdate(float deltaTime) {
         // Clear destroyed lists at start of frame
         // Both ECS (DamageSystem, CleanupSystem) and Legacy (updateEnemies OOB) can add to these
@@ -408,30 +420,20 @@ namespace infrastructure::game {
         // Run all ECS systems (PlayerInput, Movement, Collision, Damage, etc.)
         _ecs.Update(msecs);
 
-        // Sync player positions from ECS to legacy
-        syncPlayersFromECS();
-
-        // Phase 5.1: Sync deleted missiles from ECS to legacy maps
-        // CleanupSystem removes OOB missiles, LifetimeSystem removes expired ones
-        syncDeletedMissilesFromECS();
-
-        // Phase 5.3: Process KillEvents from DamageSystem
-        // DamageSystem deletes missile and enemy entities, we sync to legacy and handle score/power-ups
+        // Phase 5.3: Process KillEvents from DamageSystem (score, power-up drops)
         auto* damageSystem = _ecs.getSystem<ecs::systems::DamageSystem>(_damageSystemId);
         if (damageSystem) {
             processECSKillEvents(damageSystem->getKillEvents());
         }
 
-        // Sync deleted enemies from ECS (killed by DamageSystem)
-        syncDeletedEnemiesFromECS();
-
-        // Phase 5.4: Sync combo data from ECS to legacy
-        // ScoreSystem handles combo decay, we need combo in legacy for awardKillScore()
-        syncComboFromECS();
+        // Killed, out of bounds or expired: one destroyed event per entity
+        removeDeletedECSEntities();
 
-        // Phase 5.6: Sync weapon cooldowns from ECS to legacy
-        // WeaponSystem handles cooldown decay, we need cooldown in legacy for canPlayerShoot()
-        syncCooldownsFromECS();
+        // Enemy firing stays in updateEnemies(): drop the AI's requests before they pile up
+        auto* enemyAISystem = _ecs.getSystem<ecs::systems::EnemyAISystem>(_enemyAISystemId);
+        if (enemyAISystem) {
+            enemyAISystem->clearMissileRequests();
+        }
 
         // Note: Enemies still use legacy OOB checks in updateEnemies()
         // because movement patterns run AFTER ECS Update
@@ -439,111 +441,36 @@ namespace infrastructure::game {
 
     void GameWorld::processECSKillEvents(const std::vector<ecs::systems::KillEvent>& killEvents) {
         for (const auto& kill : killEvents) {
-            // Find enemy ID from entity ID
-            uint16_t enemyId = 0;
-            for (const auto& [id, entityId] : _enemyEntityIds) {
-                if (entityId == kill.killedEntity) {
-                    enemyId = id;
-                    break;
-                }
-            }
-
-            if (enemyId == 0) continue;  // Enemy not found in legacy map
-
-            // Get enemy data before removal (for power-up spawning)
-            auto enemyIt = _enemies.find(enemyId);
-            if (enemyIt == _enemies.end()) continue;
-
-            const Enemy& enemy = enemyIt->second;
+            EnemyType enemyType = static_cast<EnemyType>(kill.killedType);
 
             // Award score (uses legacy score system)
-            awardKillScore(kill.killerPlayerId,
-                           static_cast<EnemyType>(kill.killedType),
+            awardKillScore(kill.killerPlayerId, enemyType,
                            WeaponType::Standard);  // TODO: Get actual weapon type from missile
 
-            // Spawn power-up chance
-            EnemyType enemyType = static_cast<EnemyType>(enemy.enemy_type);
+            // Spawn power-up chance, where the enemy died
             std::uniform_int_distribution<int> dropDist(0, 99);
             if (enemyType == EnemyType::POWArmor ||
                 dropDist(_rng) < POWERUP_DROP_CHANCE) {
-                spawnPowerUp(enemy.x, enemy.y);
+                spawnPowerUp(kill.x, kill.y);
             }
-
-            // Mark enemy as destroyed (for network broadcast)
-            _destroyedEnemies.push_back(enemyId);
         }
     }
 
-    void GameWorld::syncDeletedMissilesFromECS() {
-        // Check each missile entity - if ECS deleted it, remove from legacy map
-        for (auto it = _missileEntityIds.begin(); it != _missileEntityIds.end();) {
-            if (!_ecs.entityIsActive(it->second)) {
-                // ECS has deleted this entity (OOB or lifetime expired)
-                uint16_t missileId = it->first;
-                _destroyedMissiles.push_back(missileId);
-                _missiles.erase(missileId);
-                it = _missileEntityIds.erase(it);
-            } else {
-                ++it;
+    void GameWorld::removeDeletedECSEntities() {
+        for (ECS::EntityID entity : _ecs.lastUpdateDeletions()) {
+            uint32_t index = ECS::entityIndex(entity);
+            if (index >= _wireRefs.size() || _wireRefs[index].entity != entity) {
+                continue;  // Not a missile/enemy (or its slot was reused since)
             }
-        }
-    }
-
-    void GameWorld::syncDeletedEnemiesFromECS() {
-        // Check each enemy entity - if ECS deleted it, remove from legacy map
-        for (auto it = _enemyEntityIds.begin(); it != _enemyEntityIds.end();) {
-            if (!_ecs.entityIsActive(it->second)) {
-                // ECS has deleted this entity (OOB or lifetime expired)
-                uint16_t enemyId = it->first;
-                _destroyedEnemies.push_back(enemyId);
-                _enemies.erase(enemyId);
-                it = _enemyEntityIds.erase(it);
+            uint16_t id = _wireRefs[index].id;
+            if (_wireRefs[index].isEnemy) {
+                _destroyedEnemies.push_back(id);
+                _enemies.erase(id);
+                _enemyEntityIds.erase(id);
             } else {
-                ++it;
-            }
-        }
-    }
-
-    void GameWorld::syncComboFromECS() {
-        // Phase 5.4: Sync combo data from ECS ScoreComp → legacy _playerScores
-        // ScoreSystem handles combo decay, we sync the results to legacy for awardKillScore()
-        auto players = _ecs.getEntitiesByComponentsAllOf<
-            ecs::components::PlayerTag,
-            ecs::components::ScoreComp
-        >();
-
-        for (auto entityId : players) {
-            const auto& playerTag = _ecs.entityGetComponent<ecs::components::PlayerTag>(entityId);
-            const auto& scoreComp = _ecs.entityGetComponent<ecs::components::ScoreComp>(entityId);
-
-            auto it = _playerScores.find(playerTag.playerId);
-            if (it != _playerScores.end()) {
-                // Sync combo data from ECS to legacy
-                it->second.comboMultiplier = scoreComp.comboMultiplier;
-                it->second.comboTimer = scoreComp.comboTimer;
-                if (scoreComp.maxCombo > it->second.maxCombo) {
-                    it->second.maxCombo = scoreComp.maxCombo;
-                }
-            }
-        }
-    }
-
-    void GameWorld::syncCooldownsFromECS() {
-        // Phase 5.6: Sync weapon cooldowns from ECS WeaponComp → legacy _players
-        // WeaponSystem handles cooldown decay, we sync to legacy for canPlayerShoot()
-        auto players = _ecs.getEntitiesByComponentsAllOf<
-            ecs::components::PlayerTag,
-            ecs::components::WeaponComp
-        >();
-
-        for (auto entityId : players) {
-            const auto& playerTag = _ecs.entityGetComponent<ecs::components::PlayerTag>(entityId);
-            const auto& weaponComp = _ecs.entityGetComponent<ecs::components::WeaponComp>(entityId);
-
-            auto it = _players.find(playerTag.playerId);
-            if (it != _players.end()) {
-                // Sync cooldown from ECS to legacy
-                it->second.shootCooldown = weaponComp.shootCooldown;
+                _destroyedMissiles.push_back(id);
+                _missiles.erase(id);
+                _missileEntityIds.erase(id);
             }
         }
     }
@@ -592,12 +519,12 @@ namespace infrastructure::game {
             .lastActivity = std::chrono::steady_clock::now()
         };
 
-        _players[newId] = player;
+        _players[newId] = std::move(player);
         _playerScores[newId] = PlayerScore{};  // Initialize score for new player
         // Note: Game timer starts on first input (see applyPlayerInput)
 
 #ifdef USE_ECS_BACKEND
-        // Create corresponding ECS entity (dual-running with legacy code)
+        // Create corresponding ECS entity (owns position, combo and weapon cooldown)
         createPlayerEntity(newId, static_cast<float>(startX), static_cast<float>(startY),
                           DEFAULT_HEALTH, 1, false);
 #endif
@@ -613,6 +540,7 @@ namespace infrastructure::game {
         _forcePods.erase(playerId);           // Clean up Force Pod
         _bitDevices.erase(playerId);          // Clean up Bit Devices
         _pauseVotes.erase(playerId);          // Clean up pause vote
+        _snapshotPrioritizer.removePlayer(playerId);
 
 #ifdef USE_ECS_BACKEND
         deletePlayerEntity(playerId);
@@ -629,6 +557,7 @@ namespace infrastructure::game {
                 _forcePods.erase(playerId);           // Clean up Force Pod
                 _bitDevices.erase(playerId);          // Clean up Bit Devices
                 _pauseVotes.erase(playerId);          // Clean up pause vote
+                _snapshotPrioritizer.removePlayer(playerId);
 
 #ifdef USE_ECS_BACKEND
                 deletePlayerEntity(playerId);
@@ -764,28 +693,30 @@ namespace infrastructure::game {
 
     GameSnapshot GameWorld::getSnapshot() const {
         GameSnapshot snapshot{};
+        SnapshotPrioritizer::takeFirst(getSnapshotCandidates(), snapshot);
+        return snapshot;
+    }
+
+    SnapshotCandidates GameWorld::getSnapshotCandidates(std::pmr::memory_resource* resource) const {
+        SnapshotCandidates candidates(resource);
+        GameSnapshot& snapshot = candidates.base;
 
         // ═══════════════════════════════════════════════════════════════════
         // Phase 4.6: Read players from ECS (positions are authoritative)
-        // Other entities (missiles, enemies) still read from legacy maps
+        // Missiles and enemies go through missilePosition()/enemyPosition(), which read ECS too
         // ═══════════════════════════════════════════════════════════════════
 
         snapshot.player_count = 0;
 
 #ifdef USE_ECS_BACKEND
-        // Query all player entities from ECS
-        auto playerEntities = _ecs.getEntitiesByComponentsAllOf<
-            ecs::components::PlayerTag,
-            ecs::components::PositionComp,
-            ecs::components::HealthComp
-        >();
-
-        for (auto entityId : playerEntities) {
+        // Walk the player entities in place (a view doesn't allocate, unlike a query)
+        for (auto [entityId, playerTag, pos, health] : _ecs.view<
+                ecs::components::PlayerTag,
+                ecs::components::PositionComp,
+                ecs::components::HealthComp>()) {
             if (snapshot.player_count >= MAX_PLAYERS) break;
 
-            const auto& playerTag = _ecs.entityGetComponent<ecs::components::PlayerTag>(entityId);
-            const auto& pos = _ecs.entityGetComponent<ecs::components::PositionComp>(entityId);
-            const auto& health = _ecs.entityGetComponent<ecs::components::HealthComp>(entityId);
+            const auto& scoreComp = _ecs.entityGetComponent<ecs::components::ScoreComp>(entityId);
 
             // Get last acked input sequence from legacy map
             uint16_t lastSeq = 0;
@@ -794,15 +725,14 @@ namespace infrastructure::game {
                 lastSeq = seqIt->second;
             }
 
-            // Get score data from legacy map (ScoreComp exists but legacy has more data)
+            // Score totals from the legacy map, the combo from ScoreComp (ScoreSystem decays it)
             uint32_t score = 0;
             uint16_t kills = 0;
-            uint8_t combo = 10;  // 1.0x default
+            uint8_t combo = PlayerScore::encodeCombo(scoreComp.comboMultiplier);
             auto scoreIt = _playerScores.find(playerTag.playerId);
             if (scoreIt != _playerScores.end()) {
                 score = scoreIt->second.score;
                 kills = scoreIt->second.kills;
-                combo = scoreIt->second.getComboEncoded();
             }
 
             // Get weapon/charge data from legacy player (WeaponComp exists but legacy is authoritative)
@@ -886,46 +816,43 @@ namespace infrastructure::game {
         }
 #endif
 
-        snapshot.missile_count = 0;
+        // Missiles and enemies are listed in full, the per-packet caps apply when the snapshot is built
+        candidates.missiles.reserve(_missiles.size());
         for (const auto& [id, missile] : _missiles) {
-            if (snapshot.missile_count >= MAX_MISSILES) break;
+            auto [missileX, missileY] = missilePosition(missile);
             // Clamp pour éviter UB lors de la conversion float négatif -> uint16_t
-            snapshot.missiles[snapshot.missile_count] = MissileState{
+            candidates.missiles.push_back(MissileState{
                 .id = missile.id,
                 .owner_id = missile.owner_id,
-                .x = static_cast<uint16_t>(std::clamp(missile.x, 0.0f, static_cast<float>(UINT16_MAX))),
-                .y = static_cast<uint16_t>(std::clamp(missile.y, 0.0f, static_cast<float>(UINT16_MAX))),
+                .x = static_cast<uint16_t>(std::clamp(missileX, 0.0f, static_cast<float>(UINT16_MAX))),
+                .y = static_cast<uint16_t>(std::clamp(missileY, 0.0f, static_cast<float>(UINT16_MAX))),
                 .weapon_type = static_cast<uint8_t>(missile.weaponType)
-            };
-            snapshot.missile_count++;
+            });
         }
 
-        snapshot.enemy_count = 0;
+        candidates.enemies.reserve(_enemies.size());
         for (const auto& [id, enemy] : _enemies) {
-            if (snapshot.enemy_count >= MAX_ENEMIES) break;
+            auto [enemyX, enemyY] = enemyPosition(enemy);
             // Clamp pour éviter UB lors de la conversion float négatif -> uint16_t
-            snapshot.enemies[snapshot.enemy_count] = EnemyState{
+            candidates.enemies.push_back(EnemyState{
                 .id = enemy.id,
-                .x = static_cast<uint16_t>(std::clamp(enemy.x, 0.0f, static_cast<float>(UINT16_MAX))),
-                .y = static_cast<uint16_t>(std::clamp(enemy.y, 0.0f, static_cast<float>(UINT16_MAX))),
-                .health = enemy.health,
+                .x = static_cast<uint16_t>(std::clamp(enemyX, 0.0f, static_cast<float>(UINT16_MAX))),
+                .y = static_cast<uint16_t>(std::clamp(enemyY, 0.0f, static_cast<float>(UINT16_MAX))),
+                .health = enemyHealth(enemy),
                 .enemy_type = enemy.enemy_type
-            };
-            snapshot.enemy_count++;
+            });
         }
 
-        snapshot.enemy_missile_count = 0;
+        candidates.enemyMissiles.reserve(_enemyMissiles.size());
         for (const auto& [id, missile] : _enemyMissiles) {
-            if (snapshot.enemy_missile_count >= MAX_ENEMY_MISSILES) break;
             // Clamp pour éviter UB lors de la conversion float négatif -> uint16_t
-            snapshot.enemy_missiles[snapshot.enemy_missile_count] = MissileState{
+            candidates.enemyMissiles.push_back(MissileState{
                 .id = missile.id,
                 .owner_id = ENEMY_OWNER_ID,
                 .x = static_cast<uint16_t>(std::clamp(missile.x, 0.0f, static_cast<float>(UINT16_MAX))),
                 .y = static_cast<uint16_t>(std::clamp(missile.y, 0.0f, static_cast<float>(UINT16_MAX))),
                 .weapon_type = 0  // Enemy missiles are standard type
-            };
-            snapshot.enemy_missile_count++;
+            });
         }
 
         // Wave info
@@ -977,7 +904,7 @@ namespace infrastructure::game {
             }
         }
 
-        return snapshot;
+        return candidates;
     }
 
     uint16_t GameWorld::spawnMissile(uint8_t playerId) {
@@ -987,8 +914,9 @@ namespace infrastructure::game {
         const auto& player = it->second;
         uint16_t missileId = _nextMissileId++;
 
-        float spawnX = static_cast<float>(player.x) + MISSILE_SPAWN_OFFSET_X;
-        float spawnY = static_cast<float>(player.y) + MISSILE_SPAWN_OFFSET_Y;
+        auto [playerX, playerY] = playerPosition(player);
+        float spawnX = playerX + MISSILE_SPAWN_OFFSET_X;
+        float spawnY = playerY + MISSILE_SPAWN_OFFSET_Y;
 
         Missile missile{
             .id = missileId,
@@ -1001,7 +929,7 @@ namespace infrastructure::game {
         _missiles[missileId] = missile;
 
 #ifdef USE_ECS_BACKEND
-        // Create corresponding ECS entity (dual-running)
+        // Create corresponding ECS entity (owns position, velocity and health)
         createMissileEntity(missileId, playerId, spawnX, spawnY,
                            Missile::SPEED, 0.0f,
                            static_cast<uint8_t>(WeaponType::Standard),
@@ -1012,7 +940,7 @@ namespace infrastructure::game {
     }
 
     void GameWorld::updateMissiles(float deltaTime) {
-        // Note: _destroyedMissiles is populated by syncDeletedMissilesFromECS() when ECS is enabled
+        // Note: _destroyedMissiles is populated by removeDeletedECSEntities() when ECS is enabled
 #ifndef USE_ECS_BACKEND
         _destroyedMissiles.clear();
 #endif
@@ -1038,32 +966,33 @@ namespace infrastructure::game {
                 } else {
                     auto enemyIt = _enemies.find(missile.targetEnemyId);
                     if (enemyIt != _enemies.end()) {
-                        targetX = enemyIt->second.x + Enemy::WIDTH / 2.0f;
-                        targetY = enemyIt->second.y + Enemy::HEIGHT / 2.0f;
+                        auto [enemyX, enemyY] = enemyPosition(enemyIt->second);
+                        targetX = enemyX + Enemy::WIDTH / 2.0f;
+                        targetY = enemyY + Enemy::HEIGHT / 2.0f;
                         hasTarget = true;
                     }
                 }
 
                 if (hasTarget) {
                     // Calculate direction to target
-                    float dx = targetX - missile.x;
-                    float dy = targetY - missile.y;
+                    auto [missileX, missileY] = missilePosition(missile);
+                    float dx = targetX - missileX;
+                    float dy = targetY - missileY;
                     float dist = std::sqrt(dx * dx + dy * dy);
 
                     if (dist > 1.0f) {
                         // Normalize and apply speed (with weapon level bonus)
                         float speed = Missile::getSpeed(WeaponType::Missile, missile.weaponLevel);
-                        missile.velocityX = (dx / dist) * speed;
-                        missile.velocityY = (dy / dist) * speed;
-
 #ifdef USE_ECS_BACKEND
-                        // Sync updated velocity to ECS entity
-                        auto ecsIt = _missileEntityIds.find(missileId);
-                        if (ecsIt != _missileEntityIds.end() && _ecs.entityIsActive(ecsIt->second)) {
-                            auto& vel = _ecs.entityGetComponent<ecs::components::VelocityComp>(ecsIt->second);
-                            vel.x = missile.velocityX;
-                            vel.y = missile.velocityY;
+                        // MovementSystem moves the missile with its VelocityComp
+                        if (auto entity = missileEntity(missileId)) {
+                            auto& vel = _ecs.entityGetComponent<ecs::components::VelocityComp>(*entity);
+                            vel.x = (dx / dist) * speed;
+                            vel.y = (dy / dist) * speed;
                         }
+#else
+                        missile.velocityX = (dx / dist) * speed;
+                        missile.velocityY = (dy / dist) * speed;
 #endif
                     }
                 }
@@ -1072,13 +1001,6 @@ namespace infrastructure::game {
 #ifdef USE_ECS_BACKEND
             // Phase 5.1: ECS handles movement and OOB cleanup
             // MovementSystem updates positions, CleanupSystem removes OOB entities
-            // Just sync positions from ECS to legacy for snapshot consistency
-            auto ecsIt = _missileEntityIds.find(missileId);
-            if (ecsIt != _missileEntityIds.end() && _ecs.entityIsActive(ecsIt->second)) {
-                const auto& pos = _ecs.entityGetComponent<ecs::components::PositionComp>(ecsIt->second);
-                missile.x = pos.x;
-                missile.y = pos.y;
-            }
             ++it;
 #else
             // Legacy: Update position
@@ -1099,18 +1021,22 @@ namespace infrastructure::game {
         }
     }
 
-    std::vector<uint16_t> GameWorld::getDestroyedMissiles() {
+    std::span<const uint16_t> GameWorld::getDestroyedMissiles() const {
         return _destroyedMissiles;
     }
 
     std::optional<Missile> GameWorld::getMissile(uint16_t missileId) const {
         auto it = _missiles.find(missileId);
         if (it == _missiles.end()) return std::nullopt;
-        return it->second;
+        Missile missile = it->second;
+        auto [x, y] = missilePosition(missile);
+        missile.x = x;
+        missile.y = y;
+        return missile;
     }
 
-    std::vector<udp::endpoint> GameWorld::getAllEndpoints() const {
-        std::vector<udp::endpoint> endpoints;
+    std::pmr::vector<udp::endpoint> GameWorld::getAllEndpoints(std::pmr::memory_resource* resource) const {
+        std::pmr::vector<udp::endpoint> endpoints(resource);
         endpoints.reserve(_players.size());
         for (const auto& [id, player] : _players) {
             endpoints.push_back(player.endpoint);
@@ -1118,6 +1044,66 @@ namespace infrastructure::game {
         return endpoints;
     }
 
+    std::pmr::vector<Recipient> GameWorld::getRecipients(std::pmr::memory_resource* resource) const {
+        std::pmr::vector<Recipient> recipients(resource);
+        recipients.reserve(_players.size());
+        for (const auto& [id, player] : _players) {
+            recipients.push_back({id, player.endpoint, player.statsSlot, player.ackedSnapshot, player.snapshotEncoding,
+                                  player.reliableEvents.get(), player.features});
+        }
+        return recipients;
+    }
+
+    void GameWorld::setPlayerStatsSlot(uint8_t playerId, uint32_t slot) {
+        auto it = _players.find(playerId);
+        if (it != _players.end()) {
+            it->second.statsSlot = slot;
+        }
+    }
+
+    void GameWorld::setPlayerSnapshotEncoding(uint8_t playerId, SnapshotEncoding encoding) {
+        auto it = _players.find(playerId);
+        if (it != _players.end()) {
+            it->second.snapshotEncoding = encoding;
+        }
+    }
+
+    void GameWorld::setPlayerFeatures(uint8_t playerId, uint8_t features) {
+        auto it = _players.find(playerId);
+        if (it == _players.end()) {
+            return;
+        }
+        it->second.features = features;
+        if (!(features & GameFeatures::RELIABLE_EVENTS)) {
+            it->second.reliableEvents.reset();
+        } else if (!it->second.reliableEvents) {
+            it->second.reliableEvents = std::make_unique<reliable::ReliableSender>();
+        }
+    }
+
+    void GameWorld::ackReliableEvents(uint8_t playerId, uint16_t ack, uint32_t ackBits) {
+        auto it = _players.find(playerId);
+        if (it != _players.end() && it->second.reliableEvents) {
+            it->second.reliableEvents->onAck(ack, ackBits);
+        }
+    }
+
+    void GameWorld::ackSnapshot(uint8_t playerId, uint16_t sequence) {
+        auto it = _players.find(playerId);
+        if (it == _players.end()) {
+            return;
+        }
+        // Room-wide and per-player snapshots never share a sequence, the histories forget each other's
+        const auto* playerHistory = _snapshotPrioritizer.findHistory(playerId);
+        if (!_snapshotHistory.find(sequence) && !(playerHistory && playerHistory->find(sequence))) {
+            return;
+        }
+        auto& acked = it->second.ackedSnapshot;
+        if (!acked || compression::isNewerSequence(sequence, *acked)) {
+            acked = sequence;
+        }
+    }
+
     size_t GameWorld::getPlayerCount() const {
         return _players.size();
     }
@@ -1172,7 +1158,7 @@ namespace infrastructure::game {
                 _enemies[enemyId] = enemy;
 
 #ifdef USE_ECS_BACKEND
-                // Create corresponding ECS entity (dual-running)
+                // Create corresponding ECS entity (owns position, velocity and health)
                 createEnemyEntity(enemyId, SPAWN_X, it->spawnY, health,
                                  typeValue, getEnemyPointValue(it->type), it->spawnY,
                                  phaseOffset, shootCooldown, shootInterval,
@@ -1304,10 +1290,10 @@ namespace infrastructure::game {
 
         for (const auto& [id, player] : _players) {
             if (!player.alive) continue;
-            float dist = static_cast<float>(player.x);
-            if (dist < minDist) {
-                minDist = dist;
-                nearestY = static_cast<float>(player.y);
+            auto [playerX, playerY] = playerPosition(player);
+            if (playerX < minDist) {
+                minDist = playerX;
+                nearestY = playerY;
             }
         }
         return nearestY;
@@ -1373,8 +1359,11 @@ namespace infrastructure::game {
     }
 
     void GameWorld::updateEnemies(float deltaTime) {
-        // Note: _destroyedEnemies cleared in runECSUpdate() at start of frame
+        // Note: _destroyedEnemies is cleared in runECSUpdate() when ECS is enabled
         // Both ECS (DamageSystem) and Legacy (OOB check below) can add to the list
+#ifndef USE_ECS_BACKEND
+        _destroyedEnemies.clear();
+#endif
 
         // Apply game speed multiplier to enemy updates
         float adjustedDelta = deltaTime * _gameSpeedMultiplier;
@@ -1383,31 +1372,17 @@ namespace infrastructure::game {
             Enemy& enemy = it->second;
             uint16_t enemyId = it->first;
 
-#ifdef USE_ECS_BACKEND
-            // ═══════════════════════════════════════════════════════════════════════
-            // Phase 5.5: EnemyAISystem handles movement patterns
-            // Sync position, baseY, aliveTime FROM ECS to legacy
-            // ═══════════════════════════════════════════════════════════════════════
-            auto ecsIt = _enemyEntityIds.find(enemyId);
-            if (ecsIt != _enemyEntityIds.end() && _ecs.entityIsActive(ecsIt->second)) {
-                const auto& pos = _ecs.entityGetComponent<ecs::components::PositionComp>(ecsIt->second);
-                const auto& ai = _ecs.entityGetComponent<ecs::components::EnemyAIComp>(ecsIt->second);
-                enemy.x = pos.x;
-                enemy.y = pos.y;
-                enemy.baseY = ai.baseY;           // Bomber drift synced from ECS
-                enemy.aliveTime = ai.aliveTime;   // Keep legacy in sync
-                enemy.zigzagTimer = ai.zigzagTimer;
-                enemy.zigzagUp = ai.zigzagUp;
-            }
-#else
+#ifndef USE_ECS_BACKEND
             // Legacy: calculate movement directly
+            // (with ECS, EnemyAISystem runs the movement patterns on EnemyAIComp/PositionComp)
             enemy.aliveTime += adjustedDelta;
             updateEnemyMovement(enemy, adjustedDelta);
 #endif
+            auto [enemyX, enemyY] = enemyPosition(enemy);
 
             // Handle enemy shooting (enemy missiles are NOT ECS entities)
             enemy.shootCooldown -= adjustedDelta;
-            if (enemy.shootCooldown <= 0.0f && enemy.x < SCREEN_WIDTH && enemy.x > 0.0f) {
+            if (enemy.shootCooldown <= 0.0f && enemyX < SCREEN_WIDTH && enemyX > 0.0f) {
                 enemy.shootCooldown = enemy.getShootInterval();
 
                 EnemyType type = static_cast<EnemyType>(enemy.enemy_type);
@@ -1428,8 +1403,8 @@ namespace infrastructure::game {
                     Missile enemyMissile{
                         .id = missileId,
                         .owner_id = ENEMY_OWNER_ID,
-                        .x = enemy.x - 20.0f,
-                        .y = enemy.y + yOffset,
+                        .x = enemyX - 20.0f,
+                        .y = enemyY + yOffset,
                         .velocityX = missileSpeed
                     };
                     _enemyMissiles[missileId] = enemyMissile;
@@ -1439,13 +1414,13 @@ namespace infrastructure::game {
             // Check OOB and health (legacy handles this for now)
             // Note: CleanupSystem could handle OOB but execution order is tricky
             // Enemy patterns run AFTER ECS Update, so we keep legacy OOB check
-            if (enemy.x < -Enemy::WIDTH) {
+            if (enemyX < -Enemy::WIDTH) {
                 _destroyedEnemies.push_back(enemyId);
 #ifdef USE_ECS_BACKEND
                 deleteEnemyEntity(enemyId);
 #endif
                 it = _enemies.erase(it);
-            } else if (enemy.health == 0) {
+            } else if (enemyHealth(enemy) == 0) {
                 _destroyedEnemies.push_back(enemyId);
 #ifdef USE_ECS_BACKEND
                 deleteEnemyEntity(enemyId);
@@ -1475,17 +1450,28 @@ namespace infrastructure::game {
         _playerDamageEvents.clear();
         _deadPlayers.clear();
 
+#ifdef USE_ECS_BACKEND
+        // Missiles vs enemies went through CollisionSystem's broadphase this tick
+        auto* collisionSystem = _ecs.getSystem<ecs::systems::CollisionSystem>(_collisionSystemId);
+        _collisionCandidatePairs.store(collisionSystem ? collisionSystem->getCandidatePairCount() : 0,
+                                       std::memory_order_relaxed);
+#else
+        // Broadphase over enemies, built once: they don't move during the checks
+        gatherEnemyBoxes();
+        _collisionGrid.build(_enemyBoxes.arrays());
+#endif
+
         for (auto missileIt = _missiles.begin(); missileIt != _missiles.end();) {
             const auto& missile = missileIt->second;
             uint16_t missileId = missileIt->first;
-            collision::AABB missileBox(missile.x, missile.y, Missile::WIDTH, Missile::HEIGHT);
+            auto [missileX, missileY] = missilePosition(missile);
+            collision::AABB missileBox(missileX, missileY, Missile::WIDTH, Missile::HEIGHT);
 
             bool missileDestroyed = false;
 
 #ifdef USE_ECS_BACKEND
             // Phase 5.3: Skip missiles already deleted by DamageSystem
-            auto ecsIt = _missileEntityIds.find(missileId);
-            if (ecsIt == _missileEntityIds.end() || !_ecs.entityIsActive(ecsIt->second)) {
+            if (!missileEntity(missileId)) {
                 // Missile was deleted by DamageSystem, remove from legacy map
                 missileIt = _missiles.erase(missileIt);
                 continue;
@@ -1494,45 +1480,45 @@ namespace infrastructure::game {
             // Phase 5.3: DamageSystem handles MISSILES + ENEMIES collisions
             // Skip to boss check (Boss is not an ECS entity yet)
 #else
-            // Legacy: Check missile vs enemies
-            for (auto& [enemyId, enemy] : _enemies) {
-                collision::AABB enemyBox(enemy.x, enemy.y, Enemy::WIDTH, Enemy::HEIGHT);
-
-                if (missileBox.intersects(enemyBox)) {
-                    bool wasAlive = enemy.health > 0;
-                    // Use weapon-specific damage with level bonus
-                    uint8_t damage = Missile::getDamage(missile.weaponType, missile.weaponLevel);
-                    // Calculate actual damage dealt (capped by remaining health)
-                    uint8_t actualDamage = std::min(damage, enemy.health);
-                    if (enemy.health > damage) {
-                        enemy.health -= damage;
-                    } else {
-                        enemy.health = 0;
-                    }
-                    // Track total damage dealt
-                    auto scoreIt = _playerScores.find(missile.owner_id);
-                    if (scoreIt != _playerScores.end()) {
-                        scoreIt->second.totalDamageDealt += actualDamage;
-                    }
+            // Legacy: Check missile vs enemies, the first enemy hit in _enemies order takes it
+            uint32_t firstHit = UINT32_MAX;
+            _collisionGrid.query(missileBox, [&firstHit](uint32_t index) {
+                firstHit = std::min(firstHit, index);
+            });
+            if (firstHit != UINT32_MAX) {
+                Enemy& enemy = _collisionEnemies[firstHit]->second;
+                bool wasAlive = enemy.health > 0;
+                // Use weapon-specific damage with level bonus
+                uint8_t damage = Missile::getDamage(missile.weaponType, missile.weaponLevel);
+                // Calculate actual damage dealt (capped by remaining health)
+                uint8_t actualDamage = std::min(damage, enemy.health);
+                if (enemy.health > damage) {
+                    enemy.health -= damage;
+                } else {
+                    enemy.health = 0;
+                }
+                // Track total damage dealt
+                auto scoreIt = _playerScores.find(missile.owner_id);
+                if (scoreIt != _playerScores.end()) {
+                    scoreIt->second.totalDamageDealt += actualDamage;
+                }
 
-                    // Award score if enemy was killed
-                    if (wasAlive && enemy.health == 0) {
-                        awardKillScore(missile.owner_id, static_cast<EnemyType>(enemy.enemy_type), missile.weaponType);
+                // Award score if enemy was killed
+                if (wasAlive && enemy.health == 0) {
+                    awardKillScore(missile.owner_id, static_cast<EnemyType>(enemy.enemy_type), missile.weaponType);
 
-                        // POWArmor always drops power-up, other enemies have a chance
-                        EnemyType enemyType = static_cast<EnemyType>(enemy.enemy_type);
-                        std::uniform_int_distribution<int> dropDist(0, 99);
-                        if (enemyType == EnemyType::POWArmor ||
-                            dropDist(_rng) < POWERUP_DROP_CHANCE) {
-                            spawnPowerUp(enemy.x, enemy.y);
-                        }
+                    // POWArmor always drops power-up, other enemies have a chance
+                    EnemyType enemyType = static_cast<EnemyType>(enemy.enemy_type);
+                    std::uniform_int_distribution<int> dropDist(0, 99);
+                    if (enemyType == EnemyType::POWArmor ||
+                        dropDist(_rng) < POWERUP_DROP_CHANCE) {
+                        spawnPowerUp(enemy.x, enemy.y);
                     }
-
-                    _destroyedMissiles.push_back(missileId);
-                    missileIt = _missiles.erase(missileIt);
-                    missileDestroyed = true;
-                    break;
                 }
+
+                _destroyedMissiles.push_back(missileId);
+                missileIt = _missiles.erase(missileIt);
+                missileDestroyed = true;
             }
 #endif
 
@@ -1559,6 +1545,11 @@ namespace infrastructure::game {
             }
         }
 
+#ifndef USE_ECS_BACKEND
+        _collisionCandidatePairs.store(_collisionGrid.candidateCount(), std::memory_order_relaxed);
+#endif
+
+        // Few players: a plain loop beats building a grid over them
         for (auto missileIt = _enemyMissiles.begin(); missileIt != _enemyMissiles.end();) {
             const auto& missile = missileIt->second;
             collision::AABB missileBox(missile.x, missile.y, Missile::WIDTH, Missile::HEIGHT);
@@ -1568,9 +1559,10 @@ namespace infrastructure::game {
             for (auto& [playerId, player] : _players) {
                 if (!player.alive) continue;
 
+                auto [playerX, playerY] = playerPosition(player);
                 collision::AABB playerBox(
-                    static_cast<float>(player.x),
-                    static_cast<float>(player.y),
+                    playerX,
+                    playerY,
                     collision::Hitboxes::SHIP_WIDTH,
                     collision::Hitboxes::SHIP_HEIGHT
                 );
@@ -1595,8 +1587,7 @@ namespace infrastructure::game {
                     }
 
 #ifdef USE_ECS_BACKEND
-                    // Sync damage to ECS immediately for getSnapshot() (called later this frame)
-                    // Note: syncPlayersFromECS() also syncs Legacy → ECS at start of next frame
+                    // Health is a game rule kept here, HealthComp/PlayerTag mirror it for getSnapshot()
                     auto entityIt = _playerEntityIds.find(playerId);
                     if (entityIt != _playerEntityIds.end()) {
                         auto& health = _ecs.entityGetComponent<ecs::components::HealthComp>(entityIt->second);
@@ -1631,15 +1622,110 @@ namespace infrastructure::game {
         }
     }
 
-    std::vector<uint16_t> GameWorld::getDestroyedEnemies() {
+    size_t GameWorld::getCollisionCandidatePairs() const {
+        return _collisionCandidatePairs.load(std::memory_order_relaxed);
+    }
+
+    void GameWorld::gatherEnemyBoxes() {
+        _collisionEnemies.clear();
+        _enemyBoxes.clear();
+        for (auto& entry : _enemies) {
+            _collisionEnemies.push_back(&entry);
+            auto [enemyX, enemyY] = enemyPosition(entry.second);
+            _enemyBoxes.push({enemyX, enemyY, Enemy::WIDTH, Enemy::HEIGHT});
+        }
+        _collisionHits.resize(_enemyBoxes.size());
+    }
+
+    GameWorld::Vec2 GameWorld::playerPosition(const ConnectedPlayer& player) const {
+#ifdef USE_ECS_BACKEND
+        if (auto entity = playerEntity(player.id)) {
+            const auto& pos = _ecs.entityGetComponent<ecs::components::PositionComp>(*entity);
+            return {pos.x, pos.y};
+        }
+#endif
+        return {static_cast<float>(player.x), static_cast<float>(player.y)};
+    }
+
+    GameWorld::Vec2 GameWorld::missilePosition(const Missile& missile) const {
+#ifdef USE_ECS_BACKEND
+        if (auto entity = missileEntity(missile.id)) {
+            const auto& pos = _ecs.entityGetComponent<ecs::components::PositionComp>(*entity);
+            return {pos.x, pos.y};
+        }
+#endif
+        return {missile.x, missile.y};
+    }
+
+    GameWorld::Vec2 GameWorld::enemyPosition(const Enemy& enemy) const {
+#ifdef USE_ECS_BACKEND
+        if (auto entity = enemyEntity(enemy.id)) {
+            const auto& pos = _ecs.entityGetComponent<ecs::components::PositionComp>(*entity);
+            return {pos.x, pos.y};
+        }
+#endif
+        return {enemy.x, enemy.y};
+    }
+
+    uint8_t GameWorld::enemyHealth(const Enemy& enemy) const {
+#ifdef USE_ECS_BACKEND
+        if (auto entity = enemyEntity(enemy.id)) {
+            const auto& health = _ecs.entityGetComponent<ecs::components::HealthComp>(*entity);
+            return static_cast<uint8_t>(std::min<uint16_t>(health.current, UINT8_MAX));
+        }
+#endif
+        return enemy.health;
+    }
+
+    uint8_t GameWorld::damageEnemy(Enemy& enemy, uint8_t damage) {
+#ifdef USE_ECS_BACKEND
+        if (auto entity = enemyEntity(enemy.id)) {
+            auto& health = _ecs.entityGetComponent<ecs::components::HealthComp>(*entity);
+            uint16_t dealt = std::min<uint16_t>(damage, health.current);
+            health.current -= dealt;
+            return static_cast<uint8_t>(dealt);
+        }
+#endif
+        uint8_t dealt = std::min(damage, enemy.health);
+        enemy.health -= dealt;
+        return dealt;
+    }
+
+    float GameWorld::playerCombo(uint8_t playerId) const {
+#ifdef USE_ECS_BACKEND
+        if (auto entity = playerEntity(playerId)) {
+            return _ecs.entityGetComponent<ecs::components::ScoreComp>(*entity).comboMultiplier;
+        }
+#endif
+        auto it = _playerScores.find(playerId);
+        return it != _playerScores.end() ? it->second.comboMultiplier : 1.0f;
+    }
+
+    void GameWorld::setPlayerCombo(uint8_t playerId, float multiplier) {
+#ifdef USE_ECS_BACKEND
+        if (auto entity = playerEntity(playerId)) {
+            auto& score = _ecs.entityGetComponent<ecs::components::ScoreComp>(*entity);
+            score.comboMultiplier = multiplier;
+            score.comboTimer = 0.0f;
+            return;
+        }
+#endif
+        auto it = _playerScores.find(playerId);
+        if (it != _playerScores.end()) {
+            it->second.comboMultiplier = multiplier;
+            it->second.comboTimer = 0.0f;
+        }
+    }
+
+    std::span<const uint16_t> GameWorld::getDestroyedEnemies() const {
         return _destroyedEnemies;
     }
 
-    std::vector<std::pair<uint8_t, uint8_t>> GameWorld::getPlayerDamageEvents() {
+    std::span<const std::pair<uint8_t, uint8_t>> GameWorld::getPlayerDamageEvents() const {
         return _playerDamageEvents;
     }
 
-    std::vector<uint8_t> GameWorld::getDeadPlayers() {
+    std::span<const uint8_t> GameWorld::getDeadPlayers() const {
         return _deadPlayers;
     }
 
@@ -1649,6 +1735,18 @@ namespace infrastructure::game {
         return it->second.alive;
     }
 
+    uint8_t GameWorld::getPlayerHealth(uint8_t playerId) const {
+#ifdef USE_ECS_BACKEND
+        if (auto entity = playerEntity(playerId)) {
+            const auto& health = _ecs.entityGetComponent<ecs::components::HealthComp>(*entity);
+            return static_cast<uint8_t>(std::min<uint16_t>(health.current, UINT8_MAX));
+        }
+#endif
+        auto it = _players.find(playerId);
+        if (it == _players.end()) return 0;
+        return it->second.health;
+    }
+
     void GameWorld::updatePlayerActivity(uint8_t playerId) {
         auto it = _players.find(playerId);
         if (it != _players.end()) {
@@ -1656,8 +1754,8 @@ namespace infrastructure::game {
         }
     }
 
-    std::vector<uint8_t> GameWorld::checkPlayerTimeouts(std::chrono::milliseconds timeout) {
-        std::vector<uint8_t> timedOutPlayers;
+    std::pmr::vector<uint8_t> GameWorld::checkPlayerTimeouts(std::chrono::milliseconds timeout) {
+        std::pmr::vector<uint8_t> timedOutPlayers(_frameArena.resource());
         auto now = std::chrono::steady_clock::now();
 
         for (const auto& [id, player] : _players) {
@@ -1702,7 +1800,8 @@ namespace infrastructure::game {
         PlayerScore& score = it->second;
 
         uint16_t basePoints = getEnemyPointValue(enemyType);
-        uint32_t points = static_cast<uint32_t>(basePoints * score.comboMultiplier);
+        float combo = playerCombo(playerId);
+        uint32_t points = static_cast<uint32_t>(basePoints * combo);
 
         score.score += points;
         score.kills++;
@@ -1717,13 +1816,13 @@ namespace infrastructure::game {
             default: score.standardKills++; break;
         }
 
-        // Increase combo (max 3.0x)
-        score.comboMultiplier = std::min(COMBO_MAX, score.comboMultiplier + COMBO_INCREMENT);
-        score.comboTimer = 0.0f;  // Reset combo timer
+        // Increase combo (max 3.0x), resets the combo timer
+        combo = std::min(COMBO_MAX, combo + COMBO_INCREMENT);
+        setPlayerCombo(playerId, combo);
 
         // Track max combo achieved
-        if (score.comboMultiplier > score.maxCombo) {
-            score.maxCombo = score.comboMultiplier;
+        if (combo > score.maxCombo) {
+            score.maxCombo = combo;
         }
 
         // Kill streak tracking (consecutive kills without damage)
@@ -1731,24 +1830,6 @@ namespace infrastructure::game {
         if (score.currentKillStreak > score.bestKillStreak) {
             score.bestKillStreak = score.currentKillStreak;
         }
-
-#ifdef USE_ECS_BACKEND
-        // Phase 5.4: Sync combo changes back to ECS ScoreComp
-        // This ensures ScoreSystem sees updated combo after kills
-        auto entityIt = _playerEntityIds.find(playerId);
-        if (entityIt != _playerEntityIds.end() && _ecs.entityIsActive(entityIt->second)) {
-            if (_ecs.entityHasComponent<ecs::components::ScoreComp>(entityIt->second)) {
-                auto& scoreComp = _ecs.entityGetComponent<ecs::components::ScoreComp>(entityIt->second);
-                scoreComp.comboMultiplier = score.comboMultiplier;
-                scoreComp.comboTimer = score.comboTimer;
-                scoreComp.kills = score.kills;
-                scoreComp.total = score.score;
-                if (score.maxCombo > scoreComp.maxCombo) {
-                    scoreComp.maxCombo = score.maxCombo;
-                }
-            }
-        }
-#endif
     }
 
     void GameWorld::updateComboTimers([[maybe_unused]] float deltaTime) {
@@ -1768,7 +1849,7 @@ namespace infrastructure::game {
         }
 #endif
         // Phase 5.4: When ECS is enabled, ScoreSystem handles combo decay
-        // syncComboFromECS() copies the results to _playerScores
+        // on ScoreComp, read back through playerCombo()
     }
 
     void GameWorld::onPlayerDamaged(uint8_t playerId) {
@@ -1776,7 +1857,7 @@ namespace infrastructure::game {
         if (it != _playerScores.end()) {
             it->second.tookDamageThisWave = true;
             // Reset combo on damage
-            it->second.comboMultiplier = 1.0f;
+            setPlayerCombo(playerId, 1.0f);
             // Reset kill streak on damage
             it->second.currentKillStreak = 0;
         }
@@ -2195,10 +2276,11 @@ namespace infrastructure::game {
         int missileCount = boss.isEnraged ? 6 : 4;
 
         // Find player positions
-        std::vector<std::pair<float, float>> playerPositions;
+        std::pmr::vector<std::pair<float, float>> playerPositions(_frameArena.resource());
         for (const auto& [id, player] : _players) {
             if (player.alive) {
-                playerPositions.emplace_back(player.x, player.y);
+                auto [playerX, playerY] = playerPosition(player);
+                playerPositions.emplace_back(playerX, playerY);
             }
         }
 
@@ -2289,13 +2371,14 @@ namespace infrastructure::game {
         float nearestDist = 99999.0f;
         for (const auto& [id, player] : _players) {
             if (!player.alive) continue;
-            float dx = player.x - boss.x;
-            float dy = player.y - boss.y;
+            auto [playerX, playerY] = playerPosition(player);
+            float dx = playerX - boss.x;
+            float dy = playerY - boss.y;
             float dist = std::sqrt(dx * dx + dy * dy);
             if (dist < nearestDist) {
                 nearestDist = dist;
-                targetX = player.x + 100.0f;  // Dash past the player
-                targetY = player.y;
+                targetX = playerX + 100.0f;  // Dash past the player
+                targetY = playerY;
             }
         }
 
@@ -2459,8 +2542,7 @@ namespace infrastructure::game {
                 it->second.kills++;
                 it->second.bossKills++;  // Track boss kills for leaderboard
                 // Big combo boost
-                it->second.comboMultiplier = COMBO_MAX;
-                it->second.comboTimer = 0.0f;
+                setPlayerCombo(playerId, COMBO_MAX);
             }
 
             // Track boss defeat and reset for next cycle
@@ -2511,7 +2593,7 @@ namespace infrastructure::game {
         }
 #endif
         // Phase 5.6: When ECS is enabled, WeaponSystem handles cooldown decay
-        // syncCooldownsFromECS() copies the results to _players
+        // on WeaponComp, read back by canPlayerShoot()
     }
 
     bool GameWorld::canPlayerShoot(uint8_t playerId) const {
@@ -2519,11 +2601,16 @@ namespace infrastructure::game {
         if (it == _players.end() || !it->second.alive) {
             return false;
         }
+#ifdef USE_ECS_BACKEND
+        if (auto entity = playerEntity(playerId)) {
+            return _ecs.entityGetComponent<ecs::components::WeaponComp>(*entity).shootCooldown <= 0.0f;
+        }
+#endif
         return it->second.shootCooldown <= 0.0f;
     }
 
-    std::vector<uint16_t> GameWorld::spawnMissileWithWeapon(uint8_t playerId) {
-        std::vector<uint16_t> spawnedIds;
+    std::pmr::vector<uint16_t> GameWorld::spawnMissileWithWeapon(uint8_t playerId) {
+        std::pmr::vector<uint16_t> spawnedIds(_frameArena.resource());
 
         auto it = _players.find(playerId);
         if (it == _players.end() || !it->second.alive) {
@@ -2541,12 +2628,17 @@ namespace infrastructure::game {
         uint8_t level = player.weaponLevels[static_cast<size_t>(weapon)];
 
         // Set cooldown for this weapon (affected by weapon level)
-        player.shootCooldown = Missile::getCooldown(weapon, level);
+        // With ECS it goes to WeaponComp below, WeaponSystem decays it
+        float cooldown = Missile::getCooldown(weapon, level);
+#ifndef USE_ECS_BACKEND
+        player.shootCooldown = cooldown;
+#endif
 
         // Speed is affected by weapon level (only at level 3)
         float baseSpeed = Missile::getSpeed(weapon, level);
-        float spawnX = static_cast<float>(player.x) + MISSILE_SPAWN_OFFSET_X;
-        float spawnY = static_cast<float>(player.y) + MISSILE_SPAWN_OFFSET_Y;
+        auto [playerX, playerY] = playerPosition(player);
+        float spawnX = playerX + MISSILE_SPAWN_OFFSET_X;
+        float spawnY = playerY + MISSILE_SPAWN_OFFSET_Y;
 
         switch (weapon) {
             case WeaponType::Standard: {
@@ -2569,14 +2661,12 @@ namespace infrastructure::game {
 
             case WeaponType::Spread: {
                 // Level 0-2: 3 shots, Level 3: 5 shots (wider coverage)
-                std::vector<float> angles;
-                if (level >= 3) {
-                    // 5 shots: -20°, -10°, 0°, 10°, 20°
-                    angles = {-20.0f, -10.0f, 0.0f, 10.0f, 20.0f};
-                } else {
-                    // 3 shots: -15°, 0°, 15°
-                    angles = {-15.0f, 0.0f, 15.0f};
-                }
+                // 5 shots: -20°, -10°, 0°, 10°, 20° / 3 shots: -15°, 0°, 15°
+                static constexpr float WIDE_ANGLES[] = {-20.0f, -10.0f, 0.0f, 10.0f, 20.0f};
+                static constexpr float NARROW_ANGLES[] = {-15.0f, 0.0f, 15.0f};
+                std::span<const float> angles = level >= 3
+                    ? std::span<const float>(WIDE_ANGLES)
+                    : std::span<const float>(NARROW_ANGLES);
                 for (float angle : angles) {
                     float radians = angle * 3.14159f / 180.0f;
                     Missile missile{
@@ -2621,8 +2711,9 @@ namespace infrastructure::game {
 
                 // Check regular enemies
                 for (const auto& [enemyId, enemy] : _enemies) {
-                    float dx = enemy.x - spawnX;
-                    float dy = enemy.y - spawnY;
+                    auto [enemyX, enemyY] = enemyPosition(enemy);
+                    float dx = enemyX - spawnX;
+                    float dy = enemyY - spawnY;
                     float dist = std::sqrt(dx * dx + dy * dy);
                     if (dist < nearestDist) {
                         nearestDist = dist;
@@ -2677,14 +2768,9 @@ namespace infrastructure::game {
             }
         }
 
-        // Phase 5.6: Sync cooldown back to ECS WeaponComp
-        // This ensures WeaponSystem sees the new cooldown after shooting
-        auto entityIt = _playerEntityIds.find(playerId);
-        if (entityIt != _playerEntityIds.end() && _ecs.entityIsActive(entityIt->second)) {
-            if (_ecs.entityHasComponent<ecs::components::WeaponComp>(entityIt->second)) {
-                auto& weaponComp = _ecs.entityGetComponent<ecs::components::WeaponComp>(entityIt->second);
-                weaponComp.shootCooldown = player.shootCooldown;
-            }
+        // Phase 5.6: The cooldown lives in WeaponComp, canPlayerShoot() reads it from there
+        if (auto entity = playerEntity(playerId)) {
+            _ecs.entityGetComponent<ecs::components::WeaponComp>(*entity).shootCooldown = cooldown;
         }
 #endif
 
@@ -2806,11 +2892,12 @@ namespace infrastructure::game {
                 break;
         }
 
+        auto [playerX, playerY] = playerPosition(player);
         WaveCannonProjectile wc{
             .id = _nextWaveCannonId++,
             .owner_id = playerId,
-            .x = static_cast<float>(player.x) + MISSILE_SPAWN_OFFSET_X,
-            .y = static_cast<float>(player.y) + MISSILE_SPAWN_OFFSET_Y,
+            .x = playerX + MISSILE_SPAWN_OFFSET_X,
+            .y = playerY + MISSILE_SPAWN_OFFSET_Y,
             .velocityX = WaveCannon::SPEED * _gameSpeedMultiplier,
             .chargeLevel = chargeLevel,
             .damage = damage,
@@ -2823,7 +2910,7 @@ namespace infrastructure::game {
     }
 
     void GameWorld::updateWaveCannons(float deltaTime) {
-        std::vector<uint16_t> toRemove;
+        std::pmr::vector<uint16_t> toRemove(_frameArena.resource());
 
         for (auto& [id, wc] : _waveCannons) {
             // Move wave cannon
@@ -2845,17 +2932,15 @@ namespace infrastructure::game {
                     continue;
                 }
 
-                collision::AABB enemyBox{enemy.x, enemy.y, Enemy::WIDTH, Enemy::HEIGHT};
+                auto [enemyX, enemyY] = enemyPosition(enemy);
+                collision::AABB enemyBox{enemyX, enemyY, Enemy::WIDTH, Enemy::HEIGHT};
 
                 if (wcBox.intersects(enemyBox)) {
                     // Mark as hit BEFORE applying damage
                     wc.hitEnemies.insert(enemyId);
 
-                    // Calculate actual damage dealt (capped by remaining health)
-                    uint8_t actualDamage = std::min(static_cast<uint8_t>(wc.damage), enemy.health);
-
-                    enemy.health = (enemy.health > wc.damage) ?
-                                   enemy.health - wc.damage : 0;
+                    // Actual damage dealt is capped by remaining health
+                    uint8_t actualDamage = damageEnemy(enemy, static_cast<uint8_t>(wc.damage));
 
                     // Track total damage dealt by Wave Cannon
                     auto scoreIt = _playerScores.find(wc.owner_id);
@@ -2863,7 +2948,7 @@ namespace infrastructure::game {
                         scoreIt->second.totalDamageDealt += actualDamage;
                     }
 
-                    if (enemy.health == 0) {
+                    if (enemyHealth(enemy) == 0) {
                         _destroyedEnemies.push_back(enemyId);
 #ifdef USE_ECS_BACKEND
                         deleteEnemyEntity(enemyId);
@@ -2876,7 +2961,7 @@ namespace infrastructure::game {
                         std::uniform_int_distribution<int> dropDist(0, 99);
                         if (enemyType == EnemyType::POWArmor ||
                             dropDist(_rng) < POWERUP_DROP_CHANCE) {
-                            spawnPowerUp(enemy.x, enemy.y);
+                            spawnPowerUp(enemyX, enemyY);
                         }
                     }
 
@@ -2916,10 +3001,8 @@ namespace infrastructure::game {
         }
     }
 
-    std::vector<uint16_t> GameWorld::getDestroyedWaveCannons() {
-        auto result = std::move(_destroyedWaveCannons);
-        _destroyedWaveCannons.clear();
-        return result;
+    std::pmr::vector<uint16_t> GameWorld::getDestroyedWaveCannons() {
+        return takeIntoFrame(_destroyedWaveCannons);
     }
 
     uint8_t GameWorld::getPlayerChargeLevel(uint8_t playerId) const {
@@ -2965,7 +3048,7 @@ namespace infrastructure::game {
     }
 
     void GameWorld::updatePowerUps(float deltaTime) {
-        std::vector<uint16_t> toRemove;
+        std::pmr::vector<uint16_t> toRemove(_frameArena.resource());
 
         for (auto& [id, pu] : _powerUps) {
             // Update lifetime
@@ -2995,7 +3078,7 @@ namespace infrastructure::game {
     }
 
     void GameWorld::checkPowerUpCollisions() {
-        std::vector<uint16_t> collected;
+        std::pmr::vector<uint16_t> collected(_frameArena.resource());
 
         for (auto& [puId, pu] : _powerUps) {
             collision::AABB puBox{pu.x, pu.y, PowerUp::WIDTH, PowerUp::HEIGHT};
@@ -3003,9 +3086,10 @@ namespace infrastructure::game {
             for (auto& [playerId, player] : _players) {
                 if (!player.alive) continue;
 
+                auto [playerX, playerY] = playerPosition(player);
                 collision::AABB playerBox{
-                    static_cast<float>(player.x),
-                    static_cast<float>(player.y),
+                    playerX,
+                    playerY,
                     PLAYER_SHIP_WIDTH, PLAYER_SHIP_HEIGHT
                 };
 
@@ -3129,22 +3213,16 @@ namespace infrastructure::game {
 #endif
     }
 
-    std::vector<PowerUpCollected> GameWorld::getCollectedPowerUps() {
-        auto result = std::move(_collectedPowerUps);
-        _collectedPowerUps.clear();
-        return result;
+    std::pmr::vector<PowerUpCollected> GameWorld::getCollectedPowerUps() {
+        return takeIntoFrame(_collectedPowerUps);
     }
 
-    std::vector<uint16_t> GameWorld::getExpiredPowerUps() {
-        auto result = std::move(_expiredPowerUps);
-        _expiredPowerUps.clear();
-        return result;
+    std::pmr::vector<uint16_t> GameWorld::getExpiredPowerUps() {
+        return takeIntoFrame(_expiredPowerUps);
     }
 
-    std::vector<uint16_t> GameWorld::getNewlySpawnedPowerUps() {
-        auto result = std::move(_newlySpawnedPowerUps);
-        _newlySpawnedPowerUps.clear();
-        return result;
+    std::pmr::vector<uint16_t> GameWorld::getNewlySpawnedPowerUps() {
+        return takeIntoFrame(_newlySpawnedPowerUps);
     }
 
     // --- Force Pod System ---
@@ -3163,12 +3241,13 @@ namespace infrastructure::game {
             player.forceLevel = forceIt->second.level;
         } else {
             // Create new Force Pod
+            auto [playerX, playerY] = playerPosition(player);
             ForcePod force{
                 .ownerId = playerId,
-                .x = static_cast<float>(player.x) + ForcePod::ATTACH_OFFSET_X,
-                .y = static_cast<float>(player.y),
-                .targetX = static_cast<float>(player.x) + ForcePod::ATTACH_OFFSET_X,
-                .targetY = static_cast<float>(player.y),
+                .x = playerX + ForcePod::ATTACH_OFFSET_X,
+                .y = playerY,
+                .targetX = playerX + ForcePod::ATTACH_OFFSET_X,
+                .targetY = playerY,
                 .isAttached = true,
                 .level = 1
             };
@@ -3202,14 +3281,7 @@ namespace infrastructure::game {
             const auto& player = playerIt->second;
 
             // Decrement hit cooldowns
-            for (auto it = force.hitCooldowns.begin(); it != force.hitCooldowns.end();) {
-                it->second -= deltaTime;
-                if (it->second <= 0.0f) {
-                    it = force.hitCooldowns.erase(it);  // Remove expired cooldown
-                } else {
-                    ++it;
-                }
-            }
+            force.hitCooldowns.update(deltaTime);  // Expired cooldowns are removed
             if (force.bossHitCooldown > 0.0f) {
                 force.bossHitCooldown -= deltaTime;
             }
@@ -3221,8 +3293,9 @@ namespace infrastructure::game {
 
             if (force.isAttached) {
                 // Follow player directly
-                force.targetX = static_cast<float>(player.x) + ForcePod::ATTACH_OFFSET_X;
-                force.targetY = static_cast<float>(player.y);
+                auto [playerX, playerY] = playerPosition(player);
+                force.targetX = playerX + ForcePod::ATTACH_OFFSET_X;
+                force.targetY = playerY;
 
                 // Smooth movement towards target
                 float dx = force.targetX - force.x;
@@ -3255,42 +3328,42 @@ namespace infrastructure::game {
     }
 
     void GameWorld::checkForceCollisions() {
+        // Enemies don't move during the checks: gather their boxes once for the batch kernel
+        gatherEnemyBoxes();
+
         for (auto& [playerId, force] : _forcePods) {
             collision::AABB forceBox{force.x, force.y, ForcePod::WIDTH, ForcePod::HEIGHT};
 
             // Collision with enemies (contact damage with cooldown)
-            for (auto& [enemyId, enemy] : _enemies) {
-                collision::AABB enemyBox{enemy.x, enemy.y, Enemy::WIDTH, Enemy::HEIGHT};
-
-                if (forceBox.intersects(enemyBox)) {
-                    // Check if this enemy is on cooldown
-                    auto cooldownIt = force.hitCooldowns.find(enemyId);
-                    if (cooldownIt != force.hitCooldowns.end() && cooldownIt->second > 0.0f) {
-                        continue;  // Skip, enemy was recently hit
-                    }
+            size_t hitCount = collision::intersectIndices(forceBox, _enemyBoxes.arrays(), _collisionHits.data());
+            for (size_t hit = 0; hit < hitCount; ++hit) {
+                auto& [enemyId, enemy] = *_collisionEnemies[_collisionHits[hit]];
+                // Check if this enemy is on cooldown
+                if (force.hitCooldowns.active(enemyId)) {
+                    continue;  // Skip, enemy was recently hit
+                }
 
-                    // Apply damage and set cooldown
-                    enemy.health = (enemy.health > ForcePod::CONTACT_DAMAGE) ?
-                                   enemy.health - ForcePod::CONTACT_DAMAGE : 0;
-                    force.hitCooldowns[enemyId] = ForcePod::HIT_COOLDOWN;
+                // Apply damage and set cooldown
+                damageEnemy(enemy, ForcePod::CONTACT_DAMAGE);
+                force.hitCooldowns.start(enemyId, ForcePod::HIT_COOLDOWN);
 
-                    if (enemy.health == 0) {
-                        _destroyedEnemies.push_back(enemyId);
+                if (enemyHealth(enemy) == 0) {
+                    auto [enemyX, enemyY] = enemyPosition(enemy);
+                    _destroyedEnemies.push_back(enemyId);
 #ifdef USE_ECS_BACKEND
-                        deleteEnemyEntity(enemyId);
+                    deleteEnemyEntity(enemyId);
 #endif
-                        EnemyType enemyType = static_cast<EnemyType>(enemy.enemy_type);
-                        // Force Pod kills count as player's current weapon
-                        auto playerIt = _players.find(playerId);
-                        WeaponType weapon = playerIt != _players.end() ? playerIt->second.currentWeapon : WeaponType::Standard;
-                        awardKillScore(playerId, enemyType, weapon);
-
-                        // POWArmor always drops power-up, other enemies have a chance
-                        std::uniform_int_distribution<int> dropDist(0, 99);
-                        if (enemyType == EnemyType::POWArmor ||
-                            dropDist(_rng) < POWERUP_DROP_CHANCE) {
-                            spawnPowerUp(enemy.x, enemy.y);
-                        }
+                    EnemyType enemyType = static_cast<EnemyType>(enemy.enemy_type);
+                    // Force Pod kills count as player's current weapon
+                    auto playerIt = _players.find(playerId);
+                    WeaponType weapon = playerIt != _players.end() ? playerIt->second.currentWeapon : WeaponType::Standard;
+                    awardKillScore(playerId, enemyType, weapon);
+
+                    // POWArmor always drops power-up, other enemies have a chance
+                    std::uniform_int_distribution<int> dropDist(0, 99);
+                    if (enemyType == EnemyType::POWArmor ||
+                        dropDist(_rng) < POWERUP_DROP_CHANCE) {
+                        spawnPowerUp(enemyX, enemyY);
                     }
                 }
             }
@@ -3306,7 +3379,7 @@ namespace infrastructure::game {
             }
 
             // Block enemy missiles
-            std::vector<uint16_t> blockedMissiles;
+            std::pmr::vector<uint16_t> blockedMissiles(_frameArena.resource());
             for (auto& [missileId, missile] : _enemyMissiles) {
                 collision::AABB missileBox{missile.x, missile.y,
                                            Missile::WIDTH, Missile::HEIGHT};
@@ -3340,8 +3413,9 @@ namespace infrastructure::game {
         float nearestDist = 99999.0f;
 
         for (const auto& [enemyId, enemy] : _enemies) {
-            float dx = enemy.x - x;
-            float dy = enemy.y - y;
+            auto [enemyX, enemyY] = enemyPosition(enemy);
+            float dx = enemyX - x;
+            float dy = enemyY - y;
             float dist = std::sqrt(dx * dx + dy * dy);
             if (dist < nearestDist) {
                 nearestDist = dist;
@@ -3395,8 +3469,8 @@ namespace infrastructure::game {
         return id;
     }
 
-    std::vector<uint16_t> GameWorld::spawnForceMissiles(uint8_t playerId) {
-        std::vector<uint16_t> spawnedIds;
+    std::pmr::vector<uint16_t> GameWorld::spawnForceMissiles(uint8_t playerId) {
+        std::pmr::vector<uint16_t> spawnedIds(_frameArena.resource());
 
         // Check if player has Force Pod attached
         auto forceIt = _forcePods.find(playerId);
@@ -3523,9 +3597,9 @@ namespace infrastructure::game {
         // If already has Bits, do nothing
         if (_bitDevices.find(playerId) != _bitDevices.end()) return;
 
-        const auto& player = playerIt->second;
-        float px = static_cast<float>(player.x) + PLAYER_SHIP_WIDTH / 2.0f;
-        float py = static_cast<float>(player.y) + PLAYER_SHIP_HEIGHT / 2.0f;
+        auto [playerX, playerY] = playerPosition(playerIt->second);
+        float px = playerX + PLAYER_SHIP_WIDTH / 2.0f;
+        float py = playerY + PLAYER_SHIP_HEIGHT / 2.0f;
 
         // Create 2 Bits (opposite sides of orbit)
         std::array<BitDevice, 2> bits;
@@ -3559,8 +3633,9 @@ namespace infrastructure::game {
             auto playerIt = _players.find(playerId);
             if (playerIt == _players.end()) continue;
 
-            float px = static_cast<float>(playerIt->second.x) + PLAYER_SHIP_WIDTH / 2.0f;
-            float py = static_cast<float>(playerIt->second.y) + PLAYER_SHIP_HEIGHT / 2.0f;
+            auto [playerX, playerY] = playerPosition(playerIt->second);
+            float px = playerX + PLAYER_SHIP_WIDTH / 2.0f;
+            float py = playerY + PLAYER_SHIP_HEIGHT / 2.0f;
 
             for (auto& bit : bits) {
                 // Decrement shoot cooldown
@@ -3569,14 +3644,7 @@ namespace infrastructure::game {
                 }
 
                 // Decrement hit cooldowns
-                for (auto it = bit.hitCooldowns.begin(); it != bit.hitCooldowns.end();) {
-                    it->second -= deltaTime;
-                    if (it->second <= 0.0f) {
-                        it = bit.hitCooldowns.erase(it);
-                    } else {
-                        ++it;
-                    }
-                }
+                bit.hitCooldowns.update(deltaTime);
                 if (bit.bossHitCooldown > 0.0f) {
                     bit.bossHitCooldown -= deltaTime;
                 }
@@ -3596,42 +3664,42 @@ namespace infrastructure::game {
     }
 
     void GameWorld::checkBitCollisions() {
-        std::vector<uint16_t> killedEnemies;
+        std::pmr::vector<uint16_t> killedEnemies(_frameArena.resource());
+
+        // Enemies are only erased after the loop: gather their boxes once for the batch kernel
+        gatherEnemyBoxes();
 
         for (auto& [playerId, bits] : _bitDevices) {
             for (auto& bit : bits) {
                 collision::AABB bitBox{bit.x, bit.y, BitDevice::WIDTH, BitDevice::HEIGHT};
 
                 // Collision with enemies (contact damage)
-                for (auto& [enemyId, enemy] : _enemies) {
-                    collision::AABB enemyBox{enemy.x, enemy.y, Enemy::WIDTH, Enemy::HEIGHT};
-
-                    if (bitBox.intersects(enemyBox)) {
-                        // Check cooldown
-                        auto cooldownIt = bit.hitCooldowns.find(enemyId);
-                        if (cooldownIt != bit.hitCooldowns.end() && cooldownIt->second > 0.0f) {
-                            continue;
-                        }
+                size_t hitCount = collision::intersectIndices(bitBox, _enemyBoxes.arrays(), _collisionHits.data());
+                for (size_t hit = 0; hit < hitCount; ++hit) {
+                    auto& [enemyId, enemy] = *_collisionEnemies[_collisionHits[hit]];
+                    // Check cooldown
+                    if (bit.hitCooldowns.active(enemyId)) {
+                        continue;
+                    }
+
+                    // Apply damage
+                    damageEnemy(enemy, BitDevice::CONTACT_DAMAGE);
+                    bit.hitCooldowns.start(enemyId, BitDevice::HIT_COOLDOWN);
 
-                        // Apply damage
-                        enemy.health = (enemy.health > BitDevice::CONTACT_DAMAGE) ?
-                                       enemy.health - BitDevice::CONTACT_DAMAGE : 0;
-                        bit.hitCooldowns[enemyId] = BitDevice::HIT_COOLDOWN;
-
-                        if (enemy.health == 0) {
-                            killedEnemies.push_back(enemyId);
-                            EnemyType enemyType = static_cast<EnemyType>(enemy.enemy_type);
-                            // Bit Device kills count as player's current weapon
-                            auto playerIt = _players.find(playerId);
-                            WeaponType weapon = playerIt != _players.end() ? playerIt->second.currentWeapon : WeaponType::Standard;
-                            awardKillScore(playerId, enemyType, weapon);
-
-                            // POWArmor always drops power-up, others have a chance
-                            std::uniform_int_distribution<int> dropDist(0, 99);
-                            if (enemyType == EnemyType::POWArmor ||
-                                dropDist(_rng) < POWERUP_DROP_CHANCE) {
-                                spawnPowerUp(enemy.x, enemy.y);
-                            }
+                    if (enemyHealth(enemy) == 0) {
+                        killedEnemies.push_back(enemyId);
+                        EnemyType enemyType = static_cast<EnemyType>(enemy.enemy_type);
+                        // Bit Device kills count as player's current weapon
+                        auto playerIt = _players.find(playerId);
+                        WeaponType weapon = playerIt != _players.end() ? playerIt->second.currentWeapon : WeaponType::Standard;
+                        awardKillScore(playerId, enemyType, weapon);
+
+                        // POWArmor always drops power-up, others have a chance
+                        std::uniform_int_distribution<int> dropDist(0, 99);
+                        if (enemyType == EnemyType::POWArmor ||
+                            dropDist(_rng) < POWERUP_DROP_CHANCE) {
+                            auto [enemyX, enemyY] = enemyPosition(enemy);
+                            spawnPowerUp(enemyX, enemyY);
                         }
                     }
                 }
@@ -3664,8 +3732,8 @@ namespace infrastructure::game {
         return _bitDevices.find(playerId) != _bitDevices.end();
     }
 
-    std::vector<uint16_t> GameWorld::spawnBitMissiles(uint8_t playerId) {
-        std::vector<uint16_t> spawnedIds;
+    std::pmr::vector<uint16_t> GameWorld::spawnBitMissiles(uint8_t playerId) {
+        std::pmr::vector<uint16_t> spawnedIds(_frameArena.resource());
 
         auto bitsIt = _bitDevices.find(playerId);
         if (bitsIt == _bitDevices.end()) return spawnedIds;
@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SimulationClock implementation
+*/
+
+#include "infrastructure/game/SimulationClock.hpp"
+#include <algorithm>
+
+namespace infrastructure::game {
+
+    SimulationClock::SimulationClock(SimulationRates rates) {
+        setRates(rates);
+    }
+
+    SimulationClock::Clock::duration SimulationClock::intervalOf(uint32_t perSecond) {
+        return std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(1)) / std::max<uint32_t>(perSecond, 1);
+    }
+
+    void SimulationClock::setRates(const SimulationRates& rates) {
+        SimulationRates normalized = rates;
+        normalized.tickRate = std::max<uint32_t>(normalized.tickRate, 1);
+        normalized.snapshotRate = std::clamp<uint32_t>(normalized.snapshotRate, 1, normalized.tickRate);
+        normalized.maxCatchUpTicks = std::max<uint32_t>(normalized.maxCatchUpTicks, 1);
+        if (normalized == _rates && _tickInterval != Clock::duration::zero()) {
+            return;
+        }
+        _rates = normalized;
+
+        _tickInterval = intervalOf(_rates.tickRate);
+        _snapshotInterval = intervalOf(_rates.snapshotRate);
+        _tickSeconds = std::chrono::duration<float>(_tickInterval).count();
+        _lastFrame.reset();
+        _tickAccumulator = Clock::duration::zero();
+        _snapshotAccumulator = Clock::duration::zero();
+    }
+
+    SimulationClock::Step SimulationClock::advance(Clock::time_point now) {
+        if (!_lastFrame) {
+            _lastFrame = now;
+            _tickAccumulator = _tickInterval;
+            _snapshotAccumulator = _snapshotInterval;
+        }
+        const Clock::duration elapsed = std::max(now - *_lastFrame, Clock::duration::zero());
+        _lastFrame = now;
+        _tickAccumulator += elapsed;
+        _snapshotAccumulator += elapsed;
+
+        Step step;
+        const auto owed = static_cast<uint64_t>(_tickAccumulator / _tickInterval);
+        _tickAccumulator -= _tickInterval * owed;
+        step.ticks = static_cast<uint32_t>(std::min<uint64_t>(owed, _rates.maxCatchUpTicks));
+        step.skipped = static_cast<uint32_t>(owed - step.ticks);
+
+        if (_snapshotAccumulator >= _snapshotInterval) {
+            step.snapshotDue = true;
+            // One snapshot per frame: those a late frame missed are dropped, not sent in a burst
+            _snapshotAccumulator %= _snapshotInterval;
+        }
+
+        _ticksRun.fetch_add(step.ticks, std::memory_order_relaxed);
+        _ticksSkipped.fetch_add(step.skipped, std::memory_order_relaxed);
+        if (step.snapshotDue) {
+            _snapshotsDue.fetch_add(1, std::memory_order_relaxed);
+        }
+        return step;
+    }
+
+}
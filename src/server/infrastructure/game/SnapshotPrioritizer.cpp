@@ -0,0 +1,193 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SnapshotPrioritizer implementation
+*/
+
+#include "infrastructure/game/SnapshotPrioritizer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace infrastructure::game {
+
+    namespace {
+        enum class Kind : uint8_t { Missile, Enemy, EnemyMissile };
+
+        struct Pick {
+            float priority;
+            Kind kind;
+            uint16_t index;  // In the candidate list of its kind
+        };
+
+        size_t wireSizeOf(Kind kind) {
+            return kind == Kind::Enemy ? EnemyState::WIRE_SIZE : MissileState::WIRE_SIZE;
+        }
+    }
+
+    bool SnapshotPrioritizer::fitsWhole(const SnapshotCandidates& candidates, size_t budget) {
+        if (candidates.missiles.size() > MAX_MISSILES
+            || candidates.enemies.size() > MAX_ENEMIES
+            || candidates.enemyMissiles.size() > MAX_ENEMY_MISSILES) {
+            return false;
+        }
+        size_t size = candidates.base.wire_size()
+            + candidates.missiles.size() * MissileState::WIRE_SIZE
+            + candidates.enemies.size() * EnemyState::WIRE_SIZE
+            + candidates.enemyMissiles.size() * MissileState::WIRE_SIZE;
+        return size <= budget;
+    }
+
+    void SnapshotPrioritizer::takeFirst(const SnapshotCandidates& candidates, GameSnapshot& out) {
+        out = candidates.base;
+        out.missile_count = static_cast<uint8_t>(std::min<size_t>(candidates.missiles.size(), MAX_MISSILES));
+        std::copy_n(candidates.missiles.begin(), out.missile_count, out.missiles);
+        out.enemy_count = static_cast<uint8_t>(std::min<size_t>(candidates.enemies.size(), MAX_ENEMIES));
+        std::copy_n(candidates.enemies.begin(), out.enemy_count, out.enemies);
+        out.enemy_missile_count = static_cast<uint8_t>(
+            std::min<size_t>(candidates.enemyMissiles.size(), MAX_ENEMY_MISSILES));
+        std::copy_n(candidates.enemyMissiles.begin(), out.enemy_missile_count, out.enemy_missiles);
+    }
+
+    void SnapshotPrioritizer::select(uint8_t playerId, const SnapshotCandidates& candidates, size_t budget,
+                                     std::pmr::memory_resource* scratch, GameSnapshot& out) {
+        Viewer& viewer = _viewers[playerId];
+        const uint32_t stamp = ++viewer.stamp;
+
+        // Where the player's ship is; a dead or unknown player weighs everything the same
+        bool hasShip = false;
+        float shipX = 0.0f;
+        float shipY = 0.0f;
+        for (uint8_t i = 0; i < candidates.base.player_count; ++i) {
+            const PlayerState& ps = candidates.base.players[i];
+            if (ps.id == playerId && ps.alive) {
+                hasShip = true;
+                shipX = ps.x;
+                shipY = ps.y;
+                break;
+            }
+        }
+
+        std::pmr::vector<Pick> picks(scratch);
+        picks.reserve(candidates.missiles.size() + candidates.enemies.size() + candidates.enemyMissiles.size());
+
+        auto accumulate = [&](EntityTable<Interest>& table, Kind kind, size_t index,
+                              uint16_t id, uint16_t x, uint16_t y, uint8_t health, float weight) {
+            const bool fresh = !table.contains(id);
+            Interest& interest = table[id];
+            if (fresh) {
+                interest = Interest{NEW_ENTITY_PRIORITY, x, y, health, stamp};
+            } else {
+                float proximity = 1.0f;
+                if (hasShip) {
+                    float distance = std::hypot(static_cast<float>(x) - shipX, static_cast<float>(y) - shipY);
+                    proximity += NEAR_BOOST * std::max(0.0f, 1.0f - distance / INTEREST_RADIUS);
+                }
+                float error = static_cast<float>(std::abs(x - interest.sentX) + std::abs(y - interest.sentY)
+                    + 4 * std::abs(health - interest.sentHealth));
+                float change = std::min(error / CHANGE_SCALE, MAX_CHANGE_BOOST);
+                interest.priority += weight * proximity * (1.0f + change);
+                interest.seen = stamp;
+            }
+            picks.push_back({interest.priority, kind, static_cast<uint16_t>(index)});
+        };
+
+        for (size_t i = 0; i < candidates.missiles.size(); ++i) {
+            const MissileState& ms = candidates.missiles[i];
+            accumulate(viewer.missiles, Kind::Missile, i, ms.id, ms.x, ms.y, 0, MISSILE_WEIGHT);
+        }
+        for (size_t i = 0; i < candidates.enemies.size(); ++i) {
+            const EnemyState& es = candidates.enemies[i];
+            accumulate(viewer.enemies, Kind::Enemy, i, es.id, es.x, es.y, es.health, ENEMY_WEIGHT);
+        }
+        for (size_t i = 0; i < candidates.enemyMissiles.size(); ++i) {
+            const MissileState& ms = candidates.enemyMissiles[i];
+            accumulate(viewer.enemyMissiles, Kind::EnemyMissile, i, ms.id, ms.x, ms.y, 0, ENEMY_MISSILE_WEIGHT);
+        }
+
+        // Entities gone from the world
+        for (auto* table : {&viewer.missiles, &viewer.enemies, &viewer.enemyMissiles}) {
+            for (auto it = table->begin(); it != table->end();) {
+                it = it->second.seen == stamp ? std::next(it) : table->erase(it);
+            }
+        }
+
+        // Highest priority first (ties in world order); a pick that doesn't fit leaves room for smaller ones behind it
+        std::sort(picks.begin(), picks.end(), [](const Pick& a, const Pick& b) {
+            if (a.priority != b.priority) {
+                return a.priority > b.priority;
+            }
+            return a.kind != b.kind ? a.kind < b.kind : a.index < b.index;
+        });
+
+        out = candidates.base;
+        out.missile_count = 0;
+        out.enemy_count = 0;
+        out.enemy_missile_count = 0;
+        size_t size = out.wire_size();
+        size_t kept = 0;
+        for (const Pick& pick : picks) {
+            uint8_t count = pick.kind == Kind::Missile ? out.missile_count
+                : pick.kind == Kind::Enemy ? out.enemy_count : out.enemy_missile_count;
+            uint8_t cap = pick.kind == Kind::Missile ? MAX_MISSILES
+                : pick.kind == Kind::Enemy ? MAX_ENEMIES : MAX_ENEMY_MISSILES;
+            if (count >= cap || size + wireSizeOf(pick.kind) > budget) {
+                continue;
+            }
+            size += wireSizeOf(pick.kind);
+            if (pick.kind == Kind::Missile) {
+                out.missile_count++;
+            } else if (pick.kind == Kind::Enemy) {
+                out.enemy_count++;
+            } else {
+                out.enemy_missile_count++;
+            }
+            picks[kept++] = pick;
+        }
+        picks.resize(kept);
+
+        // Sent in world order, which keeps the slots of the delta images stable
+        std::sort(picks.begin(), picks.end(), [](const Pick& a, const Pick& b) {
+            return a.kind != b.kind ? a.kind < b.kind : a.index < b.index;
+        });
+        out.missile_count = 0;
+        out.enemy_count = 0;
+        out.enemy_missile_count = 0;
+        for (const Pick& pick : picks) {
+            if (pick.kind == Kind::Missile) {
+                const MissileState& ms = candidates.missiles[pick.index];
+                out.missiles[out.missile_count++] = ms;
+                viewer.missiles.find(ms.id)->second = Interest{0.0f, ms.x, ms.y, 0, stamp};
+            } else if (pick.kind == Kind::Enemy) {
+                const EnemyState& es = candidates.enemies[pick.index];
+                out.enemies[out.enemy_count++] = es;
+                viewer.enemies.find(es.id)->second = Interest{0.0f, es.x, es.y, es.health, stamp};
+            } else {
+                const MissileState& ms = candidates.enemyMissiles[pick.index];
+                out.enemy_missiles[out.enemy_missile_count++] = ms;
+                viewer.enemyMissiles.find(ms.id)->second = Interest{0.0f, ms.x, ms.y, 0, stamp};
+            }
+        }
+    }
+
+    compression::SnapshotHistory& SnapshotPrioritizer::history(uint8_t playerId) {
+        return *_viewers[playerId].history;
+    }
+
+    const compression::SnapshotHistory* SnapshotPrioritizer::findHistory(uint8_t playerId) const {
+        auto it = _viewers.find(playerId);
+        return it == _viewers.end() ? nullptr : it->second.history.get();
+    }
+
+    void SnapshotPrioritizer::forget(uint16_t sequence) {
+        for (auto& [playerId, viewer] : _viewers) {
+            viewer.history->forget(sequence);
+        }
+    }
+
+    void SnapshotPrioritizer::removePlayer(uint8_t playerId) {
+        _viewers.erase(playerId);
+    }
+
+}
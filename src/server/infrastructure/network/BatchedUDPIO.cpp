@@ -0,0 +1,207 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BatchedUDPIO implementation
+*/
+
+#include "infrastructure/network/BatchedUDPIO.hpp"
+
+#ifdef __linux__
+
+#include "infrastructure/logging/Logger.hpp"
+#include <cerrno>
+#include <cstring>
+
+namespace infrastructure::network {
+
+namespace {
+    // BatchedUDPIO whose FlushScope is open on this thread
+    thread_local BatchedUDPIO* t_flushScope = nullptr;
+}
+
+BatchedUDPIO::BatchedUDPIO(boost::asio::io_context& io_ctx, udp::socket& socket, std::size_t datagramCapacity)
+    : _io_ctx(io_ctx),
+      _socket(socket),
+      _datagramCapacity(datagramCapacity),
+      _receiveBuffers(BATCH_SIZE * datagramCapacity) {
+    _pending.reserve(PENDING_CAPACITY);
+    _draining.reserve(PENDING_CAPACITY);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Receive
+// ═══════════════════════════════════════════════════════════════════════════
+
+void BatchedUDPIO::startReceiving(ReceiveHandler onDatagram, ErrorHandler onError) {
+    _onDatagram = std::move(onDatagram);
+    _onError = std::move(onError);
+    _socket.non_blocking(true);
+    waitReadable();
+}
+
+void BatchedUDPIO::waitReadable() {
+    _socket.async_wait(udp::socket::wait_read, [this](const boost::system::error_code& ec) {
+        if (ec) {
+            if (ec != boost::asio::error::operation_aborted) {
+                _onError(ec);
+                waitReadable();
+            }
+            return;
+        }
+        drain();
+        waitReadable();
+    });
+}
+
+void BatchedUDPIO::drain() {
+    FlushScope scope(this);  // Replies queued while handling the batch go out together
+    const int fd = _socket.native_handle();
+
+    for (std::size_t round = 0; round < MAX_BATCHES_PER_WAKEUP; round++) {
+        // recvmmsg overwrites the lengths: reset every header before each call
+        for (std::size_t i = 0; i < BATCH_SIZE; i++) {
+            _receiveIovecs[i].iov_base = _receiveBuffers.data() + i * _datagramCapacity;
+            _receiveIovecs[i].iov_len = _datagramCapacity;
+            _receiveHeaders[i].msg_hdr = msghdr{};
+            _receiveHeaders[i].msg_hdr.msg_name = &_receiveAddrs[i];
+            _receiveHeaders[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+            _receiveHeaders[i].msg_hdr.msg_iov = &_receiveIovecs[i];
+            _receiveHeaders[i].msg_hdr.msg_iovlen = 1;
+            _receiveHeaders[i].msg_len = 0;
+        }
+
+        int received = ::recvmmsg(fd, _receiveHeaders.data(), BATCH_SIZE, MSG_DONTWAIT, nullptr);
+        _receiveSyscalls.fetch_add(1, std::memory_order_relaxed);
+        if (received < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                _onError(boost::system::error_code(errno, boost::system::system_category()));
+            }
+            return;
+        }
+        _datagramsReceived.fetch_add(static_cast<uint64_t>(received), std::memory_order_relaxed);
+
+        for (int i = 0; i < received; i++) {
+            const auto& header = _receiveHeaders[i];
+            if (header.msg_hdr.msg_flags & MSG_TRUNC) {
+                continue;  // Larger than any valid datagram, same as a short read in the single-read path
+            }
+            udp::endpoint from;
+            std::memcpy(from.data(), &_receiveAddrs[i], header.msg_hdr.msg_namelen);
+            from.resize(header.msg_hdr.msg_namelen);
+            _onDatagram(from, static_cast<const uint8_t*>(_receiveIovecs[i].iov_base), header.msg_len);
+        }
+
+        if (static_cast<std::size_t>(received) < BATCH_SIZE) {
+            return;  // Socket drained
+        }
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Send
+// ═══════════════════════════════════════════════════════════════════════════
+
+void BatchedUDPIO::queue(const udp::endpoint& endpoint, const SharedSendBuffer& buffer) {
+    {
+        std::lock_guard<std::mutex> lock(_pendingMutex);
+        _pending.push_back({endpoint, buffer});
+    }
+
+    // The open scope flushes when its batch ends; other sends still go out right away
+    if (t_flushScope == this) {
+        return;
+    }
+    if (!_flushPosted.exchange(true, std::memory_order_acq_rel)) {
+        boost::asio::post(_io_ctx, [this]() {
+            _flushPosted.store(false, std::memory_order_release);
+            flush();
+        });
+    }
+}
+
+void BatchedUDPIO::flush() {
+    std::lock_guard<std::mutex> flushLock(_flushMutex);
+    {
+        std::lock_guard<std::mutex> lock(_pendingMutex);
+        if (_pending.empty()) {
+            return;
+        }
+        _pending.swap(_draining);
+    }
+
+    for (std::size_t first = 0; first < _draining.size(); first += BATCH_SIZE) {
+        sendBatch(first, std::min(BATCH_SIZE, _draining.size() - first));
+    }
+    _draining.clear();  // Drops the buffer references; capacity is kept for the next tick
+}
+
+BatchedUDPIO::FlushScope::FlushScope(BatchedUDPIO* io)
+    : _io(io), _previous(t_flushScope) {
+    if (_io) {
+        t_flushScope = _io;
+    }
+}
+
+BatchedUDPIO::FlushScope::~FlushScope() {
+    if (_io) {
+        t_flushScope = _previous;
+        _io->flush();
+    }
+}
+
+void BatchedUDPIO::sendBatch(std::size_t first, std::size_t count) {
+    std::array<mmsghdr, BATCH_SIZE> headers{};
+    std::array<iovec, BATCH_SIZE> iovecs{};
+
+    for (std::size_t i = 0; i < count; i++) {
+        const Outgoing& datagram = _draining[first + i];
+        iovecs[i].iov_base = const_cast<uint8_t*>(datagram.buffer.data());
+        iovecs[i].iov_len = datagram.buffer.size();
+        headers[i].msg_hdr.msg_name = const_cast<sockaddr*>(datagram.endpoint.data());
+        headers[i].msg_hdr.msg_namelen = static_cast<socklen_t>(datagram.endpoint.size());
+        headers[i].msg_hdr.msg_iov = &iovecs[i];
+        headers[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    const int fd = _socket.native_handle();
+    std::size_t sent = 0;
+    while (sent < count) {
+        int result = ::sendmmsg(fd, headers.data() + sent, static_cast<unsigned int>(count - sent), MSG_DONTWAIT);
+        _sendSyscalls.fetch_add(1, std::memory_order_relaxed);
+        if (result > 0) {
+            _datagramsSent.fetch_add(static_cast<uint64_t>(result), std::memory_order_relaxed);
+            sent += static_cast<std::size_t>(result);
+            continue;
+        }
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            // Send buffer full: let the reactor wait for room, one datagram at a time
+            for (; sent < count; sent++) {
+                sendOne(_draining[first + sent]);
+            }
+            return;
+        }
+        // This datagram was rejected (e.g. unreachable address): report it and move on
+        server::logging::Logger::getNetworkLogger()->error("Send error: {}", std::strerror(errno));
+        sent++;
+    }
+}
+
+void BatchedUDPIO::sendOne(const Outgoing& datagram) {
+    _socket.async_send_to(
+        boost::asio::buffer(datagram.buffer.data(), datagram.buffer.size()),
+        datagram.endpoint,
+        [buffer = datagram.buffer](boost::system::error_code ec, std::size_t) {
+            if (ec) {
+                server::logging::Logger::getNetworkLogger()->error("Send error: {}", ec.message());
+            }
+        }
+    );
+}
+
+} // namespace infrastructure::network
+
+#endif /* __linux__ */
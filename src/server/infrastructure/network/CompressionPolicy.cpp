@@ -0,0 +1,193 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** CompressionPolicy implementation
+*/
+
+#include "infrastructure/network/CompressionPolicy.hpp"
+#include "Protocol.hpp"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <lz4hc.h>
+
+namespace infrastructure::network {
+
+// ============================================================================
+// TypeStats
+// ============================================================================
+
+uint64_t CompressionPolicy::TypeStats::messages() const {
+    uint64_t total = 0;
+    for (const CodecStats& codec : codecs) {
+        total += codec.messages;
+    }
+    return total;
+}
+
+uint64_t CompressionPolicy::TypeStats::bytesIn() const {
+    uint64_t total = 0;
+    for (const CodecStats& codec : codecs) {
+        total += codec.bytesIn;
+    }
+    return total;
+}
+
+uint64_t CompressionPolicy::TypeStats::bytesOut() const {
+    uint64_t total = 0;
+    for (const CodecStats& codec : codecs) {
+        total += codec.bytesOut;
+    }
+    return total;
+}
+
+double CompressionPolicy::TypeStats::ratio() const {
+    const uint64_t in = bytesIn();
+    return in > 0 ? static_cast<double>(bytesOut()) / static_cast<double>(in) : 1.0;
+}
+
+// ============================================================================
+// Decision
+// ============================================================================
+
+CompressionPolicy::TypeSlot* CompressionPolicy::slotFor(uint16_t type) {
+    const size_t start = (static_cast<uint32_t>(type) * 0x9E3779B1u) >> 26;  // 64 slots
+    for (size_t probe = 0; probe < MAX_TYPES; ++probe) {
+        TypeSlot& slot = _slots[(start + probe) % MAX_TYPES];
+        uint32_t current = slot.type.load(std::memory_order_acquire);
+        if (current == type) {
+            return &slot;
+        }
+        if (current == TypeSlot::EMPTY) {
+            if (slot.type.compare_exchange_strong(current, type, std::memory_order_acq_rel)) {
+                return &slot;
+            }
+            // Lost the race: the winner may have claimed it for this very type
+            if (current == type) {
+                return &slot;
+            }
+        }
+    }
+    return nullptr;
+}
+
+CompressionPolicy::Codec CompressionPolicy::choose(uint16_t type, size_t payloadSize, bool allowHigh) {
+    if (payloadSize < MIN_SIZE || payloadSize > MAX_SIZE) {
+        return Codec::None;
+    }
+    TypeSlot* slot = slotFor(type);
+    if (!slot) {
+        return Codec::Fast;
+    }
+
+    const CodecCounters& fast = slot->codecs[static_cast<size_t>(Codec::Fast)];
+    const CodecCounters& high = slot->codecs[static_cast<size_t>(Codec::High)];
+    const uint64_t attempts = fast.messages.load(std::memory_order_relaxed) + high.messages.load(std::memory_order_relaxed);
+    if (attempts >= WARMUP_MESSAGES) {
+        const uint64_t in = fast.bytesIn.load(std::memory_order_relaxed) + high.bytesIn.load(std::memory_order_relaxed);
+        const uint64_t out = fast.bytesOut.load(std::memory_order_relaxed) + high.bytesOut.load(std::memory_order_relaxed);
+        const bool pays = in > 0 && static_cast<double>(out) <= static_cast<double>(in) * (1.0 - MIN_SAVING);
+        if (!pays && (slot->skipped.fetch_add(1, std::memory_order_relaxed) + 1) % PROBE_INTERVAL != 0) {
+            return Codec::None;
+        }
+    }
+
+    if (allowHigh && payloadSize >= HIGH_MIN_SIZE) {
+        const uint64_t highMessages = high.messages.load(std::memory_order_relaxed);
+        const uint64_t highBytes = high.bytesIn.load(std::memory_order_relaxed);
+        if (highMessages < WARMUP_MESSAGES || highBytes == 0
+            || high.nanos.load(std::memory_order_relaxed) / highBytes <= HIGH_MAX_NANOS_PER_BYTE) {
+            return Codec::High;
+        }
+    }
+    return Codec::Fast;
+}
+
+void CompressionPolicy::record(uint16_t type, Codec codec, size_t payloadSize, size_t sentSize, uint64_t nanos) {
+    TypeSlot* slot = slotFor(type);
+    if (!slot) {
+        return;
+    }
+    CodecCounters& counters = slot->codecs[static_cast<size_t>(codec)];
+    counters.messages.fetch_add(1, std::memory_order_relaxed);
+    counters.bytesIn.fetch_add(payloadSize, std::memory_order_relaxed);
+    counters.bytesOut.fetch_add(sentSize, std::memory_order_relaxed);
+    counters.nanos.fetch_add(nanos, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// Compression
+// ============================================================================
+
+size_t CompressionPolicy::compress(uint16_t type, std::span<const uint8_t> src, std::span<uint8_t> dst,
+                                   compression::CompressionContext* context, bool useDictionary) {
+    const bool primed = useDictionary && context && context->hasDictionary();
+    const Codec codec = choose(type, src.size(), !primed);
+    if (codec == Codec::None) {
+        record(type, Codec::None, src.size(), src.size(), 0);
+        return 0;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    size_t compressedSize = 0;
+    if (codec == Codec::High) {
+        // The HC state is large (~256 KB): one per thread, allocated on its first HC payload
+        static thread_local std::unique_ptr<LZ4_streamHC_t> highState = std::make_unique<LZ4_streamHC_t>();
+        int result = LZ4_compress_HC_extStateHC(highState.get(),
+            reinterpret_cast<const char*>(src.data()), reinterpret_cast<char*>(dst.data()),
+            static_cast<int>(src.size()), static_cast<int>(dst.size()), LZ4HC_CLEVEL_DEFAULT);
+        compressedSize = result > 0 ? static_cast<size_t>(result) : 0;
+    } else {
+        static thread_local compression::CompressionContext fastContext;
+        compressedSize = (context ? *context : fastContext).compress(src, dst, useDictionary);
+    }
+    const auto nanos = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
+
+    // Worthwhile once the CompressionHeader is paid for
+    if (compressedSize == 0 || compressedSize + CompressionHeader::WIRE_SIZE >= src.size()) {
+        record(type, codec, src.size(), src.size(), nanos);
+        return 0;
+    }
+    record(type, codec, src.size(), compressedSize + CompressionHeader::WIRE_SIZE, nanos);
+    return compressedSize;
+}
+
+// ============================================================================
+// Stats
+// ============================================================================
+
+std::vector<CompressionPolicy::TypeStats> CompressionPolicy::getStats() const {
+    std::vector<TypeStats> result;
+    for (const TypeSlot& slot : _slots) {
+        const uint32_t type = slot.type.load(std::memory_order_acquire);
+        if (type == TypeSlot::EMPTY) {
+            continue;
+        }
+        TypeStats stats;
+        stats.type = static_cast<uint16_t>(type);
+        for (size_t i = 0; i < CODEC_COUNT; ++i) {
+            stats.codecs[i].messages = slot.codecs[i].messages.load(std::memory_order_relaxed);
+            stats.codecs[i].bytesIn = slot.codecs[i].bytesIn.load(std::memory_order_relaxed);
+            stats.codecs[i].bytesOut = slot.codecs[i].bytesOut.load(std::memory_order_relaxed);
+            stats.codecs[i].nanos = slot.codecs[i].nanos.load(std::memory_order_relaxed);
+        }
+        result.push_back(stats);
+    }
+    std::sort(result.begin(), result.end(), [](const TypeStats& a, const TypeStats& b) {
+        return a.bytesIn() > b.bytesIn();
+    });
+    return result;
+}
+
+const char* CompressionPolicy::codecName(Codec codec) {
+    switch (codec) {
+        case Codec::Fast: return "lz4";
+        case Codec::High: return "lz4hc";
+        case Codec::None: break;
+    }
+    return "none";
+}
+
+} // namespace infrastructure::network
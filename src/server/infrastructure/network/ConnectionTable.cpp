@@ -0,0 +1,195 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ConnectionTable implementation
+*/
+
+#include "infrastructure/network/ConnectionTable.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+
+namespace infrastructure::network {
+
+// ============================================================================
+// EndpointKey
+// ============================================================================
+
+EndpointKey EndpointKey::from(const udp::endpoint& endpoint) {
+    EndpointKey key;
+    const auto address = endpoint.address();
+    key.address = address.is_v4()
+        ? boost::asio::ip::make_address_v6(boost::asio::ip::v4_mapped, address.to_v4()).to_bytes()
+        : address.to_v6().to_bytes();
+    key.port = endpoint.port();
+    return key;
+}
+
+std::size_t EndpointKey::hash() const {
+    uint64_t high = 0;
+    uint64_t low = 0;
+    std::memcpy(&high, address.data(), sizeof(high));
+    std::memcpy(&low, address.data() + sizeof(high), sizeof(low));
+    // Clients mostly differ in the low address bytes and the port
+    uint64_t h = (low ^ (high * 0x9E3779B97F4A7C15ULL)) + port;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+}
+
+// ============================================================================
+// Connection
+// ============================================================================
+
+bool Connection::shouldTouchSession(std::chrono::steady_clock::time_point now) const {
+    const int64_t nowTicks = now.time_since_epoch().count();
+    const int64_t interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        ConnectionTable::SESSION_TOUCH_INTERVAL).count();
+    int64_t last = _lastSessionTouch.load(std::memory_order_relaxed);
+    if (last != 0 && nowTicks - last < interval) {
+        return false;
+    }
+    return _lastSessionTouch.compare_exchange_strong(last, nowTicks, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// Read side
+// ============================================================================
+
+const Connection* ConnectionTable::Table::find(const EndpointKey& key) const {
+    if (entries.empty()) {
+        return nullptr;
+    }
+    const std::size_t mask = entries.size() - 1;
+    for (std::size_t i = key.hash() & mask;; i = (i + 1) & mask) {
+        const Entry& entry = entries[i];
+        if (!entry.connection) {
+            return nullptr;
+        }
+        if (entry.key == key) {
+            return entry.connection.get();
+        }
+    }
+}
+
+ConnectionTable::Reader ConnectionTable::read(std::size_t reader) {
+    ReaderSlot& slot = _readers[reader % _readers.size()];
+    // Announce the epoch before loading the table: a writer that retires the table
+    // after this load sees the announcement and keeps it
+    slot.epoch.store(_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+    return Reader(slot, _current.load(std::memory_order_seq_cst));
+}
+
+ConnectionTable::Reader::~Reader() {
+    _slot.epoch.store(0, std::memory_order_release);
+}
+
+const Connection* ConnectionTable::Reader::find(const udp::endpoint& endpoint) const {
+    return _table->find(EndpointKey::from(endpoint));
+}
+
+// ============================================================================
+// Write side
+// ============================================================================
+
+ConnectionTable::ConnectionTable(std::size_t readers)
+    : _readers(std::max<std::size_t>(readers, 1)), _current(new Table{}) {}
+
+ConnectionTable::~ConnectionTable() {
+    delete _current.load();
+    for (const Retired& retired : _retired) {
+        delete retired.table;
+    }
+}
+
+void ConnectionTable::insert(const udp::endpoint& endpoint, uint8_t playerId,
+                             std::weak_ptr<game::GameWorld> gameWorld,
+                             NetworkStats::Slot statsSlot, std::string endpointName) {
+    auto connection = std::make_shared<Connection>();
+    connection->playerId = playerId;
+    connection->gameWorld = std::move(gameWorld);
+    connection->statsSlot = statsSlot;
+    connection->endpoint = std::move(endpointName);
+    const EndpointKey key = EndpointKey::from(endpoint);
+
+    std::lock_guard<std::mutex> lock(_writeMutex);
+    std::vector<Entry> connections;
+    for (const Entry& entry : _current.load(std::memory_order_relaxed)->entries) {
+        if (entry.connection && !(entry.key == key)) {
+            connections.push_back(entry);
+        }
+    }
+    connections.push_back({key, std::move(connection)});
+    publish(std::move(connections));
+}
+
+void ConnectionTable::erase(const std::string& endpointName) {
+    std::lock_guard<std::mutex> lock(_writeMutex);
+    std::vector<Entry> connections;
+    bool found = false;
+    for (const Entry& entry : _current.load(std::memory_order_relaxed)->entries) {
+        if (!entry.connection) {
+            continue;
+        }
+        if (entry.connection->endpoint == endpointName) {
+            found = true;
+        } else {
+            connections.push_back(entry);
+        }
+    }
+    if (found) {
+        publish(std::move(connections));
+    }
+}
+
+void ConnectionTable::publish(std::vector<Entry> connections) {
+    auto* table = new Table{};
+    // At most half full, so probes stay short
+    table->entries.resize(std::bit_ceil(std::max<std::size_t>(connections.size() * 2, 16)));
+    const std::size_t mask = table->entries.size() - 1;
+    for (Entry& entry : connections) {
+        std::size_t i = entry.key.hash() & mask;
+        while (table->entries[i].connection) {
+            i = (i + 1) & mask;
+        }
+        table->entries[i] = std::move(entry);
+    }
+    table->count = connections.size();
+
+    const Table* old = _current.exchange(table, std::memory_order_seq_cst);
+    _retired.push_back({old, _epoch.fetch_add(1, std::memory_order_seq_cst)});
+    reclaim();
+}
+
+void ConnectionTable::reclaim() {
+    // Readers that entered at or before a table's retirement epoch may still hold it
+    uint64_t oldestReader = std::numeric_limits<uint64_t>::max();
+    for (const ReaderSlot& slot : _readers) {
+        const uint64_t epoch = slot.epoch.load(std::memory_order_seq_cst);
+        if (epoch != 0) {
+            oldestReader = std::min(oldestReader, epoch);
+        }
+    }
+    std::erase_if(_retired, [oldestReader](const Retired& retired) {
+        if (retired.epoch >= oldestReader) {
+            return false;
+        }
+        delete retired.table;
+        return true;
+    });
+}
+
+std::size_t ConnectionTable::size() const {
+    std::lock_guard<std::mutex> lock(_writeMutex);
+    return _current.load(std::memory_order_relaxed)->count;
+}
+
+std::size_t ConnectionTable::retiredCount() const {
+    std::lock_guard<std::mutex> lock(_writeMutex);
+    return _retired.size();
+}
+
+} // namespace infrastructure::network
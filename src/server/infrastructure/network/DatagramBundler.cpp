@@ -0,0 +1,116 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** DatagramBundler implementation
+*/
+
+#include "infrastructure/network/DatagramBundler.hpp"
+#include <cstring>
+
+namespace infrastructure::network {
+
+DatagramBundler::DatagramBundler(SendBufferPool& pool, Emit emit)
+    : _pool(pool), _emit(std::move(emit)) {}
+
+DatagramBundler::~DatagramBundler() {
+    flush();
+}
+
+void DatagramBundler::add(uint8_t clientId, const udp::endpoint& endpoint, uint32_t statsSlot,
+                          const SharedSendBuffer& datagram) {
+    _added++;
+    Open* open = datagram.size() >= UDPHeader::WIRE_SIZE ? openFor(clientId, endpoint, statsSlot) : nullptr;
+    if (!open) {
+        // Not a game datagram, or more clients than slots: sent on its own
+        _sent++;
+        _emit(endpoint, statsSlot, datagram);
+        return;
+    }
+
+    if (open->count > 0 && open->size + entrySize(datagram) > MAX_DATAGRAM) {
+        close(*open);
+        open->used = true;
+        open->clientId = clientId;
+        open->endpoint = endpoint;
+        open->statsSlot = statsSlot;
+    }
+    if (open->count == 0) {
+        open->first = datagram;
+        open->size = UDPHeader::WIRE_SIZE + entrySize(datagram);
+        open->count = 1;
+        return;
+    }
+    if (open->count == 1) {
+        open->bundle = _pool.acquire(MAX_DATAGRAM);
+        UDPHeader head{
+            .type = static_cast<uint16_t>(MessageType::Bundle),
+            .sequence_num = 0,
+            .timestamp = UDPHeader::getTimestamp()
+        };
+        head.to_bytes(open->bundle.data());
+        open->size = UDPHeader::WIRE_SIZE;
+        append(*open, open->first);
+    }
+    append(*open, datagram);
+    open->count++;
+}
+
+void DatagramBundler::flush() {
+    for (Open& open : _open) {
+        if (open.used) {
+            close(open);
+        }
+    }
+}
+
+DatagramBundler::Open* DatagramBundler::openFor(uint8_t clientId, const udp::endpoint& endpoint, uint32_t statsSlot) {
+    Open* unused = nullptr;
+    for (Open& open : _open) {
+        if (open.used && open.clientId == clientId) {
+            return &open;
+        }
+        if (!open.used && !unused) {
+            unused = &open;
+        }
+    }
+    if (unused) {
+        unused->used = true;
+        unused->clientId = clientId;
+        unused->endpoint = endpoint;
+        unused->statsSlot = statsSlot;
+    }
+    return unused;
+}
+
+void DatagramBundler::append(Open& open, const SharedSendBuffer& datagram) {
+    auto head = *UDPHeader::from_bytes(datagram.data(), datagram.size());
+    const std::size_t payloadSize = datagram.size() - UDPHeader::WIRE_SIZE;
+    BundleEntryHeader entry{
+        .type = head.type,
+        .sequence_num = head.sequence_num,
+        .size = static_cast<uint16_t>(payloadSize)
+    };
+    entry.to_bytes(open.bundle.data() + open.size);
+    std::memcpy(open.bundle.data() + open.size + BundleEntryHeader::WIRE_SIZE,
+                datagram.data() + UDPHeader::WIRE_SIZE, payloadSize);
+    open.size += BundleEntryHeader::WIRE_SIZE + payloadSize;
+}
+
+void DatagramBundler::close(Open& open) {
+    if (open.count == 1) {
+        _emit(open.endpoint, open.statsSlot, open.first);
+        _sent++;
+    } else if (open.count > 1) {
+        open.bundle.resize(open.size);
+        _emit(open.endpoint, open.statsSlot, open.bundle);
+        _sent++;
+    }
+    open = Open{};
+}
+
+std::size_t DatagramBundler::entrySize(const SharedSendBuffer& datagram) {
+    return BundleEntryHeader::WIRE_SIZE + datagram.size() - UDPHeader::WIRE_SIZE;
+}
+
+} // namespace infrastructure::network
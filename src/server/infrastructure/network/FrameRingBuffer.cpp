@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** FrameRingBuffer implementation
+*/
+
+#include "infrastructure/network/FrameRingBuffer.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace infrastructure::network {
+
+FrameRingBuffer::FrameRingBuffer(std::size_t capacity)
+    : _buffer(std::bit_ceil(std::max<std::size_t>(capacity, 64))) {}
+
+std::span<uint8_t> FrameRingBuffer::writable() {
+    if (size() == capacity()) {
+        return {};
+    }
+    const std::size_t tail = static_cast<std::size_t>(_write) & mask();
+    const std::size_t head = static_cast<std::size_t>(_read) & mask();
+    // Up to the end of the buffer, or up to the unread bytes if they are ahead
+    const std::size_t end = (tail < head) ? head : capacity();
+    return {_buffer.data() + tail, end - tail};
+}
+
+void FrameRingBuffer::commit(std::size_t bytes) {
+    _write += std::min(bytes, capacity() - size());
+}
+
+std::span<const uint8_t> FrameRingBuffer::peek(std::size_t offset, std::size_t length) {
+    if (length == 0 || offset + length > size()) {
+        return {};
+    }
+    const std::size_t start = static_cast<std::size_t>(_read + offset) & mask();
+    if (start + length <= capacity()) {
+        return {_buffer.data() + start, length};
+    }
+
+    // Straddles the wrap point: the end of the buffer, then its beginning
+    if (_scratch.size() < length) {
+        _scratch.resize(length);
+    }
+    const std::size_t first = capacity() - start;
+    std::memcpy(_scratch.data(), _buffer.data() + start, first);
+    std::memcpy(_scratch.data() + first, _buffer.data(), length - first);
+    ++_wrappedPeeks;
+    return {_scratch.data(), length};
+}
+
+void FrameRingBuffer::consume(std::size_t bytes) {
+    _read += std::min(bytes, size());
+    if (_read == _write) {
+        _read = 0;
+        _write = 0;
+    }
+}
+
+void FrameRingBuffer::reserve(std::size_t bytes) {
+    if (bytes <= capacity()) {
+        return;
+    }
+    std::vector<uint8_t> grown(std::bit_ceil(bytes));
+    const std::size_t buffered = size();
+    const std::size_t start = static_cast<std::size_t>(_read) & mask();
+    const std::size_t first = std::min(buffered, capacity() - start);
+    std::memcpy(grown.data(), _buffer.data() + start, first);
+    std::memcpy(grown.data() + first, _buffer.data(), buffered - first);
+    _buffer = std::move(grown);
+    _read = 0;
+    _write = buffered;
+}
+
+} // namespace infrastructure::network
@@ -0,0 +1,127 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** FrameWriteQueue implementation
+*/
+
+#include "infrastructure/network/FrameWriteQueue.hpp"
+
+namespace infrastructure::network {
+
+// ============================================================================
+// Buffers
+// ============================================================================
+
+FrameWriteQueue::Buffer FrameWriteQueue::acquire(std::size_t size) {
+    Buffer buffer;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_pool.empty()) {
+            buffer = std::move(_pool.back());
+            _pool.pop_back();
+        }
+    }
+    buffer.assign(size, 0);
+    return buffer;
+}
+
+void FrameWriteQueue::recycle(Buffer buffer) {
+    if (_pool.size() < MAX_POOLED && buffer.capacity() > 0 && buffer.capacity() <= MAX_POOLED_CAPACITY) {
+        buffer.clear();
+        _pool.push_back(std::move(buffer));
+    }
+}
+
+// ============================================================================
+// Queue
+// ============================================================================
+
+bool FrameWriteQueue::push(Buffer frame) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pending.push_back(std::move(frame));
+    ++_framesQueued;
+    if (_flushing) {
+        return false;
+    }
+    _flushing = true;
+    return true;
+}
+
+std::span<const uint8_t> FrameWriteQueue::beginFlush() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_pending.empty()) {
+        return {};
+    }
+    ++_flushes;
+
+    // How many frames go in this write: at least one, then as long as they fit
+    std::size_t count = 1;
+    std::size_t size = _pending.front().size();
+    while (count < _pending.size() && size + _pending[count].size() <= MAX_FLUSH_SIZE) {
+        size += _pending[count].size();
+        ++count;
+    }
+
+    if (count == 1) {
+        _inFlight = std::move(_pending.front());
+        _pending.pop_front();
+        return _inFlight;
+    }
+
+    if (!_pool.empty()) {
+        _inFlight = std::move(_pool.back());
+        _pool.pop_back();
+    }
+    _inFlight.clear();
+    _inFlight.reserve(size);
+    for (std::size_t i = 0; i < count; ++i) {
+        _inFlight.insert(_inFlight.end(), _pending.front().begin(), _pending.front().end());
+        recycle(std::move(_pending.front()));
+        _pending.pop_front();
+    }
+    return _inFlight;
+}
+
+bool FrameWriteQueue::endFlush() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    recycle(std::move(_inFlight));
+    _inFlight = {};
+    if (_pending.empty()) {
+        _flushing = false;
+        return false;
+    }
+    return true;
+}
+
+void FrameWriteQueue::reset() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (Buffer& frame : _pending) {
+        recycle(std::move(frame));
+    }
+    _pending.clear();
+    recycle(std::move(_inFlight));
+    _inFlight = {};
+    _flushing = false;
+}
+
+// ============================================================================
+// Stats
+// ============================================================================
+
+std::size_t FrameWriteQueue::pendingFrames() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _pending.size();
+}
+
+uint64_t FrameWriteQueue::getFramesQueued() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _framesQueued;
+}
+
+uint64_t FrameWriteQueue::getFlushes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _flushes;
+}
+
+} // namespace infrastructure::network
@@ -27,40 +27,75 @@ void NetworkStats::addBytesReceived(size_t bytes) {
 // Per-Player Stats
 // ═══════════════════════════════════════════════════════════════════════════
 
-void NetworkStats::registerPlayer(const std::string& endpoint) {
+NetworkStats::Slot NetworkStats::registerPlayer(const std::string& endpoint) {
     std::lock_guard<std::mutex> lock(_playerStatsMutex);
 
-    if (_playerStats.find(endpoint) == _playerStats.end()) {
-        PlayerNetworkStats stats;
-        stats.endpoint = endpoint;
-        stats.connectedAt = std::chrono::steady_clock::now();
-        stats.lastUpdate = stats.connectedAt;
-        _playerStats[endpoint] = stats;
+    auto it = _playerStats.find(endpoint);
+    if (it != _playerStats.end()) {
+        return it->second.slot;
     }
+
+    Slot slot = NO_SLOT;
+    if (!_freeSlots.empty()) {
+        slot = _freeSlots.back();
+        _freeSlots.pop_back();
+    } else if (_nextSlot < MAX_SLOTS) {
+        slot = _nextSlot++;
+    } else {
+        return NO_SLOT;
+    }
+
+    // A send still in flight for the previous owner may land here; a few stray bytes are fine
+    _slotCounters[slot].bytesSent.store(0, std::memory_order_relaxed);
+    _slotCounters[slot].bytesReceived.store(0, std::memory_order_relaxed);
+
+    PlayerNetworkStats stats;
+    stats.endpoint = endpoint;
+    stats.slot = slot;
+    stats.connectedAt = std::chrono::steady_clock::now();
+    stats.lastUpdate = stats.connectedAt;
+    _playerStats[endpoint] = stats;
+    return slot;
 }
 
 void NetworkStats::unregisterPlayer(const std::string& endpoint) {
     std::lock_guard<std::mutex> lock(_playerStatsMutex);
-    _playerStats.erase(endpoint);
+
+    auto it = _playerStats.find(endpoint);
+    if (it == _playerStats.end()) {
+        return;
+    }
+    _freeSlots.push_back(it->second.slot);
+    _playerStats.erase(it);
 }
 
-void NetworkStats::addBytesSentTo(const std::string& endpoint, size_t bytes) {
+NetworkStats::Slot NetworkStats::getSlot(const std::string& endpoint) const {
     std::lock_guard<std::mutex> lock(_playerStatsMutex);
 
     auto it = _playerStats.find(endpoint);
-    if (it != _playerStats.end()) {
-        it->second.bytesSent += bytes;
-        it->second.lastUpdate = std::chrono::steady_clock::now();
+    return it != _playerStats.end() ? it->second.slot : NO_SLOT;
+}
+
+void NetworkStats::addBytesSentTo(Slot slot, size_t bytes) {
+    if (slot < MAX_SLOTS) {
+        _slotCounters[slot].bytesSent.fetch_add(bytes, std::memory_order_relaxed);
     }
 }
 
-void NetworkStats::addBytesReceivedFrom(const std::string& endpoint, size_t bytes) {
-    std::lock_guard<std::mutex> lock(_playerStatsMutex);
+void NetworkStats::addBytesReceivedFrom(Slot slot, size_t bytes) {
+    if (slot < MAX_SLOTS) {
+        _slotCounters[slot].bytesReceived.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
 
-    auto it = _playerStats.find(endpoint);
-    if (it != _playerStats.end()) {
-        it->second.bytesReceived += bytes;
-        it->second.lastUpdate = std::chrono::steady_clock::now();
+void NetworkStats::syncCounters(PlayerNetworkStats& stats) const {
+    const auto& counters = _slotCounters[stats.slot];
+    uint64_t sent = counters.bytesSent.load(std::memory_order_relaxed);
+    uint64_t received = counters.bytesReceived.load(std::memory_order_relaxed);
+    if (sent != stats.bytesSent || received != stats.bytesReceived) {
+        stats.bytesSent = sent;
+        stats.bytesReceived = received;
+        stats.lastUpdate = std::chrono::steady_clock::now();
     }
 }
 
@@ -129,6 +164,8 @@ void NetworkStats::calculateRates() {
     std::lock_guard<std::mutex> lock(_playerStatsMutex);
 
     for (auto& [endpoint, stats] : _playerStats) {
+        syncCounters(stats);
+
         // OUT rate (server → player)
         uint64_t outDelta = stats.bytesSent - stats.lastBytesSent;
         stats.lastBytesSent = stats.bytesSent;
@@ -182,7 +219,9 @@ std::optional<PlayerNetworkStats> NetworkStats::getPlayerStats(const std::string
 
     auto it = _playerStats.find(endpoint);
     if (it != _playerStats.end()) {
-        return it->second;
+        PlayerNetworkStats stats = it->second;
+        syncCounters(stats);
+        return stats;
     }
     return std::nullopt;
 }
@@ -194,6 +233,7 @@ std::vector<std::pair<std::string, PlayerNetworkStats>> NetworkStats::getAllPlay
     result.reserve(_playerStats.size());
     for (const auto& [endpoint, stats] : _playerStats) {
         result.emplace_back(endpoint, stats);
+        syncCounters(result.back().second);
     }
     return result;
 }
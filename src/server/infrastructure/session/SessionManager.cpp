@@ -43,7 +43,7 @@ std::optional<SessionManager::CreateSessionResult> SessionManager::createSession
         // Expired session - clean it up
         _tokenToEmail.erase(existing.token.toHex());
         if (!existing.udpEndpoint.empty()) {
-            _endpointToEmail.erase(existing.udpEndpoint);
+            unbindEndpoint(existing.udpEndpoint);
         }
         _sessionsByEmail.erase(it);
     }
@@ -183,18 +183,20 @@ std::optional<Session> SessionManager::getSessionByEndpoint(const std::string& e
     return sessionIt->second;
 }
 
-void SessionManager::assignPlayerId(const std::string& endpoint, uint8_t playerId) {
+bool SessionManager::assignPlayerId(const std::string& endpoint, uint8_t playerId) {
     std::lock_guard<std::mutex> lock(_mutex);
 
     auto epIt = _endpointToEmail.find(endpoint);
     if (epIt == _endpointToEmail.end()) {
-        return;
+        return false;
     }
 
     auto sessionIt = _sessionsByEmail.find(epIt->second);
-    if (sessionIt != _sessionsByEmail.end()) {
-        sessionIt->second.playerId = playerId;
+    if (sessionIt == _sessionsByEmail.end()) {
+        return false;
     }
+    sessionIt->second.playerId = playerId;
+    return true;
 }
 
 std::optional<uint8_t> SessionManager::getPlayerIdByEndpoint(const std::string& endpoint) {
@@ -315,7 +317,7 @@ void SessionManager::removeSession(const std::string& email) {
     // Clean up indexes
     _tokenToEmail.erase(sessionIt->second.token.toHex());
     if (!sessionIt->second.udpEndpoint.empty()) {
-        _endpointToEmail.erase(sessionIt->second.udpEndpoint);
+        unbindEndpoint(sessionIt->second.udpEndpoint);
     }
 
     _sessionsByEmail.erase(sessionIt);
@@ -330,7 +332,7 @@ void SessionManager::removeSessionByEndpoint(const std::string& endpoint) {
     }
 
     std::string email = epIt->second;
-    _endpointToEmail.erase(epIt);
+    unbindEndpoint(endpoint);
 
     auto sessionIt = _sessionsByEmail.find(email);
     if (sessionIt != _sessionsByEmail.end()) {
@@ -348,7 +350,7 @@ void SessionManager::clearUDPBinding(const std::string& endpoint) {
     }
 
     std::string email = epIt->second;
-    _endpointToEmail.erase(epIt);
+    unbindEndpoint(endpoint);
 
     // Clear UDP binding from session but keep session active
     auto sessionIt = _sessionsByEmail.find(email);
@@ -398,7 +400,7 @@ std::vector<uint8_t> SessionManager::cleanupExpiredSessions() {
         if (sessionIt != _sessionsByEmail.end()) {
             _tokenToEmail.erase(sessionIt->second.token.toHex());
             if (!sessionIt->second.udpEndpoint.empty()) {
-                _endpointToEmail.erase(sessionIt->second.udpEndpoint);
+                unbindEndpoint(sessionIt->second.udpEndpoint);
             }
             _sessionsByEmail.erase(sessionIt);
         }
@@ -460,7 +462,7 @@ void SessionManager::banUser(const std::string& email) {
         // Remove the active session
         _tokenToEmail.erase(sessionIt->second.token.toHex());
         if (!sessionIt->second.udpEndpoint.empty()) {
-            _endpointToEmail.erase(sessionIt->second.udpEndpoint);
+            unbindEndpoint(sessionIt->second.udpEndpoint);
         }
         _sessionsByEmail.erase(sessionIt);
     }
@@ -582,7 +584,7 @@ void SessionManager::notifyPlayerLeaveGame(const std::string& email) {
                     email, static_cast<int>(playerId), roomCode, endpoint);
 
         // Clear UDP binding
-        _endpointToEmail.erase(session.udpEndpoint);
+        unbindEndpoint(session.udpEndpoint);
         session.udpBound = false;
         session.udpEndpoint.clear();
         session.playerId = std::nullopt;
@@ -650,6 +652,22 @@ void SessionManager::setGodModeChangedCallback(GodModeChangedCallback callback)
     _godModeChangedCallback = std::move(callback);
 }
 
+// ═══════════════════════════════════════════════════════════════════
+// UDP binding removal notification
+// ═══════════════════════════════════════════════════════════════════
+
+void SessionManager::setUDPBindingRemovedCallback(UDPBindingRemovedCallback callback) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _udpBindingRemovedCallback = std::move(callback);
+}
+
+void SessionManager::unbindEndpoint(const std::string& endpoint) {
+    if (_endpointToEmail.erase(endpoint) > 0 && _udpBindingRemovedCallback) {
+        // Under the lock, so a binding made after this call is never dropped by it
+        _udpBindingRemovedCallback(endpoint);
+    }
+}
+
 bool SessionManager::isPlayerInGodMode(uint8_t playerId) const {
     std::lock_guard<std::mutex> lock(_mutex);
 
@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** AABBBatchBenchmark - SIMD batch AABB kernel vs the scalar loop
+*/
+
+#include "collision/AABBBatch.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace collision;
+
+namespace {
+    using Kernel = std::size_t (*)(const AABB&, const AABBArrays&, uint32_t*);
+
+    // Nanoseconds per query, best of 5 runs
+    double measure(Kernel kernel, const AABBArrays& boxes, const std::vector<AABB>& queries,
+                   std::vector<uint32_t>& out, std::size_t& checksum) {
+        double best = 0.0;
+        for (int run = 0; run < 5; run++) {
+            auto start = std::chrono::steady_clock::now();
+            for (const auto& query : queries) {
+                checksum += kernel(query, boxes, out.data());
+            }
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            double ns = std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(queries.size());
+            if (run == 0 || ns < best) {
+                best = ns;
+            }
+        }
+        return best;
+    }
+}
+
+int main(int argc, char** argv) {
+    std::size_t queryCount = argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : 20000;
+    std::mt19937 rng(2025);
+    std::uniform_real_distribution<float> posX(0.0f, 1920.0f);
+    std::uniform_real_distribution<float> posY(0.0f, 1080.0f);
+    std::uniform_real_distribution<float> size(8.0f, 64.0f);
+
+    std::vector<AABB> queries;
+    for (std::size_t i = 0; i < queryCount; i++) {
+        queries.push_back({posX(rng), posY(rng), size(rng), size(rng)});
+    }
+
+    std::printf("kernel: %s\n", batchKernelName());
+    std::printf("%8s %14s %14s %9s\n", "boxes", "scalar ns/q", "batch ns/q", "speedup");
+    for (std::size_t count : {8u, 32u, 128u, 512u, 2048u, 8192u}) {
+        AABBBatch batch;
+        for (std::size_t i = 0; i < count; i++) {
+            batch.push({posX(rng), posY(rng), size(rng), size(rng)});
+        }
+        std::vector<uint32_t> out(count);
+        std::size_t scalarHits = 0;
+        std::size_t batchHits = 0;
+        double scalarNs = measure(intersectIndicesScalar, batch.arrays(), queries, out, scalarHits);
+        double batchNs = measure(intersectIndices, batch.arrays(), queries, out, batchHits);
+        if (scalarHits != batchHits) {
+            std::fprintf(stderr, "mismatch at %zu boxes: %zu vs %zu hits\n", count, scalarHits, batchHits);
+            return 1;
+        }
+        std::printf("%8zu %14.1f %14.1f %8.2fx\n", count, scalarNs, batchNs, scalarNs / batchNs);
+    }
+    return 0;
+}
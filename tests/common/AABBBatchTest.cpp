@@ -0,0 +1,148 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** AABBBatchTest - Tests for the SIMD batch AABB kernel against the scalar version
+*/
+
+#include <gtest/gtest.h>
+#include "collision/AABBBatch.hpp"
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace collision;
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+namespace {
+    AABBBatch randomBatch(std::mt19937& rng, std::size_t count) {
+        std::uniform_real_distribution<float> posX(-100.0f, 2000.0f);
+        std::uniform_real_distribution<float> posY(-100.0f, 1150.0f);
+        std::uniform_real_distribution<float> size(4.0f, 120.0f);
+        AABBBatch batch;
+        for (std::size_t i = 0; i < count; i++) {
+            batch.push({posX(rng), posY(rng), size(rng), size(rng)});
+        }
+        return batch;
+    }
+
+    std::vector<uint32_t> simd(const AABB& box, const AABBArrays& boxes) {
+        std::vector<uint32_t> hits(boxes.count);
+        hits.resize(intersectIndices(box, boxes, hits.data()));
+        return hits;
+    }
+
+    std::vector<uint32_t> scalar(const AABB& box, const AABBArrays& boxes) {
+        std::vector<uint32_t> hits(boxes.count);
+        hits.resize(intersectIndicesScalar(box, boxes, hits.data()));
+        return hits;
+    }
+}
+
+// ============================================================================
+// Tests - Batch
+// ============================================================================
+
+TEST(AABBBatchTest, StoresBoxesAsArrays) {
+    AABBBatch batch;
+    EXPECT_TRUE(batch.empty());
+    batch.push({1.0f, 2.0f, 3.0f, 4.0f});
+    batch.push({5.0f, 6.0f, 7.0f, 8.0f});
+
+    AABBArrays arrays = batch.arrays();
+    ASSERT_EQ(arrays.count, 2u);
+    EXPECT_FLOAT_EQ(arrays.xs[1], 5.0f);
+    EXPECT_FLOAT_EQ(arrays.hs[0], 4.0f);
+    EXPECT_FLOAT_EQ(arrays.at(1).width, 7.0f);
+
+    batch.clear();
+    EXPECT_EQ(batch.size(), 0u);
+}
+
+// ============================================================================
+// Tests - Kernel vs scalar
+// ============================================================================
+
+TEST(AABBBatchTest, MatchesScalarOnRandomBoxes) {
+    std::mt19937 rng(1234);
+    AABBBatch batch = randomBatch(rng, 1000);
+    AABBBatch queries = randomBatch(rng, 200);
+
+    for (std::size_t q = 0; q < queries.size(); q++) {
+        AABB box = queries.arrays().at(q);
+        EXPECT_EQ(simd(box, batch.arrays()), scalar(box, batch.arrays())) << "query " << q;
+    }
+}
+
+TEST(AABBBatchTest, HandlesEveryTailSize) {
+    // Sizes around the 4 and 8 lane widths exercise the scalar tail
+    for (std::size_t count = 0; count <= 19; count++) {
+        AABBBatch batch;
+        for (std::size_t i = 0; i < count; i++) {
+            batch.push({static_cast<float>(i) * 10.0f, 0.0f, 10.0f, 10.0f});
+        }
+        AABB everything{-1.0f, -1.0f, 1000.0f, 100.0f};
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < count; i++) {
+            expected.push_back(i);
+        }
+        EXPECT_EQ(simd(everything, batch.arrays()), expected) << "count " << count;
+    }
+}
+
+TEST(AABBBatchTest, TouchingEdgesDoNotIntersect) {
+    AABBBatch batch;
+    for (int i = 0; i < 8; i++) {
+        batch.push({10.0f, 0.0f, 10.0f, 10.0f});   // Right of the query, sharing an edge
+    }
+    batch.push({9.0f, 0.0f, 10.0f, 10.0f});        // Tail: overlaps by one unit
+
+    std::vector<uint32_t> hits = simd({0.0f, 0.0f, 10.0f, 10.0f}, batch.arrays());
+    EXPECT_EQ(hits, std::vector<uint32_t>{8});
+}
+
+TEST(AABBBatchTest, MaskMatchesIndices) {
+    std::mt19937 rng(7);
+    AABBBatch batch = randomBatch(rng, 300);
+    AABB box{500.0f, 400.0f, 300.0f, 200.0f};
+
+    std::vector<uint64_t> mask((batch.size() + 63) / 64, ~0ull);
+    intersectMask(box, batch.arrays(), mask.data());
+
+    std::vector<uint32_t> fromMask;
+    for (uint32_t i = 0; i < batch.size(); i++) {
+        if (mask[i / 64] >> (i % 64) & 1u) {
+            fromMask.push_back(i);
+        }
+    }
+    EXPECT_EQ(fromMask, scalar(box, batch.arrays()));
+}
+
+TEST(AABBBatchTest, PairsComeOutInNestedLoopOrder) {
+    std::mt19937 rng(99);
+    AABBBatch a = randomBatch(rng, 40);
+    AABBBatch b = randomBatch(rng, 300);
+
+    std::vector<std::pair<uint32_t, uint32_t>> expected;
+    for (uint32_t i = 0; i < a.size(); i++) {
+        for (uint32_t j = 0; j < b.size(); j++) {
+            if (a.arrays().at(i).intersects(b.arrays().at(j))) {
+                expected.emplace_back(i, j);
+            }
+        }
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> pairs;
+    forEachIntersectingPair(a.arrays(), b.arrays(), [&pairs](uint32_t i, uint32_t j) { pairs.emplace_back(i, j); });
+    EXPECT_EQ(pairs, expected);
+    EXPECT_FALSE(pairs.empty());
+}
+
+TEST(AABBBatchTest, ReportsKernelName) {
+    std::string name = batchKernelName();
+    EXPECT_TRUE(name == "avx2" || name == "sse2" || name == "neon" || name == "scalar");
+}
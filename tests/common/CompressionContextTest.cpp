@@ -0,0 +1,201 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** CompressionContextTest - Reusable LZ4 context, snapshot dictionary and dictionary training
+*/
+
+#include <gtest/gtest.h>
+#include "compression/Compression.hpp"
+#include "compression/CompressionContext.hpp"
+#include "compression/SnapshotDictionary.hpp"
+#include "Protocol.hpp"
+#include <vector>
+
+using compression::CompressionContext;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Helpers
+// ═══════════════════════════════════════════════════════════════════════════════
+
+namespace {
+    // Snapshot recorded from a GameWorld session (Snapshot payload, 254 bytes)
+    const std::vector<uint8_t> RECORDED_SNAPSHOT = {
+        0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xA7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x1F,
+        0xA6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xA5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x15, 0x00, 0xF1, 0x01, 0xB5, 0x1E, 0x02,
+        0x00, 0x16, 0x03, 0x00, 0x02, 0x0F, 0x23, 0x01, 0x00, 0x17, 0x06, 0x0C, 0x02, 0x1C, 0x23, 0x01,
+        0x00, 0x0F, 0x00, 0x96, 0x00, 0xB3, 0x3C, 0x05, 0x00, 0x10, 0x00, 0x0D, 0x02, 0x0F, 0x23, 0x01,
+        0x00, 0x1A, 0x06, 0xE0, 0x02, 0x5D, 0x1E, 0x02, 0x00, 0x18, 0x06, 0xA9, 0x01, 0xB9, 0x50, 0x04,
+        0x00, 0x19, 0x06, 0x7C, 0x01, 0x9E, 0x1E, 0x02, 0x00, 0x1B, 0x07, 0x71, 0x03, 0x1C, 0x50, 0x04,
+        0x0D, 0x00, 0x8F, 0xFF, 0x04, 0xCD, 0x01, 0xDA, 0x00, 0x00, 0x8C, 0xFF, 0x02, 0x90, 0x01, 0x32,
+        0x00, 0x00, 0x8E, 0xFF, 0x04, 0xCD, 0x01, 0xCA, 0x00, 0x00, 0x8D, 0xFF, 0x00, 0x65, 0x00, 0xE3,
+        0x00, 0x00, 0x91, 0xFF, 0x05, 0xAD, 0x01, 0xCF, 0x00, 0x00, 0x92, 0xFF, 0x05, 0xAD, 0x01, 0xDF,
+        0x00, 0x00, 0x93, 0xFF, 0x04, 0xED, 0x02, 0x30, 0x00, 0x00, 0x94, 0xFF, 0x00, 0x77, 0x02, 0x37,
+        0x00, 0x00, 0x95, 0xFF, 0x06, 0x13, 0x02, 0x0C, 0x00, 0x00, 0x96, 0xFF, 0x06, 0x7C, 0x02, 0x1C,
+        0x00, 0x00, 0x97, 0xFF, 0x02, 0xC2, 0x02, 0x12, 0x00, 0x00, 0x98, 0xFF, 0x06, 0x8D, 0x01, 0xC5,
+        0x00, 0x00, 0x99, 0xFF, 0x06, 0x8D, 0x01, 0xD5, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+    };
+
+    // A mid-wave snapshot of a two-player room, serialized like the server does
+    std::vector<uint8_t> sampleSnapshot(uint16_t tick) {
+        GameSnapshot snapshot{};
+        snapshot.player_count = 2;
+        for (uint8_t i = 0; i < 2; ++i) {
+            auto& player = snapshot.players[i];
+            player.id = static_cast<uint8_t>(i + 1);
+            player.x = static_cast<uint16_t>(100 + i * 40 + tick % 50);
+            player.y = static_cast<uint16_t>(300 + i * 120);
+            player.health = 100;
+            player.alive = 1;
+            player.lastAckedInputSeq = static_cast<uint16_t>(tick * 2 + i);
+            player.shipSkin = static_cast<uint8_t>(i + 1);
+            player.score = 1500u + tick;
+        }
+        snapshot.missile_count = 6;
+        for (uint8_t i = 0; i < 6; ++i) {
+            snapshot.missiles[i] = {static_cast<uint16_t>(40 + i), static_cast<uint8_t>(1 + i % 2),
+                                    static_cast<uint16_t>(200 + i * 90 + tick * 4), static_cast<uint16_t>(300 + (i % 2) * 120), 0};
+        }
+        snapshot.enemy_count = 8;
+        for (uint8_t i = 0; i < 8; ++i) {
+            snapshot.enemies[i] = {static_cast<uint16_t>(500 + i), static_cast<uint16_t>(1800 - i * 60 - tick),
+                                   static_cast<uint16_t>(150 + i * 95), 100, static_cast<uint8_t>(i % 3)};
+        }
+        snapshot.wave_number = 3;
+
+        std::vector<uint8_t> bytes(snapshot.wire_size());
+        snapshot.to_bytes(bytes.data());
+        return bytes;
+    }
+
+    std::vector<uint8_t> roundTrip(CompressionContext& encoder, const CompressionContext& decoder,
+                                   const std::vector<uint8_t>& data, bool useDictionary = true) {
+        std::vector<uint8_t> compressed(compression::compressBound(data.size()));
+        size_t compressedSize = encoder.compress(data, compressed, useDictionary);
+        if (compressedSize == 0) {
+            return {};
+        }
+        std::vector<uint8_t> decompressed(data.size());
+        if (!decoder.decompress({compressed.data(), compressedSize}, decompressed)) {
+            return {};
+        }
+        return decompressed;
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Compression context
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(CompressionContextTest, RoundTripsWithoutDictionary) {
+    CompressionContext context;
+    for (uint16_t tick = 0; tick < 10; ++tick) {
+        auto data = sampleSnapshot(tick);
+        EXPECT_EQ(roundTrip(context, context, data), data);
+    }
+}
+
+TEST(CompressionContextTest, MatchesTheStatelessCompressor) {
+    CompressionContext context;
+    auto data = sampleSnapshot(7);
+    std::vector<uint8_t> compressed(compression::compressBound(data.size()));
+    size_t compressedSize = context.compress(data, compressed);
+    auto stateless = compression::compress(data.data(), data.size());
+    ASSERT_GT(compressedSize, 0u);
+    EXPECT_EQ(std::vector<uint8_t>(compressed.begin(), compressed.begin() + compressedSize), stateless);
+}
+
+TEST(CompressionContextTest, RoundTripsWithTheSnapshotDictionary) {
+    CompressionContext context(compression::SNAPSHOT_DICTIONARY);
+    ASSERT_TRUE(context.hasDictionary());
+    for (uint16_t tick = 0; tick < 10; ++tick) {
+        auto data = sampleSnapshot(tick);
+        EXPECT_EQ(roundTrip(context, context, data), data);
+    }
+}
+
+TEST(CompressionContextTest, DictionaryShrinksRecordedSnapshots) {
+    CompressionContext context(compression::SNAPSHOT_DICTIONARY);
+    std::vector<uint8_t> compressed(compression::compressBound(RECORDED_SNAPSHOT.size()));
+    size_t plain = context.compress(RECORDED_SNAPSHOT, compressed, false);
+    size_t primed = context.compress(RECORDED_SNAPSHOT, compressed, true);
+    ASSERT_GT(primed, 0u);
+    EXPECT_LT(primed, plain);
+    EXPECT_EQ(roundTrip(context, context, RECORDED_SNAPSHOT), RECORDED_SNAPSHOT);
+}
+
+TEST(CompressionContextTest, DictionaryDecoderReadsPlainPackets) {
+    CompressionContext plain;
+    CompressionContext primed(compression::SNAPSHOT_DICTIONARY);
+    auto data = sampleSnapshot(5);
+    EXPECT_EQ(roundTrip(plain, primed, data), data);
+    EXPECT_EQ(roundTrip(primed, primed, data, false), data);
+}
+
+TEST(CompressionContextTest, PrimedPacketsNeedTheDictionary) {
+    CompressionContext primed(compression::SNAPSHOT_DICTIONARY);
+    CompressionContext plain;
+    EXPECT_NE(roundTrip(primed, plain, RECORDED_SNAPSHOT), RECORDED_SNAPSHOT);
+}
+
+TEST(CompressionContextTest, RejectsCorruptOrMisSizedInput) {
+    CompressionContext context(compression::SNAPSHOT_DICTIONARY);
+    auto data = sampleSnapshot(1);
+    std::vector<uint8_t> compressed(compression::compressBound(data.size()));
+    size_t compressedSize = context.compress(data, compressed);
+    ASSERT_GT(compressedSize, 0u);
+
+    std::vector<uint8_t> out(data.size() + 1);
+    EXPECT_FALSE(context.decompress({compressed.data(), compressedSize}, out));  // Wrong original size
+    std::vector<uint8_t> garbage(64, 0xFF);
+    EXPECT_FALSE(context.decompress(garbage, {out.data(), data.size()}));
+    EXPECT_FALSE(context.decompress({}, out));
+}
+
+TEST(CompressionContextTest, TooSmallOutputFailsCleanly) {
+    CompressionContext context(compression::SNAPSHOT_DICTIONARY);
+    auto data = sampleSnapshot(2);
+    std::vector<uint8_t> tiny(8);
+    EXPECT_EQ(context.compress(data, tiny), 0u);
+    EXPECT_EQ(context.compress({}, tiny), 0u);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Dictionary training
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(CompressionContextTest, TrainedDictionaryKeepsSharedRunsWithinCapacity) {
+    std::vector<std::vector<uint8_t>> samples;
+    for (uint16_t tick = 0; tick < 40; ++tick) {
+        samples.push_back(sampleSnapshot(tick));
+    }
+    auto dictionary = compression::trainDictionary(samples, 1024);
+    ASSERT_FALSE(dictionary.empty());
+    EXPECT_LE(dictionary.size(), 1024u);
+    EXPECT_EQ(dictionary.size() % 32, 0u);
+
+    // Unseen snapshot of the same game compresses better with it
+    CompressionContext trained(dictionary);
+    auto data = sampleSnapshot(200);
+    std::vector<uint8_t> compressed(compression::compressBound(data.size()));
+    size_t plain = trained.compress(data, compressed, false);
+    size_t primed = trained.compress(data, compressed, true);
+    EXPECT_LT(primed, plain);
+    EXPECT_EQ(roundTrip(trained, trained, data), data);
+}
+
+TEST(CompressionContextTest, TrainingOnUnrelatedSamplesYieldsNothing) {
+    std::vector<std::vector<uint8_t>> samples;
+    for (uint8_t i = 0; i < 4; ++i) {
+        std::vector<uint8_t> sample(64);
+        for (size_t j = 0; j < sample.size(); ++j) {
+            sample[j] = static_cast<uint8_t>(i * 64 + j);
+        }
+        samples.push_back(sample);
+    }
+    EXPECT_TRUE(compression::trainDictionary(samples, 1024).empty());
+    EXPECT_TRUE(compression::trainDictionary({}, 1024).empty());
+}
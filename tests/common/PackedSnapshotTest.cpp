@@ -0,0 +1,279 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** PackedSnapshotTest - Bit packing and the packed snapshot encoding, fuzzed against GameSnapshot::from_bytes
+*/
+
+#include <gtest/gtest.h>
+#include "BitPacking.hpp"
+#include "PackedSnapshot.hpp"
+#include "Protocol.hpp"
+#include <random>
+#include <vector>
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// BitWriter / BitReader
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(BitPackingTest, FieldRangeBits) {
+    EXPECT_EQ((FieldRange{0, 1}.bits()), 1u);
+    EXPECT_EQ((FieldRange{0, 2047}.bits()), 11u);
+    EXPECT_EQ((FieldRange{0, 2048}.bits()), 12u);
+    EXPECT_EQ((FieldRange{1, 6}.bits()), 3u);
+    EXPECT_EQ((FieldRange{5, 5}.bits()), 0u);
+    EXPECT_EQ((FieldRange{0, UINT32_MAX}.bits()), 32u);
+}
+
+TEST(BitPackingTest, FieldsRoundTripAcrossByteBoundaries) {
+    uint8_t buf[16];
+    BitWriter w(buf, sizeof(buf));
+    w.write(5, 3);
+    w.write(1500, FieldRange{0, 2047});
+    w.writeBool(true);
+    w.write(0xDEADBEEF, 32);
+    w.write(4, FieldRange{1, 6});
+    EXPECT_FALSE(w.overflowed());
+    EXPECT_EQ(w.size(), 7u);  // 3 + 11 + 1 + 32 + 3 = 50 bits
+
+    BitReader r(buf, w.size());
+    EXPECT_EQ(r.read(3), 5u);
+    EXPECT_EQ(r.read(FieldRange{0, 2047}), 1500u);
+    EXPECT_EQ(r.readBool(), true);
+    EXPECT_EQ(r.read(32), 0xDEADBEEFu);
+    EXPECT_EQ(r.read(FieldRange{1, 6}), 4u);
+    EXPECT_FALSE(r.read(8).has_value());  // Only padding left
+}
+
+TEST(BitPackingTest, OutOfRangeValuesAreClamped) {
+    uint8_t buf[4];
+    BitWriter w(buf, sizeof(buf));
+    w.write(5000, FieldRange{0, 2047});
+    w.write(0, FieldRange{1, 6});
+
+    BitReader r(buf, w.size());
+    EXPECT_EQ(r.read(FieldRange{0, 2047}), 2047u);
+    EXPECT_EQ(r.read(FieldRange{1, 6}), 1u);
+}
+
+TEST(BitPackingTest, OverflowDoesNotWritePastTheBuffer) {
+    uint8_t buf[3] = {0, 0, 0xAB};
+    BitWriter w(buf, 2);
+    w.write(0xFFFF, 16);
+    w.write(1, 1);
+    EXPECT_TRUE(w.overflowed());
+    EXPECT_EQ(buf[2], 0xAB);
+}
+
+TEST(BitPackingTest, RawValueOutsideTheRangeIsRejected) {
+    uint8_t buf[1];
+    BitWriter w(buf, sizeof(buf));
+    w.write(7, 3);  // 1 + 7 = 8, above the range max
+
+    BitReader r(buf, 1);
+    EXPECT_FALSE(r.read(FieldRange{1, 6}).has_value());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Packed snapshot, fuzzed against the byte encoding
+// ═══════════════════════════════════════════════════════════════════════════════
+
+namespace {
+    // Random snapshot with every field inside its packed range
+    GameSnapshot randomSnapshot(std::mt19937& rng) {
+        auto in = [&](FieldRange range) {
+            return std::uniform_int_distribution<uint32_t>(range.min, range.max)(rng);
+        };
+        GameSnapshot gs{};
+        gs.player_count = static_cast<uint8_t>(in(packed::PLAYER_COUNT));
+        for (uint8_t i = 0; i < gs.player_count; ++i) {
+            PlayerState& ps = gs.players[i];
+            ps.id = static_cast<uint8_t>(in(packed::PLAYER_ID));
+            ps.x = static_cast<uint16_t>(in(packed::POSITION));
+            ps.y = static_cast<uint16_t>(in(packed::POSITION));
+            ps.health = static_cast<uint8_t>(in(packed::HEALTH));
+            ps.alive = static_cast<uint8_t>(in({0, 1}));
+            ps.lastAckedInputSeq = static_cast<uint16_t>(in(packed::SEQUENCE));
+            ps.shipSkin = static_cast<uint8_t>(in(packed::SHIP_SKIN));
+            ps.score = in(packed::SCORE);
+            ps.kills = static_cast<uint16_t>(in(packed::KILLS));
+            ps.combo = static_cast<uint8_t>(in(packed::COMBO));
+            ps.currentWeapon = static_cast<uint8_t>(in(packed::WEAPON));
+            ps.chargeLevel = static_cast<uint8_t>(in(packed::LEVEL));
+            ps.speedLevel = static_cast<uint8_t>(in(packed::LEVEL));
+            ps.weaponLevel = static_cast<uint8_t>(in(packed::LEVEL));
+            ps.hasForce = static_cast<uint8_t>(in({0, 1}));
+            ps.shieldTimer = static_cast<uint8_t>(in(packed::SHIELD_TIMER));
+        }
+        auto randomMissile = [&]() {
+            return MissileState{
+                .id = static_cast<uint16_t>(in(packed::ENTITY_ID)),
+                .owner_id = static_cast<uint8_t>(in(packed::OWNER_ID)),
+                .x = static_cast<uint16_t>(in(packed::POSITION)),
+                .y = static_cast<uint16_t>(in(packed::POSITION)),
+                .weapon_type = static_cast<uint8_t>(in(packed::WEAPON))
+            };
+        };
+        gs.missile_count = static_cast<uint8_t>(in(packed::MISSILE_COUNT));
+        for (uint8_t i = 0; i < gs.missile_count; ++i) {
+            gs.missiles[i] = randomMissile();
+        }
+        gs.enemy_count = static_cast<uint8_t>(in(packed::ENEMY_COUNT));
+        for (uint8_t i = 0; i < gs.enemy_count; ++i) {
+            gs.enemies[i] = EnemyState{
+                .id = static_cast<uint16_t>(in(packed::ENTITY_ID)),
+                .x = static_cast<uint16_t>(in(packed::POSITION)),
+                .y = static_cast<uint16_t>(in(packed::POSITION)),
+                .health = static_cast<uint8_t>(in(packed::HEALTH)),
+                .enemy_type = static_cast<uint8_t>(in(packed::ENEMY_TYPE))
+            };
+        }
+        gs.enemy_missile_count = static_cast<uint8_t>(in(packed::ENEMY_MISSILE_COUNT));
+        for (uint8_t i = 0; i < gs.enemy_missile_count; ++i) {
+            gs.enemy_missiles[i] = randomMissile();
+        }
+        gs.wave_number = static_cast<uint16_t>(in(packed::WAVE));
+        gs.has_boss = static_cast<uint8_t>(in({0, 1}));
+        if (gs.has_boss) {
+            gs.boss_state = BossState{
+                .id = static_cast<uint16_t>(in(packed::ENTITY_ID)),
+                .x = static_cast<uint16_t>(in(packed::POSITION)),
+                .y = static_cast<uint16_t>(in(packed::POSITION)),
+                .max_health = static_cast<uint16_t>(in(packed::BOSS_HEALTH)),
+                .health = static_cast<uint16_t>(in(packed::BOSS_HEALTH)),
+                .phase = static_cast<uint8_t>(in(packed::BOSS_PHASE)),
+                .is_active = static_cast<uint8_t>(in({0, 1}))
+            };
+        }
+        gs.force_count = static_cast<uint8_t>(in(packed::PLAYER_COUNT));
+        for (uint8_t i = 0; i < gs.force_count; ++i) {
+            gs.forces[i] = ForceStateSnapshot{
+                .owner_id = static_cast<uint8_t>(in(packed::OWNER_ID)),
+                .x = static_cast<uint16_t>(in(packed::POSITION)),
+                .y = static_cast<uint16_t>(in(packed::POSITION)),
+                .is_attached = static_cast<uint8_t>(in({0, 1})),
+                .level = static_cast<uint8_t>(in(packed::FORCE_LEVEL))
+            };
+        }
+        gs.bit_count = static_cast<uint8_t>(in(packed::BIT_COUNT));
+        for (uint8_t i = 0; i < gs.bit_count; ++i) {
+            gs.bits[i] = BitDeviceStateSnapshot{
+                .owner_id = static_cast<uint8_t>(in(packed::OWNER_ID)),
+                .bit_index = static_cast<uint8_t>(in(packed::BIT_INDEX)),
+                .x = static_cast<uint16_t>(in(packed::POSITION)),
+                .y = static_cast<uint16_t>(in(packed::POSITION)),
+                .is_attached = 1
+            };
+        }
+        return gs;
+    }
+
+    std::vector<uint8_t> bytesOf(const GameSnapshot& gs) {
+        std::vector<uint8_t> buf(gs.wire_size());
+        gs.to_bytes(buf.data());
+        return buf;
+    }
+}
+
+TEST(PackedSnapshotTest, FuzzMatchesTheByteEncoding) {
+    std::mt19937 rng(1234);
+    uint8_t packedBuf[PACKED_SNAPSHOT_MAX_SIZE];
+
+    for (int i = 0; i < 2000; i++) {
+        GameSnapshot gs = randomSnapshot(rng);
+        std::vector<uint8_t> bytes = bytesOf(gs);
+        auto reference = GameSnapshot::from_bytes(bytes.data(), bytes.size());
+        ASSERT_TRUE(reference.has_value());
+
+        size_t packedSize = packSnapshot(gs, packedBuf, sizeof(packedBuf));
+        ASSERT_GT(packedSize, 0u);
+        ASSERT_LE(packedSize, bytes.size());
+        auto unpacked = unpackSnapshot(packedBuf, packedSize);
+        ASSERT_TRUE(unpacked.has_value()) << "iteration " << i;
+
+        ASSERT_EQ(bytesOf(*unpacked), bytesOf(*reference)) << "iteration " << i;
+    }
+}
+
+TEST(PackedSnapshotTest, FullSnapshotFitsTheMaxSize) {
+    std::mt19937 rng(99);
+    GameSnapshot gs = randomSnapshot(rng);
+    gs.player_count = MAX_PLAYERS;
+    gs.missile_count = MAX_MISSILES;
+    gs.enemy_count = MAX_ENEMIES;
+    gs.enemy_missile_count = MAX_ENEMY_MISSILES;
+    gs.has_boss = 1;
+    gs.force_count = MAX_PLAYERS;
+    gs.bit_count = MAX_BITS;
+
+    uint8_t packedBuf[PACKED_SNAPSHOT_MAX_SIZE];
+    size_t packedSize = packSnapshot(gs, packedBuf, sizeof(packedBuf));
+    EXPECT_EQ(packedSize, PACKED_SNAPSHOT_MAX_SIZE);
+    EXPECT_LT(packedSize * 10, gs.wire_size() * 8);  // Over 20% smaller than the byte encoding
+
+    EXPECT_EQ(packSnapshot(gs, packedBuf, PACKED_SNAPSHOT_MAX_SIZE - 1), 0u);
+}
+
+TEST(PackedSnapshotTest, TruncatedOrGarbagePacketsAreRejectedSafely) {
+    std::mt19937 rng(7);
+    uint8_t packedBuf[PACKED_SNAPSHOT_MAX_SIZE];
+    GameSnapshot gs = randomSnapshot(rng);
+    gs.player_count = 2;
+    gs.missile_count = 3;
+    size_t packedSize = packSnapshot(gs, packedBuf, sizeof(packedBuf));
+    for (size_t len = 0; len + 1 < packedSize; len++) {
+        EXPECT_FALSE(unpackSnapshot(packedBuf, len).has_value()) << "length " << len;
+    }
+
+    // Random bytes never read out of bounds and decode to valid counts when accepted
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::vector<uint8_t> garbage(PACKED_SNAPSHOT_MAX_SIZE);
+    for (int i = 0; i < 2000; i++) {
+        for (auto& b : garbage) {
+            b = static_cast<uint8_t>(byte(rng));
+        }
+        auto result = unpackSnapshot(garbage.data(), garbage.size() * (i % 4 + 1) / 4);
+        if (result) {
+            EXPECT_LE(result->player_count, MAX_PLAYERS);
+            EXPECT_LE(result->missile_count, MAX_MISSILES);
+            EXPECT_LE(result->enemy_count, MAX_ENEMIES);
+            EXPECT_LE(result->enemy_missile_count, MAX_ENEMY_MISSILES);
+            EXPECT_LE(result->bit_count, MAX_BITS);
+        }
+    }
+}
+
+TEST(PackedSnapshotTest, EncodingIsNegotiatedDownToWhatBothSidesKnow) {
+    EXPECT_EQ(negotiateSnapshotEncoding(0), SnapshotEncoding::Bytes);
+    EXPECT_EQ(negotiateSnapshotEncoding(1), SnapshotEncoding::Packed);
+    EXPECT_EQ(negotiateSnapshotEncoding(200), LATEST_SNAPSHOT_ENCODING);
+
+    // Old clients send JoinGame without the encoding byte
+    JoinGame join{};
+    join.shipSkin = 3;
+    join.snapshotEncoding = 1;
+    uint8_t buf[JoinGame::WIRE_SIZE];
+    join.to_bytes(buf);
+    auto legacy = JoinGame::from_bytes(buf, JoinGame::MIN_WIRE_SIZE);
+    ASSERT_TRUE(legacy.has_value());
+    EXPECT_EQ(legacy->snapshotEncoding, 0);
+    auto current = JoinGame::from_bytes(buf, JoinGame::WIRE_SIZE);
+    ASSERT_TRUE(current.has_value());
+    EXPECT_EQ(current->snapshotEncoding, 1);
+    EXPECT_EQ(current->shipSkin, 3);
+}
+
+TEST(PackedSnapshotTest, JoinMessagesWriteExactlyTheirWireSize) {
+    // Generic senders size their buffer from T::WIRE_SIZE
+    std::vector<uint8_t> buf(JoinGame::WIRE_SIZE + 1, 0xAB);
+    JoinGame join{};
+    join.features = 3;
+    join.to_bytes(buf.data());
+    EXPECT_EQ(buf[JoinGame::WIRE_SIZE - 1], 3);
+    EXPECT_EQ(buf[JoinGame::WIRE_SIZE], 0xAB);
+
+    buf.assign(JoinGameAck::WIRE_SIZE + 1, 0xAB);
+    JoinGameAck{.player_id = 1, .snapshotEncoding = 2, .features = 3}.to_bytes(buf.data());
+    EXPECT_EQ(buf[JoinGameAck::WIRE_SIZE - 1], 3);
+    EXPECT_EQ(buf[JoinGameAck::WIRE_SIZE], 0xAB);
+}
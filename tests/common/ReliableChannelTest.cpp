@@ -0,0 +1,208 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ReliableChannelTest - Resends, acks and in-order delivery of the reliable event channel
+*/
+
+#include <gtest/gtest.h>
+#include "Protocol.hpp"
+#include "ReliableChannel.hpp"
+#include <vector>
+
+using reliable::ReliableReceiver;
+using reliable::ReliableSender;
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+namespace {
+    using Clock = ReliableSender::Clock;
+
+    struct Packet {
+        uint16_t sequence = 0;
+        std::vector<uint8_t> bytes;
+    };
+
+    // The next packet the sender would put on the wire, empty if none
+    Packet nextPacket(ReliableSender& sender, Clock::time_point now) {
+        Packet packet;
+        packet.bytes.resize(1200);
+        packet.bytes.resize(sender.writePacket(now, packet.bytes.data(), packet.bytes.size(), packet.sequence));
+        return packet;
+    }
+
+    // Ids of the MissileDestroyed events the receiver delivered, in order
+    std::vector<uint16_t> receive(ReliableReceiver& receiver, const Packet& packet) {
+        std::vector<uint16_t> delivered;
+        receiver.receive(packet.sequence, packet.bytes.data(), packet.bytes.size(),
+            [&delivered](MessageType type, const uint8_t* payload, size_t size) {
+                EXPECT_EQ(type, MessageType::MissileDestroyed);
+                auto md = MissileDestroyed::from_bytes(payload, size);
+                ASSERT_TRUE(md.has_value());
+                delivered.push_back(md->missile_id);
+            });
+        return delivered;
+    }
+
+    void queueMissiles(ReliableSender& sender, uint16_t first, uint16_t count) {
+        for (uint16_t id = first; id < first + count; ++id) {
+            sender.queue(MessageType::MissileDestroyed, MissileDestroyed{.missile_id = id});
+        }
+    }
+}
+
+// ============================================================================
+// Wire format
+// ============================================================================
+
+TEST(ReliableChannelTest, SnapshotAckCarriesEventAcksOptionally) {
+    SnapshotAck ack{.sequence = 7, .event_ack = 300, .event_ack_bits = 0x80000005};
+    uint8_t buf[SnapshotAck::WIRE_SIZE];
+    ack.to_bytes(buf);
+
+    auto full = SnapshotAck::from_bytes(buf, SnapshotAck::WIRE_SIZE);
+    ASSERT_TRUE(full.has_value());
+    EXPECT_EQ(full->sequence, 7);
+    EXPECT_EQ(full->event_ack, 300);
+    EXPECT_EQ(full->event_ack_bits, 0x80000005u);
+
+    // Older clients only send the snapshot sequence
+    auto legacy = SnapshotAck::from_bytes(buf, SnapshotAck::MIN_WIRE_SIZE);
+    ASSERT_TRUE(legacy.has_value());
+    EXPECT_EQ(legacy->sequence, 7);
+    EXPECT_EQ(legacy->event_ack_bits, 0u);
+}
+
+TEST(ReliableChannelTest, JoinGameFeaturesAreOptional) {
+    JoinGame join{};
+    join.features = GameFeatures::RELIABLE_EVENTS;
+    uint8_t buf[JoinGame::WIRE_SIZE];
+    join.to_bytes(buf);
+
+    EXPECT_EQ(JoinGame::from_bytes(buf, JoinGame::MIN_WIRE_SIZE + 1)->features, 0);
+    EXPECT_EQ(JoinGame::from_bytes(buf, JoinGame::WIRE_SIZE)->features, GameFeatures::RELIABLE_EVENTS);
+}
+
+// ============================================================================
+// Delivery
+// ============================================================================
+
+TEST(ReliableChannelTest, EventsOfATickShareOnePacket) {
+    ReliableSender sender;
+    ReliableReceiver receiver;
+    queueMissiles(sender, 1, 5);
+
+    auto now = Clock::now();
+    Packet packet = nextPacket(sender, now);
+    ASSERT_FALSE(packet.bytes.empty());
+    EXPECT_EQ(packet.bytes.size(), ReliableEventsHeader::WIRE_SIZE
+        + 5 * (ReliableEventHeader::WIRE_SIZE + MissileDestroyed::WIRE_SIZE));
+    EXPECT_EQ(receive(receiver, packet), (std::vector<uint16_t>{1, 2, 3, 4, 5}));
+
+    // Sent, not due for a resend yet
+    EXPECT_TRUE(nextPacket(sender, now).bytes.empty());
+}
+
+TEST(ReliableChannelTest, LostEventsAreResentUntilAcked) {
+    ReliableSender sender;
+    ReliableReceiver receiver;
+    auto now = Clock::now();
+
+    queueMissiles(sender, 1, 2);
+    Packet lost = nextPacket(sender, now);
+    ASSERT_FALSE(lost.bytes.empty());
+
+    now += reliable::RESEND_DELAY;
+    Packet resend = nextPacket(sender, now);
+    ASSERT_FALSE(resend.bytes.empty());
+    EXPECT_NE(resend.sequence, lost.sequence);
+    EXPECT_EQ(receive(receiver, resend), (std::vector<uint16_t>{1, 2}));
+    EXPECT_EQ(sender.resent(), 2u);
+
+    sender.onAck(receiver.ack(), receiver.ackBits());
+    EXPECT_EQ(sender.pending(), 0u);
+    now += reliable::RESEND_DELAY;
+    EXPECT_TRUE(nextPacket(sender, now).bytes.empty());
+}
+
+TEST(ReliableChannelTest, ReorderedPacketsAreDeliveredInOrder) {
+    ReliableSender sender;
+    ReliableReceiver receiver;
+    auto now = Clock::now();
+
+    queueMissiles(sender, 1, 1);
+    Packet first = nextPacket(sender, now);
+    queueMissiles(sender, 2, 2);
+    Packet second = nextPacket(sender, now);
+
+    // The second packet waits for the first, which then brings both out
+    EXPECT_TRUE(receive(receiver, second).empty());
+    EXPECT_EQ(receive(receiver, first), (std::vector<uint16_t>{1, 2, 3}));
+    // Duplicates are dropped
+    EXPECT_TRUE(receive(receiver, first).empty());
+
+    EXPECT_EQ(receiver.ack(), second.sequence);
+    EXPECT_EQ(receiver.ackBits(), 0b11u);
+}
+
+TEST(ReliableChannelTest, AckBitfieldCoversTheLast32Packets) {
+    ReliableSender sender;
+    ReliableReceiver receiver;
+    auto now = Clock::now();
+
+    std::vector<Packet> packets;
+    for (uint16_t i = 0; i < 40; ++i) {
+        queueMissiles(sender, i, 1);
+        packets.push_back(nextPacket(sender, now));
+    }
+    // Every other packet arrives
+    for (size_t i = 0; i < packets.size(); i += 2) {
+        receive(receiver, packets[i]);
+    }
+    EXPECT_EQ(receiver.ack(), packets[38].sequence);
+    EXPECT_EQ(receiver.ackBits(), 0x55555555u);
+
+    // Only the events of the acked packets stop being resent
+    sender.onAck(receiver.ack(), receiver.ackBits());
+    now += reliable::RESEND_DELAY;
+    Packet resend = nextPacket(sender, now);
+    std::vector<uint16_t> delivered = receive(receiver, resend);
+    EXPECT_EQ(delivered.front(), 1);  // The first lost one, everything up to 39 follows
+    EXPECT_EQ(delivered.back(), 39);
+}
+
+TEST(ReliableChannelTest, GivenUpEventsDoNotBlockDelivery) {
+    ReliableSender sender;
+    ReliableReceiver receiver;
+    auto now = Clock::now();
+
+    queueMissiles(sender, 0, 1);
+    Packet lost = nextPacket(sender, now);
+    (void)lost;
+    // The player never acks: past the window, event 0 is given up
+    queueMissiles(sender, 1, reliable::EVENT_WINDOW);
+    EXPECT_EQ(sender.givenUp(), 1u);
+    EXPECT_EQ(sender.pending(), reliable::EVENT_WINDOW);
+
+    now += reliable::RESEND_DELAY;
+    std::vector<uint16_t> delivered;
+    for (int tick = 0; tick < 8; ++tick) {
+        auto part = receive(receiver, nextPacket(sender, now));
+        delivered.insert(delivered.end(), part.begin(), part.end());
+    }
+    ASSERT_FALSE(delivered.empty());
+    EXPECT_EQ(delivered.front(), 1);
+}
+
+TEST(ReliableChannelTest, MalformedPacketsAreIgnored) {
+    ReliableSender sender;
+    ReliableReceiver receiver;
+    queueMissiles(sender, 1, 3);
+    Packet packet = nextPacket(sender, Clock::now());
+
+    packet.bytes.pop_back();
+    EXPECT_TRUE(receive(receiver, packet).empty());
+    EXPECT_FALSE(receiver.hasAck());
+}
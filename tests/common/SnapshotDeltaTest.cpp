@@ -0,0 +1,251 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SnapshotDeltaTest - Unit tests for snapshot images, XOR deltas and the snapshot history
+*/
+
+#include <gtest/gtest.h>
+#include "compression/SnapshotDelta.hpp"
+#include "compression/Compression.hpp"
+#include "compression/CompressionContext.hpp"
+#include "compression/SnapshotDictionary.hpp"
+#include "Protocol.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace compression;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Helpers
+// ═══════════════════════════════════════════════════════════════════════════════
+
+namespace {
+    GameSnapshot makeSnapshot(uint8_t missiles, uint8_t enemies) {
+        GameSnapshot gs{};
+        gs.player_count = 2;
+        for (uint8_t i = 0; i < 2; ++i) {
+            gs.players[i].id = i + 1;
+            gs.players[i].x = 100 + i * 50;
+            gs.players[i].y = 200;
+            gs.players[i].health = 100;
+            gs.players[i].alive = 1;
+            gs.players[i].score = 1000u * i;
+        }
+        gs.missile_count = missiles;
+        for (uint8_t i = 0; i < missiles; ++i) {
+            gs.missiles[i].id = 10 + i;
+            gs.missiles[i].owner_id = 1;
+            gs.missiles[i].x = 300 + i * 10;
+            gs.missiles[i].y = 200;
+        }
+        gs.enemy_count = enemies;
+        for (uint8_t i = 0; i < enemies; ++i) {
+            gs.enemies[i].id = 100 + i;
+            gs.enemies[i].x = 1800;
+            gs.enemies[i].y = 100 + i * 60;
+            gs.enemies[i].health = 50;
+        }
+        gs.wave_number = 3;
+        return gs;
+    }
+
+    std::vector<uint8_t> payloadOf(const GameSnapshot& gs) {
+        std::vector<uint8_t> buf(gs.wire_size());
+        gs.to_bytes(buf.data());
+        return buf;
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Snapshot image
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(SnapshotImageTest, RoundTripMatchesThePayload) {
+    GameSnapshot gs = makeSnapshot(5, 3);
+    gs.has_boss = 1;
+    gs.boss_state.id = 42;
+    gs.boss_state.x = 1500;
+    gs.boss_state.health = 900;
+    gs.boss_state.max_health = 1000;
+    gs.boss_state.is_active = 1;
+
+    SnapshotImage image;
+    toSnapshotImage(gs, image);
+    auto back = fromSnapshotImage(image);
+    ASSERT_TRUE(back.has_value());
+    EXPECT_EQ(payloadOf(*back), payloadOf(gs));
+}
+
+TEST(SnapshotImageTest, CorruptCountIsRejected) {
+    SnapshotImage image;
+    toSnapshotImage(makeSnapshot(1, 1), image);
+    image[1] = MAX_MISSILES + 1;
+    EXPECT_FALSE(fromSnapshotImage(image).has_value());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Delta encoding
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(SnapshotDeltaTest, UnchangedSnapshotEncodesToNothing) {
+    SnapshotImage image;
+    toSnapshotImage(makeSnapshot(4, 2), image);
+
+    uint8_t delta[SNAPSHOT_DELTA_BOUND];
+    EXPECT_EQ(encodeSnapshotDelta(image, image, delta, sizeof(delta)), 0u);
+
+    SnapshotImage out;
+    EXPECT_TRUE(decodeSnapshotDelta(image, delta, 0, out));
+    EXPECT_EQ(out, image);
+}
+
+TEST(SnapshotDeltaTest, MovedEntitiesRebuildTheTarget) {
+    GameSnapshot before = makeSnapshot(6, 4);
+    GameSnapshot after = before;
+    after.players[0].x += 3;
+    for (uint8_t i = 0; i < after.missile_count; ++i) {
+        after.missiles[i].x += 12;
+    }
+    after.enemies[2].health = 20;
+
+    SnapshotImage baseline;
+    SnapshotImage target;
+    toSnapshotImage(before, baseline);
+    toSnapshotImage(after, target);
+
+    uint8_t delta[SNAPSHOT_DELTA_BOUND];
+    size_t size = encodeSnapshotDelta(baseline, target, delta, sizeof(delta));
+    ASSERT_NE(size, SIZE_MAX);
+    EXPECT_LT(size, after.wire_size() / 4);
+
+    SnapshotImage out;
+    ASSERT_TRUE(decodeSnapshotDelta(baseline, delta, size, out));
+    auto rebuilt = fromSnapshotImage(out);
+    ASSERT_TRUE(rebuilt.has_value());
+    EXPECT_EQ(payloadOf(*rebuilt), payloadOf(after));
+}
+
+TEST(SnapshotDeltaTest, SpawnedAndRemovedEntitiesRebuildTheTarget) {
+    GameSnapshot before = makeSnapshot(8, 5);
+    GameSnapshot after = makeSnapshot(12, 2);
+
+    SnapshotImage baseline;
+    SnapshotImage target;
+    toSnapshotImage(before, baseline);
+    toSnapshotImage(after, target);
+
+    uint8_t delta[SNAPSHOT_DELTA_BOUND];
+    size_t size = encodeSnapshotDelta(baseline, target, delta, sizeof(delta));
+    ASSERT_NE(size, SIZE_MAX);
+
+    SnapshotImage out;
+    ASSERT_TRUE(decodeSnapshotDelta(baseline, delta, size, out));
+    EXPECT_EQ(out, target);
+}
+
+TEST(SnapshotDeltaTest, EverythingChangedStaysWithinTheBound) {
+    SnapshotImage baseline;
+    SnapshotImage target;
+    baseline.fill(0x00);
+    for (size_t i = 0; i < SNAPSHOT_IMAGE_SIZE; i++) {
+        target[i] = static_cast<uint8_t>(i % 3 == 0 ? 0x00 : 0xA5);  // Worst case: lone unchanged bytes
+    }
+
+    std::vector<uint8_t> delta(SNAPSHOT_DELTA_BOUND);
+    size_t size = encodeSnapshotDelta(baseline, target, delta.data(), delta.size());
+    ASSERT_NE(size, SIZE_MAX);
+    EXPECT_LE(size, SNAPSHOT_DELTA_BOUND);
+
+    SnapshotImage out;
+    ASSERT_TRUE(decodeSnapshotDelta(baseline, delta.data(), size, out));
+    EXPECT_EQ(out, target);
+
+    // Too small a buffer is reported, not overrun
+    EXPECT_EQ(encodeSnapshotDelta(baseline, target, delta.data(), 16), SIZE_MAX);
+}
+
+TEST(SnapshotDeltaTest, CompressedDeltaRebuildsTheTarget) {
+    // A volley flying and a wave advancing: every entity moved by the same step
+    GameSnapshot before = makeSnapshot(24, 12);
+    GameSnapshot after = before;
+    for (uint8_t i = 0; i < after.missile_count; ++i) {
+        after.missiles[i].x += 12;
+    }
+    for (uint8_t i = 0; i < after.enemy_count; ++i) {
+        after.enemies[i].x -= 4;
+    }
+
+    SnapshotImage baseline;
+    SnapshotImage target;
+    toSnapshotImage(before, baseline);
+    toSnapshotImage(after, target);
+    uint8_t delta[SNAPSHOT_DELTA_BOUND];
+    size_t size = encodeSnapshotDelta(baseline, target, delta, sizeof(delta));
+    ASSERT_NE(size, SIZE_MAX);
+
+    // Server side compresses without the dictionary, the client always decodes with it
+    CompressionContext server(SNAPSHOT_DICTIONARY);
+    std::vector<uint8_t> compressed(compressBound(size));
+    size_t compressedSize = server.compress({delta, size}, compressed, false);
+    ASSERT_GT(compressedSize, 0u);
+    EXPECT_LT(compressedSize, size);
+
+    CompressionContext client(SNAPSHOT_DICTIONARY);
+    std::vector<uint8_t> decompressed(size);
+    ASSERT_TRUE(client.decompress({compressed.data(), compressedSize}, decompressed));
+    SnapshotImage out;
+    ASSERT_TRUE(decodeSnapshotDelta(baseline, decompressed.data(), decompressed.size(), out));
+    EXPECT_EQ(out, target);
+}
+
+TEST(SnapshotDeltaTest, MalformedDeltaIsRejected) {
+    SnapshotImage baseline{};
+    SnapshotImage out;
+
+    const uint8_t truncatedToken[] = {0x05};
+    EXPECT_FALSE(decodeSnapshotDelta(baseline, truncatedToken, sizeof(truncatedToken), out));
+
+    const uint8_t missingBytes[] = {0x00, 0x04, 0x01, 0x02};
+    EXPECT_FALSE(decodeSnapshotDelta(baseline, missingBytes, sizeof(missingBytes), out));
+
+    // Skips past the end of the image
+    std::vector<uint8_t> pastEnd;
+    for (size_t covered = 0; covered <= SNAPSHOT_IMAGE_SIZE; covered += 255) {
+        pastEnd.push_back(255);
+        pastEnd.push_back(0);
+    }
+    pastEnd.push_back(0);
+    pastEnd.push_back(1);
+    pastEnd.push_back(0xFF);
+    EXPECT_FALSE(decodeSnapshotDelta(baseline, pastEnd.data(), pastEnd.size(), out));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Snapshot history
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST(SnapshotHistoryTest, KeepsTheLastCapacitySequences) {
+    auto history = std::make_unique<SnapshotHistory>();
+    for (uint16_t seq = 1; seq <= SnapshotHistory::CAPACITY + 5; seq++) {
+        history->store(seq).fill(static_cast<uint8_t>(seq));
+    }
+
+    EXPECT_EQ(history->find(5), nullptr);  // Evicted by sequence 5 + CAPACITY
+    const SnapshotImage* newest = history->find(SnapshotHistory::CAPACITY + 5);
+    ASSERT_NE(newest, nullptr);
+    EXPECT_EQ((*newest)[0], static_cast<uint8_t>(SnapshotHistory::CAPACITY + 5));
+    ASSERT_NE(history->find(6), nullptr);
+
+    history->clear();
+    EXPECT_EQ(history->find(SnapshotHistory::CAPACITY + 5), nullptr);
+}
+
+TEST(SnapshotHistoryTest, SequenceComparisonWraps) {
+    EXPECT_TRUE(isNewerSequence(2, 1));
+    EXPECT_FALSE(isNewerSequence(1, 2));
+    EXPECT_FALSE(isNewerSequence(7, 7));
+    EXPECT_TRUE(isNewerSequence(3, 65530));
+    EXPECT_FALSE(isNewerSequence(65530, 3));
+}
@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SpatialGridTest - Tests for the uniform grid collision broadphase
+*/
+
+#include <gtest/gtest.h>
+#include "collision/SpatialGrid.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace collision;
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+namespace {
+    std::vector<uint32_t> queryAll(SpatialGrid& grid, const AABB& box) {
+        std::vector<uint32_t> hits;
+        grid.query(box, [&hits](uint32_t index) { hits.push_back(index); });
+        std::sort(hits.begin(), hits.end());
+        return hits;
+    }
+
+    std::vector<uint32_t> bruteForce(const std::vector<AABB>& boxes, const AABB& box) {
+        std::vector<uint32_t> hits;
+        for (uint32_t i = 0; i < boxes.size(); i++) {
+            if (box.intersects(boxes[i])) {
+                hits.push_back(i);
+            }
+        }
+        return hits;
+    }
+}
+
+// ============================================================================
+// Tests - Query
+// ============================================================================
+
+TEST(SpatialGridTest, EmptyGridReportsNothing) {
+    SpatialGrid grid;
+    grid.build(nullptr, 0);
+    EXPECT_TRUE(queryAll(grid, AABB(0.0f, 0.0f, 1920.0f, 1080.0f)).empty());
+    EXPECT_EQ(grid.candidateCount(), 0u);
+}
+
+TEST(SpatialGridTest, BoxSpanningManyCellsIsReportedOnce) {
+    std::vector<AABB> boxes = {AABB(10.0f, 10.0f, 500.0f, 300.0f)};
+    SpatialGrid grid;
+    grid.build(boxes.data(), boxes.size());
+
+    EXPECT_EQ(queryAll(grid, AABB(0.0f, 0.0f, 1000.0f, 1000.0f)), (std::vector<uint32_t>{0}));
+    EXPECT_EQ(grid.candidateCount(), 1u);
+}
+
+TEST(SpatialGridTest, OffscreenBoxesAreStillFound) {
+    std::vector<AABB> boxes = {
+        AABB(1950.0f, 500.0f, 40.0f, 40.0f),    // Spawning right of the screen
+        AABB(-100.0f, -100.0f, 40.0f, 40.0f),
+        AABB(5000.0f, 5000.0f, 40.0f, 40.0f),
+    };
+    SpatialGrid grid;
+    grid.build(boxes.data(), boxes.size());
+
+    EXPECT_EQ(queryAll(grid, AABB(1960.0f, 510.0f, 16.0f, 8.0f)), (std::vector<uint32_t>{0}));
+    EXPECT_EQ(queryAll(grid, AABB(-90.0f, -90.0f, 16.0f, 8.0f)), (std::vector<uint32_t>{1}));
+    EXPECT_EQ(queryAll(grid, AABB(5010.0f, 5010.0f, 16.0f, 8.0f)), (std::vector<uint32_t>{2}));
+    EXPECT_TRUE(queryAll(grid, AABB(1900.0f, 510.0f, 16.0f, 8.0f)).empty());
+}
+
+TEST(SpatialGridTest, MatchesBruteForce) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> posX(-100.0f, 2000.0f);
+    std::uniform_real_distribution<float> posY(-100.0f, 1150.0f);
+    std::uniform_real_distribution<float> size(4.0f, 150.0f);
+
+    std::vector<AABB> boxes;
+    for (int i = 0; i < 500; i++) {
+        boxes.emplace_back(posX(rng), posY(rng), size(rng), size(rng));
+    }
+    SpatialGrid grid;
+    grid.build(boxes.data(), boxes.size());
+
+    std::size_t checked = 0;
+    for (int i = 0; i < 500; i++) {
+        AABB probe(posX(rng), posY(rng), size(rng), size(rng));
+        EXPECT_EQ(queryAll(grid, probe), bruteForce(boxes, probe));
+        checked += boxes.size();
+    }
+    // The broadphase must prune most of the N×M pairs
+    EXPECT_LT(grid.candidateCount(), checked / 4);
+}
+
+TEST(SpatialGridTest, RebuildReplacesBoxes) {
+    std::vector<AABB> first = {AABB(100.0f, 100.0f, 10.0f, 10.0f)};
+    std::vector<AABB> second = {AABB(800.0f, 800.0f, 10.0f, 10.0f), AABB(100.0f, 100.0f, 10.0f, 10.0f)};
+    SpatialGrid grid;
+    grid.build(first.data(), first.size());
+    EXPECT_EQ(queryAll(grid, AABB(95.0f, 95.0f, 10.0f, 10.0f)), (std::vector<uint32_t>{0}));
+
+    grid.build(second.data(), second.size());
+    EXPECT_EQ(grid.candidateCount(), 0u);
+    EXPECT_EQ(queryAll(grid, AABB(95.0f, 95.0f, 10.0f, 10.0f)), (std::vector<uint32_t>{1}));
+    EXPECT_EQ(grid.size(), 2u);
+}
@@ -0,0 +1,183 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Archetype Storage Tests - Verifies the chunked SoA storage mode of the ECS
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/ecs/core/ECS.hpp"
+#include "infrastructure/ecs/components/PositionComp.hpp"
+#include "infrastructure/ecs/components/VelocityComp.hpp"
+#include "infrastructure/ecs/components/HealthComp.hpp"
+#include "infrastructure/ecs/components/HitboxComp.hpp"
+#include "infrastructure/ecs/systems/MovementSystem.hpp"
+#include <algorithm>
+
+using namespace infrastructure::ecs::components;
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ECS Setup Helper
+// ═══════════════════════════════════════════════════════════════════════════
+
+class ArchetypeStorageTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _ecs.registerComponent<PositionComp>();
+        _ecs.registerComponent<VelocityComp>();
+        _ecs.registerComponent<HealthComp>();
+        _ecs.registerComponent<HitboxComp>();
+    }
+
+    ECS::ECS _ecs{ECS::StorageMode::Archetype};
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Component Access Tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST_F(ArchetypeStorageTest, StorageModeIsArchetype) {
+    EXPECT_EQ(_ecs.storageMode(), ECS::StorageMode::Archetype);
+    ECS::ECS defaultEcs;
+    EXPECT_EQ(defaultEcs.storageMode(), ECS::StorageMode::SparseSet);
+}
+
+TEST_F(ArchetypeStorageTest, ComponentsSurviveArchetypeMoves) {
+    auto e = _ecs.entityCreate();
+    _ecs.entityAddComponent<PositionComp>(e) = {10.0f, 20.0f};
+    _ecs.entityAddComponent<VelocityComp>(e) = {-5.0f, 3.0f};
+    _ecs.entityAddComponent<HealthComp>(e).current = 42;
+
+    EXPECT_FLOAT_EQ(_ecs.entityGetComponent<PositionComp>(e).x, 10.0f);
+    EXPECT_FLOAT_EQ(_ecs.entityGetComponent<PositionComp>(e).y, 20.0f);
+    EXPECT_FLOAT_EQ(_ecs.entityGetComponent<VelocityComp>(e).x, -5.0f);
+    EXPECT_EQ(_ecs.entityGetComponent<HealthComp>(e).current, 42);
+
+    _ecs.entityRemoveComponent<VelocityComp>(e);
+    EXPECT_FALSE(_ecs.entityHasComponent<VelocityComp>(e));
+    EXPECT_FLOAT_EQ(_ecs.entityGetComponent<PositionComp>(e).y, 20.0f);
+    EXPECT_EQ(_ecs.entityGetComponent<HealthComp>(e).current, 42);
+}
+
+TEST_F(ArchetypeStorageTest, AddTwiceThrows) {
+    auto e = _ecs.entityCreate();
+    _ecs.entityAddComponent<PositionComp>(e);
+    EXPECT_THROW(_ecs.entityAddComponent<PositionComp>(e), ECS::ERROR::ComponentAlreadyAttached);
+}
+
+TEST_F(ArchetypeStorageTest, GetMissingComponentThrows) {
+    auto e = _ecs.entityCreate();
+    _ecs.entityAddComponent<PositionComp>(e);
+    EXPECT_THROW(_ecs.entityGetComponent<VelocityComp>(e), ECS::ERROR::ComponentNotAttached);
+}
+
+TEST_F(ArchetypeStorageTest, GetPoolThrowsInArchetypeMode) {
+    EXPECT_THROW(_ecs.getPool<PositionComp>(), ECS::ERROR::StorageModeMismatch);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Deletion Tests (swap-remove keeps other rows intact)
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST_F(ArchetypeStorageTest, DeleteKeepsOtherEntitiesIntact) {
+    std::vector<ECS::EntityID> entities;
+    for (int i = 0; i < 1000; i++) {
+        auto e = _ecs.entityCreate();
+        _ecs.entityAddComponent<PositionComp>(e).x = static_cast<float>(i);
+        _ecs.entityAddComponent<VelocityComp>(e).x = static_cast<float>(i) * 2.0f;
+        entities.push_back(e);
+    }
+
+    // Delete every third entity, forcing rows from the tail to be relocated
+    for (std::size_t i = 0; i < entities.size(); i += 3)
+        _ecs.entityDelete(entities[i]);
+
+    for (std::size_t i = 0; i < entities.size(); i++) {
+        if (i % 3 == 0) {
+            EXPECT_FALSE(_ecs.entityHasComponent<PositionComp>(entities[i]));
+            continue;
+        }
+        EXPECT_FLOAT_EQ(_ecs.entityGetComponent<PositionComp>(entities[i]).x, static_cast<float>(i));
+        EXPECT_FLOAT_EQ(_ecs.entityGetComponent<VelocityComp>(entities[i]).x, static_cast<float>(i) * 2.0f);
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Query Tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST_F(ArchetypeStorageTest, QueryMatchesSupersetArchetypes) {
+    auto e1 = _ecs.entityCreate();
+    auto e2 = _ecs.entityCreate();
+    auto e3 = _ecs.entityCreate();
+
+    _ecs.entityAddComponent<PositionComp>(e1);
+    _ecs.entityAddComponent<VelocityComp>(e1);
+    _ecs.entityAddComponent<PositionComp>(e2);
+    _ecs.entityAddComponent<PositionComp>(e3);
+    _ecs.entityAddComponent<VelocityComp>(e3);
+    _ecs.entityAddComponent<HealthComp>(e3);
+
+    auto moving = _ecs.getEntitiesByComponentsAllOf<PositionComp, VelocityComp>();
+    EXPECT_EQ(moving, (std::vector<ECS::EntityID>{e1, e3}));
+
+    auto any = _ecs.getEntitiesByComponentsAnyOf<VelocityComp, HealthComp>();
+    EXPECT_EQ(any, (std::vector<ECS::EntityID>{e1, e3}));
+}
+
+TEST_F(ArchetypeStorageTest, ForEachChunkYieldsContiguousColumns) {
+    for (int i = 0; i < 2000; i++) {
+        auto e = _ecs.entityCreate();
+        _ecs.entityAddComponent<PositionComp>(e).x = static_cast<float>(i);
+        _ecs.entityAddComponent<VelocityComp>(e);
+    }
+
+    std::size_t visited = 0;
+    std::size_t chunks = 0;
+    _ecs.forEachChunk<PositionComp, VelocityComp>(
+        [&](std::size_t count, const ECS::EntityID* entities, PositionComp* pos, VelocityComp*) {
+            chunks++;
+            for (std::size_t i = 0; i < count; i++) {
+                EXPECT_FLOAT_EQ(pos[i].x, static_cast<float>(entities[i]));
+            }
+            visited += count;
+        });
+
+    EXPECT_EQ(visited, 2000u);
+    EXPECT_GT(chunks, 1u);  // 2000 rows don't fit in a single 16 KiB chunk
+}
+
+TEST_F(ArchetypeStorageTest, ForEachWorksInSparseSetMode) {
+    ECS::ECS sparse;
+    sparse.registerComponent<PositionComp>();
+    sparse.registerComponent<VelocityComp>();
+    auto e = sparse.entityCreate();
+    sparse.entityAddComponent<PositionComp>(e).x = 1.0f;
+    sparse.entityAddComponent<VelocityComp>(e).x = 2.0f;
+
+    float sum = 0.0f;
+    sparse.forEach<PositionComp, VelocityComp>([&](ECS::EntityID, PositionComp& pos, VelocityComp& vel) {
+        sum += pos.x + vel.x;
+    });
+    EXPECT_FLOAT_EQ(sum, 3.0f);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// System Tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST_F(ArchetypeStorageTest, MovementSystemUpdatesArchetypeStorage) {
+    _ecs.addSystem<infrastructure::ecs::systems::MovementSystem>();
+
+    auto moving = _ecs.entityCreate();
+    _ecs.entityAddComponent<PositionComp>(moving) = {100.0f, 100.0f};
+    _ecs.entityAddComponent<VelocityComp>(moving) = {200.0f, -100.0f};
+    auto still = _ecs.entityCreate();
+    _ecs.entityAddComponent<PositionComp>(still) = {50.0f, 50.0f};
+
+    _ecs.Update(500);
+
+    EXPECT_FLOAT_EQ(_ecs.entityGetComponent<PositionComp>(moving).x, 200.0f);
+    EXPECT_FLOAT_EQ(_ecs.entityGetComponent<PositionComp>(moving).y, 50.0f);
+    EXPECT_FLOAT_EQ(_ecs.entityGetComponent<PositionComp>(still).x, 50.0f);
+}
@@ -163,6 +163,39 @@ TEST_F(ECSIntegrationTest, DeleteEntityRemovesFromActiveCount) {
     EXPECT_TRUE(_ecs.entityIsActive(e2));
 }
 
+TEST_F(ECSIntegrationTest, StaleHandleDoesNotAliasReusedSlot) {
+    auto old = _ecs.entityCreate();
+    _ecs.entityAddComponent<HealthComp>(old).current = 1;
+    _ecs.entityDelete(old);
+
+    // LIFO free list: the freed slot is reused right away, with a new generation
+    auto fresh = _ecs.entityCreate();
+    _ecs.entityAddComponent<HealthComp>(fresh).current = 2;
+    EXPECT_EQ(ECS::entityIndex(fresh), ECS::entityIndex(old));
+    EXPECT_NE(fresh, old);
+
+    EXPECT_FALSE(_ecs.entityIsActive(old));
+    EXPECT_FALSE(_ecs.entityHasComponent<HealthComp>(old));
+    EXPECT_THROW(_ecs.entityGetComponent<HealthComp>(old), ECS::ERROR::InvalidEntityID);
+    EXPECT_THROW(_ecs.entityAddComponent<PositionComp>(old), ECS::ERROR::InvalidEntityID);
+
+    // Deleting through the stale handle must not touch the new entity
+    _ecs.entityDelete(old);
+    EXPECT_TRUE(_ecs.entityIsActive(fresh));
+    EXPECT_EQ(_ecs.entityGetComponent<HealthComp>(fresh).current, 2);
+}
+
+TEST_F(ECSIntegrationTest, FreedSlotsAreReusedLastInFirstOut) {
+    auto a = _ecs.entityCreate();
+    auto b = _ecs.entityCreate();
+    _ecs.entityCreate();
+    _ecs.entityDelete(a);
+    _ecs.entityDelete(b);
+
+    EXPECT_EQ(ECS::entityIndex(_ecs.entityCreate()), ECS::entityIndex(b));
+    EXPECT_EQ(ECS::entityIndex(_ecs.entityCreate()), ECS::entityIndex(a));
+}
+
 // ═══════════════════════════════════════════════════════════════════════════
 // Entity Group Tests
 // ═══════════════════════════════════════════════════════════════════════════
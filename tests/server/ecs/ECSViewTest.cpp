@@ -0,0 +1,149 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ECS View Tests - Verifies typed views and cached component queries
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/ecs/core/ECS.hpp"
+#include "infrastructure/ecs/components/PositionComp.hpp"
+#include "infrastructure/ecs/components/VelocityComp.hpp"
+#include "infrastructure/ecs/components/HealthComp.hpp"
+#include <algorithm>
+
+using namespace infrastructure::ecs::components;
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ECS Setup Helper (runs every test against both storage modes)
+// ═══════════════════════════════════════════════════════════════════════════
+
+class ECSViewTest : public ::testing::TestWithParam<ECS::StorageMode> {
+protected:
+    void SetUp() override {
+        _ecs.registerComponent<PositionComp>();
+        _ecs.registerComponent<VelocityComp>();
+        _ecs.registerComponent<HealthComp>();
+    }
+
+    std::vector<ECS::EntityID> collectMoving() {
+        std::vector<ECS::EntityID> result;
+        for (auto [entity, pos, vel] : _ecs.view<PositionComp, VelocityComp>())
+            result.push_back(entity);
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    ECS::ECS _ecs{GetParam()};
+};
+
+INSTANTIATE_TEST_SUITE_P(StorageModes, ECSViewTest,
+    ::testing::Values(ECS::StorageMode::SparseSet, ECS::StorageMode::Archetype));
+
+// ═══════════════════════════════════════════════════════════════════════════
+// View Tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST_P(ECSViewTest, EmptyWhenComponentNotRegistered) {
+    struct UnusedComp { int value; };
+    auto e = _ecs.entityCreate();
+    _ecs.entityAddComponent<PositionComp>(e);
+    EXPECT_TRUE((_ecs.view<PositionComp, UnusedComp>().empty()));
+}
+
+TEST_P(ECSViewTest, YieldsOnlyEntitiesWithAllComponents) {
+    auto e1 = _ecs.entityCreate();
+    auto e2 = _ecs.entityCreate();
+    auto e3 = _ecs.entityCreate();
+    _ecs.entityAddComponent<PositionComp>(e1);
+    _ecs.entityAddComponent<VelocityComp>(e1);
+    _ecs.entityAddComponent<PositionComp>(e2);
+    _ecs.entityAddComponent<VelocityComp>(e3);
+    _ecs.entityAddComponent<PositionComp>(e3);
+    _ecs.entityAddComponent<HealthComp>(e3);
+
+    EXPECT_EQ(collectMoving(), (std::vector<ECS::EntityID>{e1, e3}));
+}
+
+TEST_P(ECSViewTest, ReferencesWriteThrough) {
+    auto e = _ecs.entityCreate();
+    _ecs.entityAddComponent<PositionComp>(e) = {1.0f, 2.0f};
+    _ecs.entityAddComponent<VelocityComp>(e) = {10.0f, 20.0f};
+
+    for (auto [entity, pos, vel] : _ecs.view<PositionComp, VelocityComp>()) {
+        pos.x += vel.x;
+        pos.y += vel.y;
+    }
+
+    EXPECT_FLOAT_EQ(_ecs.entityGetComponent<PositionComp>(e).x, 11.0f);
+    EXPECT_FLOAT_EQ(_ecs.entityGetComponent<PositionComp>(e).y, 22.0f);
+}
+
+TEST_P(ECSViewTest, SkipsRemovedAndDeletedEntities) {
+    std::vector<ECS::EntityID> entities;
+    for (int i = 0; i < 3000; i++) {
+        auto e = _ecs.entityCreate();
+        _ecs.entityAddComponent<PositionComp>(e);
+        _ecs.entityAddComponent<VelocityComp>(e);
+        entities.push_back(e);
+    }
+    std::vector<ECS::EntityID> expected;
+    for (std::size_t i = 0; i < entities.size(); i++) {
+        if (i % 3 == 0)
+            _ecs.entityDelete(entities[i]);
+        else if (i % 3 == 1)
+            _ecs.entityRemoveComponent<VelocityComp>(entities[i]);
+        else
+            expected.push_back(entities[i]);
+    }
+
+    EXPECT_EQ(collectMoving(), expected);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Query Cache Tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST_P(ECSViewTest, CachedQueryFollowsStructuralChanges) {
+    auto e1 = _ecs.entityCreate();
+    auto e2 = _ecs.entityCreate();
+    _ecs.entityAddComponent<PositionComp>(e1);
+    _ecs.entityAddComponent<VelocityComp>(e1);
+    _ecs.entityAddComponent<PositionComp>(e2);
+
+    // First call builds the cache
+    EXPECT_EQ((_ecs.getEntitiesByComponentsAllOf<PositionComp, VelocityComp>()),
+              (std::vector<ECS::EntityID>{e1}));
+
+    _ecs.entityAddComponent<VelocityComp>(e2);
+    EXPECT_EQ((_ecs.getEntitiesByComponentsAllOf<PositionComp, VelocityComp>()),
+              (std::vector<ECS::EntityID>{e1, e2}));
+
+    _ecs.entityRemoveComponent<PositionComp>(e1);
+    EXPECT_EQ((_ecs.getEntitiesByComponentsAllOf<PositionComp, VelocityComp>()),
+              (std::vector<ECS::EntityID>{e2}));
+
+    _ecs.entityDelete(e2);
+    EXPECT_TRUE((_ecs.getEntitiesByComponentsAllOf<PositionComp, VelocityComp>().empty()));
+
+    // Recycled IDs must not inherit the previous owner's cache entry
+    auto e3 = _ecs.entityCreate();
+    _ecs.entityAddComponent<VelocityComp>(e3);
+    EXPECT_TRUE((_ecs.getEntitiesByComponentsAllOf<PositionComp, VelocityComp>().empty()));
+    _ecs.entityAddComponent<PositionComp>(e3);
+    EXPECT_EQ((_ecs.getEntitiesByComponentsAllOf<PositionComp, VelocityComp>()),
+              (std::vector<ECS::EntityID>{e3}));
+}
+
+TEST_P(ECSViewTest, CachedQueryMatchesView) {
+    for (int i = 0; i < 500; i++) {
+        auto e = _ecs.entityCreate();
+        _ecs.entityAddComponent<PositionComp>(e);
+        if (i % 2 == 0)
+            _ecs.entityAddComponent<VelocityComp>(e);
+    }
+    auto cached = _ecs.getEntitiesByComponentsAllOf<PositionComp, VelocityComp>();
+    EXPECT_EQ(cached.size(), 250u);
+    EXPECT_TRUE(std::is_sorted(cached.begin(), cached.end()));
+    EXPECT_EQ(cached, collectMoving());
+}
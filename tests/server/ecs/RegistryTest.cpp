@@ -0,0 +1,109 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Registry Tests - Verifies the dense pool list and per-entity signatures
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/ecs/core/ECS.hpp"
+#include "infrastructure/ecs/components/PositionComp.hpp"
+#include "infrastructure/ecs/components/VelocityComp.hpp"
+#include "infrastructure/ecs/components/HealthComp.hpp"
+#include <utility>
+
+using namespace infrastructure::ecs::components;
+
+namespace {
+    template<std::size_t N>
+    struct NumberedComp { int value = 0; };
+
+    template<std::size_t... Is>
+    void registerNumbered(ECS::Registry& registry, std::index_sequence<Is...>) {
+        (registry.registerComponent<NumberedComp<Is>>(), ...);
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Signature Tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(RegistryTest, SlotsFollowRegistrationOrder) {
+    ECS::Registry registry;
+    registry.registerComponent<HealthComp>();
+    registry.registerComponent<PositionComp>();
+
+    EXPECT_EQ(registry.slotOf<HealthComp>(), 0u);
+    EXPECT_EQ(registry.slotOf<PositionComp>(), 1u);
+    EXPECT_FALSE(registry.registerComponent<HealthComp>());
+    EXPECT_THROW(registry.slotOf<VelocityComp>(), ECS::ERROR::UnregisteredComponent);
+}
+
+TEST(RegistryTest, SignatureTracksAttachedComponents) {
+    ECS::Registry registry;
+    registry.registerComponent<PositionComp>();
+    registry.registerComponent<VelocityComp>();
+
+    registry.addComponent<PositionComp>(5);
+    registry.addComponent<VelocityComp>(5);
+    EXPECT_TRUE(registry.hasComponent<PositionComp>(5));
+    EXPECT_EQ(registry.signature(5).count(), 2u);
+
+    registry.removeComponent<VelocityComp>(5);
+    EXPECT_FALSE(registry.hasComponent<VelocityComp>(5));
+    EXPECT_FALSE(registry.getPool<VelocityComp>().hasComponent(5));
+    EXPECT_EQ(registry.signature(5).count(), 1u);
+
+    // Entities never seen have an empty signature
+    EXPECT_TRUE(registry.signature(100000).none());
+    EXPECT_FALSE(registry.hasComponent<PositionComp>(100000));
+}
+
+TEST(RegistryTest, DisableEntityClearsAttachedPoolsOnly) {
+    ECS::Registry registry;
+    registry.registerComponent<PositionComp>();
+    registry.registerComponent<VelocityComp>();
+    registry.registerComponent<HealthComp>();
+
+    registry.addComponent<PositionComp>(1) = {3.0f, 4.0f};
+    registry.addComponent<HealthComp>(1);
+    registry.addComponent<VelocityComp>(2);
+
+    registry.disableEntity(1);
+
+    EXPECT_TRUE(registry.signature(1).none());
+    EXPECT_EQ(registry.getPool<PositionComp>().size(), 0u);
+    EXPECT_EQ(registry.getPool<HealthComp>().size(), 0u);
+    EXPECT_TRUE(registry.hasComponent<VelocityComp>(2));
+}
+
+TEST(RegistryTest, TooManyComponentTypesThrows) {
+    ECS::Registry registry;
+    registerNumbered(registry, std::make_index_sequence<ECS::MAX_COMPONENT_TYPES>{});
+    EXPECT_THROW(registry.registerComponent<PositionComp>(), ECS::ERROR::TooManyComponentTypes);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ECS Integration Tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(RegistryTest, AnyOfUsesSignatures) {
+    ECS::ECS ecs;
+    ecs.registerComponent<PositionComp>();
+    ecs.registerComponent<VelocityComp>();
+    ecs.registerComponent<HealthComp>();
+
+    auto e1 = ecs.entityCreate();
+    auto e2 = ecs.entityCreate();
+    auto e3 = ecs.entityCreate();
+    ecs.entityAddComponent<VelocityComp>(e3);
+    ecs.entityAddComponent<PositionComp>(e2);
+    ecs.entityAddComponent<HealthComp>(e1);
+
+    EXPECT_EQ((ecs.getEntitiesByComponentsAnyOf<PositionComp, VelocityComp>()),
+              (std::vector<ECS::EntityID>{e2, e3}));
+
+    ecs.entityDelete(e2);
+    EXPECT_EQ((ecs.getEntitiesByComponentsAnyOf<PositionComp, VelocityComp>()),
+              (std::vector<ECS::EntityID>{e3}));
+}
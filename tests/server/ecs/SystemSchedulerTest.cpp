@@ -0,0 +1,277 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** System Scheduler Tests - Verifies access-based stages, the job system and deferred deletion
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/ecs/core/ECS.hpp"
+#include "infrastructure/ecs/components/PositionComp.hpp"
+#include "infrastructure/ecs/components/VelocityComp.hpp"
+#include "infrastructure/ecs/components/HealthComp.hpp"
+#include "infrastructure/ecs/components/LifetimeComp.hpp"
+#include "infrastructure/ecs/systems/MovementSystem.hpp"
+#include "infrastructure/ecs/systems/LifetimeSystem.hpp"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using namespace infrastructure::ecs::components;
+
+namespace {
+    // Records the order systems run in and how many ran at the same time
+    struct Trace {
+        std::mutex mutex;
+        std::vector<ECS::SystemID> order;
+        std::atomic<int> running{0};
+        std::atomic<int> maxRunning{0};
+    };
+
+    class TracingSystem : public ECS::ISystem {
+    public:
+        TracingSystem(Trace& trace, ECS::SystemAccess access) : _trace(trace), _access(std::move(access)) {}
+
+        void Update(ECS::ECS&, ECS::SystemID thisID, uint32_t) override {
+            int now = ++_trace.running;
+            int seen = _trace.maxRunning.load();
+            while (now > seen && !_trace.maxRunning.compare_exchange_weak(seen, now)) {}
+            {
+                std::lock_guard<std::mutex> lock(_trace.mutex);
+                _trace.order.push_back(thisID);
+            }
+            --_trace.running;
+        }
+
+        ECS::SystemAccess access() const override { return _access; }
+
+    private:
+        Trace& _trace;
+        ECS::SystemAccess _access;
+    };
+
+    class ThrowingSystem : public ECS::ISystem {
+    public:
+        void Update(ECS::ECS&, ECS::SystemID, uint32_t) override { throw std::runtime_error("system failure"); }
+        ECS::SystemAccess access() const override { return ECS::SystemAccess().read<HealthComp>(); }
+    };
+
+    // Deletes every entity whose health dropped to 0
+    class ReaperSystem : public ECS::ISystem {
+    public:
+        void Update(ECS::ECS& ecs, ECS::SystemID thisID, uint32_t) override {
+            for (auto [entity, health] : ecs.view<HealthComp>()) {
+                if (health.current <= 0)
+                    ecs.entityDeleteDeferred(thisID, entity);
+            }
+        }
+        ECS::SystemAccess access() const override { return ECS::SystemAccess().read<HealthComp>(); }
+    };
+
+    void populate(ECS::ECS& ecs, int count) {
+        for (int i = 0; i < count; i++) {
+            auto e = ecs.entityCreate();
+            ecs.entityAddComponent<PositionComp>(e) = {static_cast<float>(i), 0.0f};
+            ecs.entityAddComponent<VelocityComp>(e) = {10.0f, static_cast<float>(i % 7)};
+            ecs.entityAddComponent<LifetimeComp>(e).remaining = static_cast<float>(i % 5) * 0.01f;
+            ecs.entityAddComponent<HealthComp>(e).current = i % 3;
+        }
+    }
+
+    void registerAll(ECS::ECS& ecs) {
+        ecs.registerComponent<PositionComp>();
+        ecs.registerComponent<VelocityComp>();
+        ecs.registerComponent<LifetimeComp>();
+        ecs.registerComponent<HealthComp>();
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Access Tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(SystemSchedulerTest, AccessConflicts) {
+    auto readPos = ECS::SystemAccess().read<PositionComp>();
+    auto writePos = ECS::SystemAccess().write<PositionComp>();
+    auto writeVel = ECS::SystemAccess().write<VelocityComp>();
+
+    EXPECT_FALSE(readPos.conflictsWith(readPos));
+    EXPECT_TRUE(readPos.conflictsWith(writePos));
+    EXPECT_TRUE(writePos.conflictsWith(readPos));
+    EXPECT_TRUE(writePos.conflictsWith(writePos));
+    EXPECT_FALSE(writePos.conflictsWith(writeVel));
+    EXPECT_TRUE(ECS::SystemAccess::all().conflictsWith(readPos));
+}
+
+TEST(SystemSchedulerTest, UndeclaredSystemsStayExclusive) {
+    class Opaque : public ECS::ISystem {
+    public:
+        void Update(ECS::ECS&, ECS::SystemID, uint32_t) override {}
+    };
+    EXPECT_TRUE(Opaque().access().exclusive);
+    EXPECT_FALSE(infrastructure::ecs::systems::MovementSystem().access().exclusive);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Stage Tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(SystemSchedulerTest, ConflictingSystemsKeepRegistrationOrder) {
+    ECS::JobSystem jobs(3);
+    Trace trace;
+    ECS::ECS ecs;
+    ecs.setJobSystem(&jobs);
+    for (int i = 0; i < 6; i++)
+        ecs.addSystemWithArgs<TracingSystem>(0, trace, ECS::SystemAccess().write<PositionComp>());
+
+    for (int tick = 0; tick < 20; tick++)
+        ecs.Update(16);
+
+    ASSERT_EQ(trace.order.size(), 120u);
+    for (std::size_t i = 0; i < trace.order.size(); i++)
+        EXPECT_EQ(trace.order[i], i % 6);
+    EXPECT_EQ(trace.maxRunning.load(), 1);
+}
+
+TEST(SystemSchedulerTest, DependencySplitsStage) {
+    ECS::JobSystem jobs(3);
+    Trace trace;
+    ECS::ECS ecs;
+    ecs.setJobSystem(&jobs);
+    auto producer = ecs.addSystemWithArgs<TracingSystem>(0, trace, ECS::SystemAccess().read<PositionComp>());
+    auto consumer = ecs.addSystemWithArgs<TracingSystem>(0, trace, ECS::SystemAccess().read<PositionComp>());
+    ecs.systemAddDependency(consumer, producer);
+
+    for (int tick = 0; tick < 50; tick++)
+        ecs.Update(16);
+
+    ASSERT_EQ(trace.order.size(), 100u);
+    for (std::size_t i = 0; i < trace.order.size(); i += 2) {
+        EXPECT_EQ(trace.order[i], producer);
+        EXPECT_EQ(trace.order[i + 1], consumer);
+    }
+}
+
+TEST(SystemSchedulerTest, ExceptionsPropagateFromParallelStage) {
+    ECS::JobSystem jobs(2);
+    Trace trace;
+    ECS::ECS ecs;
+    ecs.setJobSystem(&jobs);
+    ecs.addSystemWithArgs<TracingSystem>(0, trace, ECS::SystemAccess().read<HealthComp>());
+    ecs.addSystem<ThrowingSystem>();
+
+    EXPECT_THROW(ecs.Update(16), std::runtime_error);
+    EXPECT_THROW(ecs.Update(16), std::runtime_error);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Deferred Deletion Tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+TEST(SystemSchedulerTest, DeferredDeleteIsImmediateOutsideUpdate) {
+    ECS::ECS ecs;
+    registerAll(ecs);
+    auto e = ecs.entityCreate();
+    ecs.entityDeleteDeferred(0, e);
+    EXPECT_FALSE(ecs.entityIsActive(e));
+}
+
+TEST(SystemSchedulerTest, DeferredDeletesAreAppliedAfterTheStage) {
+    ECS::ECS ecs;
+    registerAll(ecs);
+    populate(ecs, 30);
+    ecs.addSystem<ReaperSystem>();
+    ecs.addSystem<ReaperSystem>();  // Same stage, deletes the same entities again
+
+    ecs.Update(16);
+
+    EXPECT_EQ(ecs.currentEntityCount(), 20u);
+    for (auto [entity, health] : ecs.view<HealthComp>())
+        EXPECT_GT(health.current, 0);
+}
+
+TEST(SystemSchedulerTest, LastUpdateDeletionsListsEachDeletionOnce) {
+    ECS::ECS ecs;
+    registerAll(ecs);
+    populate(ecs, 30);
+    ecs.addSystem<ReaperSystem>();
+    ecs.addSystem<ReaperSystem>();
+
+    auto outside = ecs.entityCreate();
+    ecs.entityDelete(outside);
+    EXPECT_TRUE(ecs.lastUpdateDeletions().empty());
+
+    ecs.Update(16);
+    const auto& deleted = ecs.lastUpdateDeletions();
+    ASSERT_EQ(deleted.size(), 10u);
+    for (auto e : deleted)
+        EXPECT_FALSE(ecs.entityIsActive(e));
+    EXPECT_EQ(std::find(deleted.begin(), deleted.end(), outside), deleted.end());
+
+    ecs.Update(16);
+    EXPECT_TRUE(ecs.lastUpdateDeletions().empty());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Determinism Tests (parallel vs sequential, both storage modes)
+// ═══════════════════════════════════════════════════════════════════════════
+
+class SystemSchedulerModeTest : public ::testing::TestWithParam<ECS::StorageMode> {};
+
+INSTANTIATE_TEST_SUITE_P(StorageModes, SystemSchedulerModeTest,
+    ::testing::Values(ECS::StorageMode::SparseSet, ECS::StorageMode::Archetype));
+
+TEST_P(SystemSchedulerModeTest, ParallelUpdateMatchesSequential) {
+    ECS::JobSystem jobs(3);
+    ECS::ECS sequential{GetParam()};
+    ECS::ECS parallel{GetParam()};
+    parallel.setJobSystem(&jobs);
+
+    for (ECS::ECS* ecs : {&sequential, &parallel}) {
+        registerAll(*ecs);
+        populate(*ecs, 500);
+        ecs->addSystem<infrastructure::ecs::systems::MovementSystem>();
+        ecs->addSystem<infrastructure::ecs::systems::LifetimeSystem>();
+        ecs->addSystem<ReaperSystem>();
+    }
+
+    for (int tick = 0; tick < 5; tick++) {
+        sequential.Update(16);
+        parallel.Update(16);
+        // Recycled IDs must match too: deletions are applied in the same order
+        auto a = sequential.entityCreate();
+        auto b = parallel.entityCreate();
+        EXPECT_EQ(a, b);
+    }
+
+    EXPECT_EQ(sequential.currentEntityCount(), parallel.currentEntityCount());
+    auto expected = sequential.getEntitiesByComponentsAllOf<PositionComp>();
+    ASSERT_EQ(expected, parallel.getEntitiesByComponentsAllOf<PositionComp>());
+    for (auto e : expected) {
+        EXPECT_FLOAT_EQ(sequential.entityGetComponent<PositionComp>(e).x, parallel.entityGetComponent<PositionComp>(e).x);
+        EXPECT_FLOAT_EQ(sequential.entityGetComponent<PositionComp>(e).y, parallel.entityGetComponent<PositionComp>(e).y);
+    }
+}
+
+TEST_P(SystemSchedulerModeTest, ParallelForEachVisitsEveryEntityOnce) {
+    ECS::JobSystem jobs(3);
+    ECS::ECS ecs{GetParam()};
+    ecs.setJobSystem(&jobs);
+    registerAll(ecs);
+    populate(ecs, 5000);
+
+    std::atomic<std::size_t> visited{0};
+    ecs.parallelForEach<PositionComp, VelocityComp>(
+        [&visited](ECS::EntityID, PositionComp& pos, const VelocityComp& vel) {
+            pos.x += vel.x;
+            visited++;
+        }, 256);
+
+    EXPECT_EQ(visited.load(), 5000u);
+    double sum = 0.0;
+    ecs.forEach<PositionComp>([&sum](ECS::EntityID, const PositionComp& pos) { sum += pos.x; });
+    // Σ(i + 10) for i in [0, 5000)
+    EXPECT_DOUBLE_EQ(sum, 4999.0 * 5000.0 / 2.0 + 50000.0);
+}
@@ -408,3 +408,46 @@ TEST_F(CollisionSystemTest, MultipleCollisionsInOneFrame) {
     // Total: 3 collisions
     EXPECT_EQ(system.getCollisions().size(), 3);
 }
+
+TEST_F(CollisionSystemTest, BroadphaseSkipsDistantPairsAndKeepsOrder) {
+    DomainBridge bridge(_gameRule, _collisionRule, _enemyBehavior);
+    CollisionSystem system(bridge);
+
+    auto addBox = [this](ECS::EntityGroup group, float x, float y) {
+        auto e = _ecs.entityCreate(group);
+        auto& pos = _ecs.entityAddComponent<PositionComp>(e);
+        pos.x = x;
+        pos.y = y;
+        auto& hitbox = _ecs.entityAddComponent<HitboxComp>(e);
+        hitbox.width = 20.0f;
+        hitbox.height = 20.0f;
+        return e;
+    };
+
+    // 100 enemies spread over the playfield, 100 missiles far from all but two of them
+    std::vector<ECS::EntityID> enemies;
+    for (int i = 0; i < 100; i++) {
+        enemies.push_back(addBox(ECS::EntityGroup::ENEMIES,
+                                 static_cast<float>((i % 10) * 190), static_cast<float>((i / 10) * 100)));
+    }
+    for (int i = 0; i < 98; i++) {
+        addBox(ECS::EntityGroup::MISSILES, 1000.0f, 1050.0f);
+    }
+    auto shooter = addBox(ECS::EntityGroup::MISSILES, 5.0f, 5.0f);    // Hits enemies[0] only
+    auto wide = _ecs.entityCreate(ECS::EntityGroup::MISSILES);          // Hits enemies[1] and [2]
+    _ecs.entityAddComponent<PositionComp>(wide) = {200.0f, 5.0f};
+    auto& wideHitbox = _ecs.entityAddComponent<HitboxComp>(wide);
+    wideHitbox.width = 200.0f;
+    wideHitbox.height = 10.0f;
+
+    system.Update(_ecs, 0, 0);
+
+    const auto& collisions = system.getCollisions();
+    ASSERT_EQ(collisions.size(), 3u);
+    EXPECT_EQ(collisions[0].entityA, shooter);
+    EXPECT_EQ(collisions[0].entityB, enemies[0]);
+    EXPECT_EQ(collisions[1].entityA, wide);
+    EXPECT_EQ(collisions[1].entityB, enemies[1]);
+    EXPECT_EQ(collisions[2].entityB, enemies[2]);
+    EXPECT_LT(system.getCandidatePairCount(), 100u * 100u / 10u);
+}
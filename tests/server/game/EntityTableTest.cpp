@@ -0,0 +1,135 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** EntityTableTest - Tests for the dense slot map holding GameWorld entities
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/game/EntityTable.hpp"
+#include <map>
+#include <random>
+#include <string>
+
+using infrastructure::game::EntityTable;
+
+// ============================================================================
+// Basic Operations
+// ============================================================================
+
+TEST(EntityTableTest, InsertFindErase) {
+    EntityTable<int> table;
+    EXPECT_TRUE(table.empty());
+
+    table[7] = 70;
+    table[65535] = 1;
+    table[3] = 30;
+
+    EXPECT_EQ(table.size(), 3u);
+    ASSERT_NE(table.find(7), table.end());
+    EXPECT_EQ(table.find(7)->first, 7);
+    EXPECT_EQ(table.find(7)->second, 70);
+    EXPECT_EQ(table[65535], 1);
+    EXPECT_EQ(table.find(4), table.end());
+    EXPECT_EQ(table.find(60000), table.end());
+
+    EXPECT_EQ(table.erase(7), 1u);
+    EXPECT_EQ(table.erase(7), 0u);
+    EXPECT_FALSE(table.contains(7));
+    EXPECT_EQ(table.size(), 2u);
+    EXPECT_EQ(table[3], 30);
+}
+
+TEST(EntityTableTest, SubscriptKeepsExistingValue) {
+    EntityTable<std::string> table;
+    table[1] = "first";
+    table[1] += "!";
+    EXPECT_EQ(table.size(), 1u);
+    EXPECT_EQ(table[1], "first!");
+}
+
+TEST(EntityTableTest, IterationIsContiguousWithStructuredBindings) {
+    EntityTable<int> table;
+    for (uint16_t id = 1; id <= 10; id++) {
+        table[id] = id * 2;
+    }
+
+    int sum = 0;
+    for (auto& [id, value] : table) {
+        EXPECT_EQ(value, id * 2);
+        value += 1;
+        sum += value;
+    }
+    EXPECT_EQ(sum, 2 * 55 + 10);
+    EXPECT_EQ(&*table.begin() + 9, &*(table.end() - 1));
+}
+
+// ============================================================================
+// Erase While Iterating
+// ============================================================================
+
+TEST(EntityTableTest, EraseIteratorVisitsEveryEntryOnce) {
+    EntityTable<int> table;
+    for (uint16_t id = 1; id <= 100; id++) {
+        table[id] = id;
+    }
+
+    int visited = 0;
+    for (auto it = table.begin(); it != table.end();) {
+        visited++;
+        if (it->second % 3 == 0) {
+            it = table.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    EXPECT_EQ(visited, 100);
+    EXPECT_EQ(table.size(), 67u);
+    for (const auto& [id, value] : table) {
+        EXPECT_NE(value % 3, 0);
+        ASSERT_NE(table.find(id), table.end());
+        EXPECT_EQ(table.find(id)->second, value);
+    }
+}
+
+TEST(EntityTableTest, MatchesStdMapUnderRandomOperations) {
+    EntityTable<int> table;
+    std::map<uint16_t, int> reference;
+    std::mt19937 rng(77);
+    std::uniform_int_distribution<int> idDist(0, 300);
+    std::uniform_int_distribution<int> opDist(0, 2);
+
+    for (int step = 0; step < 5000; step++) {
+        uint16_t id = static_cast<uint16_t>(idDist(rng));
+        if (opDist(rng) == 0) {
+            EXPECT_EQ(table.erase(id), reference.erase(id));
+        } else {
+            table[id] = step;
+            reference[id] = step;
+        }
+    }
+
+    ASSERT_EQ(table.size(), reference.size());
+    std::map<uint16_t, int> contents(table.begin(), table.end());
+    EXPECT_EQ(contents, reference);
+
+    table.clear();
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.find(reference.begin()->first), table.end());
+}
+
+TEST(EntityTableTest, ReservedTableDoesNotReallocate) {
+    EntityTable<int> table(64);
+    table[1] = 1;
+    const auto* first = &*table.begin();
+
+    // Churn below the reserved size: spawns and despawns reuse the same storage
+    for (uint16_t id = 2; id < 2000; id++) {
+        table[id] = id;
+        if (table.size() > 32) {
+            table.erase(table.begin() + 1);
+        }
+    }
+    EXPECT_EQ(first, &*table.begin());
+}
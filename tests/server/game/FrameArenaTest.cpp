@@ -0,0 +1,404 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** FrameArenaTest - Tests for the per-tick arena and the allocation-free steady-state tick
+*/
+
+#include <gtest/gtest.h>
+#include "Protocol.hpp"
+#include "infrastructure/game/FrameArena.hpp"
+#include "infrastructure/game/GameWorld.hpp"
+#include "infrastructure/adapters/in/network/UDPServer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+// ============================================================================
+// Global heap allocation counter
+// ============================================================================
+// Replaces the global operator new/delete of server_tests; counting is off
+// unless a test arms it, so the other tests are unaffected.
+
+namespace {
+    std::atomic<bool> g_counting{false};
+    std::atomic<std::size_t> g_allocations{0};
+
+    void* countedAlloc(std::size_t size, std::size_t alignment) {
+        if (g_counting.load(std::memory_order_relaxed)) {
+            g_allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (size == 0)
+            size = 1;
+        if (alignment > alignof(std::max_align_t))
+            return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+        return std::malloc(size);
+    }
+
+    class AllocationCounter {
+    public:
+        AllocationCounter() {
+            g_allocations = 0;
+            g_counting = true;
+        }
+        ~AllocationCounter() { g_counting = false; }
+
+        std::size_t stop() {
+            g_counting = false;
+            return g_allocations.load();
+        }
+    };
+}
+
+void* operator new(std::size_t size) {
+    if (void* p = countedAlloc(size, 0))
+        return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) { return operator new(size); }
+void* operator new(std::size_t size, std::align_val_t al) {
+    if (void* p = countedAlloc(size, static_cast<std::size_t>(al)))
+        return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size, std::align_val_t al) { return operator new(size, al); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size, 0); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size, 0); }
+void* operator new(std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept {
+    return countedAlloc(size, static_cast<std::size_t>(al));
+}
+void* operator new[](std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept {
+    return countedAlloc(size, static_cast<std::size_t>(al));
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+
+using infrastructure::game::FrameArena;
+using infrastructure::game::GameWorld;
+using infrastructure::game::SnapshotPrioritizer;
+
+// ============================================================================
+// FrameArena
+// ============================================================================
+
+TEST(FrameArenaTest, AllocationsComeFromTheBlock) {
+    FrameArena arena(4096);
+    AllocationCounter counter;
+    int sum = 0;
+    {
+        std::pmr::vector<int> values(arena.resource());
+        for (int i = 0; i < 100; i++)
+            values.push_back(i);
+        std::pmr::vector<uint16_t> ids(50, 7, arena.resource());
+        sum = values[99] + ids[49];
+    }
+    arena.reset();
+    EXPECT_EQ(counter.stop(), 0u);
+    EXPECT_EQ(sum, 106);
+    EXPECT_EQ(arena.overflowBytes(), 0u);
+}
+
+TEST(FrameArenaTest, ResetReusesTheBlock) {
+    FrameArena arena(1024);
+    void* first = arena.resource()->allocate(512);
+    arena.reset();
+    void* again = arena.resource()->allocate(512);
+    EXPECT_EQ(first, again);
+}
+
+TEST(FrameArenaTest, OverflowGrowsTheBlockOnce) {
+    FrameArena arena(1024);
+    std::size_t initial = arena.capacity();
+
+    [[maybe_unused]] void* overflow = arena.resource()->allocate(3000);
+    EXPECT_GT(arena.overflowBytes(), 0u);
+    arena.reset();
+    EXPECT_GE(arena.capacity(), initial + 3000);
+    EXPECT_EQ(arena.overflowBytes(), 0u);
+
+    // The same peak now fits: no heap allocation on the next frames
+    AllocationCounter counter;
+    for (int frame = 0; frame < 10; frame++) {
+        [[maybe_unused]] void* block = arena.resource()->allocate(3000);
+        arena.reset();
+    }
+    EXPECT_EQ(counter.stop(), 0u);
+}
+
+// ============================================================================
+// Steady-state tick
+// ============================================================================
+
+class FrameArenaTickTest : public ::testing::Test {
+protected:
+    static constexpr float DT = 1.0f / 20.0f;
+    static constexpr uint32_t SEED = 42;
+
+    boost::asio::io_context io_ctx;
+    std::shared_ptr<GameWorld> gameWorld;
+
+    void SetUp() override {
+        gameWorld = std::make_shared<GameWorld>(io_ctx);
+        gameWorld->seedRandom(SEED);
+    }
+
+    std::vector<uint8_t> players;
+    std::vector<uint8_t> mortalPlayers;
+    std::size_t damageEvents = 0;
+
+    // God mode unless mortal: a mortal player gets hit, and healed before each tick so they never die
+    void addPlayer(unsigned short port, bool mortal = false) {
+        boost::asio::ip::udp::endpoint ep(boost::asio::ip::make_address("127.0.0.1"), port);
+        auto idOpt = gameWorld->addPlayer(ep);
+        ASSERT_TRUE(idOpt.has_value());
+        if (mortal) {
+            mortalPlayers.push_back(*idOpt);
+        } else {
+            gameWorld->setPlayerGodMode(*idOpt, true);
+        }
+        players.push_back(*idOpt);
+    }
+
+    void healMortalPlayers() {
+        for (uint8_t id : mortalPlayers) {
+            while (gameWorld->getPlayerHealth(id) < infrastructure::game::DEFAULT_HEALTH)
+                gameWorld->applyPowerUp(id, PowerUpType::Health);
+        }
+    }
+
+    // Enemies fire straight ahead: keeps the mortal players on the row of the nearest one.
+    // Reads a full snapshot, so it runs outside the counted code.
+    void steerMortalPlayers() {
+        GameSnapshot snapshot = gameWorld->getSnapshot();
+        const EnemyState* nearest = nullptr;
+        for (uint8_t i = 0; i < snapshot.enemy_count; i++) {
+            if (!nearest || snapshot.enemies[i].x < nearest->x)
+                nearest = &snapshot.enemies[i];
+        }
+        for (uint8_t id : mortalPlayers) {
+            uint16_t keys = 0;
+            for (uint8_t i = 0; nearest && i < snapshot.player_count; i++) {
+                if (snapshot.players[i].id != id)
+                    continue;
+                int offset = static_cast<int>(nearest->y) - static_cast<int>(snapshot.players[i].y);
+                keys = offset > 4 ? InputKeys::DOWN : offset < -4 ? InputKeys::UP : 0;
+            }
+            gameWorld->applyPlayerInput(id, keys, ++inputSequence);
+        }
+    }
+
+    uint16_t inputSequence = 0;
+
+    // The room loop of UDPServer::updateAndBroadcastRoom, minus the sends (players fire at will)
+    std::size_t tick() {
+        std::size_t events = 0;
+        gameWorld->beginFrame();
+        healMortalPlayers();
+        for (uint8_t id : players) {
+            if (gameWorld->canPlayerShoot(id))
+                gameWorld->spawnMissileWithWeapon(id);
+        }
+#ifdef USE_ECS_BACKEND
+        gameWorld->runECSUpdate(DT);
+#else
+        gameWorld->updatePlayers(DT);
+#endif
+        gameWorld->updateShootCooldowns(DT);
+        gameWorld->updateMissiles(DT);
+        gameWorld->updateWaveSpawning(DT);
+        gameWorld->updateEnemies(DT);
+        gameWorld->checkBossSpawn();
+        gameWorld->updateBoss(DT);
+        gameWorld->updateComboTimers(DT);
+        gameWorld->updateAllCharging(DT);
+        gameWorld->updateWaveCannons(DT);
+        gameWorld->updatePowerUps(DT);
+        gameWorld->updateForcePods(DT);
+        gameWorld->updateBitDevices(DT);
+        gameWorld->checkPowerUpCollisions();
+        gameWorld->checkForceCollisions();
+        gameWorld->checkBitCollisions();
+        gameWorld->checkCollisions();
+
+        events += gameWorld->getDestroyedMissiles().size();
+        events += gameWorld->getDestroyedEnemies().size();
+        damageEvents += gameWorld->getPlayerDamageEvents().size();
+        events += gameWorld->getPlayerDamageEvents().size();
+        events += gameWorld->getDeadPlayers().size();
+        events += gameWorld->getNewlySpawnedPowerUps().size();
+        events += gameWorld->getCollectedPowerUps().size();
+        events += gameWorld->getExpiredPowerUps().size();
+        events += gameWorld->getDestroyedWaveCannons().size();
+
+        // Both snapshot paths of the broadcast: the shared one and the per-player picks
+        auto candidates = gameWorld->getSnapshotCandidates(gameWorld->frameResource());
+        GameSnapshot snapshot;
+        SnapshotPrioritizer::takeFirst(candidates, snapshot);
+        for (uint8_t id : players) {
+            gameWorld->getSnapshotPrioritizer().select(id, candidates, gameWorld->getSnapshotBudget(),
+                                                       gameWorld->frameResource(), snapshot);
+        }
+        std::pmr::vector<uint8_t> payload(snapshot.wire_size(), gameWorld->frameResource());
+        snapshot.to_bytes(payload.data());
+        events += gameWorld->getAllEndpoints(gameWorld->frameResource()).size();
+        return events;
+    }
+};
+
+TEST_F(FrameArenaTickTest, SteadyStateTickDoesNotAllocate) {
+    addPlayer(12345);
+    addPlayer(12346, true);
+    gameWorld->giveForceToPlayer(players[0]);
+    gameWorld->giveBitDevicesToPlayer(players[1]);
+
+    // Waves, kills, drops and contact hits take every buffer to its working size
+    std::size_t events = 0;
+    for (int i = 0; i < 1200; i++) {
+        steerMortalPlayers();
+        events += tick();
+    }
+    EXPECT_GT(events, 0u);
+    GameSnapshot busy = gameWorld->getSnapshot();
+    EXPECT_GT(busy.enemy_count, 0);
+    EXPECT_GT(busy.missile_count, 0);
+
+    damageEvents = 0;
+    std::size_t allocations = 0;
+    for (int i = 0; i < 300; i++) {
+        steerMortalPlayers();
+        AllocationCounter counter;
+        events += tick();
+        allocations += counter.stop();
+    }
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_GT(damageEvents, 0u);  // The damage broadcasts' inputs were built under the counter
+}
+
+// ============================================================================
+// Steady-state room frame, sends included
+// ============================================================================
+
+using infrastructure::adapters::in::network::UDPServer;
+
+// Friend of UDPServer: runs its real runRoomFrame(), so the snapshot and event
+// broadcasts, the bundler and the socket sends are counted with the gameplay
+class FrameArenaRoomFrameTest : public FrameArenaTickTest {
+protected:
+    static constexpr const char* ROOM = "FRAME1";
+
+    std::unique_ptr<UDPServer> server;
+    // The clients: never read, the kernel drops what overflows
+    boost::asio::ip::udp::socket bundledClient{io_ctx, {boost::asio::ip::make_address("127.0.0.1"), 0}};
+    boost::asio::ip::udp::socket plainClient{io_ctx, {boost::asio::ip::make_address("127.0.0.1"), 0}};
+
+    void SetUp() override {
+        server = std::make_unique<UDPServer>(io_ctx, nullptr, nullptr, 1, 0);
+        gameWorld = server->_instanceManager.getOrCreateInstance(ROOM, io_ctx, 0);
+        gameWorld->seedRandom(SEED);
+
+        // One client on the newest protocol, one on the oldest that acks for deltas
+        addPlayer(bundledClient.local_endpoint().port());
+        addPlayer(plainClient.local_endpoint().port(), true);
+        gameWorld->setPlayerFeatures(players[0], GameFeatures::SUPPORTED);
+        gameWorld->setPlayerSnapshotEncoding(players[0], LATEST_SNAPSHOT_ENCODING);
+        gameWorld->setPlayerSnapshotEncoding(players[1], SnapshotEncoding::Bytes);
+    }
+
+    void TearDown() override {
+        server->stop();
+    }
+
+    // What the room's strand runs each frame, with the client traffic it would have received
+    void roomFrame() {
+        healMortalPlayers();
+        for (uint8_t id : players) {
+            gameWorld->updatePlayerActivity(id);  // Stands in for the heartbeats
+            bool mortal = std::find(mortalPlayers.begin(), mortalPlayers.end(), id) != mortalPlayers.end();
+            if (!mortal && gameWorld->canPlayerShoot(id))
+                gameWorld->spawnMissileWithWeapon(id);  // The mortal player leaves its enemy alive
+        }
+        gameWorld->ackSnapshot(players[1], static_cast<uint16_t>(gameWorld->getSimulationClock().getSnapshotsDue()));
+        server->runRoomFrame(ROOM, gameWorld);
+        damageEvents += gameWorld->getPlayerDamageEvents().size();  // Broadcast by the frame
+    }
+
+    /**
+     * Runs frames paced by a timer inside io_context::run(), like the shard's
+     * frame timer: asio only recycles handler memory on threads running the
+     * io_context. Allocations are counted inside the frames after the warm-up:
+     * at least countedFrames, and until one broadcast a player's damage (the
+     * test's own timer and steering are not part of the room frame).
+     */
+    std::size_t runRoomFrames(int warmupFrames, int countedFrames) {
+        static constexpr int MAX_EXTRA_FRAMES = 10000;
+
+        struct FrameLoop {
+            FrameArenaRoomFrameTest* test;
+            boost::asio::steady_timer* timer;
+            std::size_t* allocations;
+            int frame;
+            int warmupFrames;
+            int lastFrame;
+
+            void operator()(boost::system::error_code ec) {
+                if (ec)
+                    return;
+                test->steerMortalPlayers();
+                if (frame == warmupFrames)
+                    test->damageEvents = 0;
+                if (frame < warmupFrames) {
+                    test->roomFrame();
+                } else {
+                    AllocationCounter counter;
+                    test->roomFrame();
+                    *allocations += counter.stop();
+                }
+                // Frames only last a millisecond of play: go on until the mortal player was hit
+                if (++frame >= lastFrame && (test->damageEvents > 0 || frame >= lastFrame + MAX_EXTRA_FRAMES))
+                    return;
+                timer->expires_after(std::chrono::milliseconds(1));
+                timer->async_wait(*this);
+            }
+        };
+
+        boost::asio::steady_timer timer(io_ctx);
+        std::size_t allocations = 0;
+        timer.expires_after(std::chrono::milliseconds(1));
+        timer.async_wait(FrameLoop{this, &timer, &allocations, 0, warmupFrames, warmupFrames + countedFrames});
+        io_ctx.restart();
+        io_ctx.run();
+        return allocations;
+    }
+};
+
+TEST_F(FrameArenaRoomFrameTest, SteadyStateRoomFrameDoesNotAllocate) {
+    gameWorld->giveForceToPlayer(players[0]);
+    gameWorld->giveBitDevicesToPlayer(players[1]);
+
+    // Gameplay warm-up at full speed, then frames at 1 kHz so the test stays short
+    for (int i = 0; i < 1200; i++) {
+        steerMortalPlayers();
+        tick();
+    }
+    gameWorld->getSimulationClock().setRates({.tickRate = 1000, .snapshotRate = 1000, .maxCatchUpTicks = 1000});
+
+    EXPECT_EQ(runRoomFrames(300, 300), 0u);
+    EXPECT_GT(damageEvents, 0u);
+    EXPECT_GT(gameWorld->getSimulationClock().getSnapshotsDue(), 500u);
+    EXPECT_GT(bundledClient.available(), 0u);
+    EXPECT_GT(plainClient.available(), 0u);
+}
@@ -0,0 +1,45 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** GameInstanceManagerTest - Room instances pinned to network shards
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/game/GameInstanceManager.hpp"
+#include <thread>
+
+using infrastructure::game::GameInstanceManager;
+
+TEST(GameInstanceManagerTest, DefaultInstancesLiveOnShardZero) {
+    boost::asio::io_context io_ctx;
+    GameInstanceManager manager(io_ctx);
+
+    auto room = manager.getOrCreateInstance("ROOM01");
+    ASSERT_NE(room, nullptr);
+    EXPECT_EQ(room->getShard(), 0u);
+    EXPECT_EQ(manager.getOrCreateInstance("ROOM01"), room);
+}
+
+TEST(GameInstanceManagerTest, RoomKeepsTheShardItWasCreatedOn) {
+    boost::asio::io_context mainCtx;
+    boost::asio::io_context shardCtx;
+    GameInstanceManager manager(mainCtx);
+
+    auto room = manager.getOrCreateInstance("ROOM02", shardCtx, 3);
+    EXPECT_EQ(room->getShard(), 3u);
+
+    // A later player whose packets reach another shard joins the same instance
+    boost::asio::io_context otherCtx;
+    EXPECT_EQ(manager.getOrCreateInstance("ROOM02", otherCtx, 1), room);
+    EXPECT_EQ(room->getShard(), 3u);
+
+    // Its strand runs on the shard's io_context
+    std::thread::id ranOn;
+    boost::asio::post(room->getStrand(), [&ranOn]() { ranOn = std::this_thread::get_id(); });
+    EXPECT_EQ(mainCtx.poll(), 0u);
+    std::thread shardThread([&shardCtx]() { shardCtx.run(); });
+    std::thread::id shardId = shardThread.get_id();
+    shardThread.join();
+    EXPECT_EQ(ranOn, shardId);
+}
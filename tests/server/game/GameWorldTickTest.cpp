@@ -0,0 +1,235 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** GameWorldTickTest - Drives whole GameWorld ticks, with whichever backend the server uses
+*/
+
+#include <gtest/gtest.h>
+#include "Protocol.hpp"
+#include "infrastructure/game/GameWorld.hpp"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+// ============================================================================
+// Fixture
+// ============================================================================
+
+class GameWorldTickTest : public ::testing::Test {
+protected:
+    static constexpr float DT = 1.0f / 60.0f;
+
+    boost::asio::io_context io_ctx;
+    std::unique_ptr<infrastructure::game::GameWorld> gameWorld;
+    std::vector<uint16_t> destroyedMissiles;
+    std::vector<uint16_t> destroyedEnemies;
+    std::vector<uint16_t> spawnedPowerUps;
+
+    void SetUp() override {
+        gameWorld = std::make_unique<infrastructure::game::GameWorld>(io_ctx);
+    }
+
+    uint8_t addPlayer(unsigned short port = 12345) {
+        boost::asio::ip::udp::endpoint ep(boost::asio::ip::make_address("127.0.0.1"), port);
+        auto idOpt = gameWorld->addPlayer(ep);
+        EXPECT_TRUE(idOpt.has_value());
+        return idOpt.value_or(0);
+    }
+
+    // Same update order as the room loop, without wave spawning
+    void tick() {
+#ifdef USE_ECS_BACKEND
+        gameWorld->runECSUpdate(DT);
+#else
+        gameWorld->updatePlayers(DT);
+#endif
+        gameWorld->updateShootCooldowns(DT);
+        gameWorld->updateMissiles(DT);
+        gameWorld->updateEnemies(DT);
+        gameWorld->updateComboTimers(DT);
+        gameWorld->checkCollisions();
+        gameWorld->updatePowerUps(DT);
+
+        auto missiles = gameWorld->getDestroyedMissiles();
+        destroyedMissiles.insert(destroyedMissiles.end(), missiles.begin(), missiles.end());
+        auto enemies = gameWorld->getDestroyedEnemies();
+        destroyedEnemies.insert(destroyedEnemies.end(), enemies.begin(), enemies.end());
+        auto powerUps = gameWorld->getNewlySpawnedPowerUps();
+        spawnedPowerUps.insert(spawnedPowerUps.end(), powerUps.begin(), powerUps.end());
+    }
+
+    static const MissileState* findMissile(const GameSnapshot& snapshot, uint16_t id) {
+        for (uint8_t i = 0; i < snapshot.missile_count; i++) {
+            if (snapshot.missiles[i].id == id)
+                return &snapshot.missiles[i];
+        }
+        return nullptr;
+    }
+};
+
+// ============================================================================
+// Missiles
+// ============================================================================
+
+TEST_F(GameWorldTickTest, MissileMovesAndIsDestroyedOnceOffScreen) {
+    uint8_t playerId = addPlayer();
+    auto ids = gameWorld->spawnMissileWithWeapon(playerId);
+    ASSERT_EQ(ids.size(), 1u);
+    uint16_t missileId = ids[0];
+
+    auto before = gameWorld->getSnapshot();
+    const MissileState* start = findMissile(before, missileId);
+    ASSERT_NE(start, nullptr);
+    uint16_t startX = start->x;
+
+    tick();
+    auto after = gameWorld->getSnapshot();
+    const MissileState* moved = findMissile(after, missileId);
+    ASSERT_NE(moved, nullptr);
+    EXPECT_GT(moved->x, startX);
+
+    for (int i = 0; i < 600 && findMissile(gameWorld->getSnapshot(), missileId); i++)
+        tick();
+
+    EXPECT_EQ(findMissile(gameWorld->getSnapshot(), missileId), nullptr);
+    EXPECT_EQ(std::count(destroyedMissiles.begin(), destroyedMissiles.end(), missileId), 1);
+}
+
+// ============================================================================
+// Kills
+// ============================================================================
+
+TEST_F(GameWorldTickTest, KilledEnemyIsReportedOnceAndDropsPowerUp) {
+    uint8_t playerId = addPlayer();
+    for (int i = 0; i < 3; i++)
+        gameWorld->switchWeapon(playerId, true);  // Standard -> Missile (homing)
+    gameWorld->spawnPOWArmor();
+
+    auto snapshot = gameWorld->getSnapshot();
+    ASSERT_EQ(snapshot.enemy_count, 1);
+    uint16_t enemyId = snapshot.enemies[0].id;
+
+    for (int i = 0; i < 900 && destroyedEnemies.empty(); i++) {
+        if (gameWorld->canPlayerShoot(playerId))
+            gameWorld->spawnMissileWithWeapon(playerId);
+        tick();
+    }
+    tick();
+
+    ASSERT_EQ(std::count(destroyedEnemies.begin(), destroyedEnemies.end(), enemyId), 1);
+    EXPECT_EQ(destroyedEnemies.size(), 1u);
+    EXPECT_EQ(spawnedPowerUps.size(), 1u);  // POW Armor always drops
+
+    auto after = gameWorld->getSnapshot();
+    EXPECT_EQ(after.enemy_count, 0);
+    ASSERT_EQ(after.player_count, 1);
+    EXPECT_GT(after.players[0].score, 0u);
+    EXPECT_EQ(after.players[0].kills, 1);
+    EXPECT_GT(after.players[0].combo, 10);  // Kill bumped the multiplier above 1.0x
+}
+
+TEST_F(GameWorldTickTest, CollisionCandidatePairsAreReportedPerTick) {
+    uint8_t playerId = addPlayer();
+    for (int i = 0; i < 3; i++)
+        gameWorld->switchWeapon(playerId, true);  // Standard -> Missile (homing)
+
+    // Missiles but no enemy: nothing for the broadphase to pair
+    gameWorld->spawnMissileWithWeapon(playerId);
+    tick();
+    EXPECT_EQ(gameWorld->getCollisionCandidatePairs(), 0u);
+
+    gameWorld->spawnPOWArmor();
+    size_t maxPairs = 0;
+    for (int i = 0; i < 900 && destroyedEnemies.empty(); i++) {
+        if (gameWorld->canPlayerShoot(playerId))
+            gameWorld->spawnMissileWithWeapon(playerId);
+        tick();
+        maxPairs = std::max(maxPairs, gameWorld->getCollisionCandidatePairs());
+    }
+    ASSERT_EQ(destroyedEnemies.size(), 1u);
+    EXPECT_GE(maxPairs, 1u);  // The missiles that hit were candidates
+
+    // Counted again on the next tick, not accumulated
+    for (int i = 0; i < 300 && gameWorld->getSnapshot().missile_count > 0; i++)
+        tick();
+    tick();
+    EXPECT_EQ(gameWorld->getCollisionCandidatePairs(), 0u);
+}
+
+TEST_F(GameWorldTickTest, PlayerHealthMatchesTheSnapshot) {
+    uint8_t playerId = addPlayer();
+    auto snapshot = gameWorld->getSnapshot();
+    ASSERT_EQ(snapshot.player_count, 1);
+    EXPECT_EQ(gameWorld->getPlayerHealth(playerId), snapshot.players[0].health);
+    EXPECT_EQ(gameWorld->getPlayerHealth(playerId), infrastructure::game::DEFAULT_HEALTH);
+    EXPECT_EQ(gameWorld->getPlayerHealth(playerId + 1), 0);  // Unknown player
+}
+
+TEST_F(GameWorldTickTest, SnapshotAckOnlyMovesForwardWithinTheHistory) {
+    uint8_t id = addPlayer();
+    auto ackedSnapshot = [&]() {
+        auto recipients = gameWorld->getRecipients(gameWorld->frameResource());
+        EXPECT_EQ(recipients.size(), 1u);
+        return recipients.empty() ? std::nullopt : recipients[0].ackedSnapshot;
+    };
+    auto sendSnapshot = [&]() {
+        uint16_t seq = gameWorld->nextSnapshotSequence();
+        compression::toSnapshotImage(gameWorld->getSnapshot(), gameWorld->getSnapshotHistory().store(seq));
+        return seq;
+    };
+
+    EXPECT_FALSE(ackedSnapshot().has_value());  // New players get full snapshots
+
+    uint16_t first = sendSnapshot();
+    uint16_t second = sendSnapshot();
+    gameWorld->ackSnapshot(id, second);
+    EXPECT_EQ(ackedSnapshot(), second);
+
+    gameWorld->ackSnapshot(id, first);  // Reordered ack
+    EXPECT_EQ(ackedSnapshot(), second);
+
+    gameWorld->ackSnapshot(id, second + 100);  // Never sent
+    EXPECT_EQ(ackedSnapshot(), second);
+}
+
+TEST_F(GameWorldTickTest, SnapshotAckMatchesThePlayersOwnHistory) {
+    uint8_t id = addPlayer();
+    auto& prioritizer = gameWorld->getSnapshotPrioritizer();
+
+    // A per-player snapshot: only that player's history has its image
+    uint16_t personal = gameWorld->nextSnapshotSequence();
+    gameWorld->getSnapshotHistory().forget(personal);
+    compression::toSnapshotImage(gameWorld->getSnapshot(), prioritizer.history(id).store(personal));
+
+    gameWorld->ackSnapshot(id, personal);
+    auto recipients = gameWorld->getRecipients(gameWorld->frameResource());
+    ASSERT_EQ(recipients.size(), 1u);
+    EXPECT_EQ(recipients[0].playerId, id);
+    EXPECT_EQ(recipients[0].ackedSnapshot, personal);
+
+    gameWorld->removePlayer(id);
+    EXPECT_EQ(prioritizer.findHistory(id), nullptr);
+}
+
+TEST_F(GameWorldTickTest, ReliableEventsOnlyForPlayersThatNegotiatedThem) {
+    uint8_t legacy = addPlayer();
+    uint8_t reliable = addPlayer(12346);
+    gameWorld->setPlayerFeatures(reliable, GameFeatures::RELIABLE_EVENTS);
+
+    auto recipients = gameWorld->getRecipients(gameWorld->frameResource());
+    ASSERT_EQ(recipients.size(), 2u);
+    for (const auto& recipient : recipients) {
+        EXPECT_EQ(recipient.reliableEvents != nullptr, recipient.playerId == reliable);
+    }
+
+    // Acks reach the player's sender
+    auto* sender = std::find_if(recipients.begin(), recipients.end(),
+        [reliable](const auto& r) { return r.playerId == reliable; })->reliableEvents;
+    sender->queue(MessageType::PlayerJoin, PlayerJoin{.player_id = legacy});
+    uint8_t buf[64];
+    uint16_t sequence = 0;
+    ASSERT_GT(sender->writePacket(std::chrono::steady_clock::now(), buf, sizeof(buf), sequence), 0u);
+    gameWorld->ackReliableEvents(reliable, sequence, 1);
+    EXPECT_EQ(sender->pending(), 0u);
+}
@@ -0,0 +1,139 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SimulationClockTest - Fixed-step accumulator, snapshot rate, catch-up cap and tick-time histogram
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/game/SimulationClock.hpp"
+#include "infrastructure/game/TickTimeHistogram.hpp"
+#include <chrono>
+
+using infrastructure::game::SimulationClock;
+using infrastructure::game::SimulationRates;
+using infrastructure::game::TickTimeHistogram;
+using namespace std::chrono_literals;
+
+// ============================================================================
+// Fixed step
+// ============================================================================
+
+TEST(SimulationClockTest, FirstFrameRunsOneTickAndSendsASnapshot) {
+    SimulationClock clock;
+    auto step = clock.advance(SimulationClock::Clock::now());
+    EXPECT_EQ(step.ticks, 1u);
+    EXPECT_EQ(step.skipped, 0u);
+    EXPECT_TRUE(step.snapshotDue);
+    EXPECT_FLOAT_EQ(clock.getTickSeconds(), 1.0f / 60.0f);
+}
+
+TEST(SimulationClockTest, ElapsedTimeIsSpentInWholeTicks) {
+    SimulationClock clock(SimulationRates{.tickRate = 100, .snapshotRate = 10, .maxCatchUpTicks = 8});
+    auto now = SimulationClock::Clock::now();
+    clock.advance(now);
+
+    // 25 ms: two 10 ms ticks, 5 ms carried over
+    now += 25ms;
+    EXPECT_EQ(clock.advance(now).ticks, 2u);
+    // 5 ms later the carried 5 ms make a whole tick
+    now += 5ms;
+    EXPECT_EQ(clock.advance(now).ticks, 1u);
+    // Too early for another one
+    now += 4ms;
+    EXPECT_EQ(clock.advance(now).ticks, 0u);
+    EXPECT_EQ(clock.getTicksRun(), 4u);
+}
+
+TEST(SimulationClockTest, SnapshotsFollowTheirOwnRate) {
+    SimulationClock clock(SimulationRates{.tickRate = 60, .snapshotRate = 20, .maxCatchUpTicks = 4});
+    auto now = SimulationClock::Clock::now();
+    clock.advance(now);
+
+    // One frame per tick for a second: 60 ticks, 20 snapshots
+    const auto frame = clock.getTickInterval();
+    uint32_t ticks = 0;
+    uint32_t snapshots = 0;
+    for (int i = 0; i < 60; ++i) {
+        now += frame;
+        auto step = clock.advance(now);
+        ticks += step.ticks;
+        snapshots += step.snapshotDue ? 1 : 0;
+    }
+    EXPECT_EQ(ticks, 60u);
+    EXPECT_NEAR(snapshots, 20u, 1u);
+}
+
+TEST(SimulationClockTest, SnapshotRateIsCappedAtTheTickRate) {
+    SimulationClock clock(SimulationRates{.tickRate = 30, .snapshotRate = 120, .maxCatchUpTicks = 4});
+    EXPECT_EQ(clock.getRates().snapshotRate, 30u);
+}
+
+// ============================================================================
+// Overload
+// ============================================================================
+
+TEST(SimulationClockTest, BacklogPastTheCatchUpCapIsSkipped) {
+    SimulationClock clock(SimulationRates{.tickRate = 100, .snapshotRate = 20, .maxCatchUpTicks = 3});
+    auto now = SimulationClock::Clock::now();
+    clock.advance(now);
+
+    // A 100 ms stall owes 10 ticks: 3 run, 7 dropped, one snapshot
+    now += 100ms;
+    auto step = clock.advance(now);
+    EXPECT_EQ(step.ticks, 3u);
+    EXPECT_EQ(step.skipped, 7u);
+    EXPECT_TRUE(step.snapshotDue);
+    EXPECT_EQ(clock.getTicksSkipped(), 7u);
+
+    // The dropped backlog is not owed on the next frame
+    now += 10ms;
+    step = clock.advance(now);
+    EXPECT_EQ(step.ticks, 1u);
+    EXPECT_EQ(step.skipped, 0u);
+    EXPECT_FALSE(step.snapshotDue);
+}
+
+TEST(SimulationClockTest, NewRatesRestartTheAccumulators) {
+    SimulationClock clock;
+    auto now = SimulationClock::Clock::now();
+    clock.advance(now);
+    now += 10ms;
+
+    clock.setRates(SimulationRates{.tickRate = 30, .snapshotRate = 10, .maxCatchUpTicks = 2});
+    auto step = clock.advance(now);
+    EXPECT_EQ(step.ticks, 1u);
+    EXPECT_TRUE(step.snapshotDue);
+    EXPECT_FLOAT_EQ(clock.getTickSeconds(), 1.0f / 30.0f);
+}
+
+// ============================================================================
+// Tick-time histogram
+// ============================================================================
+
+TEST(SimulationClockTest, TickTimesLandInTheirBuckets) {
+    TickTimeHistogram histogram;
+    for (int i = 0; i < 98; ++i) {
+        histogram.record(300us);
+    }
+    histogram.record(3ms);
+    histogram.record(60ms);
+
+    auto summary = histogram.summary();
+    EXPECT_EQ(summary.total, 100u);
+    EXPECT_EQ(summary.counts[2], 98u);  // (250, 500] µs
+    EXPECT_EQ(summary.counts[TickTimeHistogram::BUCKETS - 1], 1u);
+    EXPECT_EQ(summary.maxUs, 60000u);
+    EXPECT_EQ(summary.quantileUs(0.5), 500u);
+    EXPECT_EQ(summary.quantileUs(0.99), 4000u);
+    EXPECT_EQ(summary.quantileUs(1.0), 60000u);
+    EXPECT_EQ(summary.meanUs(), (98u * 300u + 3000u + 60000u) / 100u);
+}
+
+TEST(SimulationClockTest, EmptyHistogramReadsZero) {
+    TickTimeHistogram histogram;
+    auto summary = histogram.summary();
+    EXPECT_EQ(summary.total, 0u);
+    EXPECT_EQ(summary.meanUs(), 0u);
+    EXPECT_EQ(summary.quantileUs(0.99), 0u);
+}
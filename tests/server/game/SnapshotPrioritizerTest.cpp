@@ -0,0 +1,140 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SnapshotPrioritizerTest - Per-player entity selection under the snapshot caps and byte budget
+*/
+
+#include <gtest/gtest.h>
+#include "Protocol.hpp"
+#include "infrastructure/game/SnapshotPrioritizer.hpp"
+#include <algorithm>
+#include <map>
+#include <memory_resource>
+
+using infrastructure::game::SnapshotCandidates;
+using infrastructure::game::SnapshotPrioritizer;
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+namespace {
+    constexpr uint8_t PLAYER = 1;
+
+    SnapshotCandidates makeCandidates(size_t missiles, size_t enemies) {
+        SnapshotCandidates candidates;
+        candidates.base.player_count = 1;
+        candidates.base.players[0] = PlayerState{};
+        candidates.base.players[0].id = PLAYER;
+        candidates.base.players[0].x = 100;
+        candidates.base.players[0].y = 500;
+        candidates.base.players[0].alive = 1;
+        for (size_t i = 0; i < missiles; ++i) {
+            candidates.missiles.push_back(MissileState{
+                .id = static_cast<uint16_t>(1 + i), .owner_id = PLAYER,
+                .x = static_cast<uint16_t>(100 + i * 40), .y = 500, .weapon_type = 0});
+        }
+        for (size_t i = 0; i < enemies; ++i) {
+            candidates.enemies.push_back(EnemyState{
+                .id = static_cast<uint16_t>(1000 + i),
+                .x = static_cast<uint16_t>(200 + i * 100), .y = 500, .health = 50, .enemy_type = 0});
+        }
+        return candidates;
+    }
+
+    bool hasMissile(const GameSnapshot& gs, uint16_t id) {
+        return std::any_of(gs.missiles, gs.missiles + gs.missile_count,
+            [id](const MissileState& ms) { return ms.id == id; });
+    }
+}
+
+// ============================================================================
+// Shared snapshot
+// ============================================================================
+
+TEST(SnapshotPrioritizerTest, SmallRoomFitsOneSharedSnapshot) {
+    auto candidates = makeCandidates(MAX_MISSILES, MAX_ENEMIES);
+    EXPECT_TRUE(SnapshotPrioritizer::fitsWhole(candidates, SnapshotPrioritizer::DEFAULT_BUDGET));
+
+    GameSnapshot gs;
+    SnapshotPrioritizer::takeFirst(candidates, gs);
+    EXPECT_EQ(gs.missile_count, MAX_MISSILES);
+    EXPECT_EQ(gs.enemy_count, MAX_ENEMIES);
+
+    candidates.missiles.push_back(MissileState{.id = 999, .owner_id = PLAYER, .x = 0, .y = 0, .weapon_type = 0});
+    EXPECT_FALSE(SnapshotPrioritizer::fitsWhole(candidates, SnapshotPrioritizer::DEFAULT_BUDGET));
+    EXPECT_FALSE(SnapshotPrioritizer::fitsWhole(makeCandidates(4, 2), 40));
+}
+
+// ============================================================================
+// Per-player selection
+// ============================================================================
+
+TEST(SnapshotPrioritizerTest, SelectionStaysWithinCapsAndBudget) {
+    SnapshotPrioritizer prioritizer;
+    std::pmr::monotonic_buffer_resource scratch;
+    auto candidates = makeCandidates(MAX_MISSILES * 3, MAX_ENEMIES * 2);
+
+    GameSnapshot gs;
+    prioritizer.select(PLAYER, candidates, SnapshotPrioritizer::DEFAULT_BUDGET, &scratch, gs);
+    EXPECT_EQ(gs.missile_count, MAX_MISSILES);
+    EXPECT_EQ(gs.enemy_count, MAX_ENEMIES);
+    EXPECT_EQ(gs.player_count, 1);
+
+    const size_t budget = 300;
+    prioritizer.select(PLAYER, candidates, budget, &scratch, gs);
+    EXPECT_LE(gs.wire_size(), budget);
+    EXPECT_GT(gs.wire_size() + MissileState::WIRE_SIZE, budget);  // Filled up to the budget
+}
+
+TEST(SnapshotPrioritizerTest, EveryEntityIsEventuallySent) {
+    SnapshotPrioritizer prioritizer;
+    std::pmr::monotonic_buffer_resource scratch;
+    auto candidates = makeCandidates(MAX_MISSILES * 3, 0);
+
+    std::map<uint16_t, int> sends;
+    GameSnapshot gs;
+    for (int tick = 0; tick < 30; ++tick) {
+        prioritizer.select(PLAYER, candidates, SnapshotPrioritizer::DEFAULT_BUDGET, &scratch, gs);
+        for (uint8_t i = 0; i < gs.missile_count; ++i) {
+            sends[gs.missiles[i].id]++;
+        }
+    }
+    EXPECT_EQ(sends.size(), candidates.missiles.size());
+
+    // Missiles close to the ship are refreshed more often than far ones
+    EXPECT_GT(sends[1], sends[static_cast<uint16_t>(candidates.missiles.size())]);
+}
+
+TEST(SnapshotPrioritizerTest, NewEntitiesJumpTheQueue) {
+    SnapshotPrioritizer prioritizer;
+    std::pmr::monotonic_buffer_resource scratch;
+    auto candidates = makeCandidates(MAX_MISSILES * 2, 0);
+
+    GameSnapshot gs;
+    for (int tick = 0; tick < 5; ++tick) {
+        prioritizer.select(PLAYER, candidates, SnapshotPrioritizer::DEFAULT_BUDGET, &scratch, gs);
+    }
+    // Far away, but never sent yet
+    candidates.missiles.push_back(MissileState{.id = 500, .owner_id = PLAYER, .x = 1900, .y = 50, .weapon_type = 0});
+    prioritizer.select(PLAYER, candidates, SnapshotPrioritizer::DEFAULT_BUDGET, &scratch, gs);
+    EXPECT_TRUE(hasMissile(gs, 500));
+}
+
+TEST(SnapshotPrioritizerTest, PlayersGetTheirOwnHistory) {
+    SnapshotPrioritizer prioritizer;
+    prioritizer.history(1).store(7).fill(0x11);
+    prioritizer.history(2).store(7).fill(0x22);
+
+    ASSERT_NE(prioritizer.findHistory(1), nullptr);
+    EXPECT_EQ((*prioritizer.findHistory(1)->find(7))[0], 0x11);
+    EXPECT_EQ((*prioritizer.findHistory(2)->find(7))[0], 0x22);
+
+    // A room-wide snapshot under sequence 7 + CAPACITY replaces both images
+    prioritizer.forget(7 + compression::SnapshotHistory::CAPACITY);
+    EXPECT_EQ(prioritizer.findHistory(1)->find(7), nullptr);
+
+    prioritizer.removePlayer(2);
+    EXPECT_EQ(prioritizer.findHistory(2), nullptr);
+}
@@ -0,0 +1,163 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BatchedUDPIOTest - recvmmsg/sendmmsg batching over loopback sockets
+*/
+
+#ifdef __linux__
+
+#include <gtest/gtest.h>
+#include "infrastructure/network/BatchedUDPIO.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+using infrastructure::network::BatchedUDPIO;
+using infrastructure::network::SendBufferPool;
+using boost::asio::ip::udp;
+
+class BatchedUDPIOTest : public ::testing::Test {
+protected:
+    boost::asio::io_context io_ctx;
+    udp::socket server{io_ctx, udp::endpoint(boost::asio::ip::make_address("127.0.0.1"), 0)};
+    udp::socket client{io_ctx, udp::endpoint(boost::asio::ip::make_address("127.0.0.1"), 0)};
+    BatchedUDPIO batched{io_ctx, server, 512};
+    SendBufferPool pool;
+
+    // Runs the io_context until done() holds (or a second has passed)
+    template<typename Predicate>
+    void runUntil(Predicate done) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (!done() && std::chrono::steady_clock::now() < deadline) {
+            io_ctx.run_for(std::chrono::milliseconds(10));
+            io_ctx.restart();
+        }
+    }
+};
+
+TEST_F(BatchedUDPIOTest, DrainsSeveralDatagramsPerSyscall) {
+    constexpr int COUNT = 100;
+    std::set<int> received;
+    udp::endpoint lastSender;
+    batched.startReceiving(
+        [&](const udp::endpoint& from, const uint8_t* data, std::size_t size) {
+            ASSERT_EQ(size, sizeof(int));
+            int value;
+            std::memcpy(&value, data, sizeof(value));
+            received.insert(value);
+            lastSender = from;
+        },
+        [](const boost::system::error_code& ec) { FAIL() << ec.message(); });
+
+    // Queued in the kernel before the reactor gets a chance to wake up
+    for (int i = 0; i < COUNT; i++)
+        client.send_to(boost::asio::buffer(&i, sizeof(i)), server.local_endpoint());
+
+    runUntil([&] { return received.size() == COUNT; });
+
+    EXPECT_EQ(received.size(), static_cast<std::size_t>(COUNT));
+    EXPECT_EQ(lastSender, client.local_endpoint());
+    EXPECT_EQ(batched.getDatagramsReceived(), static_cast<uint64_t>(COUNT));
+    EXPECT_LT(batched.getReceiveSyscalls(), static_cast<uint64_t>(COUNT) / 4);
+}
+
+TEST_F(BatchedUDPIOTest, FlushSendsQueuedDatagramsInBatches) {
+    constexpr std::size_t COUNT = 2 * BatchedUDPIO::BATCH_SIZE + 5;
+    for (std::size_t i = 0; i < COUNT; i++) {
+        auto buf = pool.acquire(sizeof(i));
+        std::memcpy(buf.data(), &i, sizeof(i));
+        batched.queue(client.local_endpoint(), buf);
+    }
+    batched.flush();
+
+    EXPECT_EQ(batched.getDatagramsSent(), COUNT);
+    EXPECT_EQ(batched.getSendSyscalls(), 3u);
+
+    std::set<std::size_t> received;
+    client.non_blocking(true);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (received.size() < COUNT && std::chrono::steady_clock::now() < deadline) {
+        std::size_t value = 0;
+        udp::endpoint from;
+        boost::system::error_code ec;
+        std::size_t size = client.receive_from(boost::asio::buffer(&value, sizeof(value)), from, 0, ec);
+        if (!ec) {
+            EXPECT_EQ(size, sizeof(value));
+            EXPECT_EQ(from, server.local_endpoint());
+            received.insert(value);
+        }
+    }
+    EXPECT_EQ(received.size(), COUNT);
+
+    // Every buffer went back to the pool once sent
+    EXPECT_EQ(pool.idleCount(), COUNT);
+}
+
+TEST_F(BatchedUDPIOTest, SendsQueuedOutsideAFlushStillGoOut) {
+    auto buf = pool.acquire(3);
+    std::memcpy(buf.data(), "abc", 3);
+    batched.queue(client.local_endpoint(), buf);
+    buf = {};
+
+    runUntil([&] { return batched.getDatagramsSent() == 1; });
+    EXPECT_EQ(batched.getDatagramsSent(), 1u);
+
+    char data[8] = {};
+    udp::endpoint from;
+    EXPECT_EQ(client.receive_from(boost::asio::buffer(data), from), 3u);
+    EXPECT_STREQ(data, "abc");
+}
+
+TEST_F(BatchedUDPIOTest, SendsQueuedInAFlushScopeWaitForItsEnd) {
+    {
+        BatchedUDPIO::FlushScope scope(&batched);
+        batched.queue(client.local_endpoint(), pool.acquire(3));
+        batched.queue(client.local_endpoint(), pool.acquire(3));
+        io_ctx.poll();  // Nothing was posted for them
+        io_ctx.restart();
+        EXPECT_EQ(batched.getDatagramsSent(), 0u);
+    }
+    EXPECT_EQ(batched.getDatagramsSent(), 2u);
+    EXPECT_EQ(batched.getSendSyscalls(), 1u);
+}
+
+TEST_F(BatchedUDPIOTest, FramesOnAPooledIoContextSendInOneSyscallEach) {
+    // Room frames on a strand, with idle threads ready to run anything posted, like GameBootstrap's pool
+    constexpr int THREADS = 4;
+    constexpr int FRAMES = 50;
+    constexpr std::size_t DATAGRAMS_PER_FRAME = 20;
+    auto work = boost::asio::make_work_guard(io_ctx);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < THREADS; i++)
+        threads.emplace_back([this]() { io_ctx.run(); });
+
+    auto strand = boost::asio::make_strand(io_ctx);
+    std::atomic<int> framesDone{0};
+    for (int frame = 0; frame < FRAMES; frame++) {
+        boost::asio::post(strand, [this, &framesDone]() {
+            BatchedUDPIO::FlushScope scope(&batched);
+            for (std::size_t i = 0; i < DATAGRAMS_PER_FRAME; i++) {
+                batched.queue(client.local_endpoint(), pool.acquire(8));
+                std::this_thread::yield();  // Simulation work between the sends
+            }
+            framesDone.fetch_add(1);
+        });
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (framesDone.load() < FRAMES && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    work.reset();
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(framesDone.load(), FRAMES);
+    EXPECT_EQ(batched.getDatagramsSent(), FRAMES * DATAGRAMS_PER_FRAME);
+    EXPECT_EQ(batched.getSendSyscalls(), static_cast<uint64_t>(FRAMES));  // DATAGRAMS_PER_FRAME per sendmmsg
+}
+
+#endif /* __linux__ */
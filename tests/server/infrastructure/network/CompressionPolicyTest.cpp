@@ -0,0 +1,230 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** CompressionPolicyTest - Codec choice, learned ratios and per-type stats of the compression policy
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/network/CompressionPolicy.hpp"
+#include "infrastructure/network/NetworkStats.hpp"
+#include "compression/Compression.hpp"
+#include "compression/SnapshotDictionary.hpp"
+#include "Protocol.hpp"
+#include <random>
+#include <thread>
+#include <vector>
+
+using infrastructure::network::CompressionPolicy;
+using infrastructure::network::NetworkStats;
+using Codec = CompressionPolicy::Codec;
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+namespace {
+    constexpr auto ROOM_UPDATE = static_cast<uint16_t>(MessageType::RoomUpdate);
+    constexpr auto LEADERBOARD = static_cast<uint16_t>(MessageType::LeaderboardData);
+    constexpr auto SNAPSHOT = static_cast<uint16_t>(MessageType::Snapshot);
+
+    // Fixed-size records with names and zero padding, like the TCP list payloads
+    std::vector<uint8_t> listPayload(size_t entries) {
+        std::vector<uint8_t> payload;
+        for (size_t i = 0; i < entries; ++i) {
+            std::string name = "player_" + std::to_string(i % 7);
+            name.resize(32, '\0');
+            payload.insert(payload.end(), name.begin(), name.end());
+            payload.push_back(static_cast<uint8_t>(i));
+            payload.push_back(0);
+            payload.push_back(0);
+            payload.push_back(static_cast<uint8_t>(i * 3));
+        }
+        return payload;
+    }
+
+    std::vector<uint8_t> noise(size_t size, uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::vector<uint8_t> bytes(size);
+        for (auto& byte : bytes) {
+            byte = static_cast<uint8_t>(rng());
+        }
+        return bytes;
+    }
+
+    // Compresses through the policy; empty when the payload was left raw
+    std::vector<uint8_t> compressWith(CompressionPolicy& policy, uint16_t type, const std::vector<uint8_t>& payload,
+                                      compression::CompressionContext* context = nullptr, bool useDictionary = false) {
+        std::vector<uint8_t> compressed(compression::compressBound(payload.size()));
+        size_t size = policy.compress(type, payload, compressed, context, useDictionary);
+        compressed.resize(size);
+        return compressed;
+    }
+
+    const CompressionPolicy::TypeStats* statsOf(const std::vector<CompressionPolicy::TypeStats>& stats, uint16_t type) {
+        for (const auto& entry : stats) {
+            if (entry.type == type) {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+}
+
+// ============================================================================
+// Codec choice
+// ============================================================================
+
+TEST(CompressionPolicyTest, SmallPayloadsAreSentRaw) {
+    CompressionPolicy policy;
+    EXPECT_EQ(policy.choose(ROOM_UPDATE, CompressionPolicy::MIN_SIZE - 1), Codec::None);
+    EXPECT_TRUE(compressWith(policy, ROOM_UPDATE, std::vector<uint8_t>(16, 0)).empty());
+
+    auto stats = policy.getStats();
+    const auto* typeStats = statsOf(stats, ROOM_UPDATE);
+    ASSERT_NE(typeStats, nullptr);
+    EXPECT_EQ(typeStats->of(Codec::None).messages, 1u);
+    EXPECT_EQ(typeStats->ratio(), 1.0);
+}
+
+TEST(CompressionPolicyTest, MediumPayloadsUseFastLZ4) {
+    CompressionPolicy policy;
+    auto payload = listPayload(10);
+    ASSERT_LT(payload.size(), CompressionPolicy::HIGH_MIN_SIZE);
+    EXPECT_EQ(policy.choose(ROOM_UPDATE, payload.size()), Codec::Fast);
+
+    auto compressed = compressWith(policy, ROOM_UPDATE, payload);
+    ASSERT_FALSE(compressed.empty());
+    EXPECT_EQ(compression::decompress(compressed.data(), compressed.size(), payload.size()), payload);
+
+    auto stats = policy.getStats();
+    const auto* typeStats = statsOf(stats, ROOM_UPDATE);
+    ASSERT_NE(typeStats, nullptr);
+    EXPECT_EQ(typeStats->of(Codec::Fast).messages, 1u);
+    EXPECT_EQ(typeStats->of(Codec::Fast).bytesOut, compressed.size() + CompressionHeader::WIRE_SIZE);
+}
+
+TEST(CompressionPolicyTest, LargePayloadsUseHCWhichDecodesAsPlainLZ4) {
+    CompressionPolicy policy;
+    auto payload = listPayload(100);
+    ASSERT_GE(payload.size(), CompressionPolicy::HIGH_MIN_SIZE);
+
+    auto compressed = compressWith(policy, LEADERBOARD, payload);
+    ASSERT_FALSE(compressed.empty());
+    EXPECT_EQ(compression::decompress(compressed.data(), compressed.size(), payload.size()), payload);
+    auto stats = policy.getStats();
+    ASSERT_EQ(stats.size(), 1u);
+    EXPECT_EQ(stats[0].of(Codec::High).messages, 1u);
+
+    // At least as small as fast LZ4
+    EXPECT_LE(compressed.size(), compression::compress(payload.data(), payload.size()).size());
+}
+
+TEST(CompressionPolicyTest, DictionaryPayloadsStayOnTheCallersContext) {
+    CompressionPolicy policy;
+    compression::CompressionContext context(compression::SNAPSHOT_DICTIONARY);
+    auto payload = listPayload(100);
+
+    auto compressed = compressWith(policy, SNAPSHOT, payload, &context, true);
+    ASSERT_FALSE(compressed.empty());
+    std::vector<uint8_t> decompressed(payload.size());
+    EXPECT_TRUE(context.decompress(compressed, decompressed));
+    EXPECT_EQ(decompressed, payload);
+
+    auto stats = policy.getStats();
+    const auto* typeStats = statsOf(stats, SNAPSHOT);
+    ASSERT_NE(typeStats, nullptr);
+    EXPECT_EQ(typeStats->of(Codec::Fast).messages, 1u);
+    EXPECT_EQ(typeStats->of(Codec::High).messages, 0u);
+}
+
+TEST(CompressionPolicyTest, SlowHCFallsBackToFast) {
+    CompressionPolicy policy;
+    for (uint64_t i = 0; i < CompressionPolicy::WARMUP_MESSAGES; ++i) {
+        policy.record(LEADERBOARD, Codec::High, 4096, 1024, 4096 * (CompressionPolicy::HIGH_MAX_NANOS_PER_BYTE + 1));
+    }
+    EXPECT_EQ(policy.choose(LEADERBOARD, 4096), Codec::Fast);
+    EXPECT_EQ(policy.choose(ROOM_UPDATE, 4096), Codec::High);
+}
+
+// ============================================================================
+// Learned ratio
+// ============================================================================
+
+TEST(CompressionPolicyTest, IncompressibleTypesAreSentRawAndProbed) {
+    CompressionPolicy policy;
+    auto payload = noise(256, 42);
+    for (uint64_t i = 0; i < CompressionPolicy::WARMUP_MESSAGES; ++i) {
+        EXPECT_TRUE(compressWith(policy, ROOM_UPDATE, payload).empty());
+    }
+
+    // Now known not to pay: only one payload in PROBE_INTERVAL is still tried
+    for (uint64_t i = 0; i < CompressionPolicy::PROBE_INTERVAL; ++i) {
+        compressWith(policy, ROOM_UPDATE, payload);
+    }
+    auto stats = policy.getStats();
+    const auto* typeStats = statsOf(stats, ROOM_UPDATE);
+    ASSERT_NE(typeStats, nullptr);
+    EXPECT_EQ(typeStats->of(Codec::Fast).messages, CompressionPolicy::WARMUP_MESSAGES + 1);
+    EXPECT_EQ(typeStats->of(Codec::None).messages, CompressionPolicy::PROBE_INTERVAL - 1);
+    EXPECT_EQ(typeStats->bytesOut(), typeStats->bytesIn());
+
+    // Other types are not affected
+    EXPECT_EQ(policy.choose(LEADERBOARD, payload.size()), Codec::Fast);
+}
+
+TEST(CompressionPolicyTest, TypesAreListedMostBytesFirst) {
+    CompressionPolicy policy;
+    compressWith(policy, ROOM_UPDATE, listPayload(4));
+    compressWith(policy, LEADERBOARD, listPayload(50));
+    compressWith(policy, LEADERBOARD, listPayload(50));
+
+    auto stats = policy.getStats();
+    ASSERT_EQ(stats.size(), 2u);
+    EXPECT_EQ(stats[0].type, LEADERBOARD);
+    EXPECT_EQ(stats[0].messages(), 2u);
+    EXPECT_LT(stats[0].ratio(), 0.5);
+    EXPECT_EQ(stats[1].type, ROOM_UPDATE);
+}
+
+TEST(CompressionPolicyTest, ConcurrentSendersAreAllCounted) {
+    CompressionPolicy policy;
+    auto payload = listPayload(10);
+    std::vector<std::thread> senders;
+    for (uint16_t t = 0; t < 4; ++t) {
+        senders.emplace_back([&policy, &payload, t]() {
+            for (int i = 0; i < 500; ++i) {
+                compressWith(policy, static_cast<uint16_t>(ROOM_UPDATE + i % 2), payload);
+                compressWith(policy, static_cast<uint16_t>(0x1000 + t), payload);
+            }
+        });
+    }
+    for (auto& sender : senders) {
+        sender.join();
+    }
+
+    auto stats = policy.getStats();
+    EXPECT_EQ(stats.size(), 6u);
+    uint64_t messages = 0;
+    for (const auto& type : stats) {
+        messages += type.messages();
+    }
+    EXPECT_EQ(messages, 4000u);
+    EXPECT_EQ(statsOf(stats, ROOM_UPDATE)->messages(), 1000u);
+}
+
+// ============================================================================
+// NetworkStats
+// ============================================================================
+
+TEST(CompressionPolicyTest, NetworkStatsExposesTheSharedPolicy) {
+    NetworkStats networkStats;
+    auto policy = networkStats.getCompressionPolicy();
+    ASSERT_NE(policy, nullptr);
+    EXPECT_EQ(policy, networkStats.getCompressionPolicy());
+
+    compressWith(*policy, LEADERBOARD, listPayload(50));
+    auto stats = networkStats.getCompressionStats();
+    ASSERT_EQ(stats.size(), 1u);
+    EXPECT_EQ(stats[0].type, LEADERBOARD);
+}
@@ -0,0 +1,192 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ConnectionTableTest - Lookups, RCU reclamation and session-driven removal of the endpoint table
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/network/ConnectionTable.hpp"
+#include "infrastructure/session/SessionManager.hpp"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using infrastructure::network::ConnectionTable;
+using infrastructure::network::EndpointKey;
+using infrastructure::network::NetworkStats;
+using infrastructure::session::SessionManager;
+using boost::asio::ip::udp;
+using boost::asio::ip::make_address;
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+namespace {
+    udp::endpoint endpointOf(const std::string& address, unsigned short port) {
+        return {make_address(address), port};
+    }
+
+    std::string nameOf(const udp::endpoint& endpoint) {
+        return endpoint.address().to_string() + ":" + std::to_string(endpoint.port());
+    }
+
+    void insertPlayer(ConnectionTable& table, const udp::endpoint& endpoint, uint8_t playerId) {
+        table.insert(endpoint, playerId, {}, playerId, nameOf(endpoint));
+    }
+}
+
+// ============================================================================
+// Lookups
+// ============================================================================
+
+TEST(ConnectionTableTest, FindsInsertedEndpoints) {
+    ConnectionTable table(1);
+    const auto a = endpointOf("127.0.0.1", 5000);
+    const auto b = endpointOf("127.0.0.1", 5001);
+    insertPlayer(table, a, 1);
+    insertPlayer(table, b, 2);
+
+    auto reader = table.read(0);
+    ASSERT_NE(reader.find(a), nullptr);
+    EXPECT_EQ(reader.find(a)->playerId, 1);
+    EXPECT_EQ(reader.find(a)->endpoint, "127.0.0.1:5000");
+    EXPECT_EQ(reader.find(b)->playerId, 2);
+    EXPECT_EQ(reader.find(b)->statsSlot, NetworkStats::Slot{2});
+    EXPECT_EQ(reader.find(endpointOf("127.0.0.2", 5000)), nullptr);
+}
+
+TEST(ConnectionTableTest, IPv4AndItsMappedFormAreOneKey) {
+    EXPECT_EQ(EndpointKey::from(endpointOf("10.0.0.7", 4000)),
+              EndpointKey::from(endpointOf("::ffff:10.0.0.7", 4000)));
+    EXPECT_FALSE(EndpointKey::from(endpointOf("10.0.0.7", 4000)) == EndpointKey::from(endpointOf("10.0.0.7", 4001)));
+    EXPECT_FALSE(EndpointKey::from(endpointOf("::1", 4000)) == EndpointKey::from(endpointOf("127.0.0.1", 4000)));
+}
+
+TEST(ConnectionTableTest, InsertReplacesAndEraseRemoves) {
+    ConnectionTable table(1);
+    const auto a = endpointOf("192.168.1.10", 6000);
+    insertPlayer(table, a, 1);
+    insertPlayer(table, a, 3);  // Rejoined
+    EXPECT_EQ(table.size(), 1u);
+    EXPECT_EQ(table.read(0).find(a)->playerId, 3);
+
+    table.erase(nameOf(a));
+    EXPECT_EQ(table.size(), 0u);
+    EXPECT_EQ(table.read(0).find(a), nullptr);
+    table.erase(nameOf(a));  // Unknown: no-op
+}
+
+TEST(ConnectionTableTest, ManyEndpointsStayReachable) {
+    ConnectionTable table(1);
+    for (uint16_t i = 0; i < 300; ++i) {
+        insertPlayer(table, endpointOf("10.1.0." + std::to_string(i % 200), static_cast<unsigned short>(7000 + i)),
+                     static_cast<uint8_t>(i));
+    }
+    auto reader = table.read(0);
+    for (uint16_t i = 0; i < 300; ++i) {
+        auto* connection = reader.find(endpointOf("10.1.0." + std::to_string(i % 200), static_cast<unsigned short>(7000 + i)));
+        ASSERT_NE(connection, nullptr);
+        EXPECT_EQ(connection->playerId, static_cast<uint8_t>(i));
+    }
+}
+
+TEST(ConnectionTableTest, SessionTouchIsRateLimited) {
+    ConnectionTable table(1);
+    const auto a = endpointOf("127.0.0.1", 5000);
+    insertPlayer(table, a, 1);
+    auto reader = table.read(0);
+    const auto* connection = reader.find(a);
+
+    auto now = std::chrono::steady_clock::now();
+    EXPECT_TRUE(connection->shouldTouchSession(now));
+    EXPECT_FALSE(connection->shouldTouchSession(now + std::chrono::milliseconds(500)));
+    EXPECT_TRUE(connection->shouldTouchSession(now + ConnectionTable::SESSION_TOUCH_INTERVAL));
+}
+
+// ============================================================================
+// RCU
+// ============================================================================
+
+TEST(ConnectionTableTest, ReaderKeepsItsTableUntilItLeaves) {
+    ConnectionTable table(2);
+    const auto a = endpointOf("127.0.0.1", 5000);
+    insertPlayer(table, a, 1);
+
+    {
+        auto reader = table.read(0);
+        const auto* connection = reader.find(a);
+        ASSERT_NE(connection, nullptr);
+
+        // Removed while read: the reader's table, and the connection, stay alive
+        table.erase(nameOf(a));
+        EXPECT_EQ(connection->playerId, 1);
+        EXPECT_EQ(connection->endpoint, "127.0.0.1:5000");
+        EXPECT_GE(table.retiredCount(), 1u);
+        EXPECT_EQ(table.read(1).find(a), nullptr);
+    }
+
+    // Next write frees what no reader holds anymore
+    insertPlayer(table, endpointOf("127.0.0.1", 5001), 2);
+    EXPECT_EQ(table.retiredCount(), 0u);
+}
+
+TEST(ConnectionTableTest, ConcurrentReadersSeeConsistentTables) {
+    ConnectionTable table(4);
+    const auto stable = endpointOf("127.0.0.1", 4000);
+    insertPlayer(table, stable, 42);
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> misses{0};
+    std::vector<std::thread> readers;
+    for (size_t r = 0; r < 3; ++r) {
+        readers.emplace_back([&table, &stop, &misses, &stable, r]() {
+            while (!stop.load(std::memory_order_relaxed)) {
+                auto reader = table.read(r);
+                const auto* connection = reader.find(stable);
+                if (!connection || connection->playerId != 42 || connection->endpoint != "127.0.0.1:4000") {
+                    misses.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    // Churn of joins and leaves around the stable endpoint
+    for (int i = 0; i < 2000; ++i) {
+        const auto churn = endpointOf("10.0.0.1", static_cast<unsigned short>(5000 + i % 50));
+        insertPlayer(table, churn, 1);
+        table.erase(nameOf(churn));
+    }
+    stop = true;
+    for (auto& thread : readers) {
+        thread.join();
+    }
+    EXPECT_EQ(misses.load(), 0u);
+    EXPECT_EQ(table.size(), 1u);
+}
+
+// ============================================================================
+// Session side
+// ============================================================================
+
+TEST(ConnectionTableTest, LosingTheSessionBindingRemovesTheConnection) {
+    ConnectionTable table(1);
+    SessionManager sessions;
+    sessions.setUDPBindingRemovedCallback([&table](const std::string& endpoint) {
+        table.erase(endpoint);
+    });
+
+    auto created = sessions.createSession("player@test.com", "Player");
+    ASSERT_TRUE(created.has_value());
+    const auto a = endpointOf("192.168.1.1", 5000);
+    ASSERT_TRUE(sessions.validateAndBindUDP(created->token, nameOf(a)).has_value());
+    insertPlayer(table, a, 1);
+    EXPECT_TRUE(sessions.assignPlayerId(nameOf(a), 1));
+
+    sessions.clearUDPBinding(nameOf(a));  // Kicked from the game
+    EXPECT_EQ(table.read(0).find(a), nullptr);
+    EXPECT_FALSE(sessions.assignPlayerId(nameOf(a), 1));
+}
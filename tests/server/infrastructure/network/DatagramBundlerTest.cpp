@@ -0,0 +1,142 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** DatagramBundlerTest - Tests for the per-client coalescing of a tick's datagrams
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/network/DatagramBundler.hpp"
+#include <cstring>
+#include <vector>
+
+using infrastructure::network::DatagramBundler;
+using infrastructure::network::SendBufferPool;
+using infrastructure::network::SharedSendBuffer;
+using boost::asio::ip::udp;
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+namespace {
+    struct Sent {
+        udp::endpoint endpoint;
+        SharedSendBuffer buffer;
+    };
+
+    SharedSendBuffer makeDatagram(SendBufferPool& pool, MessageType type, uint16_t sequence, size_t payloadSize) {
+        auto buf = pool.acquire(UDPHeader::WIRE_SIZE + payloadSize);
+        UDPHeader{.type = static_cast<uint16_t>(type), .sequence_num = sequence, .timestamp = 1}.to_bytes(buf.data());
+        std::memset(buf.data() + UDPHeader::WIRE_SIZE, static_cast<int>(sequence & 0xFF), payloadSize);
+        return buf;
+    }
+
+    // Entries of a Bundle datagram, as (type, sequence, size)
+    std::vector<BundleEntryHeader> entriesOf(const SharedSendBuffer& bundle) {
+        std::vector<BundleEntryHeader> entries;
+        size_t offset = UDPHeader::WIRE_SIZE;
+        while (auto entry = BundleEntryHeader::from_bytes(bundle.data() + offset, bundle.size() - offset)) {
+            entries.push_back(*entry);
+            offset += BundleEntryHeader::WIRE_SIZE + entry->size;
+        }
+        EXPECT_EQ(offset, bundle.size());
+        return entries;
+    }
+
+    uint16_t typeOf(const SharedSendBuffer& datagram) {
+        return UDPHeader::from_bytes(datagram.data(), datagram.size())->type;
+    }
+
+    const udp::endpoint CLIENT_A(boost::asio::ip::make_address("127.0.0.1"), 5000);
+    const udp::endpoint CLIENT_B(boost::asio::ip::make_address("127.0.0.1"), 5001);
+}
+
+// ============================================================================
+// Coalescing
+// ============================================================================
+
+TEST(DatagramBundlerTest, TickDatagramsShareOneBundlePerClient) {
+    SendBufferPool pool;
+    std::vector<Sent> sent;
+    DatagramBundler bundler(pool, [&sent](const udp::endpoint& endpoint, uint32_t, const SharedSendBuffer& buffer) {
+        sent.push_back({endpoint, buffer});
+    });
+
+    bundler.add(1, CLIENT_A, 0, makeDatagram(pool, MessageType::MissileDestroyed, 0, 2));
+    bundler.add(1, CLIENT_A, 0, makeDatagram(pool, MessageType::EnemyDestroyed, 0, 2));
+    bundler.add(1, CLIENT_A, 0, makeDatagram(pool, MessageType::SnapshotDelta, 42, 300));
+    EXPECT_TRUE(sent.empty());  // Nothing goes out before the end of the tick
+
+    bundler.flush();
+    ASSERT_EQ(sent.size(), 1u);
+    EXPECT_EQ(sent[0].endpoint, CLIENT_A);
+    EXPECT_EQ(typeOf(sent[0].buffer), static_cast<uint16_t>(MessageType::Bundle));
+
+    auto entries = entriesOf(sent[0].buffer);
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries[0].type, static_cast<uint16_t>(MessageType::MissileDestroyed));
+    EXPECT_EQ(entries[2].type, static_cast<uint16_t>(MessageType::SnapshotDelta));
+    EXPECT_EQ(entries[2].sequence_num, 42);
+    EXPECT_EQ(entries[2].size, 300);
+    EXPECT_EQ(bundler.getDatagramsAdded(), 3u);
+    EXPECT_EQ(bundler.getDatagramsSent(), 1u);
+}
+
+TEST(DatagramBundlerTest, LoneDatagramIsSentAsIs) {
+    SendBufferPool pool;
+    std::vector<Sent> sent;
+    DatagramBundler bundler(pool, [&sent](const udp::endpoint& endpoint, uint32_t, const SharedSendBuffer& buffer) {
+        sent.push_back({endpoint, buffer});
+    });
+
+    auto snapshot = makeDatagram(pool, MessageType::Snapshot, 7, 200);
+    bundler.add(1, CLIENT_A, 0, snapshot);
+    bundler.add(2, CLIENT_B, 0, snapshot);
+    bundler.flush();
+
+    // Both clients still share the broadcast's buffer
+    ASSERT_EQ(sent.size(), 2u);
+    EXPECT_EQ(sent[0].buffer.data(), snapshot.data());
+    EXPECT_EQ(sent[1].buffer.data(), snapshot.data());
+}
+
+TEST(DatagramBundlerTest, BundlesStayWithinMaxDatagram) {
+    SendBufferPool pool;
+    std::vector<Sent> sent;
+    DatagramBundler bundler(pool, [&sent](const udp::endpoint& endpoint, uint32_t, const SharedSendBuffer& buffer) {
+        sent.push_back({endpoint, buffer});
+    });
+
+    for (uint16_t i = 0; i < 10; ++i) {
+        bundler.add(1, CLIENT_A, 0, makeDatagram(pool, MessageType::PowerUpSpawned, i, 300));
+    }
+    bundler.flush();
+
+    size_t entries = 0;
+    ASSERT_GT(sent.size(), 1u);
+    for (const auto& datagram : sent) {
+        EXPECT_LE(datagram.buffer.size(), DatagramBundler::MAX_DATAGRAM);
+        entries += typeOf(datagram.buffer) == static_cast<uint16_t>(MessageType::Bundle)
+            ? entriesOf(datagram.buffer).size() : 1;
+    }
+    EXPECT_EQ(entries, 10u);
+    EXPECT_LT(sent.size(), 10u);
+}
+
+TEST(DatagramBundlerTest, OversizedDatagramGoesAlone) {
+    SendBufferPool pool;
+    std::vector<Sent> sent;
+    DatagramBundler bundler(pool, [&sent](const udp::endpoint& endpoint, uint32_t, const SharedSendBuffer& buffer) {
+        sent.push_back({endpoint, buffer});
+    });
+
+    bundler.add(1, CLIENT_A, 0, makeDatagram(pool, MessageType::PlayerDied, 0, 1));
+    auto large = makeDatagram(pool, MessageType::Snapshot, 3, DatagramBundler::MAX_DATAGRAM);
+    bundler.add(1, CLIENT_A, 0, large);
+    bundler.flush();
+
+    ASSERT_EQ(sent.size(), 2u);
+    EXPECT_EQ(typeOf(sent[0].buffer), static_cast<uint16_t>(MessageType::PlayerDied));
+    EXPECT_EQ(sent[1].buffer.data(), large.data());
+}
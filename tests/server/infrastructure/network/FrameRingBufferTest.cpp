@@ -0,0 +1,182 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** FrameRingBufferTest - In-place views, wrap-point copies and growth of the TCP receive ring
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/network/FrameRingBuffer.hpp"
+#include "Protocol.hpp"
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using infrastructure::network::FrameRingBuffer;
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+namespace {
+    // Writes bytes like successive socket reads, as far as the ring lets them in
+    size_t feed(FrameRingBuffer& ring, const uint8_t* data, size_t size) {
+        size_t written = 0;
+        while (written < size) {
+            auto space = ring.writable();
+            if (space.empty()) {
+                break;
+            }
+            size_t chunk = std::min(space.size(), size - written);
+            std::memcpy(space.data(), data + written, chunk);
+            ring.commit(chunk);
+            written += chunk;
+        }
+        return written;
+    }
+
+    size_t feed(FrameRingBuffer& ring, const std::vector<uint8_t>& bytes) {
+        return feed(ring, bytes.data(), bytes.size());
+    }
+
+    std::vector<uint8_t> sequence(size_t size, uint8_t first = 0) {
+        std::vector<uint8_t> bytes(size);
+        for (size_t i = 0; i < size; ++i) {
+            bytes[i] = static_cast<uint8_t>(first + i);
+        }
+        return bytes;
+    }
+
+    std::vector<uint8_t> frame(MessageType type, const std::vector<uint8_t>& payload) {
+        Header head{.isAuthenticated = true, .type = static_cast<uint16_t>(type),
+                    .payload_size = static_cast<uint32_t>(payload.size())};
+        std::vector<uint8_t> bytes(Header::WIRE_SIZE + payload.size());
+        head.to_bytes(bytes.data());
+        std::copy(payload.begin(), payload.end(), bytes.begin() + Header::WIRE_SIZE);
+        return bytes;
+    }
+
+    bool isInside(std::span<const uint8_t> view, std::span<const uint8_t> whole) {
+        return view.data() >= whole.data() && view.data() + view.size() <= whole.data() + whole.size();
+    }
+}
+
+// ============================================================================
+// Views and copies
+// ============================================================================
+
+TEST(FrameRingBufferTest, CapacityIsAPowerOfTwo) {
+    EXPECT_EQ(FrameRingBuffer().capacity(), FrameRingBuffer::DEFAULT_CAPACITY);
+    EXPECT_EQ(FrameRingBuffer(100).capacity(), 128u);
+    EXPECT_EQ(FrameRingBuffer(1).capacity(), 64u);
+}
+
+TEST(FrameRingBufferTest, ContiguousBytesAreViewedInPlace) {
+    FrameRingBuffer ring(64);
+    auto whole = ring.writable();
+    auto data = sequence(40);
+    ASSERT_EQ(feed(ring, data), 40u);
+
+    auto view = ring.peek(10, 20);
+    ASSERT_EQ(view.size(), 20u);
+    EXPECT_TRUE(isInside(view, whole));
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), data.begin() + 10));
+    EXPECT_EQ(ring.getWrappedPeeks(), 0u);
+    EXPECT_TRUE(ring.peek(30, 20).empty());  // Not buffered yet
+}
+
+TEST(FrameRingBufferTest, BytesStraddlingTheWrapPointAreCopied) {
+    FrameRingBuffer ring(64);
+    feed(ring, sequence(50));
+    ring.consume(40);
+
+    // 14 bytes fit before the end, the rest wraps to the front
+    auto data = sequence(30, 100);
+    ASSERT_EQ(ring.writable().size(), 14u);
+    ASSERT_EQ(feed(ring, data), 30u);
+    ASSERT_EQ(ring.size(), 40u);
+
+    auto view = ring.peek(10, 30);
+    ASSERT_EQ(view.size(), 30u);
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), data.begin()));
+    EXPECT_EQ(ring.getWrappedPeeks(), 1u);
+
+    // The part after the wrap point is contiguous again
+    view = ring.peek(24, 16);
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), data.begin() + 14));
+    EXPECT_EQ(ring.getWrappedPeeks(), 1u);
+}
+
+TEST(FrameRingBufferTest, EmptyRingRestartsAtTheFront) {
+    FrameRingBuffer ring(64);
+    feed(ring, sequence(50));
+    ring.consume(50);
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(ring.writable().size(), 64u);
+}
+
+TEST(FrameRingBufferTest, FullRingGrowsWithoutReorderingItsBytes) {
+    FrameRingBuffer ring(64);
+    feed(ring, sequence(60));
+    ring.consume(30);
+    auto data = sequence(34, 60);
+    ASSERT_EQ(feed(ring, data), 34u);
+    EXPECT_TRUE(ring.writable().empty());
+
+    ring.reserve(ring.capacity() * 2);
+    EXPECT_EQ(ring.capacity(), 128u);
+    auto expected = sequence(64, 30);
+    auto view = ring.peek(0, 64);
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), expected.begin()));
+    EXPECT_EQ(ring.writable().size(), 64u);
+}
+
+// ============================================================================
+// Frames
+// ============================================================================
+
+TEST(FrameRingBufferTest, FramesSurviveArbitraryReadBoundaries) {
+    // Lobby traffic: small chat and room frames, and one leaderboard larger than the ring
+    std::vector<std::vector<uint8_t>> payloads;
+    std::vector<uint8_t> stream;
+    for (size_t i = 0; i < 200; ++i) {
+        auto payload = sequence(i == 120 ? 700 : (i * 37) % 90, static_cast<uint8_t>(i));
+        auto bytes = frame(MessageType::SendChatMessage, payload);
+        stream.insert(stream.end(), bytes.begin(), bytes.end());
+        payloads.push_back(std::move(payload));
+    }
+
+    // Same loop as Session::do_read, with reads of random sizes
+    FrameRingBuffer ring(256);
+    std::mt19937 rng(7);
+    std::vector<std::vector<uint8_t>> received;
+    size_t offset = 0;
+    while (offset < stream.size()) {
+        if (ring.writable().empty()) {
+            ring.reserve(ring.capacity() * 2);
+        }
+        auto space = ring.writable();
+        size_t read = std::min({space.size(), stream.size() - offset, static_cast<size_t>(1 + rng() % 97)});
+        std::memcpy(space.data(), stream.data() + offset, read);
+        ring.commit(read);
+        offset += read;
+
+        while (ring.size() >= Header::WIRE_SIZE) {
+            auto head = Header::from_bytes(ring.peek(0, Header::WIRE_SIZE).data(), Header::WIRE_SIZE);
+            ASSERT_TRUE(head.has_value());
+            size_t totalSize = Header::WIRE_SIZE + head->payload_size;
+            if (ring.size() < totalSize) {
+                break;
+            }
+            auto payload = ring.peek(Header::WIRE_SIZE, head->payload_size);
+            received.emplace_back(payload.begin(), payload.end());
+            ring.consume(totalSize);
+        }
+    }
+
+    EXPECT_EQ(received, payloads);
+    EXPECT_TRUE(ring.empty());
+    EXPECT_GE(ring.capacity(), 1024u);
+    EXPECT_GT(ring.getWrappedPeeks(), 0u);
+}
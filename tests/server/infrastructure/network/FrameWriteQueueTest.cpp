@@ -0,0 +1,177 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** FrameWriteQueueTest - Ordering, coalescing and buffer reuse of the TCP outbound queue
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/network/FrameWriteQueue.hpp"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using infrastructure::network::FrameWriteQueue;
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+namespace {
+    FrameWriteQueue::Buffer makeFrame(FrameWriteQueue& queue, size_t size, uint8_t fill) {
+        auto frame = queue.acquire(size);
+        std::fill(frame.begin(), frame.end(), fill);
+        return frame;
+    }
+
+    // Same loop as Session::flush_writes, with a socket that always completes
+    std::vector<uint8_t> drain(FrameWriteQueue& queue, size_t* writes = nullptr) {
+        std::vector<uint8_t> sent;
+        do {
+            auto data = queue.beginFlush();
+            sent.insert(sent.end(), data.begin(), data.end());
+            if (writes) {
+                ++*writes;
+            }
+        } while (queue.endFlush());
+        return sent;
+    }
+}
+
+// ============================================================================
+// Flushes
+// ============================================================================
+
+TEST(FrameWriteQueueTest, OnlyThePushThatFindsTheQueueIdleStartsAFlush) {
+    FrameWriteQueue queue;
+    EXPECT_TRUE(queue.push(makeFrame(queue, 8, 1)));
+    EXPECT_FALSE(queue.push(makeFrame(queue, 8, 2)));
+
+    drain(queue);
+    EXPECT_EQ(queue.pendingFrames(), 0u);
+    EXPECT_TRUE(queue.push(makeFrame(queue, 8, 3)));
+}
+
+TEST(FrameWriteQueueTest, PendingFramesAreCoalescedInOrder) {
+    FrameWriteQueue queue;
+    queue.push(makeFrame(queue, 10, 1));
+    queue.push(makeFrame(queue, 20, 2));
+    queue.push(makeFrame(queue, 30, 3));
+
+    auto data = queue.beginFlush();
+    ASSERT_EQ(data.size(), 60u);
+    EXPECT_EQ(data[0], 1);
+    EXPECT_EQ(data[10], 2);
+    EXPECT_EQ(data[30], 3);
+    EXPECT_FALSE(queue.endFlush());
+    EXPECT_EQ(queue.getFlushes(), 1u);
+    EXPECT_EQ(queue.getFramesQueued(), 3u);
+}
+
+TEST(FrameWriteQueueTest, FlushStopsAtTheRecordLimit) {
+    FrameWriteQueue queue;
+    const size_t frameSize = 6000;  // Two fit in a record, not three
+    for (uint8_t i = 0; i < 5; ++i) {
+        queue.push(makeFrame(queue, frameSize, i));
+    }
+
+    size_t writes = 0;
+    auto sent = drain(queue, &writes);
+    EXPECT_EQ(writes, 3u);
+    ASSERT_EQ(sent.size(), 5 * frameSize);
+    for (uint8_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(sent[i * frameSize], i);
+    }
+}
+
+TEST(FrameWriteQueueTest, OversizedFrameIsSentAlone) {
+    FrameWriteQueue queue;
+    queue.push(makeFrame(queue, 100, 1));
+    queue.push(makeFrame(queue, FrameWriteQueue::MAX_FLUSH_SIZE * 2, 2));
+    queue.push(makeFrame(queue, 100, 3));
+
+    EXPECT_EQ(queue.beginFlush().size(), 100u);
+    ASSERT_TRUE(queue.endFlush());
+    EXPECT_EQ(queue.beginFlush().size(), FrameWriteQueue::MAX_FLUSH_SIZE * 2);
+    ASSERT_TRUE(queue.endFlush());
+    EXPECT_EQ(queue.beginFlush().size(), 100u);
+    EXPECT_FALSE(queue.endFlush());
+}
+
+TEST(FrameWriteQueueTest, SingleFrameIsSentWithoutCopy) {
+    FrameWriteQueue queue;
+    auto frame = makeFrame(queue, 64, 7);
+    const uint8_t* bytes = frame.data();
+    queue.push(std::move(frame));
+
+    EXPECT_EQ(queue.beginFlush().data(), bytes);
+    queue.endFlush();
+}
+
+TEST(FrameWriteQueueTest, ResetDropsPendingFramesAndRearms) {
+    FrameWriteQueue queue;
+    queue.push(makeFrame(queue, 8, 1));
+    queue.push(makeFrame(queue, 8, 2));
+    queue.beginFlush();
+
+    queue.reset();  // The write failed
+    EXPECT_EQ(queue.pendingFrames(), 0u);
+    EXPECT_TRUE(queue.push(makeFrame(queue, 8, 3)));
+}
+
+// ============================================================================
+// Buffers
+// ============================================================================
+
+TEST(FrameWriteQueueTest, SentBuffersAreReused) {
+    FrameWriteQueue queue;
+    queue.push(makeFrame(queue, 256, 1));
+    const uint8_t* bytes = queue.beginFlush().data();
+    queue.endFlush();
+
+    auto frame = queue.acquire(128);
+    EXPECT_EQ(frame.data(), bytes);
+    EXPECT_EQ(frame.size(), 128u);
+    EXPECT_EQ(std::count(frame.begin(), frame.end(), 0), 128);
+}
+
+TEST(FrameWriteQueueTest, ConcurrentPushesKeepEachSendersOrder) {
+    // Broadcast burst: several sessions push to the same one while it flushes
+    FrameWriteQueue queue;
+    constexpr int SENDERS = 4;
+    constexpr int FRAMES = 500;
+    std::vector<uint8_t> sent;  // Only the thread running the flush appends
+
+    std::vector<std::thread> senders;
+    for (int s = 0; s < SENDERS; ++s) {
+        senders.emplace_back([&queue, &sent, s]() {
+            for (int i = 0; i < FRAMES; ++i) {
+                auto frame = queue.acquire(3);
+                frame[0] = static_cast<uint8_t>(s);
+                frame[1] = static_cast<uint8_t>(i >> 8);
+                frame[2] = static_cast<uint8_t>(i);
+                if (queue.push(std::move(frame))) {
+                    // Whoever starts the flush runs it, one at a time like on the strand
+                    do {
+                        auto data = queue.beginFlush();
+                        sent.insert(sent.end(), data.begin(), data.end());
+                    } while (queue.endFlush());
+                }
+            }
+        });
+    }
+    for (auto& sender : senders) {
+        sender.join();
+    }
+    EXPECT_EQ(queue.pendingFrames(), 0u);
+    EXPECT_EQ(queue.getFramesQueued(), static_cast<uint64_t>(SENDERS * FRAMES));
+
+    ASSERT_EQ(sent.size(), static_cast<size_t>(SENDERS * FRAMES * 3));
+    std::vector<int> next(SENDERS, 0);
+    for (size_t i = 0; i < sent.size(); i += 3) {
+        int sender = sent[i];
+        int index = (sent[i + 1] << 8) | sent[i + 2];
+        ASSERT_EQ(index, next[sender]) << "sender " << sender;
+        ++next[sender];
+    }
+}
@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** HandlerMemoryPoolTest - Recycled operation memory of the UDP sends
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/network/HandlerMemoryPool.hpp"
+#include <boost/asio.hpp>
+#include <memory>
+
+using infrastructure::network::HandlerAllocator;
+using infrastructure::network::HandlerMemoryPool;
+using infrastructure::network::makePooledHandler;
+
+namespace {
+    struct Operation {
+        char bytes[200];
+    };
+}
+
+// ============================================================================
+// Blocks
+// ============================================================================
+
+TEST(HandlerMemoryPoolTest, ReleasedBlocksAreReused) {
+    HandlerMemoryPool pool;
+    HandlerAllocator<Operation> allocator(pool);
+
+    Operation* first = allocator.allocate(1);
+    allocator.deallocate(first, 1);
+    EXPECT_EQ(pool.idleCount(), 1u);
+
+    Operation* again = allocator.allocate(1);
+    EXPECT_EQ(again, first);
+    EXPECT_EQ(pool.idleCount(), 0u);
+    allocator.deallocate(again, 1);
+}
+
+TEST(HandlerMemoryPoolTest, ReservedBlocksServeTheFirstOperations) {
+    HandlerMemoryPool pool;
+    pool.reserve(8);
+    EXPECT_EQ(pool.idleCount(), 8u);
+
+    HandlerAllocator<Operation> allocator(pool);
+    Operation* operation = allocator.allocate(1);
+    EXPECT_EQ(pool.idleCount(), 7u);
+    allocator.deallocate(operation, 1);
+    EXPECT_EQ(pool.idleCount(), 8u);
+}
+
+TEST(HandlerMemoryPoolTest, OversizedRequestsBypassThePool) {
+    HandlerMemoryPool pool;
+    HandlerAllocator<char> allocator(pool);
+    char* big = allocator.allocate(HandlerMemoryPool::BLOCK_SIZE + 1);
+    allocator.deallocate(big, HandlerMemoryPool::BLOCK_SIZE + 1);
+    EXPECT_EQ(pool.idleCount(), 0u);
+}
+
+TEST(HandlerMemoryPoolTest, OperationsMayOutliveThePool) {
+    auto pool = std::make_unique<HandlerMemoryPool>();
+    HandlerAllocator<Operation> allocator(*pool);
+    Operation* pending = allocator.allocate(1);
+    pool.reset();
+    allocator.deallocate(pending, 1);  // Freed, not returned to the destroyed pool
+}
+
+// ============================================================================
+// asio
+// ============================================================================
+
+TEST(HandlerMemoryPoolTest, AsioTakesTheOperationFromThePool) {
+    boost::asio::io_context io_ctx;
+    HandlerMemoryPool pool;
+    pool.reserve(1);
+
+    bool done = false;
+    boost::asio::post(io_ctx, makePooledHandler(pool, [&done]() { done = true; }));
+    EXPECT_EQ(pool.idleCount(), 0u);  // Held by the queued operation
+
+    io_ctx.run();
+    EXPECT_TRUE(done);
+    EXPECT_EQ(pool.idleCount(), 1u);
+}
@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** NetworkStatsTest - Tests for the slot-keyed per-player counters
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/network/NetworkStats.hpp"
+
+using infrastructure::network::NetworkStats;
+
+TEST(NetworkStatsTest, SlotCountersShowUpInPlayerStats) {
+    NetworkStats stats;
+    auto slot = stats.registerPlayer("127.0.0.1:5000");
+    ASSERT_NE(slot, NetworkStats::NO_SLOT);
+    EXPECT_EQ(stats.registerPlayer("127.0.0.1:5000"), slot);
+    EXPECT_EQ(stats.getSlot("127.0.0.1:5000"), slot);
+
+    stats.addBytesSentTo(slot, 100);
+    stats.addBytesSentTo(slot, 20);
+    stats.addBytesReceivedFrom(slot, 7);
+    stats.addBytesSentTo(NetworkStats::NO_SLOT, 1000);
+
+    auto player = stats.getPlayerStats("127.0.0.1:5000");
+    ASSERT_TRUE(player.has_value());
+    EXPECT_EQ(player->bytesSent, 120u);
+    EXPECT_EQ(player->bytesReceived, 7u);
+
+    stats.calculateRates();
+    auto room = stats.getRoomStats({"127.0.0.1:5000"});
+    EXPECT_EQ(room.playerCount, 1u);
+    EXPECT_DOUBLE_EQ(room.outCurrent, 120.0);
+    EXPECT_DOUBLE_EQ(room.inCurrent, 7.0);
+}
+
+TEST(NetworkStatsTest, UnregisteredSlotIsReusedWithFreshCounters) {
+    NetworkStats stats;
+    auto first = stats.registerPlayer("10.0.0.1:1");
+    stats.addBytesSentTo(first, 500);
+    stats.unregisterPlayer("10.0.0.1:1");
+    EXPECT_EQ(stats.getSlot("10.0.0.1:1"), NetworkStats::NO_SLOT);
+
+    auto second = stats.registerPlayer("10.0.0.2:2");
+    EXPECT_EQ(second, first);
+    EXPECT_EQ(stats.getPlayerStats("10.0.0.2:2")->bytesSent, 0u);
+}
+
+TEST(NetworkStatsTest, SlotsRunOutAtMaxSlots) {
+    NetworkStats stats;
+    for (size_t i = 0; i < NetworkStats::MAX_SLOTS; i++)
+        ASSERT_NE(stats.registerPlayer("p" + std::to_string(i)), NetworkStats::NO_SLOT);
+    EXPECT_EQ(stats.registerPlayer("one-too-many"), NetworkStats::NO_SLOT);
+}
@@ -0,0 +1,101 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SendBufferPoolTest - Tests for the pooled, ref-counted broadcast buffers
+*/
+
+#include <gtest/gtest.h>
+#include "infrastructure/network/SendBufferPool.hpp"
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using infrastructure::network::SendBufferPool;
+using infrastructure::network::SharedSendBuffer;
+
+// ============================================================================
+// Sharing
+// ============================================================================
+
+TEST(SendBufferPoolTest, CopiesShareTheSameBytes) {
+    SendBufferPool pool;
+    auto buf = pool.acquire(4);
+    std::memcpy(buf.data(), "abcd", 4);
+
+    std::vector<SharedSendBuffer> recipients(4, buf);
+    EXPECT_EQ(buf.useCount(), 5u);
+    for (const auto& copy : recipients) {
+        EXPECT_EQ(copy.data(), buf.data());
+        EXPECT_EQ(copy.size(), 4u);
+    }
+
+    recipients.clear();
+    EXPECT_EQ(buf.useCount(), 1u);
+    EXPECT_EQ(pool.idleCount(), 0u);
+}
+
+TEST(SendBufferPoolTest, LastReleaseReturnsTheBufferToThePool) {
+    SendBufferPool pool;
+    const uint8_t* storage = nullptr;
+    {
+        auto buf = pool.acquire(100);
+        storage = buf.data();
+        SharedSendBuffer copy = buf;
+        buf = {};
+        EXPECT_EQ(pool.idleCount(), 0u);
+    }
+    EXPECT_EQ(pool.idleCount(), 1u);
+
+    // Reused, resized to the new datagram
+    auto again = pool.acquire(10);
+    EXPECT_EQ(again.data(), storage);
+    EXPECT_EQ(again.size(), 10u);
+    EXPECT_EQ(pool.idleCount(), 0u);
+}
+
+TEST(SendBufferPoolTest, ReservedBuffersServeTheFirstSends) {
+    SendBufferPool pool;
+    pool.reserve(4);
+    EXPECT_EQ(pool.idleCount(), 4u);
+
+    auto buf = pool.acquire(SendBufferPool::DEFAULT_BUFFER_CAPACITY);
+    EXPECT_EQ(pool.idleCount(), 3u);
+    buf = {};
+    EXPECT_EQ(pool.idleCount(), 4u);
+}
+
+// ============================================================================
+// Lifetime
+// ============================================================================
+
+TEST(SendBufferPoolTest, BufferOutlivesThePool) {
+    SharedSendBuffer inFlight;
+    {
+        SendBufferPool pool;
+        inFlight = pool.acquire(8);
+        auto idle = pool.acquire(8);
+    }
+    // Like a send completing after the server is gone: the buffer frees itself
+    ASSERT_TRUE(inFlight);
+    inFlight.data()[7] = 1;
+    inFlight = {};
+    EXPECT_FALSE(inFlight);
+}
+
+TEST(SendBufferPoolTest, ConcurrentReleasesRecycleEveryBuffer) {
+    SendBufferPool pool;
+    constexpr int ROUNDS = 200;
+    constexpr int THREADS = 4;
+
+    for (int round = 0; round < ROUNDS; round++) {
+        auto buf = pool.acquire(64);
+        std::vector<std::thread> senders;
+        for (int t = 0; t < THREADS; t++)
+            senders.emplace_back([copy = buf]() mutable { copy = {}; });
+        buf = {};
+        for (auto& sender : senders)
+            sender.join();
+        EXPECT_EQ(pool.idleCount(), 1u);
+    }
+}
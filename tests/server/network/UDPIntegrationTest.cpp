@@ -15,6 +15,9 @@
 #include <queue>
 #include <string>
 #include <memory>
+#include <map>
+#include <set>
+#include <vector>
 
 using boost::asio::ip::udp;
 using namespace std::chrono_literals;
@@ -514,3 +517,66 @@ TEST_F(UDPRobustnessTest, InvalidDataHandling) {
     client.stop();
     server.stop();
 }
+
+#ifdef __linux__
+// ============================================================================
+// Tests SO_REUSEPORT (sharding du port de jeu)
+// ============================================================================
+
+/**
+ * @test Plusieurs sockets SO_REUSEPORT sur le même port : chaque client
+ * arrive toujours sur le même socket (le serveur y épingle sa room)
+ */
+TEST_F(UDPRobustnessTest, ReusePortKeepsEachClientOnOneShard) {
+    constexpr size_t SHARDS = 4;
+    constexpr unsigned short PORT = 19895;
+    boost::asio::io_context io_ctx;
+
+    std::vector<udp::socket> shards;
+    for (size_t i = 0; i < SHARDS; i++) {
+        udp::socket socket(io_ctx);
+        socket.open(udp::v4());
+        int enable = 1;
+        ASSERT_EQ(::setsockopt(socket.native_handle(), SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)), 0);
+        socket.bind(udp::endpoint(boost::asio::ip::make_address("127.0.0.1"), PORT));
+        socket.non_blocking(true);
+        shards.push_back(std::move(socket));
+    }
+
+    constexpr int CLIENTS = 16;
+    constexpr int PACKETS = 10;
+    std::vector<udp::socket> clients;
+    for (int c = 0; c < CLIENTS; c++) {
+        clients.emplace_back(io_ctx, udp::endpoint(boost::asio::ip::make_address("127.0.0.1"), 0));
+    }
+    udp::endpoint target(boost::asio::ip::make_address("127.0.0.1"), PORT);
+    for (int p = 0; p < PACKETS; p++) {
+        for (auto& client : clients) {
+            client.send_to(boost::asio::buffer("x", 1), target);
+        }
+    }
+    std::this_thread::sleep_for(100ms);
+
+    // Client port -> shards qui ont reçu ses paquets
+    std::map<unsigned short, std::set<size_t>> seenOn;
+    int received = 0;
+    for (size_t i = 0; i < SHARDS; i++) {
+        char buf[16];
+        udp::endpoint from;
+        boost::system::error_code ec;
+        while (shards[i].receive_from(boost::asio::buffer(buf), from, 0, ec) > 0 && !ec) {
+            seenOn[from.port()].insert(i);
+            received++;
+        }
+    }
+
+    EXPECT_EQ(received, CLIENTS * PACKETS);
+    EXPECT_EQ(seenOn.size(), static_cast<size_t>(CLIENTS));
+    std::set<size_t> usedShards;
+    for (const auto& [port, on] : seenOn) {
+        EXPECT_EQ(on.size(), 1u) << "client " << port << " arrived on several shards";
+        usedShards.insert(*on.begin());
+    }
+    EXPECT_GT(usedShards.size(), 1u);  // La charge est répartie
+}
+#endif